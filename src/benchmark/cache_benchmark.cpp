@@ -0,0 +1,105 @@
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "cache/gdfs_cache.hpp"
+#include "cache/sharded_gdfs_cache.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Mimics a plan cache: SQL strings as keys and shared_ptrs (which are copied on each hit) as values
+constexpr auto CACHE_CAPACITY = size_t{1024};
+constexpr auto HOT_KEY_COUNT = size_t{256};
+constexpr auto KEY_COUNT = size_t{4096};
+
+std::string key_for(const size_t key_id) {
+  return "SELECT * FROM lineitem WHERE l_orderkey = " + std::to_string(key_id) + " AND l_quantity > 10";
+}
+
+template <typename Cache>
+std::shared_ptr<Cache> create_cache() {
+  auto cache = std::make_shared<Cache>(CACHE_CAPACITY);
+  for (auto key_id = size_t{0}; key_id < HOT_KEY_COUNT; ++key_id) {
+    cache->set(key_for(key_id), std::make_shared<size_t>(key_id));
+  }
+  return cache;
+}
+
+// The cache is shared by all threads of a benchmark run. It is created by the first thread before the threads are
+// synchronized at the start of the measurement loop.
+template <typename Cache>
+std::shared_ptr<Cache>& shared_cache() {
+  static auto cache = std::shared_ptr<Cache>{};
+  return cache;
+}
+
+// Every lookup is a hit, as for a server that executes the same set of statements over and over
+template <typename Cache>
+void BM_CacheHits(benchmark::State& state) {
+  auto& cache = shared_cache<Cache>();
+  if (state.thread_index == 0) {
+    cache = create_cache<Cache>();
+  }
+
+  auto keys = std::vector<std::string>{};
+  for (auto key_id = size_t{0}; key_id < HOT_KEY_COUNT; ++key_id) {
+    keys.emplace_back(key_for(key_id));
+  }
+  auto random_engine = std::minstd_rand{static_cast<uint32_t>(state.thread_index)};
+  auto key_distribution = std::uniform_int_distribution<size_t>{0, HOT_KEY_COUNT - 1};
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cache->try_get(keys[key_distribution(random_engine)]));
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Lookups from a larger key space with a skewed distribution, inserting on misses. This exercises the eviction.
+template <typename Cache>
+void BM_CacheMixed(benchmark::State& state) {
+  auto& cache = shared_cache<Cache>();
+  if (state.thread_index == 0) {
+    cache = create_cache<Cache>();
+  }
+
+  auto keys = std::vector<std::string>{};
+  for (auto key_id = size_t{0}; key_id < KEY_COUNT; ++key_id) {
+    keys.emplace_back(key_for(key_id));
+  }
+  auto random_engine = std::minstd_rand{static_cast<uint32_t>(state.thread_index)};
+  auto key_distribution = std::geometric_distribution<size_t>{4.0 / static_cast<double>(KEY_COUNT)};
+
+  auto hits = size_t{0};
+  for (auto _ : state) {
+    const auto key_id = key_distribution(random_engine) % KEY_COUNT;
+    if (cache->try_get(keys[key_id])) {
+      ++hits;
+    } else {
+      cache->set(keys[key_id], std::make_shared<size_t>(key_id));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations());
+  const auto hit_rate = static_cast<double>(hits) / static_cast<double>(state.iterations());
+  state.counters["hit_rate"] = benchmark::Counter(hit_rate, benchmark::Counter::kAvgThreads);
+}
+
+using PlanGDFSCache = GDFSCache<std::string, std::shared_ptr<size_t>>;
+using PlanShardedGDFSCache = ShardedGDFSCache<std::string, std::shared_ptr<size_t>>;
+
+}  // namespace
+
+namespace opossum {
+
+BENCHMARK_TEMPLATE(BM_CacheHits, PlanGDFSCache)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CacheHits, PlanShardedGDFSCache)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CacheMixed, PlanGDFSCache)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CacheMixed, PlanShardedGDFSCache)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace opossum
@@ -0,0 +1,97 @@
+#include <iostream>
+#include <string>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include "benchmark_runner.hpp"
+#include "ch/ch_benchmark_item_runner.hpp"
+#include "ch/ch_queries.hpp"
+#include "ch/ch_table_generator.hpp"
+#include "cli_config_parser.hpp"
+#include "hybrid_benchmark_runner.hpp"
+#include "tpcc/tpcc_benchmark_item_runner.hpp"
+#include "utils/assert.hpp"
+
+using namespace opossum;  // NOLINT
+
+/**
+ * This benchmark measures Hyrise's performance for a mixed OLTP/OLAP workload, the CH-benCHmark. Transactional
+ * clients execute the TPC-C procedures while, concurrently, analytical clients execute the 22 CH queries on the same
+ * tables. The CH queries are TPC-H queries rewritten for the TPC-C schema (see ch_queries.cpp).
+ *
+ * The number of transactional clients is set with --clients, that of analytical clients with --analytical_clients.
+ * Setting either to zero runs only the other workload. For both workloads to run concurrently, --scheduler is required.
+ *
+ * Besides the tpmC (New-Order transactions per minute) and the latency percentiles of the queries, the benchmark
+ * reports the share of rows that the transactions have invalidated over time (see HybridBenchmarkRunner). As for the
+ * TPC-C benchmark, we do not claim to report correctly calculated tpmC.
+ *
+ * main() is mostly concerned with parsing the CLI options while HybridBenchmarkRunner.run() performs the actual
+ * benchmark logic.
+ */
+
+int main(int argc, char* argv[]) {
+  auto cli_options = BenchmarkRunner::get_basic_cli_options("CH-benCHmark");
+
+  // clang-format off
+  cli_options.add_options()
+    ("s,scale", "Scale factor (warehouses)", cxxopts::value<size_t>()->default_value("1")) // NOLINT
+    ("analytical_clients", "Specify how many CH queries should run in parallel to the TPC-C clients (see --clients)", cxxopts::value<uint32_t>()->default_value("1")) // NOLINT
+    ("q,queries", "Specify CH queries to run (comma-separated query ids, e.g. \"--queries 1,3,19\"), default is all", cxxopts::value<std::string>()); // NOLINT
+  // clang-format on
+
+  // Parse command line args
+  const auto cli_parse_result = cli_options.parse(argc, argv);
+
+  if (CLIConfigParser::print_help_if_requested(cli_options, cli_parse_result)) {
+    return 0;
+  }
+
+  const auto num_warehouses = cli_parse_result["scale"].as<size_t>();
+  const auto analytical_clients = cli_parse_result["analytical_clients"].as<uint32_t>();
+
+  const auto config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_cli_options(cli_parse_result));
+
+  // The results of the CH queries change with every transaction, so that they cannot be compared to SQLite
+  Assert(!config->verify, "The CH-benCHmark does not support verification");
+
+  auto context = BenchmarkRunner::create_context(*config);
+
+  std::cout << "- CH-benCHmark scale factor (number of warehouses) is " << num_warehouses << std::endl;
+  std::cout << "- Running " << config->clients << " TPC-C client(s) and " << analytical_clients << " CH client(s)"
+            << std::endl;
+
+  // Add CH-specific information
+  context.emplace("scale_factor", num_warehouses);
+
+  auto item_ids = std::vector<BenchmarkItemID>{};
+  if (cli_parse_result.count("queries")) {
+    // Split the input into query ids, ignoring leading, trailing, or duplicate commas
+    auto comma_separated_queries = cli_parse_result["queries"].as<std::string>();
+    auto item_ids_str = std::vector<std::string>();
+    boost::trim_if(comma_separated_queries, boost::is_any_of(","));
+    boost::split(item_ids_str, comma_separated_queries, boost::is_any_of(","), boost::token_compress_on);
+    for (const auto& item_id_str : item_ids_str) {
+      const auto item_id =
+          BenchmarkItemID{boost::lexical_cast<BenchmarkItemID::base_type, std::string>(item_id_str) - 1};
+      AssertInput(item_id < ch_queries.size(), "There are only " + std::to_string(ch_queries.size()) + " queries");
+      item_ids.emplace_back(item_id);
+    }
+  }
+
+  auto transactional_item_runner = std::make_unique<TPCCBenchmarkItemRunner>(config, num_warehouses);
+  auto analytical_item_runner = item_ids.empty() ? std::make_unique<CHBenchmarkItemRunner>(config)
+                                                 : std::make_unique<CHBenchmarkItemRunner>(config, item_ids);
+
+  auto benchmark_runner = HybridBenchmarkRunner{*config,
+                                                std::move(transactional_item_runner),
+                                                std::move(analytical_item_runner),
+                                                analytical_clients,
+                                                std::make_unique<CHTableGenerator>(num_warehouses, config),
+                                                context};
+  benchmark_runner.run();
+
+  // New-Order is the item with the id 1 (see TPCCBenchmarkItemRunner)
+  std::cout << "- tpmC: " << benchmark_runner.transactional_items_per_minute(BenchmarkItemID{1}) << std::endl;
+}
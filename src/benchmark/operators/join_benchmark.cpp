@@ -8,7 +8,9 @@
 #include "operators/join_sort_merge.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/table.hpp"
 #include "synthetic_table_generator.hpp"
 #include "types.hpp"
 
@@ -33,20 +35,37 @@ void clear_cache() {
 
 namespace opossum {
 
-std::shared_ptr<TableWrapper> generate_table(const size_t number_of_rows) {
+// If @param sorted is set, each chunk holds a sorted run of distinct values. These tables are used to calibrate the
+// JoinCostModel for presorted inputs.
+std::shared_ptr<TableWrapper> generate_table(const size_t number_of_rows, const bool sorted = false) {
   auto table_generator = std::make_shared<SyntheticTableGenerator>();
 
   const auto chunk_size = static_cast<ChunkOffset>(number_of_rows / NUMBER_OF_CHUNKS);
   Assert(chunk_size > 0, "The chunk size is 0 or less, can not generate such a table");
 
-  auto table =
-      table_generator->generate_table(1ul, number_of_rows, chunk_size, SegmentEncodingSpec{EncodingType::Dictionary});
+  auto table = std::shared_ptr<Table>{};
+  if (sorted) {
+    table = std::make_shared<Table>(TableColumnDefinitions{{"column_1", DataType::Int, false}}, TableType::Data,
+                                    chunk_size);
+    for (auto value = int32_t{0}; value < static_cast<int32_t>(number_of_rows); ++value) {
+      table->append({value});
+    }
+    table->last_chunk()->finalize();
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+  } else {
+    table =
+        table_generator->generate_table(1ul, number_of_rows, chunk_size, SegmentEncodingSpec{EncodingType::Dictionary});
+  }
 
   const auto chunk_count = table->chunk_count();
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
     const auto chunk = table->get_chunk(chunk_id);
     Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
+    if (sorted) {
+      chunk->set_individually_sorted_by(SortColumnDefinition{ColumnID{0}});
+    }
+
     for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
       chunk->create_index<AdaptiveRadixTreeIndex>(std::vector<ColumnID>{column_id});
     }
@@ -100,6 +119,22 @@ void BM_Join_MediumAndMedium(benchmark::State& state) {  // NOLINT 100,000 x 100
   bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
 }
 
+template <class C>
+void BM_Join_MediumAndMediumSorted(benchmark::State& state) {  // NOLINT 100,000 x 100,000, chunks are sorted
+  auto table_wrapper_left = generate_table(TABLE_SIZE_MEDIUM, true);
+  auto table_wrapper_right = generate_table(TABLE_SIZE_MEDIUM, true);
+
+  bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
+}
+
+template <class C>
+void BM_Join_BigAndBigSorted(benchmark::State& state) {  // NOLINT 10,000,000 x 10,000,000, chunks are sorted
+  auto table_wrapper_left = generate_table(TABLE_SIZE_BIG, true);
+  auto table_wrapper_right = generate_table(TABLE_SIZE_BIG, true);
+
+  bm_join_impl<C>(state, table_wrapper_left, table_wrapper_right);
+}
+
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinNestedLoop);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinIndex);
@@ -109,9 +144,13 @@ BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinIndex);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinHash);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinHash);
+BENCHMARK_TEMPLATE(BM_Join_MediumAndMediumSorted, JoinHash);
+BENCHMARK_TEMPLATE(BM_Join_BigAndBigSorted, JoinHash);
 
 BENCHMARK_TEMPLATE(BM_Join_SmallAndSmall, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_SmallAndBig, JoinSortMerge);
 BENCHMARK_TEMPLATE(BM_Join_MediumAndMedium, JoinSortMerge);
+BENCHMARK_TEMPLATE(BM_Join_MediumAndMediumSorted, JoinSortMerge);
+BENCHMARK_TEMPLATE(BM_Join_BigAndBigSorted, JoinSortMerge);
 
 }  // namespace opossum
@@ -2,10 +2,14 @@
 
 #include "../micro_benchmark_basic_fixture.hpp"
 #include "benchmark/benchmark.h"
+#include "constant_mappings.hpp"
 #include "expression/expression_functional.hpp"
+#include "micro_benchmark_utils.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/table.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+#include "synthetic_table_generator.hpp"
 #include "utils/load_table.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -57,6 +61,63 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScanVariable_OnDict)(benchmark::
   benchmark_tablescan_impl(state, _table_dict_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, ColumnID{1});
 }
 
+// Scans of dictionary segments whose attribute vectors are compressed with state.range(0) (a VectorCompressionType).
+// state.range(1) is the number of distinct values per chunk. With 200 distinct values, FixedWidthIntegerVectors store
+// one byte per row, with 20'000 two bytes, and with 100'000 (i.e., all values of a chunk are distinct) four bytes.
+std::shared_ptr<TableWrapper> create_dictionary_table_wrapper(benchmark::State& state) {
+  const auto vector_compression_type = static_cast<VectorCompressionType>(state.range(0));
+  const auto distinct_value_count = static_cast<double>(state.range(1));
+  state.SetLabel(vector_compression_type_to_string.left.at(vector_compression_type));
+
+  const auto column_specification =
+      ColumnSpecification{ColumnDataDistribution::make_uniform_config(0.0, distinct_value_count), DataType::Int,
+                          SegmentEncodingSpec{EncodingType::Dictionary, vector_compression_type}};
+  const auto table =
+      SyntheticTableGenerator::generate_table({column_specification}, size_t{1'000'000}, ChunkOffset{100'000});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+  return table_wrapper;
+}
+
+void dictionary_scan_arguments(benchmark::internal::Benchmark* benchmark) {
+  for (const auto vector_compression_type :
+       {VectorCompressionType::FixedWidthInteger, VectorCompressionType::BitPacking}) {
+    for (const auto distinct_value_count : {200, 20'000, 100'000}) {
+      benchmark->Args({static_cast<int64_t>(vector_compression_type), distinct_value_count});
+    }
+  }
+}
+
+void BM_TableScanDictionary_LessThan(benchmark::State& state) {
+  const auto table_wrapper = create_dictionary_table_wrapper(state);
+  micro_benchmark_clear_cache();
+
+  // Roughly 10% of the rows match
+  const auto search_value = static_cast<int32_t>(state.range(1) / 10);
+  benchmark_tablescan_impl(state, table_wrapper, ColumnID{0}, PredicateCondition::LessThan, search_value);
+}
+BENCHMARK(BM_TableScanDictionary_LessThan)->Apply(dictionary_scan_arguments);
+
+void BM_TableScanDictionary_Between(benchmark::State& state) {
+  const auto table_wrapper = create_dictionary_table_wrapper(state);
+  micro_benchmark_clear_cache();
+
+  // Roughly 50% of the rows match
+  const auto column = pqp_column_(ColumnID{0}, DataType::Int, false, "");
+  const auto predicate = between_inclusive_(column, value_(static_cast<int32_t>(state.range(1) / 4)),
+                                            value_(static_cast<int32_t>(state.range(1) * 3 / 4)));
+
+  auto warm_up = std::make_shared<TableScan>(table_wrapper, predicate);
+  warm_up->execute();
+  for (auto _ : state) {
+    auto table_scan = std::make_shared<TableScan>(table_wrapper, predicate);
+    table_scan->execute();
+  }
+}
+BENCHMARK(BM_TableScanDictionary_Between)->Apply(dictionary_scan_arguments);
+
 BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScan_Like)(benchmark::State& state) {
   const auto lineitem_table = load_table("resources/test_data/tbl/tpch/sf-0.001/lineitem.tbl");
 
@@ -70,6 +131,7 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScan_Like)(benchmark::State& sta
       {"l_shipinstruct", pmr_string{"quickly%"}},
       {"l_comment", pmr_string{"%foxes"}},
       {"l_comment", pmr_string{"%quick_y__above%even%"}},
+      {"l_comment", pmr_string{"s%ly%_ep"}},
   });
 
   for (auto _ : state) {
@@ -0,0 +1,89 @@
+#include <memory>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "storage/pos_lists/bitmap_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+constexpr auto CHUNK_SIZE = size_t{65'535};
+
+// Positions of a chunk that are selected with the given probability (in percent), e.g., by a TableScan
+template <typename PosList>
+std::shared_ptr<PosList> create_pos_list(const int64_t selectivity_percent) {
+  auto random_engine = std::minstd_rand{42};
+  auto distribution = std::uniform_int_distribution<int64_t>{0, 99};
+
+  auto row_id_pos_list = RowIDPosList{};
+  for (auto chunk_offset = size_t{0}; chunk_offset < CHUNK_SIZE; ++chunk_offset) {
+    if (distribution(random_engine) < selectivity_percent) {
+      row_id_pos_list.emplace_back(RowID{ChunkID{0}, static_cast<ChunkOffset>(chunk_offset)});
+    }
+  }
+  row_id_pos_list.guarantee_single_chunk();
+
+  if constexpr (std::is_same_v<PosList, BitmapPosList>) {
+    auto bitmap = BitmapPosList::Bitmap(BitmapPosList::word_count(CHUNK_SIZE));
+    for (const auto& row_id : row_id_pos_list) {
+      const auto offset = static_cast<size_t>(row_id.chunk_offset);
+      bitmap[offset / BitmapPosList::BITS_PER_WORD] |= uint64_t{1} << (offset % BitmapPosList::BITS_PER_WORD);
+    }
+    return std::make_shared<BitmapPosList>(ChunkID{0}, std::move(bitmap));
+  } else {
+    return std::make_shared<RowIDPosList>(std::move(row_id_pos_list));
+  }
+}
+
+// Random accesses as issued by consumers such as the ReferenceSegment's accessors, the Sort, or the JoinIndex. They go
+// through the virtual operator[] of the AbstractPosList, as these consumers do not know the type of the PosList.
+template <typename PosList>
+void BM_PosListRandomAccess(benchmark::State& state) {
+  const auto pos_list = std::static_pointer_cast<const AbstractPosList>(create_pos_list<PosList>(state.range(0)));
+  const auto size = pos_list->size();
+
+  auto random_engine = std::minstd_rand{17};
+  auto indices = std::vector<size_t>(1'024);
+  for (auto& index : indices) {
+    index = std::uniform_int_distribution<size_t>{0, size - 1}(random_engine);
+  }
+
+  for (auto _ : state) {
+    for (const auto index : indices) {
+      benchmark::DoNotOptimize((*pos_list)[index]);
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * indices.size()));
+}
+
+// Sequential iteration, which does not need a select for BitmapPosLists
+template <typename PosList>
+void BM_PosListSequentialAccess(benchmark::State& state) {
+  const auto pos_list = create_pos_list<PosList>(state.range(0));
+
+  for (auto _ : state) {
+    for (const auto& row_id : *pos_list) {
+      benchmark::DoNotOptimize(row_id);
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * pos_list->size()));
+}
+
+}  // namespace
+
+namespace opossum {
+
+BENCHMARK_TEMPLATE(BM_PosListRandomAccess, RowIDPosList)->Arg(10)->Arg(50)->Arg(90);
+BENCHMARK_TEMPLATE(BM_PosListRandomAccess, BitmapPosList)->Arg(10)->Arg(50)->Arg(90);
+BENCHMARK_TEMPLATE(BM_PosListSequentialAccess, RowIDPosList)->Arg(10)->Arg(50)->Arg(90);
+BENCHMARK_TEMPLATE(BM_PosListSequentialAccess, BitmapPosList)->Arg(10)->Arg(50)->Arg(90);
+
+}  // namespace opossum
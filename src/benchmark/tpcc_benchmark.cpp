@@ -1,12 +1,17 @@
 #include "tpcc/tpcc_table_generator.hpp"
 
 #include <algorithm>
+#include <chrono>
+#include <filesystem>
 
 #include "benchmark_runner.hpp"
 #include "cli_config_parser.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "tpcc/constants.hpp"
 #include "tpcc/tpcc_benchmark_item_runner.hpp"
+#include "utils/timer.hpp"
 
 using namespace opossum;  // NOLINT
 
@@ -19,7 +24,7 @@ using namespace opossum;  // NOLINT
  * Other limitations (that may be removed in the future):
  *  - No primary / foreign keys are used as they are currently unsupported
  *  - Values that are "retrieved" by the terminal are just selected, but not necessarily materialized
- *  - Data is not persisted as logging is currently unsupported; this means that the durability tests are not executed
+ *  - Data is only persisted if a write-ahead log is used (--write_ahead_log); the durability tests are not executed
  *  - As decimals are not supported, we use floats instead
  *  - The delivery transaction is not executed in a "deferred" mode; as such, no delivery result file is written
  *  - We do not execute the isolation tests, as we consider our MVCC tests to be sufficient
@@ -41,7 +46,9 @@ int main(int argc, char* argv[]) {
   cli_options.add_options()
     // We use -s instead of -w for consistency with the options of our other TPC-x binaries.
     ("s,scale", "Scale factor (warehouses)", cxxopts::value<size_t>()->default_value("1")) // NOLINT
-    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("write_ahead_log", "Log committed transactions to the given file, which is overwritten, and report the commit latency", cxxopts::value<std::string>()) // NOLINT
+    ("group_commit_delay", "Time in microseconds that the write-ahead log waits to collect commits before syncing", cxxopts::value<uint64_t>()->default_value("0")); // NOLINT
   // clang-format on
 
   std::shared_ptr<BenchmarkConfig> config;
@@ -71,11 +78,47 @@ int main(int argc, char* argv[]) {
   // Add TPC-C-specific information
   context.emplace("scale_factor", num_warehouses);
 
-  // Run the benchmark
+  // Generate the tables
   auto item_runner = std::make_unique<TPCCBenchmarkItemRunner>(config, num_warehouses);
-  BenchmarkRunner(*config, std::move(item_runner), std::make_unique<TPCCTableGenerator>(num_warehouses, config),
-                  context)
-      .run();
+  auto benchmark_runner = BenchmarkRunner{*config, std::move(item_runner),
+                                          std::make_unique<TPCCTableGenerator>(num_warehouses, config), context};
+
+  // The log is created after the tables have been generated, so that only the benchmark's transactions are logged
+  auto write_ahead_log = std::shared_ptr<WriteAheadLog>{};
+  if (cli_parse_result.count("write_ahead_log")) {
+    const auto write_ahead_log_path = cli_parse_result["write_ahead_log"].as<std::string>();
+    const auto group_commit_delay = std::chrono::microseconds{cli_parse_result["group_commit_delay"].as<uint64_t>()};
+    std::cout << "- Logging committed transactions to " << write_ahead_log_path << " (group commit delay "
+              << group_commit_delay.count() << " µs)" << std::endl;
+
+    std::filesystem::remove(write_ahead_log_path);
+    write_ahead_log = std::make_shared<WriteAheadLog>(write_ahead_log_path, group_commit_delay);
+    write_ahead_log->recover();
+    Hyrise::get().write_ahead_log = write_ahead_log;
+  }
+
+  // Run the benchmark
+  auto timer = Timer{};
+  benchmark_runner.run();
+  const auto benchmark_duration = timer.lap();
+
+  if (write_ahead_log) {
+    const auto statistics = write_ahead_log->statistics();
+    const auto commit_count = static_cast<double>(statistics.commit_count);
+    const auto commits_per_second = commit_count / std::chrono::duration<double>(benchmark_duration).count();
+    const auto commits_per_sync = commit_count / static_cast<double>(std::max(statistics.flush_count, uint64_t{1}));
+    const auto mean_commit_latency =
+        std::chrono::duration<double, std::micro>(statistics.accumulated_commit_latency).count() /
+        std::max(commit_count, 1.0);
+
+    std::cout << "- Write-ahead log: " << statistics.commit_count << " commits (" << commits_per_second
+              << " per second) in " << statistics.flush_count << " syncs, " << commits_per_sync
+              << " commits per sync on average" << std::endl;
+    std::cout << "- Write-ahead log: mean commit latency " << mean_commit_latency << " µs, "
+              << statistics.written_bytes / 1'000'000 << " MB written" << std::endl;
+
+    Hyrise::get().write_ahead_log = nullptr;
+  }
 
   if (consistency_checks || config->verify) {
     std::cout << "- Running consistency checks at the end of the benchmark" << std::endl;
@@ -11,6 +11,7 @@
 #include "scheduler/node_queue_scheduler.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_key/table_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/list_directory.hpp"
@@ -336,6 +337,22 @@ void AbstractTableGenerator::generate_and_store() {
         std::cout << "(" << per_index_timer.lap_formatted() << ")" << std::endl;
       }
     }
+
+    // Primary keys are additionally indexed by table-wide key indexes, which serve point lookups and enforce the keys
+    // for subsequent inserts
+    for (const auto& [table_name, table_info] : table_info_by_name) {
+      for (const auto& table_key_constraint : table_info.table->soft_key_constraints()) {
+        if (table_key_constraint.key_type() != KeyConstraintType::PRIMARY_KEY) {
+          continue;
+        }
+
+        std::cout << "-  Creating primary key index on " << table_name << " " << std::flush;
+        Timer per_index_timer;
+        table_info.table->create_key_index(table_key_constraint);
+        std::cout << "(" << per_index_timer.lap_formatted() << ")" << std::endl;
+      }
+    }
+
     metrics.index_duration = timer.lap();
     std::cout << "- Creating indexes done (" << format_duration(metrics.index_duration) << ")" << std::endl;
   } else {
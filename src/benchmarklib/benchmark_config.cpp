@@ -7,10 +7,12 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode init_benchmark_mode, const
                                  const int64_t init_max_runs, const Duration& init_max_duration,
                                  const Duration& init_warmup_duration,
                                  const std::optional<std::string>& init_output_file_path,
-                                 const bool init_enable_scheduler, const uint32_t init_cores,
+                                 const bool init_enable_scheduler, const bool init_work_stealing,
+                                 const uint32_t init_cores,
                                  const uint32_t init_data_preparation_cores, const uint32_t init_clients,
                                  const bool init_enable_visualization, const bool init_verify,
-                                 const bool init_cache_binary_tables, const bool init_metrics)
+                                 const bool init_cache_binary_tables, const bool init_metrics,
+                                 const std::optional<size_t>& init_memory_budget)
     : benchmark_mode(init_benchmark_mode),
       chunk_size(init_chunk_size),
       encoding_config(init_encoding_config),
@@ -20,13 +22,15 @@ BenchmarkConfig::BenchmarkConfig(const BenchmarkMode init_benchmark_mode, const
       warmup_duration(init_warmup_duration),
       output_file_path(init_output_file_path),
       enable_scheduler(init_enable_scheduler),
+      work_stealing(init_work_stealing),
       cores(init_cores),
       data_preparation_cores(init_data_preparation_cores),
       clients(init_clients),
       enable_visualization(init_enable_visualization),
       verify(init_verify),
       cache_binary_tables(init_cache_binary_tables),
-      metrics(init_metrics) {}
+      metrics(init_metrics),
+      memory_budget(init_memory_budget) {}
 
 BenchmarkConfig BenchmarkConfig::get_default_config() {
   return BenchmarkConfig();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
 
 #include "encoding_config.hpp"
 #include "storage/chunk.hpp"
@@ -23,9 +24,10 @@ class BenchmarkConfig {
                   const EncodingConfig& init_encoding_config, const bool init_indexes, const int64_t init_max_runs,
                   const Duration& init_max_duration, const Duration& init_warmup_duration,
                   const std::optional<std::string>& init_output_file_path, const bool init_enable_scheduler,
-                  const uint32_t init_cores, const uint32_t init_data_preparation_cores, const uint32_t init_clients,
-                  const bool init_enable_visualization, const bool init_verify, const bool init_cache_binary_tables,
-                  const bool init_metrics);
+                  const bool init_work_stealing, const uint32_t init_cores, const uint32_t init_data_preparation_cores,
+                  const uint32_t init_clients, const bool init_enable_visualization, const bool init_verify,
+                  const bool init_cache_binary_tables, const bool init_metrics,
+                  const std::optional<size_t>& init_memory_budget);
 
   static BenchmarkConfig get_default_config();
 
@@ -38,6 +40,7 @@ class BenchmarkConfig {
   Duration warmup_duration = std::chrono::seconds(0);
   std::optional<std::string> output_file_path = std::nullopt;
   bool enable_scheduler = false;
+  bool work_stealing = false;
   uint32_t cores = 0;
   uint32_t data_preparation_cores = 0;
   uint32_t clients = 1;
@@ -45,6 +48,7 @@ class BenchmarkConfig {
   bool verify = false;
   bool cache_binary_tables = false;  // Defaults to false for internal use, but the CLI sets it to true by default
   bool metrics = false;
+  std::optional<size_t> memory_budget = std::nullopt;  // Per statement, in bytes. No budget by default.
 
  private:
   BenchmarkConfig() = default;
@@ -16,6 +16,7 @@
 #include "constant_mappings.hpp"
 #include "hyrise.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "storage/chunk.hpp"
 #include "tpch/tpch_table_generator.hpp"
@@ -35,6 +36,7 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config,
       _context(context) {
   Hyrise::get().default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
   Hyrise::get().default_lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+  Hyrise::get().default_memory_budget = config.memory_budget;
 
   // Initialise the scheduler if the benchmark was requested to run multi-threaded
   if (config.enable_scheduler) {
@@ -49,8 +51,11 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config,
     }
     _context.push_back({"utilized_cores_per_numa_node", numa_cores_per_node});
 
-    const auto scheduler = std::make_shared<NodeQueueScheduler>();
-    Hyrise::get().set_scheduler(scheduler);
+    if (config.work_stealing) {
+      Hyrise::get().set_scheduler(std::make_shared<WorkStealingScheduler>());
+    } else {
+      Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+    }
   }
 
   _table_generator->generate_and_store();
@@ -499,11 +504,13 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("compression", "Specify vector compression as a string. Options: " + compression_strings_option, cxxopts::value<std::string>()->default_value(""))  // NOLINT
     ("indexes", "Create indexes (where defined by benchmark)", cxxopts::value<bool>()->default_value("false"))  // NOLINT
     ("scheduler", "Enable or disable the scheduler", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("work_stealing", "Use per-worker work-stealing deques instead of shared node queues (if the scheduler is active)", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("cores", "Specify the number of cores used by the scheduler (if active). 0 means all available cores", cxxopts::value<uint32_t>()->default_value("0")) // NOLINT
     ("clients", "Specify how many items should run in parallel if the scheduler is active", cxxopts::value<uint32_t>()->default_value("1")) // NOLINT
     ("visualize", "Create a visualization image of one LQP and PQP for each query, do not properly run the benchmark", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("verify", "Verify each query by comparing it with the SQLite result", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("dont_cache_binary_tables", "Do not cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("memory_budget", "Memory (in bytes) that the operators of each statement may use before they spill to disk. 'auto' shares half of the memory that is available before the data is loaded among the clients. By default, there is no budget", cxxopts::value<std::string>()->default_value("")) // NOLINT
     ("metrics", "Track more metrics (steps in SQL pipeline, system utilization, etc.) and add them to the output JSON (see -o)", cxxopts::value<bool>()->default_value("false")) // NOLINT
     // This option is only advised when the underlying system's memory capacity is overleaded by the preparation phase.
     ("data_preparation_cores", "Specify the number of cores used by the scheduler for data preparation, i.e., sorting and encoding tables and generating table statistics. 0 means all available cores.", cxxopts::value<uint32_t>()->default_value("0")); // NOLINT
@@ -513,6 +520,8 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
 }
 
 nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
+  const auto memory_budget = config.memory_budget ? nlohmann::json(*config.memory_budget) : nlohmann::json{};
+
   // Generate YY-MM-DD hh:mm::ss
   auto current_time = std::time(nullptr);
   auto local_time = *std::localtime(&current_time);
@@ -541,10 +550,12 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
                         {"max_duration", config.max_duration.count()},
                         {"warmup_duration", config.warmup_duration.count()},
                         {"using_scheduler", config.enable_scheduler},
+                        {"work_stealing", config.work_stealing},
                         {"cores", config.cores},
                         {"clients", config.clients},
                         {"data_preparation_cores", config.data_preparation_cores},
                         {"verify", config.verify},
+                        {"memory_budget", memory_budget},
                         {"time_unit", "ns"},
                         {"GIT-HASH", GIT_HEAD_SHA1 + std::string(GIT_IS_DIRTY ? "-dirty" : "")}};
 }
@@ -0,0 +1,43 @@
+#include "ch_benchmark_item_runner.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "ch_queries.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+CHBenchmarkItemRunner::CHBenchmarkItemRunner(const std::shared_ptr<BenchmarkConfig>& config)
+    : AbstractBenchmarkItemRunner(config) {
+  _items.resize(ch_queries.size());
+  std::iota(_items.begin(), _items.end(), BenchmarkItemID{0});
+}
+
+CHBenchmarkItemRunner::CHBenchmarkItemRunner(const std::shared_ptr<BenchmarkConfig>& config,
+                                             const std::vector<BenchmarkItemID>& items)
+    : AbstractBenchmarkItemRunner(config), _items(items) {
+  Assert(std::all_of(_items.begin(), _items.end(),
+                     [&](const auto benchmark_item_id) {
+                       return benchmark_item_id >= BenchmarkItemID{0} && benchmark_item_id < ch_queries.size();
+                     }),
+         "Invalid CH item id");
+}
+
+const std::vector<BenchmarkItemID>& CHBenchmarkItemRunner::items() const {
+  return _items;
+}
+
+bool CHBenchmarkItemRunner::_on_execute_item(const BenchmarkItemID item_id, BenchmarkSQLExecutor& sql_executor) {
+  // Queries are stored with their one-indexed CH query number
+  const auto [status, table] = sql_executor.execute(ch_queries.at(item_id + 1));
+  Assert(status == SQLPipelineStatus::Success, "CH items should not fail");
+  return true;
+}
+
+std::string CHBenchmarkItemRunner::item_name(const BenchmarkItemID item_id) const {
+  Assert(item_id < ch_queries.size(), "item_id out of range");
+  return std::string("CH ") + (item_id + 1 < 10 ? "0" : "") + std::to_string(item_id + 1);
+}
+
+}  // namespace opossum
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "abstract_benchmark_item_runner.hpp"
+
+namespace opossum {
+
+// Runs the analytical queries of the CH-benCHmark (see ch_queries.cpp). The queries do not have parameters. Their
+// results change as the TPC-C transactions modify the tables that they read.
+class CHBenchmarkItemRunner : public AbstractBenchmarkItemRunner {
+ public:
+  // Constructor for a CHBenchmarkItemRunner containing all CH queries
+  explicit CHBenchmarkItemRunner(const std::shared_ptr<BenchmarkConfig>& config);
+
+  // Constructor for a CHBenchmarkItemRunner containing a subset of CH queries
+  CHBenchmarkItemRunner(const std::shared_ptr<BenchmarkConfig>& config, const std::vector<BenchmarkItemID>& items);
+
+  std::string item_name(const BenchmarkItemID item_id) const override;
+  const std::vector<BenchmarkItemID>& items() const override;
+
+ protected:
+  bool _on_execute_item(const BenchmarkItemID item_id, BenchmarkSQLExecutor& sql_executor) override;
+
+  std::vector<BenchmarkItemID> _items;
+};
+
+}  // namespace opossum
@@ -0,0 +1,332 @@
+#include "ch_queries.hpp"
+
+/**
+ * The analytical queries of the CH-benCHmark (Cole et al., "The mixed workload CH-benCHmark", DBTest 2011) are TPC-H
+ * queries rewritten for the TPC-C schema. They are run on the tables of the TPC-C benchmark plus the SUPPLIER, NATION,
+ * and REGION tables (see CHTableGenerator).
+ *
+ * Changes that apply to all queries:
+ *  1. The TPC-C tables store dates as UNIX timestamps (int). Dates are thus given as timestamps and
+ *     EXTRACT(YEAR FROM date) is replaced by date / 31556952 + 1970, with 31556952 being the average number of seconds
+ *     per year. The CH-benCHmark chose the upper bounds of date ranges so that they include all orders of a benchmark
+ *     run at that time. As orders are created with the current date, these bounds are replaced by the largest
+ *     timestamp (2147483647).
+ *  2. Hyrise cannot evaluate join predicates on computed values. Supplier keys (S_W_ID * S_I_ID) % 10000 and
+ *     nation initials SUBSTR(C_STATE, 1, 1) are thus computed in a subquery in the FROM clause and joined from there.
+ *  3. Hyrise does not support ASCII(). Instead of ASCII(SUBSTR(C_STATE, 1, 1)) = N_NATIONKEY, the first character of
+ *     C_STATE is joined with N_STATE_INITIAL.
+ *  4. The TPC-C data generator only produces lowercase strings. Patterns with uppercase characters that are meant to
+ *     match the generated data (e.g., 'A%' for C_STATE) are lowercased. Nation and region names are uppercase, as in
+ *     TPC-H.
+ */
+
+namespace {
+
+/**
+ * CH 1
+ */
+const char* const ch_query_1 =
+    R"(SELECT OL_NUMBER, SUM(OL_QUANTITY) AS SUM_QTY, SUM(OL_AMOUNT) AS SUM_AMOUNT, AVG(OL_QUANTITY) AS AVG_QTY,
+      AVG(OL_AMOUNT) AS AVG_AMOUNT, COUNT(*) AS COUNT_ORDER
+      FROM ORDER_LINE
+      WHERE OL_DELIVERY_D > 1167696000
+      GROUP BY OL_NUMBER
+      ORDER BY OL_NUMBER;)";
+
+/**
+ * CH 2
+ */
+const char* const ch_query_2 =
+    R"(SELECT SU_SUPPKEY, SU_NAME, N_NAME, I_ID, I_NAME, SU_ADDRESS, SU_PHONE, SU_COMMENT
+      FROM ITEM, SUPPLIER, NATION, REGION,
+        (SELECT S_I_ID, S_QUANTITY, (S_W_ID * S_I_ID) % 10000 AS S_SU_SUPPKEY FROM STOCK) AS S,
+        (SELECT S_I_ID AS M_I_ID, MIN(S_QUANTITY) AS M_S_QUANTITY
+         FROM (SELECT S_I_ID, S_QUANTITY, (S_W_ID * S_I_ID) % 10000 AS S_SU_SUPPKEY FROM STOCK) AS S,
+           SUPPLIER, NATION, REGION
+         WHERE S_SU_SUPPKEY = SU_SUPPKEY AND SU_NATIONKEY = N_NATIONKEY AND N_REGIONKEY = R_REGIONKEY
+           AND R_NAME LIKE 'EUROP%'
+         GROUP BY S_I_ID) AS M
+      WHERE I_ID = S_I_ID AND S_SU_SUPPKEY = SU_SUPPKEY AND SU_NATIONKEY = N_NATIONKEY
+        AND N_REGIONKEY = R_REGIONKEY AND I_DATA LIKE '%b' AND R_NAME LIKE 'EUROP%' AND I_ID = M_I_ID
+        AND S_QUANTITY = M_S_QUANTITY
+      ORDER BY N_NAME, SU_NAME, I_ID;)";
+
+/**
+ * CH 3
+ */
+const char* const ch_query_3 =
+    R"(SELECT OL_O_ID, OL_W_ID, OL_D_ID, SUM(OL_AMOUNT) AS REVENUE, O_ENTRY_D
+      FROM CUSTOMER, NEW_ORDER, "ORDER", ORDER_LINE
+      WHERE C_STATE LIKE 'a%' AND C_ID = O_C_ID AND C_W_ID = O_W_ID AND C_D_ID = O_D_ID AND NO_W_ID = O_W_ID
+        AND NO_D_ID = O_D_ID AND NO_O_ID = O_ID AND OL_W_ID = O_W_ID AND OL_D_ID = O_D_ID AND OL_O_ID = O_ID
+        AND O_ENTRY_D > 1167696000
+      GROUP BY OL_O_ID, OL_W_ID, OL_D_ID, O_ENTRY_D
+      ORDER BY REVENUE DESC, O_ENTRY_D;)";
+
+/**
+ * CH 4
+ */
+const char* const ch_query_4 =
+    R"(SELECT O_OL_CNT, COUNT(*) AS ORDER_COUNT
+      FROM "ORDER"
+      WHERE O_ENTRY_D >= 1167696000 AND O_ENTRY_D < 2147483647
+        AND EXISTS (SELECT * FROM ORDER_LINE
+                    WHERE O_ID = OL_O_ID AND O_W_ID = OL_W_ID AND O_D_ID = OL_D_ID AND OL_DELIVERY_D >= O_ENTRY_D)
+      GROUP BY O_OL_CNT
+      ORDER BY O_OL_CNT;)";
+
+/**
+ * CH 5
+ *
+ * Changes:
+ *  1. ASCII(SUBSTR(C_STATE, 1, 1)) = SU_NATIONKEY AND SU_NATIONKEY = N_NATIONKEY is expressed as
+ *     C_STATE_INITIAL = N_STATE_INITIAL AND SU_NATIONKEY = N_NATIONKEY
+ */
+const char* const ch_query_5 =
+    R"(SELECT N_NAME, SUM(OL_AMOUNT) AS REVENUE
+      FROM (SELECT C_ID, C_W_ID, C_D_ID, SUBSTR(C_STATE, 1, 1) AS C_STATE_INITIAL FROM CUSTOMER) AS C,
+        "ORDER", ORDER_LINE, (SELECT S_I_ID, S_W_ID, (S_W_ID * S_I_ID) % 10000 AS S_SU_SUPPKEY FROM STOCK) AS S,
+        SUPPLIER, NATION, REGION
+      WHERE C_ID = O_C_ID AND C_W_ID = O_W_ID AND C_D_ID = O_D_ID AND OL_O_ID = O_ID AND OL_W_ID = O_W_ID
+        AND OL_D_ID = O_D_ID AND OL_W_ID = S_W_ID AND OL_I_ID = S_I_ID AND S_SU_SUPPKEY = SU_SUPPKEY
+        AND C_STATE_INITIAL = N_STATE_INITIAL AND SU_NATIONKEY = N_NATIONKEY AND N_REGIONKEY = R_REGIONKEY
+        AND R_NAME = 'EUROPE' AND O_ENTRY_D >= 1167696000
+      GROUP BY N_NAME
+      ORDER BY REVENUE DESC;)";
+
+/**
+ * CH 6
+ */
+const char* const ch_query_6 =
+    R"(SELECT SUM(OL_AMOUNT) AS REVENUE
+      FROM ORDER_LINE
+      WHERE OL_DELIVERY_D >= 915148800 AND OL_DELIVERY_D < 2147483647 AND OL_QUANTITY BETWEEN 1 AND 100000;)";
+
+/**
+ * CH 7
+ */
+const char* const ch_query_7 =
+    R"(SELECT SU_NATIONKEY AS SUPP_NATION, C_STATE_INITIAL AS CUST_NATION, O_ENTRY_D / 31556952 + 1970 AS L_YEAR,
+        SUM(OL_AMOUNT) AS REVENUE
+      FROM SUPPLIER, (SELECT S_I_ID, S_W_ID, (S_W_ID * S_I_ID) % 10000 AS S_SU_SUPPKEY FROM STOCK) AS S, ORDER_LINE,
+        "ORDER", (SELECT C_ID, C_W_ID, C_D_ID, SUBSTR(C_STATE, 1, 1) AS C_STATE_INITIAL FROM CUSTOMER) AS C,
+        NATION AS N1, NATION AS N2
+      WHERE OL_SUPPLY_W_ID = S_W_ID AND OL_I_ID = S_I_ID AND S_SU_SUPPKEY = SU_SUPPKEY AND OL_W_ID = O_W_ID
+        AND OL_D_ID = O_D_ID AND OL_O_ID = O_ID AND C_ID = O_C_ID AND C_W_ID = O_W_ID AND C_D_ID = O_D_ID
+        AND SU_NATIONKEY = N1.N_NATIONKEY AND C_STATE_INITIAL = N2.N_STATE_INITIAL
+        AND ((N1.N_NAME = 'GERMANY' AND N2.N_NAME = 'CAMBODIA') OR (N1.N_NAME = 'CAMBODIA' AND N2.N_NAME = 'GERMANY'))
+        AND OL_DELIVERY_D BETWEEN 1167696000 AND 2147483647
+      GROUP BY SU_NATIONKEY, C_STATE_INITIAL, O_ENTRY_D / 31556952 + 1970
+      ORDER BY SUPP_NATION, CUST_NATION, L_YEAR;)";
+
+/**
+ * CH 8
+ */
+const char* const ch_query_8 =
+    R"(SELECT O_ENTRY_D / 31556952 + 1970 AS L_YEAR,
+        SUM(CASE WHEN N2.N_NAME = 'GERMANY' THEN OL_AMOUNT ELSE 0 END) / SUM(OL_AMOUNT) AS MKT_SHARE
+      FROM ITEM, SUPPLIER, (SELECT S_I_ID, S_W_ID, (S_W_ID * S_I_ID) % 10000 AS S_SU_SUPPKEY FROM STOCK) AS S,
+        ORDER_LINE, "ORDER", (SELECT C_ID, C_W_ID, C_D_ID, SUBSTR(C_STATE, 1, 1) AS C_STATE_INITIAL FROM CUSTOMER) AS C,
+        NATION AS N1, NATION AS N2, REGION
+      WHERE I_ID = S_I_ID AND OL_I_ID = S_I_ID AND OL_SUPPLY_W_ID = S_W_ID AND S_SU_SUPPKEY = SU_SUPPKEY
+        AND OL_W_ID = O_W_ID AND OL_D_ID = O_D_ID AND OL_O_ID = O_ID AND C_ID = O_C_ID AND C_W_ID = O_W_ID
+        AND C_D_ID = O_D_ID AND N1.N_STATE_INITIAL = C_STATE_INITIAL AND N1.N_REGIONKEY = R_REGIONKEY
+        AND OL_I_ID < 1000 AND R_NAME = 'EUROPE' AND SU_NATIONKEY = N2.N_NATIONKEY
+        AND O_ENTRY_D BETWEEN 1167696000 AND 2147483647 AND I_DATA LIKE '%b' AND I_ID = OL_I_ID
+      GROUP BY O_ENTRY_D / 31556952 + 1970
+      ORDER BY L_YEAR;)";
+
+/**
+ * CH 9
+ */
+const char* const ch_query_9 =
+    R"(SELECT N_NAME, O_ENTRY_D / 31556952 + 1970 AS L_YEAR, SUM(OL_AMOUNT) AS SUM_PROFIT
+      FROM ITEM, (SELECT S_I_ID, S_W_ID, (S_W_ID * S_I_ID) % 10000 AS S_SU_SUPPKEY FROM STOCK) AS S, SUPPLIER,
+        ORDER_LINE, "ORDER", NATION
+      WHERE OL_I_ID = S_I_ID AND OL_SUPPLY_W_ID = S_W_ID AND S_SU_SUPPKEY = SU_SUPPKEY AND OL_W_ID = O_W_ID
+        AND OL_D_ID = O_D_ID AND OL_O_ID = O_ID AND OL_I_ID = I_ID AND SU_NATIONKEY = N_NATIONKEY
+        AND I_DATA LIKE '%bb'
+      GROUP BY N_NAME, O_ENTRY_D / 31556952 + 1970
+      ORDER BY N_NAME, L_YEAR DESC;)";
+
+/**
+ * CH 10
+ */
+const char* const ch_query_10 =
+    R"(SELECT C_ID, C_LAST, SUM(OL_AMOUNT) AS REVENUE, C_CITY, C_PHONE, N_NAME
+      FROM (SELECT C_ID, C_W_ID, C_D_ID, C_LAST, C_CITY, C_PHONE, SUBSTR(C_STATE, 1, 1) AS C_STATE_INITIAL
+            FROM CUSTOMER) AS C, "ORDER", ORDER_LINE, NATION
+      WHERE C_ID = O_C_ID AND C_W_ID = O_W_ID AND C_D_ID = O_D_ID AND OL_W_ID = O_W_ID AND OL_D_ID = O_D_ID
+        AND OL_O_ID = O_ID AND O_ENTRY_D >= 1167696000 AND O_ENTRY_D <= OL_DELIVERY_D
+        AND N_STATE_INITIAL = C_STATE_INITIAL
+      GROUP BY C_ID, C_LAST, C_CITY, C_PHONE, N_NAME
+      ORDER BY REVENUE DESC;)";
+
+/**
+ * CH 11
+ */
+const char* const ch_query_11 =
+    R"(SELECT S_I_ID, SUM(S_ORDER_CNT) AS ORDERCOUNT
+      FROM (SELECT S_I_ID, S_ORDER_CNT, (S_W_ID * S_I_ID) % 10000 AS S_SU_SUPPKEY FROM STOCK) AS S, SUPPLIER, NATION
+      WHERE S_SU_SUPPKEY = SU_SUPPKEY AND SU_NATIONKEY = N_NATIONKEY AND N_NAME = 'GERMANY'
+      GROUP BY S_I_ID
+      HAVING SUM(S_ORDER_CNT) > (
+        SELECT SUM(S_ORDER_CNT) * 0.005
+        FROM (SELECT S_I_ID, S_ORDER_CNT, (S_W_ID * S_I_ID) % 10000 AS S_SU_SUPPKEY FROM STOCK) AS S, SUPPLIER, NATION
+        WHERE S_SU_SUPPKEY = SU_SUPPKEY AND SU_NATIONKEY = N_NATIONKEY AND N_NAME = 'GERMANY')
+      ORDER BY ORDERCOUNT DESC;)";
+
+/**
+ * CH 12
+ */
+const char* const ch_query_12 =
+    R"(SELECT O_OL_CNT, SUM(CASE WHEN O_CARRIER_ID = 1 OR O_CARRIER_ID = 2 THEN 1 ELSE 0 END) AS HIGH_LINE_COUNT,
+        SUM(CASE WHEN O_CARRIER_ID <> 1 AND O_CARRIER_ID <> 2 THEN 1 ELSE 0 END) AS LOW_LINE_COUNT
+      FROM "ORDER", ORDER_LINE
+      WHERE OL_W_ID = O_W_ID AND OL_D_ID = O_D_ID AND OL_O_ID = O_ID AND O_ENTRY_D <= OL_DELIVERY_D
+        AND OL_DELIVERY_D < 2147483647
+      GROUP BY O_OL_CNT
+      ORDER BY O_OL_CNT;)";
+
+/**
+ * CH 13
+ */
+const char* const ch_query_13 =
+    R"(SELECT C_COUNT, COUNT(*) AS CUSTDIST
+      FROM (SELECT C_ID, COUNT(O_ID) AS C_COUNT
+            FROM CUSTOMER LEFT OUTER JOIN "ORDER"
+              ON C_W_ID = O_W_ID AND C_D_ID = O_D_ID AND C_ID = O_C_ID AND O_CARRIER_ID > 8
+            GROUP BY C_ID) AS C_ORDERS
+      GROUP BY C_COUNT
+      ORDER BY CUSTDIST DESC, C_COUNT DESC;)";
+
+/**
+ * CH 14
+ */
+const char* const ch_query_14 =
+    R"(SELECT 100.00 * SUM(CASE WHEN I_DATA LIKE 'pr%' THEN OL_AMOUNT ELSE 0 END) / (1 + SUM(OL_AMOUNT))
+        AS PROMO_REVENUE
+      FROM ORDER_LINE, ITEM
+      WHERE OL_I_ID = I_ID AND OL_DELIVERY_D >= 1167696000 AND OL_DELIVERY_D < 2147483647;)";
+
+/**
+ * CH 15
+ *
+ * Changes:
+ *  1. The view is defined in a WITH clause instead of a CREATE VIEW statement. This allows multiple clients to run the
+ *     query concurrently.
+ */
+const char* const ch_query_15 =
+    R"(WITH REVENUE AS (
+        SELECT S_SU_SUPPKEY AS SUPPLIER_NO, SUM(OL_AMOUNT) AS TOTAL_REVENUE
+        FROM ORDER_LINE, (SELECT S_I_ID, S_W_ID, (S_W_ID * S_I_ID) % 10000 AS S_SU_SUPPKEY FROM STOCK) AS S
+        WHERE OL_I_ID = S_I_ID AND OL_SUPPLY_W_ID = S_W_ID AND OL_DELIVERY_D >= 1167696000
+        GROUP BY S_SU_SUPPKEY)
+      SELECT SU_SUPPKEY, SU_NAME, SU_ADDRESS, SU_PHONE, TOTAL_REVENUE
+      FROM SUPPLIER, REVENUE
+      WHERE SU_SUPPKEY = SUPPLIER_NO AND TOTAL_REVENUE = (SELECT MAX(TOTAL_REVENUE) FROM REVENUE)
+      ORDER BY SU_SUPPKEY;)";
+
+/**
+ * CH 16
+ */
+const char* const ch_query_16 =
+    R"(SELECT I_NAME, SUBSTR(I_DATA, 1, 3) AS BRAND, I_PRICE, COUNT(DISTINCT S_SU_SUPPKEY) AS SUPPLIER_CNT
+      FROM (SELECT S_I_ID, (S_W_ID * S_I_ID) % 10000 AS S_SU_SUPPKEY FROM STOCK) AS S, ITEM
+      WHERE I_ID = S_I_ID AND I_DATA NOT LIKE 'zz%'
+        AND S_SU_SUPPKEY NOT IN (SELECT SU_SUPPKEY FROM SUPPLIER WHERE SU_COMMENT LIKE '%bad%')
+      GROUP BY I_NAME, SUBSTR(I_DATA, 1, 3), I_PRICE
+      ORDER BY SUPPLIER_CNT DESC;)";
+
+/**
+ * CH 17
+ */
+const char* const ch_query_17 =
+    R"(SELECT SUM(OL_AMOUNT) / 2.0 AS AVG_YEARLY
+      FROM ORDER_LINE, (SELECT I_ID, AVG(OL_QUANTITY) AS A
+                        FROM ITEM, ORDER_LINE
+                        WHERE I_DATA LIKE '%b' AND OL_I_ID = I_ID
+                        GROUP BY I_ID) AS T
+      WHERE OL_I_ID = T.I_ID AND OL_QUANTITY < T.A;)";
+
+/**
+ * CH 18
+ */
+const char* const ch_query_18 =
+    R"(SELECT C_LAST, C_ID, O_ID, O_ENTRY_D, O_OL_CNT, SUM(OL_AMOUNT) AS AMOUNT_SUM
+      FROM CUSTOMER, "ORDER", ORDER_LINE
+      WHERE C_ID = O_C_ID AND C_W_ID = O_W_ID AND C_D_ID = O_D_ID AND OL_W_ID = O_W_ID AND OL_D_ID = O_D_ID
+        AND OL_O_ID = O_ID
+      GROUP BY O_ID, O_W_ID, O_D_ID, C_ID, C_LAST, O_ENTRY_D, O_OL_CNT
+      HAVING SUM(OL_AMOUNT) > 200
+      ORDER BY AMOUNT_SUM DESC, O_ENTRY_D;)";
+
+/**
+ * CH 19
+ */
+const char* const ch_query_19 =
+    R"(SELECT SUM(OL_AMOUNT) AS REVENUE
+      FROM ORDER_LINE, ITEM
+      WHERE (OL_I_ID = I_ID AND I_DATA LIKE '%a' AND OL_QUANTITY >= 1 AND OL_QUANTITY <= 10
+             AND I_PRICE BETWEEN 1 AND 400000 AND OL_W_ID IN (1, 2, 3))
+        OR (OL_I_ID = I_ID AND I_DATA LIKE '%b' AND OL_QUANTITY >= 1 AND OL_QUANTITY <= 10
+            AND I_PRICE BETWEEN 1 AND 400000 AND OL_W_ID IN (1, 2, 4))
+        OR (OL_I_ID = I_ID AND I_DATA LIKE '%c' AND OL_QUANTITY >= 1 AND OL_QUANTITY <= 10
+            AND I_PRICE BETWEEN 1 AND 400000 AND OL_W_ID IN (1, 5, 3));)";
+
+/**
+ * CH 20
+ */
+const char* const ch_query_20 =
+    R"(SELECT SU_NAME, SU_ADDRESS
+      FROM SUPPLIER, NATION
+      WHERE SU_SUPPKEY IN (SELECT (S_I_ID * S_W_ID) % 10000
+                           FROM STOCK, ORDER_LINE
+                           WHERE S_I_ID IN (SELECT I_ID FROM ITEM WHERE I_DATA LIKE 'co%') AND OL_I_ID = S_I_ID
+                             AND OL_DELIVERY_D > 1274616000
+                           GROUP BY S_I_ID, S_W_ID, S_QUANTITY
+                           HAVING 2 * S_QUANTITY > SUM(OL_QUANTITY))
+        AND SU_NATIONKEY = N_NATIONKEY AND N_NAME = 'GERMANY'
+      ORDER BY SU_NAME;)";
+
+/**
+ * CH 21
+ */
+const char* const ch_query_21 =
+    R"(SELECT SU_NAME, COUNT(*) AS NUMWAIT
+      FROM SUPPLIER, ORDER_LINE AS L1, "ORDER",
+        (SELECT S_I_ID, S_W_ID, (S_W_ID * S_I_ID) % 10000 AS S_SU_SUPPKEY FROM STOCK) AS S, NATION
+      WHERE L1.OL_O_ID = O_ID AND L1.OL_W_ID = O_W_ID AND L1.OL_D_ID = O_D_ID AND L1.OL_W_ID = S_W_ID
+        AND L1.OL_I_ID = S_I_ID AND S_SU_SUPPKEY = SU_SUPPKEY AND L1.OL_DELIVERY_D > O_ENTRY_D
+        AND NOT EXISTS (SELECT * FROM ORDER_LINE AS L2
+                        WHERE L2.OL_O_ID = L1.OL_O_ID AND L2.OL_W_ID = L1.OL_W_ID AND L2.OL_D_ID = L1.OL_D_ID
+                          AND L2.OL_DELIVERY_D > L1.OL_DELIVERY_D)
+        AND SU_NATIONKEY = N_NATIONKEY AND N_NAME = 'GERMANY'
+      GROUP BY SU_NAME
+      ORDER BY NUMWAIT DESC, SU_NAME;)";
+
+/**
+ * CH 22
+ */
+const char* const ch_query_22 =
+    R"(SELECT SUBSTR(C_STATE, 1, 1) AS COUNTRY, COUNT(*) AS NUMCUST, SUM(C_BALANCE) AS TOTACCTBAL
+      FROM CUSTOMER
+      WHERE SUBSTR(C_PHONE, 1, 1) IN ('1', '2', '3', '4', '5', '6', '7')
+        AND C_BALANCE > (SELECT AVG(C_BALANCE) FROM CUSTOMER
+                         WHERE C_BALANCE > 0.00 AND SUBSTR(C_PHONE, 1, 1) IN ('1', '2', '3', '4', '5', '6', '7'))
+        AND NOT EXISTS (SELECT * FROM "ORDER" WHERE O_C_ID = C_ID AND O_W_ID = C_W_ID AND O_D_ID = C_D_ID)
+      GROUP BY SUBSTR(C_STATE, 1, 1)
+      ORDER BY COUNTRY;)";
+
+}  // namespace
+
+namespace opossum {
+
+const std::map<size_t, const char*> ch_queries = {
+    {1, ch_query_1},   {2, ch_query_2},   {3, ch_query_3},   {4, ch_query_4},   {5, ch_query_5},
+    {6, ch_query_6},   {7, ch_query_7},   {8, ch_query_8},   {9, ch_query_9},   {10, ch_query_10},
+    {11, ch_query_11}, {12, ch_query_12}, {13, ch_query_13}, {14, ch_query_14}, {15, ch_query_15},
+    {16, ch_query_16}, {17, ch_query_17}, {18, ch_query_18}, {19, ch_query_19}, {20, ch_query_20},
+    {21, ch_query_21}, {22, ch_query_22}};
+
+}  // namespace opossum
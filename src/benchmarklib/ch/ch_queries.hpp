@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdlib>
+#include <map>
+
+namespace opossum {
+
+/**
+ * Contains the 22 analytical queries of the CH-benCHmark. Use ordered map to have queries sorted by query id.
+ * This allows for guaranteed execution order when iterating over the queries.
+ */
+extern const std::map<size_t, const char*> ch_queries;
+
+}  // namespace opossum
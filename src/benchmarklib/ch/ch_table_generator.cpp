@@ -0,0 +1,218 @@
+#include "ch_table_generator.hpp"
+
+#include <array>
+#include <filesystem>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storage/table.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+struct NationDefinition {
+  const char* name;
+  int32_t region_key;
+};
+
+// The nation keys are the ASCII codes of '0' to '9', 'A' to 'Z', and 'a' to 'z'. Customers belong to the nation
+// whose key is the ASCII code of the first character of C_STATE. As the TPC-C data generator only uses lowercase
+// characters for C_STATE, customers are located in one of the last 26 nations, which are the 25 TPC-H nations and
+// Cambodia (which is used by query 7).
+constexpr auto nations = std::array<NationDefinition, CHTableGenerator::NUM_NATIONS>{{
+    {"NIGERIA", 0},     {"GHANA", 0},        {"SENEGAL", 0},      {"TANZANIA", 0},      {"UGANDA", 0},
+    {"ZAMBIA", 0},      {"ANGOLA", 0},       {"MEXICO", 1},       {"CHILE", 1},         {"COLOMBIA", 1},
+    {"VENEZUELA", 1},   {"ECUADOR", 1},      {"URUGUAY", 1},      {"CUBA", 1},          {"BOLIVIA", 1},
+    {"THAILAND", 2},    {"MALAYSIA", 2},     {"PHILIPPINES", 2},  {"SINGAPORE", 2},     {"KOREA", 2},
+    {"MONGOLIA", 2},    {"NEPAL", 2},        {"ITALY", 3},        {"SPAIN", 3},         {"PORTUGAL", 3},
+    {"POLAND", 3},      {"AUSTRIA", 3},      {"BELGIUM", 3},      {"SWEDEN", 3},        {"NORWAY", 3},
+    {"ISRAEL", 4},      {"LEBANON", 4},      {"SYRIA", 4},        {"OMAN", 4},          {"QATAR", 4},
+    {"KUWAIT", 4},      {"ALGERIA", 0},      {"ARGENTINA", 1},    {"BRAZIL", 1},        {"CANADA", 1},
+    {"EGYPT", 4},       {"ETHIOPIA", 0},     {"FRANCE", 3},       {"GERMANY", 3},       {"INDIA", 2},
+    {"INDONESIA", 2},   {"IRAN", 4},         {"IRAQ", 4},         {"JAPAN", 2},         {"JORDAN", 4},
+    {"KENYA", 0},       {"MOROCCO", 0},      {"MOZAMBIQUE", 0},   {"PERU", 1},          {"CHINA", 2},
+    {"ROMANIA", 3},     {"SAUDI ARABIA", 4}, {"VIETNAM", 2},      {"RUSSIA", 3},        {"UNITED KINGDOM", 3},
+    {"UNITED STATES", 1}, {"CAMBODIA", 2}}};
+
+constexpr auto regions =
+    std::array<const char*, CHTableGenerator::NUM_REGIONS>{"AFRICA", "AMERICA", "ASIA", "EUROPE", "MIDDLE EAST"};
+
+char nation_character(const size_t nation_idx) {
+  if (nation_idx < 10) {
+    return static_cast<char>('0' + nation_idx);
+  }
+  if (nation_idx < 36) {
+    return static_cast<char>('A' + (nation_idx - 10));
+  }
+  return static_cast<char>('a' + (nation_idx - 36));
+}
+
+}  // namespace
+
+namespace opossum {
+
+CHTableGenerator::CHTableGenerator(size_t num_warehouses, const std::shared_ptr<BenchmarkConfig>& benchmark_config)
+    : TPCCTableGenerator(num_warehouses, benchmark_config) {}
+
+CHTableGenerator::CHTableGenerator(size_t num_warehouses, ChunkOffset chunk_size)
+    : TPCCTableGenerator(num_warehouses, chunk_size) {}
+
+std::shared_ptr<Table> CHTableGenerator::generate_supplier_table() {
+  auto cardinalities = std::make_shared<std::vector<size_t>>(std::initializer_list<size_t>{NUM_SUPPLIERS});
+
+  /**
+   * indices[0] = supplier
+   */
+  std::vector<Segments> segments_by_chunk;
+  TableColumnDefinitions column_definitions;
+
+  // As in TPC-H, a few suppliers have received complaints. Query 16 ignores these suppliers.
+  auto bad_ids = _random_gen.select_unique_ids(NUM_SUPPLIERS / 100, NUM_SUPPLIERS);
+
+  // Suppliers are referenced by STOCK as (S_W_ID * S_I_ID) % NUM_SUPPLIERS, so that the keys start at 0
+  _add_column<int32_t>(segments_by_chunk, column_definitions, "SU_SUPPKEY", cardinalities,
+                       [&](std::vector<size_t> indices) { return indices[0]; });
+  _add_column<pmr_string>(segments_by_chunk, column_definitions, "SU_NAME", cardinalities,
+                          [&](std::vector<size_t> indices) {
+                            std::stringstream name;
+                            name << "Supplier#" << std::setw(9) << std::setfill('0') << indices[0];
+                            return pmr_string{name.str()};
+                          });
+  _add_column<pmr_string>(segments_by_chunk, column_definitions, "SU_ADDRESS", cardinalities,
+                          [&](std::vector<size_t>) { return pmr_string{_random_gen.astring(10, 40)}; });
+  _add_column<int32_t>(segments_by_chunk, column_definitions, "SU_NATIONKEY", cardinalities, [&](std::vector<size_t>) {
+    return nation_character(_random_gen.random_number(0, NUM_NATIONS - 1));
+  });
+  _add_column<pmr_string>(segments_by_chunk, column_definitions, "SU_PHONE", cardinalities,
+                          [&](std::vector<size_t>) { return pmr_string{_random_gen.nstring(16, 16)}; });
+  _add_column<float>(segments_by_chunk, column_definitions, "SU_ACCTBAL", cardinalities, [&](std::vector<size_t>) {
+    return static_cast<float>(_random_gen.random_number(0, 1'099'998)) / 100.f - 999.99f;
+  });
+  _add_column<pmr_string>(
+      segments_by_chunk, column_definitions, "SU_COMMENT", cardinalities, [&](std::vector<size_t> indices) {
+        std::string comment = _random_gen.astring(25, 100);
+        if (bad_ids.find(indices[0]) != bad_ids.end()) {
+          const auto complaint = std::string{"bad"};
+          const auto start_pos = _random_gen.random_number(0, comment.length() - complaint.length());
+          comment.replace(start_pos, complaint.length(), complaint);
+        }
+        return pmr_string{comment};
+      });
+
+  auto table =
+      std::make_shared<Table>(column_definitions, TableType::Data, _benchmark_config->chunk_size, UseMvcc::Yes);
+  for (const auto& segments : segments_by_chunk) {
+    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
+    table->append_chunk(segments, mvcc_data);
+  }
+
+  return table;
+}
+
+std::shared_ptr<Table> CHTableGenerator::generate_nation_table() {
+  auto cardinalities = std::make_shared<std::vector<size_t>>(std::initializer_list<size_t>{NUM_NATIONS});
+
+  /**
+   * indices[0] = nation
+   */
+  std::vector<Segments> segments_by_chunk;
+  TableColumnDefinitions column_definitions;
+
+  _add_column<int32_t>(segments_by_chunk, column_definitions, "N_NATIONKEY", cardinalities,
+                       [&](std::vector<size_t> indices) { return nation_character(indices[0]); });
+  _add_column<pmr_string>(segments_by_chunk, column_definitions, "N_NAME", cardinalities,
+                          [&](std::vector<size_t> indices) { return pmr_string{nations[indices[0]].name}; });
+  _add_column<int32_t>(segments_by_chunk, column_definitions, "N_REGIONKEY", cardinalities,
+                       [&](std::vector<size_t> indices) { return nations[indices[0]].region_key; });
+  _add_column<pmr_string>(segments_by_chunk, column_definitions, "N_COMMENT", cardinalities,
+                          [&](std::vector<size_t>) { return pmr_string{_random_gen.astring(31, 114)}; });
+  // Hyrise does not support ASCII(), which the CH-benCHmark uses to map C_STATE to N_NATIONKEY. Instead, the queries
+  // join the first character of C_STATE with this column.
+  _add_column<pmr_string>(segments_by_chunk, column_definitions, "N_STATE_INITIAL", cardinalities,
+                          [&](std::vector<size_t> indices) { return pmr_string(1, nation_character(indices[0])); });
+
+  auto table =
+      std::make_shared<Table>(column_definitions, TableType::Data, _benchmark_config->chunk_size, UseMvcc::Yes);
+  for (const auto& segments : segments_by_chunk) {
+    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
+    table->append_chunk(segments, mvcc_data);
+  }
+
+  return table;
+}
+
+std::shared_ptr<Table> CHTableGenerator::generate_region_table() {
+  auto cardinalities = std::make_shared<std::vector<size_t>>(std::initializer_list<size_t>{NUM_REGIONS});
+
+  /**
+   * indices[0] = region
+   */
+  std::vector<Segments> segments_by_chunk;
+  TableColumnDefinitions column_definitions;
+
+  _add_column<int32_t>(segments_by_chunk, column_definitions, "R_REGIONKEY", cardinalities,
+                       [&](std::vector<size_t> indices) { return indices[0]; });
+  _add_column<pmr_string>(segments_by_chunk, column_definitions, "R_NAME", cardinalities,
+                          [&](std::vector<size_t> indices) { return pmr_string{regions[indices[0]]}; });
+  _add_column<pmr_string>(segments_by_chunk, column_definitions, "R_COMMENT", cardinalities,
+                          [&](std::vector<size_t>) { return pmr_string{_random_gen.astring(31, 115)}; });
+
+  auto table =
+      std::make_shared<Table>(column_definitions, TableType::Data, _benchmark_config->chunk_size, UseMvcc::Yes);
+  for (const auto& segments : segments_by_chunk) {
+    const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
+    table->append_chunk(segments, mvcc_data);
+  }
+
+  return table;
+}
+
+std::unordered_map<std::string, BenchmarkTableInfo> CHTableGenerator::generate() {
+  // The TPC-C tables are cached (and loaded from the cache) together with those of the TPC-C benchmark
+  auto table_info_by_name = TPCCTableGenerator::generate();
+
+  // The additional tables do not depend on the number of warehouses
+  const auto cache_directory = std::string{"ch_cached_tables"};
+  if (_benchmark_config->cache_binary_tables && std::filesystem::is_directory(cache_directory)) {
+    table_info_by_name.merge(_load_binary_tables_from_path(cache_directory));
+    return table_info_by_name;
+  }
+
+  auto ch_table_info_by_name =
+      std::unordered_map<std::string, BenchmarkTableInfo>({{"SUPPLIER", BenchmarkTableInfo{generate_supplier_table()}},
+                                                           {"NATION", BenchmarkTableInfo{generate_nation_table()}},
+                                                           {"REGION", BenchmarkTableInfo{generate_region_table()}}});
+
+  if (_benchmark_config->cache_binary_tables) {
+    std::filesystem::create_directories(cache_directory);
+    for (auto& [table_name, table_info] : ch_table_info_by_name) {
+      table_info.binary_file_path = cache_directory + "/" + table_name + ".bin";  // NOLINT
+    }
+  }
+
+  table_info_by_name.merge(std::move(ch_table_info_by_name));
+  return table_info_by_name;
+}
+
+void CHTableGenerator::_add_constraints(std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name) const {
+  TPCCTableGenerator::_add_constraints(table_info_by_name);
+
+  const auto& supplier_table = table_info_by_name.at("SUPPLIER").table;
+  supplier_table->add_soft_key_constraint(
+      {{supplier_table->column_id_by_name("SU_SUPPKEY")}, KeyConstraintType::PRIMARY_KEY});
+
+  const auto& nation_table = table_info_by_name.at("NATION").table;
+  nation_table->add_soft_key_constraint(
+      {{nation_table->column_id_by_name("N_NATIONKEY")}, KeyConstraintType::PRIMARY_KEY});
+
+  const auto& region_table = table_info_by_name.at("REGION").table;
+  region_table->add_soft_key_constraint(
+      {{region_table->column_id_by_name("R_REGIONKEY")}, KeyConstraintType::PRIMARY_KEY});
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "tpcc/tpcc_table_generator.hpp"
+
+namespace opossum {
+
+// Generates the tables of the CH-benCHmark, i.e., the unmodified TPC-C tables plus the SUPPLIER, NATION, and REGION
+// tables that the analytical queries join with. Their sizes do not depend on the number of warehouses. See
+// ch_queries.cpp for how the TPC-C tables relate to the additional tables.
+class CHTableGenerator : public TPCCTableGenerator {
+ public:
+  static constexpr auto NUM_SUPPLIERS = size_t{10'000};
+  static constexpr auto NUM_NATIONS = size_t{62};
+  static constexpr auto NUM_REGIONS = size_t{5};
+
+  CHTableGenerator(size_t num_warehouses, const std::shared_ptr<BenchmarkConfig>& benchmark_config);
+
+  // Convenience constructor for creating a CHTableGenerator without a benchmarking context
+  explicit CHTableGenerator(size_t num_warehouses, ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
+
+  std::shared_ptr<Table> generate_supplier_table();
+
+  std::shared_ptr<Table> generate_nation_table();
+
+  std::shared_ptr<Table> generate_region_table();
+
+  std::unordered_map<std::string, BenchmarkTableInfo> generate() override;
+
+ protected:
+  void _add_constraints(std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name) const override;
+};
+
+}  // namespace opossum
@@ -8,6 +8,7 @@
 
 #include "constant_mappings.hpp"
 #include "utils/assert.hpp"
+#include "utils/memory_budget.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace opossum {
@@ -29,6 +30,14 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
   const auto core_info = enable_scheduler ? " using " + number_of_cores_str + " cores" : "";
   std::cout << "- Running in " + std::string(enable_scheduler ? "multi" : "single") + "-threaded mode" << core_info
             << std::endl;
+  const auto work_stealing = parse_result["work_stealing"].as<bool>();
+  if (work_stealing) {
+    if (enable_scheduler) {
+      std::cout << "- Using the work-stealing scheduler" << std::endl;
+    } else {
+      PerformanceWarning("'--work_stealing' specified but ignored, because '--scheduler' is false");
+    }
+  }
   const auto data_preparation_cores = parse_result["data_preparation_cores"].as<uint32_t>();
   const auto number_of_data_preparation_cores_str =
       (data_preparation_cores == 0) ? "all available" : std::to_string(data_preparation_cores);
@@ -137,6 +146,14 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
     std::cout << "- Not tracking SQL metrics" << std::endl;
   }
 
+  // Each client executes one statement at a time, so the available memory is shared by all clients
+  const auto memory_budget = MemoryBudget::parse_limit(parse_result["memory_budget"].as<std::string>(), clients);
+  if (memory_budget) {
+    std::cout << "- Memory budget per statement is " << *memory_budget << " bytes" << std::endl;
+  } else {
+    std::cout << "- No memory budget" << std::endl;
+  }
+
   return BenchmarkConfig{benchmark_mode,
                          chunk_size,
                          *encoding_config,
@@ -146,13 +163,15 @@ BenchmarkConfig CLIConfigParser::parse_cli_options(const cxxopts::ParseResult& p
                          warmup_duration,
                          output_file_path,
                          enable_scheduler,
+                         work_stealing,
                          cores,
                          data_preparation_cores,
                          clients,
                          enable_visualization,
                          verify,
                          cache_binary_tables,
-                         metrics};
+                         metrics,
+                         memory_budget};
 }
 
 EncodingConfig CLIConfigParser::parse_encoding_config(const std::string& encoding_file_str) {
@@ -0,0 +1,378 @@
+#include "hybrid_benchmark_runner.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+
+#include "hyrise.hpp"
+#include "scheduler/job_task.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "utils/assert.hpp"
+#include "utils/format_duration.hpp"
+
+namespace opossum {
+
+HybridBenchmarkRunner::HybridBenchmarkRunner(const BenchmarkConfig& config,
+                                             std::unique_ptr<AbstractBenchmarkItemRunner> transactional_item_runner,
+                                             std::unique_ptr<AbstractBenchmarkItemRunner> analytical_item_runner,
+                                             const uint32_t analytical_clients,
+                                             std::unique_ptr<AbstractTableGenerator> table_generator,
+                                             const nlohmann::json& context)
+    : _config(config),
+      _analytical_clients(analytical_clients),
+      _transactional_item_runner(std::move(transactional_item_runner)),
+      _analytical_item_runner(std::move(analytical_item_runner)),
+      _table_generator(std::move(table_generator)),
+      _context(context) {
+  Assert(_config.clients > 0 || _analytical_clients > 0, "Need at least one client");
+  Assert(!_config.verify, "Results cannot be verified while the tables are modified concurrently");
+
+  _context["analytical_clients"] = _analytical_clients;
+
+  Hyrise::get().default_pqp_cache = std::make_shared<SQLPhysicalPlanCache>();
+  Hyrise::get().default_lqp_cache = std::make_shared<SQLLogicalPlanCache>();
+
+  // Initialise the scheduler if the benchmark was requested to run multi-threaded
+  if (config.enable_scheduler) {
+    Hyrise::get().topology.use_default_topology(config.cores);
+    std::cout << "- Multi-threaded Topology:" << std::endl;
+    std::cout << Hyrise::get().topology;
+
+    if (config.work_stealing) {
+      Hyrise::get().set_scheduler(std::make_shared<WorkStealingScheduler>());
+    } else {
+      Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+    }
+  } else {
+    std::cout << "- Scheduler is disabled, transactional and analytical items are executed alternately" << std::endl;
+  }
+
+  _table_generator->generate_and_store();
+
+  _transactional_item_runner->on_tables_loaded();
+  _analytical_item_runner->on_tables_loaded();
+}
+
+void HybridBenchmarkRunner::run() {
+  for (const auto workload : {Workload::Transactional, Workload::Analytical}) {
+    const auto& items = _item_runner(workload).items();
+    if (!items.empty()) {
+      _results(workload) = std::vector<BenchmarkItemResult>{*std::max_element(items.begin(), items.end()) + 1u};
+    }
+  }
+
+  if (_config.warmup_duration > Duration{0}) {
+    std::cout << "- Warming up for " << format_duration(_config.warmup_duration) << std::endl;
+    _run_workloads(_config.warmup_duration, false);
+  }
+
+  std::cout << "- Starting Benchmark with " << _config.clients << " transactional and " << _analytical_clients
+            << " analytical client(s)" << std::endl;
+  _run_workloads(_config.max_duration, true);
+
+  _print_results();
+
+  if (_config.output_file_path) {
+    write_report_to_file();
+  }
+
+  if (Hyrise::get().scheduler()) {
+    Hyrise::get().scheduler()->finish();
+    Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+  }
+}
+
+void HybridBenchmarkRunner::_run_workloads(const Duration duration, const bool record) {
+  // Both workloads pick their items in shuffled mode (see BenchmarkRunner::_benchmark_shuffled)
+  const auto weighted_item_ids = [&](const Workload workload) {
+    const auto& item_runner = _item_runner(workload);
+    const auto& weights = item_runner.weights();
+    if (weights.empty()) {
+      return item_runner.items();
+    }
+
+    auto item_ids_weighted = std::vector<BenchmarkItemID>{};
+    for (const auto& item_id : item_runner.items()) {
+      item_ids_weighted.resize(item_ids_weighted.size() + weights.at(item_id), item_id);
+    }
+    return item_ids_weighted;
+  };
+
+  const auto transactional_item_ids = weighted_item_ids(Workload::Transactional);
+  const auto analytical_item_ids = weighted_item_ids(Workload::Analytical);
+  auto transactional_item_ids_shuffled = std::vector<BenchmarkItemID>{};
+  auto analytical_item_ids_shuffled = std::vector<BenchmarkItemID>{};
+
+  std::random_device random_device;
+  std::mt19937 random_generator(random_device());
+
+  const auto next_item_id = [&](const std::vector<BenchmarkItemID>& item_ids,
+                                std::vector<BenchmarkItemID>& item_ids_shuffled) {
+    if (item_ids_shuffled.empty()) {
+      item_ids_shuffled = item_ids;
+      std::shuffle(item_ids_shuffled.begin(), item_ids_shuffled.end(), random_generator);
+    }
+    const auto item_id = item_ids_shuffled.back();
+    item_ids_shuffled.pop_back();
+    return item_id;
+  };
+
+  Assert(_currently_running_transactional_clients == 0 && _currently_running_analytical_clients == 0,
+         "Did not expect any clients to run at this time");
+
+  _successful_transactional_runs = 0;
+  _successful_analytical_runs = 0;
+  _samples.clear();
+  _state = BenchmarkState{duration};
+  _benchmark_start = std::chrono::steady_clock::now();
+
+  auto next_sample = std::chrono::steady_clock::now();
+  while (_state.keep_running()) {
+    if (record && std::chrono::steady_clock::now() >= next_sample) {
+      _samples.emplace_back(_take_sample());
+      next_sample += TRACKING_INTERVAL;
+    }
+
+    auto scheduled_item = false;
+
+    // We want to only schedule as many items simultaneously as we have simulated clients of each workload
+    if (!transactional_item_ids.empty() &&
+        _currently_running_transactional_clients.load(std::memory_order_relaxed) < _config.clients) {
+      _schedule_item_run(Workload::Transactional,
+                         next_item_id(transactional_item_ids, transactional_item_ids_shuffled), record);
+      scheduled_item = true;
+    }
+
+    if (!analytical_item_ids.empty() &&
+        _currently_running_analytical_clients.load(std::memory_order_relaxed) < _analytical_clients) {
+      _schedule_item_run(Workload::Analytical, next_item_id(analytical_item_ids, analytical_item_ids_shuffled),
+                         record);
+      scheduled_item = true;
+    }
+
+    if (!scheduled_item) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+  }
+
+  if (record) {
+    _samples.emplace_back(_take_sample());
+  }
+  _state.set_done();
+
+  // Wait for the rest of the tasks that didn't make it in time - they will not count towards the results
+  if (Hyrise::get().scheduler()) {
+    Hyrise::get().scheduler()->wait_for_all_tasks();
+  }
+  Assert(_currently_running_transactional_clients == 0 && _currently_running_analytical_clients == 0,
+         "All runs must be finished at this point");
+
+  for (const auto workload : {Workload::Transactional, Workload::Analytical}) {
+    for (auto& result : _results(workload)) {
+      if (record) {
+        // As the execution of benchmark items is intermingled, we use the total duration for all items
+        result.duration = _state.benchmark_duration;
+      } else {
+        result.successful_runs = {};
+        result.unsuccessful_runs = {};
+      }
+    }
+  }
+}
+
+void HybridBenchmarkRunner::_schedule_item_run(const Workload workload, const BenchmarkItemID item_id,
+                                               const bool record) {
+  const auto is_transactional = workload == Workload::Transactional;
+  auto& currently_running_clients =
+      is_transactional ? _currently_running_transactional_clients : _currently_running_analytical_clients;
+  auto& successful_runs = is_transactional ? _successful_transactional_runs : _successful_analytical_runs;
+  auto& item_runner = _item_runner(workload);
+  auto& result = _results(workload)[item_id];
+
+  ++currently_running_clients;
+
+  auto task = std::make_shared<JobTask>(
+      [&, item_id, record]() {
+        const auto run_start = std::chrono::steady_clock::now();
+        auto [success, metrics, any_run_verification_failed] = item_runner.execute_item(item_id);
+        const auto run_end = std::chrono::steady_clock::now();
+
+        --currently_running_clients;
+
+        if (!record || _state.is_done()) {  // To prevent items from adding their result after the time is up
+          return;
+        }
+
+        if (!_config.metrics) {
+          metrics.clear();
+        }
+        const auto item_result =
+            BenchmarkItemRunResult{run_start - _benchmark_start, run_end - run_start, std::move(metrics)};
+        if (success) {
+          result.successful_runs.push_back(item_result);
+          ++successful_runs;
+        } else {
+          result.unsuccessful_runs.push_back(item_result);
+        }
+      },
+      SchedulePriority::High);
+
+  task->schedule();
+}
+
+HybridBenchmarkRunner::Sample HybridBenchmarkRunner::_take_sample() const {
+  auto sample = Sample{std::chrono::steady_clock::now() - _benchmark_start, _successful_transactional_runs.load(),
+                       _successful_analytical_runs.load(), 0, 0};
+
+  for (const auto& [table_name, table] : Hyrise::get().storage_manager.tables()) {
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk) {
+        continue;
+      }
+
+      sample.invalid_row_count += chunk->invalid_row_count();
+      sample.row_count += chunk->size();
+    }
+  }
+
+  return sample;
+}
+
+double HybridBenchmarkRunner::transactional_items_per_minute(const BenchmarkItemID item_id) const {
+  const auto& result = _transactional_results.at(item_id);
+  // chrono::minutes uses an integer precision duration type, but we need a floating-point value.
+  const auto duration_minutes = std::chrono::duration<double, std::ratio<60>>{result.duration}.count();
+  return duration_minutes > 0 ? static_cast<double>(result.successful_runs.size()) / duration_minutes : 0.0;
+}
+
+std::vector<Duration> HybridBenchmarkRunner::_latency_percentiles(const BenchmarkItemResult& result) {
+  auto durations = std::vector<Duration>{};
+  durations.reserve(result.successful_runs.size());
+  for (const auto& run_result : result.successful_runs) {
+    durations.emplace_back(run_result.duration);
+  }
+  std::sort(durations.begin(), durations.end());
+
+  auto percentiles = std::vector<Duration>{};
+  if (durations.empty()) {
+    return percentiles;
+  }
+
+  for (const auto percentile : LATENCY_PERCENTILES) {
+    const auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(durations.size())));
+    percentiles.emplace_back(durations[std::max(rank, size_t{1}) - 1]);
+  }
+  return percentiles;
+}
+
+void HybridBenchmarkRunner::_print_results() const {
+  for (const auto workload : {Workload::Transactional, Workload::Analytical}) {
+    const auto& item_runner = _item_runner(workload);
+    for (const auto& item_id : item_runner.items()) {
+      const auto& result = _results(workload)[item_id];
+      std::cout << "- Results for " << item_runner.item_name(item_id) << std::endl;
+      std::cout << "  -> Executed " << result.successful_runs.size() << " times";
+
+      const auto percentiles = _latency_percentiles(result);
+      for (auto percentile_idx = size_t{0}; percentile_idx < percentiles.size(); ++percentile_idx) {
+        std::cout << (percentile_idx == 0 ? " (Latency " : ", ") << "p" << LATENCY_PERCENTILES[percentile_idx] << ": "
+                  << std::chrono::duration<double, std::milli>{percentiles[percentile_idx]}.count() << " ms"
+                  << (percentile_idx + 1 == percentiles.size() ? ")" : "");
+      }
+      std::cout << std::endl;
+
+      if (!result.unsuccessful_runs.empty()) {
+        std::cout << "  -> " << result.unsuccessful_runs.size() << " additional runs failed" << std::endl;
+      }
+    }
+  }
+
+  if (!_samples.empty()) {
+    const auto& last_sample = _samples.back();
+    const auto invalid_row_share = last_sample.row_count > 0 ? static_cast<double>(last_sample.invalid_row_count) /
+                                                                   static_cast<double>(last_sample.row_count)
+                                                             : 0.0;
+    std::cout << "- " << last_sample.invalid_row_count << " of " << last_sample.row_count << " rows ("
+              << std::setprecision(3) << 100.0 * invalid_row_share << "%) have been invalidated" << std::endl;
+  }
+}
+
+void HybridBenchmarkRunner::write_report_to_file() const {
+  auto benchmarks = nlohmann::json::array();
+
+  for (const auto workload : {Workload::Transactional, Workload::Analytical}) {
+    const auto& item_runner = _item_runner(workload);
+    for (const auto& item_id : item_runner.items()) {
+      const auto& result = _results(workload)[item_id];
+
+      const auto runs_to_json = [](const auto& runs) {
+        auto runs_json = nlohmann::json::array();
+        for (const auto& run_result : runs) {
+          runs_json.push_back(
+              nlohmann::json{{"begin", run_result.begin.count()}, {"duration", run_result.duration.count()}});
+        }
+        return runs_json;
+      };
+
+      auto latency_percentiles_json = nlohmann::json::object();
+      const auto percentiles = _latency_percentiles(result);
+      for (auto percentile_idx = size_t{0}; percentile_idx < percentiles.size(); ++percentile_idx) {
+        latency_percentiles_json[std::to_string(static_cast<int>(LATENCY_PERCENTILES[percentile_idx]))] =
+            percentiles[percentile_idx].count();
+      }
+
+      // chrono::seconds uses an integer precision duration type, but we need a floating-point value.
+      const auto duration_seconds = std::chrono::duration<double>(result.duration).count();
+      const auto items_per_second =
+          duration_seconds > 0 ? (static_cast<double>(result.successful_runs.size()) / duration_seconds) : 0;
+
+      benchmarks.push_back(
+          nlohmann::json{{"name", item_runner.item_name(item_id)},
+                         {"workload", workload == Workload::Transactional ? "transactional" : "analytical"},
+                         {"duration", result.duration.count()},
+                         {"items_per_second", items_per_second},
+                         {"latency_percentiles", latency_percentiles_json},
+                         {"successful_runs", runs_to_json(result.successful_runs)},
+                         {"unsuccessful_runs", runs_to_json(result.unsuccessful_runs)}});
+    }
+  }
+
+  auto samples = nlohmann::json::array();
+  for (const auto& sample : _samples) {
+    samples.push_back(nlohmann::json{{"timestamp", sample.timestamp.count()},
+                                     {"successful_transactional_runs", sample.transactional_runs},
+                                     {"successful_analytical_runs", sample.analytical_runs},
+                                     {"invalid_row_count", sample.invalid_row_count},
+                                     {"row_count", sample.row_count}});
+  }
+
+  nlohmann::json report{{"context", _context},
+                        {"benchmarks", std::move(benchmarks)},
+                        {"samples", std::move(samples)},
+                        {"table_generation", _table_generator->metrics}};
+
+  // Write the output file
+  std::ofstream{_config.output_file_path.value()} << std::setw(2) << report << std::endl;
+}
+
+AbstractBenchmarkItemRunner& HybridBenchmarkRunner::_item_runner(const Workload workload) const {
+  return workload == Workload::Transactional ? *_transactional_item_runner : *_analytical_item_runner;
+}
+
+std::vector<BenchmarkItemResult>& HybridBenchmarkRunner::_results(const Workload workload) {
+  return workload == Workload::Transactional ? _transactional_results : _analytical_results;
+}
+
+const std::vector<BenchmarkItemResult>& HybridBenchmarkRunner::_results(const Workload workload) const {
+  return workload == Workload::Transactional ? _transactional_results : _analytical_results;
+}
+
+}  // namespace opossum
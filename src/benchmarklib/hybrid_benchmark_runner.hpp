@@ -0,0 +1,109 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "abstract_benchmark_item_runner.hpp"
+#include "abstract_table_generator.hpp"
+#include "benchmark_config.hpp"
+#include "benchmark_item_result.hpp"
+#include "benchmark_state.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Runs a transactional and an analytical workload concurrently on the same tables, for example, TPC-C and the
+// queries of the CH-benCHmark (see ch_benchmark.cpp). Other than the BenchmarkRunner, which executes the items of a
+// single item runner, it keeps a separate number of clients busy for each of the two item runners. The transactional
+// workload uses BenchmarkConfig::clients clients so that the transactional item runner sees its own client count.
+// Both workloads run in shuffled mode, i.e., the items are picked randomly according to their weights.
+//
+// Besides the throughput and latency percentiles of all items, the runner periodically records the share of rows that
+// have been invalidated by the transactional workload. These rows are still scanned (and discarded by the Validate
+// operator) by the analytical queries, which is one reason why their latencies increase over time.
+class HybridBenchmarkRunner : public Noncopyable {
+ public:
+  // Defines the interval in which the throughput and the share of invalidated rows are sampled
+  static constexpr auto TRACKING_INTERVAL = std::chrono::seconds{1};
+
+  // Percentiles of the item latencies that are reported
+  static constexpr auto LATENCY_PERCENTILES = std::array<double, 4>{50.0, 90.0, 95.0, 99.0};
+
+  HybridBenchmarkRunner(const BenchmarkConfig& config,
+                        std::unique_ptr<AbstractBenchmarkItemRunner> transactional_item_runner,
+                        std::unique_ptr<AbstractBenchmarkItemRunner> analytical_item_runner,
+                        const uint32_t analytical_clients, std::unique_ptr<AbstractTableGenerator> table_generator,
+                        const nlohmann::json& context);
+
+  void run();
+
+  // Returns the number of successful runs of a transactional item per minute of the measured benchmark duration. For
+  // the New-Order item of TPC-C, this is the tpmC metric.
+  double transactional_items_per_minute(const BenchmarkItemID item_id) const;
+
+  // Writes the results, including the samples taken during the run, as JSON to config.output_file_path. Similar to the
+  // BenchmarkRunner, this is idempotent.
+  void write_report_to_file() const;
+
+ private:
+  enum class Workload { Transactional, Analytical };
+
+  struct Sample {
+    Duration timestamp;
+    size_t transactional_runs;
+    size_t analytical_runs;
+    uint64_t invalid_row_count;
+    uint64_t row_count;
+  };
+
+  // Runs both workloads for the given duration. If `record` is false, the results are discarded (i.e., warmup).
+  void _run_workloads(const Duration duration, const bool record);
+
+  // Schedules a run of the given item. If the scheduler is disabled, the item is executed immediately.
+  void _schedule_item_run(const Workload workload, const BenchmarkItemID item_id, const bool record);
+
+  // Counts the invalidated and the total rows of all stored tables
+  Sample _take_sample() const;
+
+  void _print_results() const;
+
+  AbstractBenchmarkItemRunner& _item_runner(const Workload workload) const;
+  std::vector<BenchmarkItemResult>& _results(const Workload workload);
+  const std::vector<BenchmarkItemResult>& _results(const Workload workload) const;
+
+  // Returns the latencies at LATENCY_PERCENTILES, using the nearest-rank method
+  static std::vector<Duration> _latency_percentiles(const BenchmarkItemResult& result);
+
+  const BenchmarkConfig _config;
+  const uint32_t _analytical_clients;
+
+  std::unique_ptr<AbstractBenchmarkItemRunner> _transactional_item_runner;
+  std::unique_ptr<AbstractBenchmarkItemRunner> _analytical_item_runner;
+  std::unique_ptr<AbstractTableGenerator> _table_generator;
+
+  // Slots for the results of the item executions, indexed by BenchmarkItemID (see BenchmarkRunner::_results)
+  std::vector<BenchmarkItemResult> _transactional_results;
+  std::vector<BenchmarkItemResult> _analytical_results;
+
+  std::vector<Sample> _samples;
+
+  nlohmann::json _context;
+
+  TimePoint _benchmark_start;
+
+  std::atomic_uint32_t _currently_running_transactional_clients{0};
+  std::atomic_uint32_t _currently_running_analytical_clients{0};
+
+  // Successful runs of the current phase, used for sampling the throughput without iterating over the results
+  std::atomic_size_t _successful_transactional_runs{0};
+  std::atomic_size_t _successful_analytical_runs{0};
+
+  BenchmarkState _state{Duration{0}};
+};
+
+}  // namespace opossum
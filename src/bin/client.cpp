@@ -1,8 +1,164 @@
 #include "client.hpp"
 
+#include <libpq-fe.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include "cxxopts.hpp"
+
+#include "utils/assert.hpp"
+
 // Files in the /bin folder are not tested. Everything that can be tested should be in the /lib folder and this file
 // should be as short as possible.
 
+// Connection-scaling benchmark for the Hyrise server. For an increasing number of open connections, a fixed number of
+// them executes queries while the remaining ones stay idle, as it is the case for the connection pools of application
+// servers. Run it against a server with and without --async_sessions to compare how idle sessions affect throughput
+// and latency. Note that the number of connections might be limited by the maximum number of open files (ulimit -n).
+
+namespace {
+
+using Connection = std::unique_ptr<PGconn, decltype(&PQfinish)>;
+
+Connection connect(const std::string& connection_string) {
+  auto connection = Connection{PQconnectdb(connection_string.c_str()), &PQfinish};
+  Assert(PQstatus(connection.get()) == CONNECTION_OK,
+         "Connection to server failed: " + std::string{PQerrorMessage(connection.get())});
+  return connection;
+}
+
+void execute(PGconn* connection, const std::string& query) {
+  const auto result = std::unique_ptr<PGresult, decltype(&PQclear)>{PQexec(connection, query.c_str()), &PQclear};
+  const auto status = PQresultStatus(result.get());
+  Assert(status == PGRES_TUPLES_OK || status == PGRES_COMMAND_OK,
+         "Query failed: " + std::string{PQresultErrorMessage(result.get())});
+}
+
+struct Measurement {
+  size_t query_count;
+  double queries_per_second;
+  double mean_latency_ms;
+  double p99_latency_ms;
+};
+
+// Each of the first active_connection_count connections executes the query in a closed loop on its own thread
+Measurement measure(const std::vector<Connection>& connections, const size_t active_connection_count,
+                    const std::string& query, const std::chrono::seconds duration) {
+  auto latencies_per_connection = std::vector<std::vector<std::chrono::nanoseconds>>(active_connection_count);
+  auto threads = std::vector<std::thread>{};
+
+  const auto begin = std::chrono::steady_clock::now();
+  const auto end = begin + duration;
+  for (auto connection_id = size_t{0}; connection_id < active_connection_count; ++connection_id) {
+    threads.emplace_back([&, connection_id]() {
+      auto& latencies = latencies_per_connection[connection_id];
+      while (std::chrono::steady_clock::now() < end) {
+        const auto query_begin = std::chrono::steady_clock::now();
+        execute(connections[connection_id].get(), query);
+        latencies.emplace_back(std::chrono::steady_clock::now() - query_begin);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  const auto elapsed_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+  auto latencies = std::vector<std::chrono::nanoseconds>{};
+  for (const auto& connection_latencies : latencies_per_connection) {
+    latencies.insert(latencies.end(), connection_latencies.begin(), connection_latencies.end());
+  }
+  Assert(!latencies.empty(), "No query was executed during the measurement");
+  std::sort(latencies.begin(), latencies.end());
+
+  const auto to_ms = [](const std::chrono::nanoseconds latency) {
+    return std::chrono::duration<double, std::milli>(latency).count();
+  };
+  const auto query_count = latencies.size();
+  const auto latency_sum = std::accumulate(latencies.begin(), latencies.end(), std::chrono::nanoseconds{0});
+
+  return Measurement{query_count, static_cast<double>(query_count) / elapsed_seconds,
+                     to_ms(latency_sum) / static_cast<double>(query_count),
+                     to_ms(latencies[(query_count - 1) * 99 / 100])};
+}
+
+}  // namespace
+
+cxxopts::Options get_client_cli_options() {
+  cxxopts::Options cli_options("./hyriseClient",
+                               "Measures the throughput and latency of the Hyrise server for an increasing number of "
+                               "open connections, of which a fixed number is actively executing queries.");
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "Display this help and exit") // NOLINT
+    ("address", "Specify the address of the server", cxxopts::value<std::string>()->default_value("127.0.0.1"))  // NOLINT
+    ("p,port", "Specify the port number of the server", cxxopts::value<uint16_t>()->default_value("5432"))  // NOLINT
+    ("connections", "Comma-separated, increasing numbers of open connections", cxxopts::value<std::string>()->default_value("1,10,100,1000"))  // NOLINT
+    ("active_connections", "Number of connections executing queries, the others are idle", cxxopts::value<size_t>()->default_value("8"))  // NOLINT
+    ("query", "Query executed by the active connections", cxxopts::value<std::string>()->default_value("SELECT 1;"))  // NOLINT
+    ("t,time", "Measurement duration in seconds per number of connections", cxxopts::value<uint64_t>()->default_value("5"))  // NOLINT
+    ;  // NOLINT
+  // clang-format on
+
+  return cli_options;
+}
+
 int main(int argc, char** argv) {
+  auto cli_options = get_client_cli_options();
+  const auto parsed_options = cli_options.parse(argc, argv);
+
+  // Print help and exit
+  if (parsed_options.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto connection_string = "hostaddr=" + parsed_options["address"].as<std::string>() +
+                                 " port=" + std::to_string(parsed_options["port"].as<uint16_t>());
+  const auto max_active_connection_count = parsed_options["active_connections"].as<size_t>();
+  const auto query = parsed_options["query"].as<std::string>();
+  const auto duration = std::chrono::seconds{parsed_options["time"].as<uint64_t>()};
+
+  auto connection_count_strings = std::vector<std::string>{};
+  boost::split(connection_count_strings, parsed_options["connections"].as<std::string>(), boost::is_any_of(","),
+               boost::token_compress_on);
+  auto connection_counts = std::vector<size_t>{};
+  for (const auto& connection_count_string : connection_count_strings) {
+    connection_counts.emplace_back(boost::lexical_cast<size_t>(boost::trim_copy(connection_count_string)));
+  }
+  Assert(std::is_sorted(connection_counts.begin(), connection_counts.end()), "Connection counts must be increasing");
+  Assert(max_active_connection_count > 0, "At least one connection has to be active");
+
+  std::cout << std::setw(12) << "connections" << std::setw(8) << "active" << std::setw(12) << "queries"
+            << std::setw(14) << "queries/s" << std::setw(12) << "mean [ms]" << std::setw(12) << "p99 [ms]" << std::endl;
+
+  // Connections are kept open while the number of connections is increased
+  auto connections = std::vector<Connection>{};
+  for (const auto connection_count : connection_counts) {
+    while (connections.size() < connection_count) {
+      connections.emplace_back(connect(connection_string));
+    }
+
+    const auto active_connection_count = std::min(max_active_connection_count, connection_count);
+    const auto measurement = measure(connections, active_connection_count, query, duration);
+
+    std::cout << std::fixed << std::setprecision(3) << std::setw(12) << connection_count << std::setw(8)
+              << active_connection_count << std::setw(12) << measurement.query_count << std::setw(14)
+              << measurement.queries_per_second << std::setw(12) << measurement.mean_latency_ms << std::setw(12)
+              << measurement.p99_latency_ms << std::endl;
+  }
+
   return 0;
 }
@@ -1,15 +1,20 @@
 #include "cxxopts.hpp"
 
+#include <iostream>
+#include <thread>
+
 #include <boost/algorithm/string.hpp>
 #include <boost/lexical_cast.hpp>
 
 #include "benchmark_config.hpp"
 #include "cli_config_parser.hpp"
+#include "hyrise.hpp"
 #include "server/server.hpp"
 #include "tpcc/tpcc_table_generator.hpp"
 #include "tpcds/tpcds_table_generator.hpp"
 #include "tpch/tpch_constants.hpp"
 #include "tpch/tpch_table_generator.hpp"
+#include "utils/memory_budget.hpp"
 
 namespace {
 
@@ -61,6 +66,9 @@ cxxopts::Options get_server_cli_options() {
                        "TPC-DS, and TPC-H. The sizing factor determines the scale factor in TPC-DS and TPC-H, and the "
                        "warehouse count in TPC-C.", cxxopts::value<std::string>()) // NOLINT
     ("execution_info", "Send execution information after statement execution", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("async_sessions", "Handle sessions event-driven on the scheduler instead of running a thread per session", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("memory_budget", "Memory (in bytes) that the operators of each statement may use before they spill to disk. 'auto' shares half of the available memory at startup among as many statements as there are cores. By default, there is no budget", cxxopts::value<std::string>()->default_value("")) // NOLINT
+    ("io_threads", "Number of threads receiving requests and sending responses if sessions are handled event-driven", cxxopts::value<uint32_t>()->default_value("1")) // NOLINT
     ;  // NOLINT
   // clang-format on
 
@@ -91,13 +99,25 @@ int main(int argc, char* argv[]) {
 
   const auto execution_info = parsed_options["execution_info"].as<bool>();
   const auto port = parsed_options["port"].as<uint16_t>();
+  const auto session_mode =
+      parsed_options["async_sessions"].as<bool>() ? opossum::SessionMode::Async : opossum::SessionMode::Threaded;
+  const auto io_thread_count = parsed_options["io_threads"].as<uint32_t>();
+
+  // The server's scheduler executes as many statements concurrently as there are cores
+  const auto memory_budget = opossum::MemoryBudget::parse_limit(parsed_options["memory_budget"].as<std::string>(),
+                                                                std::thread::hardware_concurrency());
+  if (memory_budget) {
+    std::cout << "Memory budget per statement is " << *memory_budget << " bytes" << std::endl;
+  }
+  opossum::Hyrise::get().default_memory_budget = memory_budget;
 
   boost::system::error_code error;
   const auto address = boost::asio::ip::make_address(parsed_options["address"].as<std::string>(), error);
 
   Assert(!error, "Not a valid IPv4 address: " + parsed_options["address"].as<std::string>() + ", terminating...");
 
-  auto server = opossum::Server{address, port, static_cast<opossum::SendExecutionInfo>(execution_info)};
+  auto server = opossum::Server{address, port, static_cast<opossum::SendExecutionInfo>(execution_info), session_mode,
+                                io_thread_count};
   server.run();
 
   return 0;
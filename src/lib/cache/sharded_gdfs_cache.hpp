@@ -0,0 +1,300 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
+#include <boost/heap/fibonacci_heap.hpp>
+
+#include "abstract_cache.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+inline constexpr size_t DEFAULT_CACHE_SHARD_COUNT = 16;
+
+/**
+ * GDFS cache for highly concurrent lookups, e.g., the plan caches of many server sessions.
+ *
+ * GDFSCache has to take an exclusive lock for every try_get(), as each hit updates the entry's priority in the heap.
+ * This variant reduces the contention in two ways:
+ *  (1) The keys are hash-partitioned into shards, each being a separate GDFS cache with its own lock, capacity, and
+ *      inflation value. Lookups of different keys rarely compete for the same lock.
+ *  (2) A hit only takes a shared lock and increments a counter of pending hits in the entry. The first pending hit of
+ *      an entry registers it with the shard. The pending hits are applied to the priorities in a batch whenever the
+ *      shard is modified, i.e., before any eviction. Hot entries thus do not touch the heap at all.
+ *
+ * Compared to GDFSCache, the eviction decision is only made within the shard of the new key, and priorities of hit
+ * entries use the inflation value at the time of the batched update instead of the one at the time of the hit. With
+ * a sufficient number of entries per shard, both effects are small.
+ *
+ * The number of shards in use is limited by the capacity, so that each shard can hold at least one entry. Resizing the
+ * cache below the shard count thus moves the entries to fewer shards instead of leaving shards without capacity.
+ */
+template <typename Key, typename Value>
+class ShardedGDFSCache : public AbstractCache<Key, Value> {
+ public:
+  using SnapshotEntry = typename AbstractCache<Key, Value>::SnapshotEntry;
+
+  explicit ShardedGDFSCache(size_t capacity = DEFAULT_CACHE_CAPACITY, size_t shard_count = DEFAULT_CACHE_SHARD_COUNT)
+      : AbstractCache<Key, Value>(capacity), _shards(std::max(size_t{1}, shard_count)) {
+    ShardedGDFSCache::resize(capacity);
+  }
+
+  void set(const Key& key, const Value& value, double cost = 1.0, double size = 1.0) final {
+    const auto [shard_id, lock] = _lock_shard<std::unique_lock<std::shared_mutex>>(key);
+    auto& shard = _shards[shard_id];
+    if (shard.capacity == 0) {
+      return;
+    }
+
+    _apply_pending_hits(shard);
+
+    auto it = shard.map.find(key);
+    if (it != shard.map.end()) {
+      // Update priority.
+      auto& entry = it->second;
+      entry.value = value;
+
+      auto& heap_entry = *entry.handle;
+      heap_entry.size = size;
+      heap_entry.frequency++;
+      heap_entry.priority = shard.inflation + static_cast<double>(heap_entry.frequency) / heap_entry.size;
+      shard.queue.update(entry.handle);
+      return;
+    }
+
+    // If the shard is full, erase the item at the top of its heap so that we can insert the new item.
+    if (shard.queue.size() >= shard.capacity) {
+      _evict_from(shard);
+    }
+
+    // Insert new item in cache. The heap refers to the key stored in the map, which does not move on rehashing.
+    const auto [inserted_it, _] = shard.map.try_emplace(key, value);
+    inserted_it->second.handle =
+        shard.queue.push(HeapEntry{&inserted_it->first, 1, size, shard.inflation + 1.0 / size});
+  }
+
+  std::optional<Value> try_get(const Key& query) final {
+    const auto [shard_id, lock] = _lock_shard<std::shared_lock<std::shared_mutex>>(query);
+    auto& shard = _shards[shard_id];
+    auto it = shard.map.find(query);
+    if (it == shard.map.end()) {
+      return std::nullopt;
+    }
+
+    auto& entry = it->second;
+    if (entry.pending_hits.fetch_add(1, std::memory_order_relaxed) == 0) {
+      // First hit since the last update of the priorities
+      std::lock_guard<std::mutex> pending_lock(shard.pending_mutex);
+      shard.pending_entries.emplace_back(&entry);
+    }
+    return entry.value;
+  }
+
+  bool has(const Key& key) const final {
+    const auto [shard_id, lock] = _lock_shard<std::shared_lock<std::shared_mutex>>(key);
+    return _shards[shard_id].map.contains(key);
+  }
+
+  size_t size() const final {
+    auto size = size_t{0};
+    for (const auto& shard : _shards) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      size += shard.map.size();
+    }
+    return size;
+  }
+
+  void clear() final {
+    for (auto& shard : _shards) {
+      std::unique_lock<std::shared_mutex> lock(shard.mutex);
+      shard.pending_entries.clear();
+      shard.queue.clear();
+      shard.map.clear();
+    }
+  }
+
+  void resize(size_t capacity) final {
+    auto locks = std::vector<std::unique_lock<std::shared_mutex>>{};
+    locks.reserve(_shards.size());
+    for (auto& shard : _shards) {
+      locks.emplace_back(shard.mutex);
+      _apply_pending_hits(shard);
+    }
+
+    const auto active_shard_count = std::max(size_t{1}, std::min(_shards.size(), capacity));
+    const auto previous_active_shard_count = _active_shard_count.load();
+    _active_shard_count = active_shard_count;
+    if (active_shard_count != previous_active_shard_count) {
+      _move_to_new_shards(previous_active_shard_count);
+    }
+
+    for (auto shard_id = size_t{0}; shard_id < _shards.size(); ++shard_id) {
+      auto& shard = _shards[shard_id];
+      shard.capacity = 0;
+      if (shard_id < active_shard_count) {
+        shard.capacity = capacity / active_shard_count + (shard_id < capacity % active_shard_count ? 1 : 0);
+      }
+
+      while (shard.queue.size() > shard.capacity) {
+        _evict_from(shard);
+      }
+    }
+
+    this->_capacity = capacity;
+  }
+
+  std::unordered_map<Key, SnapshotEntry> snapshot() const final {
+    std::unordered_map<Key, SnapshotEntry> map_copy;
+    for (const auto& shard : _shards) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      for (const auto& [key, entry] : shard.map) {
+        const auto frequency = (*entry.handle).frequency + entry.pending_hits.load(std::memory_order_relaxed);
+        map_copy[key] = SnapshotEntry{entry.value, frequency};
+      }
+    }
+    return map_copy;
+  }
+
+  // The number of shards in use
+  size_t shard_count() const {
+    return _active_shard_count.load();
+  }
+
+ protected:
+  struct HeapEntry {
+    const Key* key;
+    size_t frequency;
+    double size;
+    double priority;
+
+    // The underlying heap is a max-heap.
+    // To have the item with lowest priority at the top, we invert the comparison.
+    bool operator<(const HeapEntry& other) const {
+      return priority > other.priority;
+    }
+  };
+
+  using Handle = typename boost::heap::fibonacci_heap<HeapEntry>::handle_type;
+
+  struct Entry {
+    explicit Entry(const Value& init_value) : value(init_value) {}
+
+    Value value;
+    Handle handle;
+
+    // Hits that are not yet reflected in the frequency and priority of the heap entry
+    std::atomic_size_t pending_hits{0};
+  };
+
+  // Shards are aligned to cache lines so that the locks of different shards do not share a cache line.
+  struct alignas(64) Shard {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<Key, Entry> map;
+    boost::heap::fibonacci_heap<HeapEntry> queue;
+    double inflation{0.0};
+    size_t capacity{0};
+
+    // Entries with pending hits. Only appended to while holding a shared lock on `mutex`, only consumed while holding
+    // an exclusive lock. Thus, the entries cannot be erased while they are listed here.
+    std::mutex pending_mutex;
+    std::vector<Entry*> pending_entries;
+  };
+
+  std::vector<Shard> _shards;
+
+  // Keys are partitioned across the first _active_shard_count shards. Only changed while all shards are locked.
+  std::atomic_size_t _active_shard_count{1};
+
+  // Returns the id of the key's shard together with a lock on that shard. As the number of active shards might change
+  // while waiting for the lock, the shard is determined again once the lock is held.
+  template <typename Lock>
+  std::pair<size_t, Lock> _lock_shard(const Key& key) const {
+    const auto hash = std::hash<Key>{}(key);
+    while (true) {
+      const auto shard_id = hash % _active_shard_count.load();
+      auto lock = Lock{_shards[shard_id].mutex};
+      if (shard_id == hash % _active_shard_count.load()) {
+        return {shard_id, std::move(lock)};
+      }
+    }
+  }
+
+  // Requires exclusive locks on all shards and that pending hits were applied. Moves the entries of the previously
+  // active shards to the shards that their keys map to now. Their frequencies are kept.
+  void _move_to_new_shards(const size_t previous_active_shard_count) {
+    const auto active_shard_count = _active_shard_count.load();
+    for (auto shard_id = size_t{0}; shard_id < previous_active_shard_count; ++shard_id) {
+      auto& shard = _shards[shard_id];
+      for (auto it = shard.map.begin(); it != shard.map.end();) {
+        const auto new_shard_id = std::hash<Key>{}(it->first) % active_shard_count;
+        if (new_shard_id == shard_id) {
+          ++it;
+          continue;
+        }
+
+        auto& new_shard = _shards[new_shard_id];
+        const auto& heap_entry = *it->second.handle;
+        const auto [inserted_it, _] = new_shard.map.try_emplace(it->first, it->second.value);
+        inserted_it->second.handle = new_shard.queue.push(
+            HeapEntry{&inserted_it->first, heap_entry.frequency, heap_entry.size,
+                      new_shard.inflation + static_cast<double>(heap_entry.frequency) / heap_entry.size});
+
+        shard.queue.erase(it->second.handle);
+        it = shard.map.erase(it);
+      }
+    }
+  }
+
+  // Requires an exclusive lock on the shard
+  static void _apply_pending_hits(Shard& shard) {
+    for (auto* entry : shard.pending_entries) {
+      auto& heap_entry = *entry->handle;
+      heap_entry.frequency += entry->pending_hits.exchange(0, std::memory_order_relaxed);
+      heap_entry.priority = shard.inflation + static_cast<double>(heap_entry.frequency) / heap_entry.size;
+      shard.queue.update(entry->handle);
+    }
+    shard.pending_entries.clear();
+  }
+
+  // Requires an exclusive lock on the shard and that pending hits were applied
+  static void _evict_from(Shard& shard) {
+    const auto& top = shard.queue.top();
+
+    shard.inflation = top.priority;
+    // The key lives in the map node, so erase(const Key&) would still read it while destroying the node
+    const auto it = shard.map.find(*top.key);
+    DebugAssert(it != shard.map.end(), "Evicted key is not in the cache");
+    shard.queue.pop();
+    shard.map.erase(it);
+  }
+
+  // Evicts the entry with the lowest priority across all shards. The shards are locked in order to avoid deadlocks.
+  void _evict() final {
+    auto locks = std::vector<std::unique_lock<std::shared_mutex>>{};
+    locks.reserve(_shards.size());
+
+    auto* victim_shard = static_cast<Shard*>(nullptr);
+    auto victim_priority = std::numeric_limits<double>::max();
+    for (auto& shard : _shards) {
+      locks.emplace_back(shard.mutex);
+      _apply_pending_hits(shard);
+      if (!shard.queue.empty() && shard.queue.top().priority < victim_priority) {
+        victim_shard = &shard;
+        victim_priority = shard.queue.top().priority;
+      }
+    }
+
+    if (victim_shard) {
+      _evict_from(*victim_shard);
+    }
+  }
+};
+
+}  // namespace opossum
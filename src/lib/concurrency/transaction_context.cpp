@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "commit_context.hpp"
+#include "write_ahead_log.hpp"
 #include "hyrise.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "utils/assert.hpp"
@@ -103,6 +104,23 @@ void TransactionContext::commit_async(const std::function<void(TransactionID)>&
     op->commit_records(commit_id());
   }
 
+  const auto& write_ahead_log = Hyrise::get().write_ahead_log;
+  if (write_ahead_log) {
+    auto record = WriteAheadLogRecord{};
+    for (const auto& op : _read_write_operators) {
+      op->log_records(record);
+    }
+
+    if (!record.empty()) {
+      // The transaction becomes visible once its modifications are durable. Until then, the following transactions
+      // cannot become visible either, as commit IDs are made visible in order.
+      write_ahead_log->append(record, [context = shared_from_this(), callback]() {
+        context->_mark_as_pending_and_try_commit(callback);
+      });
+      return;
+    }
+  }
+
   _mark_as_pending_and_try_commit(callback);
 }
 
@@ -0,0 +1,467 @@
+#include "write_ahead_log.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+#include <vector>
+
+#include <boost/crc.hpp>
+
+#include "hyrise.hpp"
+#include "operators/delete.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Format of the log file: a sequence of records, each consisting of
+ *   - the payload size (uint32_t),
+ *   - the CRC-32 checksum of the payload (uint32_t),
+ *   - the payload, which starts with the RecordType.
+ * The payload of a commit record is a sequence of entries. Each entry starts with its EntryType and the table name:
+ *   - Insert: chunk ID and begin/end offsets of the inserted rows, then the rows' (null flag, value) pairs per column
+ *   - Invalidation: number of rows, then their chunk IDs and offsets
+ *   - Relocation: number of rows, then their old chunk IDs and offsets, then their new chunk IDs and offsets
+ * Values are stored in host byte order, as the log is only read on the machine that wrote it. Strings are prefixed with
+ * their length.
+ */
+enum class RecordType : uint8_t { Commit, Recovered };
+enum class EntryType : uint8_t { Insert, Invalidation, Relocation };
+
+constexpr auto RECORD_HEADER_SIZE = 2 * sizeof(uint32_t);
+
+template <typename T>
+void write_value(std::string& data, const T& value) {
+  if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, pmr_string>) {
+    write_value(data, static_cast<uint32_t>(value.size()));
+    data.append(value.data(), value.size());
+  } else {
+    static_assert(std::is_trivially_copyable_v<T>, "Cannot serialize type");
+    data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+}
+
+class LogReader {
+ public:
+  explicit LogReader(const std::string_view data) : _data(data) {}
+
+  template <typename T>
+  T read() {
+    if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, pmr_string>) {
+      const auto size = read<uint32_t>();
+      Assert(_position + size <= _data.size(), "Write-ahead log record is corrupted");
+      const auto value = T{_data.data() + _position, size};
+      _position += size;
+      return value;
+    } else {
+      Assert(_position + sizeof(T) <= _data.size(), "Write-ahead log record is corrupted");
+      auto value = T{};
+      std::memcpy(&value, _data.data() + _position, sizeof(T));
+      _position += sizeof(T);
+      return value;
+    }
+  }
+
+  bool at_end() const {
+    return _position == _data.size();
+  }
+
+ private:
+  const std::string_view _data;
+  size_t _position{0};
+};
+
+uint32_t checksum(const std::string_view data) {
+  auto crc = boost::crc_32_type{};
+  crc.process_bytes(data.data(), data.size());
+  return crc.checksum();
+}
+
+void write_record_header(std::string& data, const std::string_view payload) {
+  write_value(data, static_cast<uint32_t>(payload.size()));
+  write_value(data, checksum(payload));
+}
+
+uint64_t row_key(const ChunkID chunk_id, const ChunkOffset chunk_offset) {
+  return (static_cast<uint64_t>(chunk_id) << 32u) | chunk_offset;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void WriteAheadLogRecord::log_insert(const std::string& table_name, const Table& table, const ChunkID chunk_id,
+                                     const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset) {
+  if (_data.empty()) {
+    write_value(_data, RecordType::Commit);
+  }
+
+  write_value(_data, EntryType::Insert);
+  write_value(_data, table_name);
+  write_value(_data, static_cast<ChunkID::base_type>(chunk_id));
+  write_value(_data, static_cast<ChunkOffset::base_type>(begin_chunk_offset));
+  write_value(_data, static_cast<ChunkOffset::base_type>(end_chunk_offset));
+
+  const auto chunk = table.get_chunk(chunk_id);
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      segment_with_iterators<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto begin, const auto end) {
+        auto iter = begin + begin_chunk_offset;
+        for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset, ++iter) {
+          write_value(_data, iter->is_null());
+          write_value(_data, iter->value());
+        }
+      });
+    });
+  }
+}
+
+void WriteAheadLogRecord::log_invalidation(const std::string& table_name, const AbstractPosList& row_ids) {
+  if (row_ids.empty()) {
+    return;
+  }
+
+  if (_data.empty()) {
+    write_value(_data, RecordType::Commit);
+  }
+
+  write_value(_data, EntryType::Invalidation);
+  write_value(_data, table_name);
+  write_value(_data, static_cast<uint32_t>(row_ids.size()));
+  for (const auto row_id : row_ids) {
+    write_value(_data, static_cast<ChunkID::base_type>(row_id.chunk_id));
+    write_value(_data, static_cast<ChunkOffset::base_type>(row_id.chunk_offset));
+  }
+}
+
+void WriteAheadLogRecord::log_relocation(const std::string& table_name, const AbstractPosList& old_row_ids,
+                                         const AbstractPosList& new_row_ids) {
+  DebugAssert(old_row_ids.size() == new_row_ids.size(), "Each moved row needs an old and a new position");
+  if (old_row_ids.empty()) {
+    return;
+  }
+
+  if (_data.empty()) {
+    write_value(_data, RecordType::Commit);
+  }
+
+  write_value(_data, EntryType::Relocation);
+  write_value(_data, table_name);
+  write_value(_data, static_cast<uint32_t>(old_row_ids.size()));
+  for (const auto& row_ids : {&old_row_ids, &new_row_ids}) {
+    for (const auto row_id : *row_ids) {
+      write_value(_data, static_cast<ChunkID::base_type>(row_id.chunk_id));
+      write_value(_data, static_cast<ChunkOffset::base_type>(row_id.chunk_offset));
+    }
+  }
+}
+
+bool WriteAheadLogRecord::empty() const {
+  return _data.empty();
+}
+
+const std::string& WriteAheadLogRecord::data() const {
+  return _data;
+}
+
+WriteAheadLog::WriteAheadLog(const std::string& path, const std::chrono::microseconds group_commit_delay)
+    : _path(path), _group_commit_delay(group_commit_delay) {
+  _file_descriptor = open(_path.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor >= 0, "Cannot open write-ahead log '" + _path + "': " + std::strerror(errno));
+
+  _flush_thread = std::thread{&WriteAheadLog::_flush_loop, this};
+}
+
+WriteAheadLog::~WriteAheadLog() {
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _shutdown = true;
+  }
+  _pending_condition.notify_one();
+  _flush_thread.join();
+
+  close(_file_descriptor);
+}
+
+uint64_t WriteAheadLog::recover() {
+  Assert(!_recovered, "Write-ahead log has already been recovered");
+
+  auto file = std::ifstream{_path, std::ios::binary};
+  const auto log = std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+  const auto log_view = std::string_view{log};
+
+  auto replayed_commit_count = uint64_t{0};
+  auto position = size_t{0};
+  while (position + RECORD_HEADER_SIZE <= log.size()) {
+    auto header_reader = LogReader{log_view.substr(position, RECORD_HEADER_SIZE)};
+    const auto payload_size = header_reader.read<uint32_t>();
+    const auto payload_checksum = header_reader.read<uint32_t>();
+    if (payload_size == 0 || position + RECORD_HEADER_SIZE + payload_size > log.size()) {
+      break;
+    }
+
+    const auto payload = log_view.substr(position + RECORD_HEADER_SIZE, payload_size);
+    if (checksum(payload) != payload_checksum) {
+      break;
+    }
+
+    switch (static_cast<RecordType>(payload.front())) {
+      case RecordType::Commit:
+        _replay_commit(payload.substr(1));
+        ++replayed_commit_count;
+        break;
+      case RecordType::Recovered:
+        // The following records were logged after a recovery. Positions refer to the layout after that recovery,
+        // which equals the current layout.
+        _replayed_row_ids.clear();
+        break;
+      default:
+        Fail("Unknown record type in write-ahead log");
+    }
+
+    position += RECORD_HEADER_SIZE + payload_size;
+  }
+  _replayed_row_ids.clear();
+
+  if (position < log.size()) {
+    Hyrise::get().log_manager.add_message("WriteAheadLog",
+                                          "Discarded incomplete record at the end of write-ahead log '" + _path + "'",
+                                          LogLevel::Warning);
+    Assert(ftruncate(_file_descriptor, static_cast<off_t>(position)) == 0,
+           "Cannot truncate write-ahead log: " + std::string{std::strerror(errno)});
+  }
+
+  if (position > 0) {
+    auto payload = std::string{};
+    write_value(payload, RecordType::Recovered);
+    auto record = std::string{};
+    write_record_header(record, payload);
+    record += payload;
+    _write(record);
+  }
+
+  _recovered = true;
+  return replayed_commit_count;
+}
+
+void WriteAheadLog::append(const WriteAheadLogRecord& record, const std::function<void()>& on_durable) {
+  Assert(_recovered, "Write-ahead log has to be recovered before commits are logged");
+  DebugAssert(!record.empty(), "Empty records should not be logged");
+
+  auto header = std::string{};
+  write_record_header(header, record.data());
+
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    _pending_data += header;
+    _pending_data += record.data();
+    _pending_commits.emplace_back(PendingCommit{on_durable, std::chrono::steady_clock::now()});
+  }
+  _pending_condition.notify_one();
+}
+
+WriteAheadLog::Statistics WriteAheadLog::statistics() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _statistics;
+}
+
+void WriteAheadLog::_flush_loop() {
+  auto data = std::string{};
+  auto commits = std::vector<PendingCommit>{};
+
+  while (true) {
+    {
+      auto lock = std::unique_lock<std::mutex>{_mutex};
+      _pending_condition.wait(lock, [&]() { return _shutdown || !_pending_commits.empty(); });
+      if (_pending_commits.empty()) {
+        return;
+      }
+    }
+
+    if (_group_commit_delay.count() > 0) {
+      std::this_thread::sleep_for(_group_commit_delay);
+    }
+
+    // All records that arrived up to now are written with a single sync
+    {
+      const auto lock = std::lock_guard<std::mutex>{_mutex};
+      std::swap(data, _pending_data);
+      std::swap(commits, _pending_commits);
+    }
+
+    _write(data);
+
+    const auto durable_time = std::chrono::steady_clock::now();
+    {
+      const auto lock = std::lock_guard<std::mutex>{_mutex};
+      _statistics.commit_count += commits.size();
+      ++_statistics.flush_count;
+      _statistics.written_bytes += data.size();
+      for (const auto& commit : commits) {
+        _statistics.accumulated_commit_latency += durable_time - commit.append_time;
+      }
+    }
+
+    for (const auto& commit : commits) {
+      commit.on_durable();
+    }
+
+    data.clear();
+    commits.clear();
+  }
+}
+
+void WriteAheadLog::_write(const std::string& data) {
+  auto written_bytes = size_t{0};
+  while (written_bytes < data.size()) {
+    const auto result = write(_file_descriptor, data.data() + written_bytes, data.size() - written_bytes);
+    if (result < 0) {
+      Assert(errno == EINTR, "Cannot write to write-ahead log: " + std::string{std::strerror(errno)});
+      continue;
+    }
+    written_bytes += static_cast<size_t>(result);
+  }
+
+  Assert(fsync(_file_descriptor) == 0, "Cannot sync write-ahead log: " + std::string{std::strerror(errno)});
+}
+
+void WriteAheadLog::_replay_commit(const std::string_view payload) {
+  auto& storage_manager = Hyrise::get().storage_manager;
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+
+  auto reader = LogReader{payload};
+  while (!reader.at_end()) {
+    const auto entry_type = reader.read<EntryType>();
+    const auto table_name = reader.read<std::string>();
+    Assert(storage_manager.has_table(table_name),
+           "Cannot recover changes of table '" + table_name + "', which has not been loaded");
+    const auto table = storage_manager.get_table(table_name);
+    auto& replayed_row_ids = _replayed_row_ids[table_name];
+
+    if (entry_type == EntryType::Insert) {
+      const auto logged_chunk_id = ChunkID{reader.read<ChunkID::base_type>()};
+      const auto begin_chunk_offset = ChunkOffset{reader.read<ChunkOffset::base_type>()};
+      const auto end_chunk_offset = ChunkOffset{reader.read<ChunkOffset::base_type>()};
+      const auto row_count = ChunkOffset{end_chunk_offset - begin_chunk_offset};
+
+      auto segments = Segments{};
+      const auto column_count = table->column_count();
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        resolve_data_type(table->column_data_type(column_id), [&](const auto data_type_t) {
+          using ColumnDataType = typename decltype(data_type_t)::type;
+
+          auto values = pmr_vector<ColumnDataType>(row_count);
+          auto null_values = pmr_vector<bool>(row_count);
+          for (auto row_offset = ChunkOffset{0}; row_offset < row_count; ++row_offset) {
+            null_values[row_offset] = reader.read<bool>();
+            values[row_offset] = reader.read<ColumnDataType>();
+          }
+
+          if (table->column_is_nullable(column_id)) {
+            segments.emplace_back(
+                std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+          } else {
+            segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+          }
+        });
+      }
+
+      const auto values_table =
+          std::make_shared<Table>(table->column_definitions(), TableType::Data, table->target_chunk_size());
+      values_table->append_chunk(segments);
+      const auto table_wrapper = std::make_shared<TableWrapper>(values_table);
+      table_wrapper->execute();
+
+      const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+      insert->set_transaction_context(transaction_context);
+      insert->execute();
+      Assert(!insert->execute_failed(), "Recovered insert violates a key of the table");
+
+      // Rows are inserted sequentially during recovery. Thus, the inserted rows are the last rows of the table.
+      auto remaining_rows = row_count;
+      auto chunk_id = table->chunk_count();
+      while (remaining_rows > 0) {
+        --chunk_id;
+        const auto chunk_size = table->get_chunk(chunk_id)->size();
+        const auto rows_in_chunk = std::min(chunk_size, remaining_rows);
+        remaining_rows -= rows_in_chunk;
+        for (auto row_offset = ChunkOffset{0}; row_offset < rows_in_chunk; ++row_offset) {
+          const auto logged_chunk_offset = ChunkOffset{begin_chunk_offset + remaining_rows + row_offset};
+          replayed_row_ids[row_key(logged_chunk_id, logged_chunk_offset)] =
+              RowID{chunk_id, ChunkOffset{chunk_size - rows_in_chunk + row_offset}};
+        }
+      }
+    } else if (entry_type == EntryType::Relocation) {
+      // The moved rows hold the same values as the old rows, which are still at their (translated) positions. Thus,
+      // nothing is modified, but later entries that refer to the new positions are translated to the old ones.
+      const auto row_count = reader.read<uint32_t>();
+      auto current_row_ids = std::vector<RowID>(row_count);
+      for (auto& current_row_id : current_row_ids) {
+        const auto chunk_id = ChunkID{reader.read<ChunkID::base_type>()};
+        const auto chunk_offset = ChunkOffset{reader.read<ChunkOffset::base_type>()};
+        const auto replayed_row_id_iter = replayed_row_ids.find(row_key(chunk_id, chunk_offset));
+        current_row_id =
+            replayed_row_id_iter != replayed_row_ids.end() ? replayed_row_id_iter->second : RowID{chunk_id, chunk_offset};
+      }
+
+      for (const auto& current_row_id : current_row_ids) {
+        const auto chunk_id = ChunkID{reader.read<ChunkID::base_type>()};
+        const auto chunk_offset = ChunkOffset{reader.read<ChunkOffset::base_type>()};
+        replayed_row_ids[row_key(chunk_id, chunk_offset)] = current_row_id;
+      }
+    } else {
+      Assert(entry_type == EntryType::Invalidation, "Unknown entry type in write-ahead log");
+
+      const auto row_count = reader.read<uint32_t>();
+      const auto pos_list = std::make_shared<RowIDPosList>();
+      pos_list->reserve(row_count);
+      for (auto row_index = uint32_t{0}; row_index < row_count; ++row_index) {
+        const auto chunk_id = ChunkID{reader.read<ChunkID::base_type>()};
+        const auto chunk_offset = ChunkOffset{reader.read<ChunkOffset::base_type>()};
+
+        // Rows that have not been inserted or moved since the last recovery are still at their logged positions
+        const auto replayed_row_id_iter = replayed_row_ids.find(row_key(chunk_id, chunk_offset));
+        pos_list->emplace_back(replayed_row_id_iter != replayed_row_ids.end() ? replayed_row_id_iter->second
+                                                                              : RowID{chunk_id, chunk_offset});
+      }
+
+      auto segments = Segments{};
+      const auto column_count = table->column_count();
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        segments.emplace_back(std::make_shared<ReferenceSegment>(table, column_id, pos_list));
+      }
+
+      const auto rows_to_delete = std::make_shared<Table>(table->column_definitions(), TableType::References);
+      rows_to_delete->append_chunk(segments);
+      const auto table_wrapper = std::make_shared<TableWrapper>(rows_to_delete);
+      table_wrapper->execute();
+
+      const auto delete_operator = std::make_shared<Delete>(table_name, table_wrapper);
+      delete_operator->set_transaction_context(transaction_context);
+      delete_operator->execute();
+      Assert(!delete_operator->execute_failed(), "Recovered invalidation conflicts with another transaction");
+    }
+  }
+
+  transaction_context->commit();
+}
+
+}  // namespace opossum
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractPosList;
+class Table;
+
+/**
+ * Changes of a committing transaction as they are written to the WriteAheadLog. The read/write operators add their
+ * modifications via AbstractReadWriteOperator::log_records() after their records have been committed.
+ *
+ * Inserted rows are logged with their values and their position in the table. Invalidated rows are only logged with
+ * their position. Rows that were moved without being modified (see ReplaceChunk) are logged with their old and their
+ * new position. During recovery, the positions are used to identify rows that have been inserted or moved before.
+ */
+class WriteAheadLogRecord {
+ public:
+  // Logs the values of the rows [begin_chunk_offset, end_chunk_offset) of the given chunk
+  void log_insert(const std::string& table_name, const Table& table, const ChunkID chunk_id,
+                  const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset);
+
+  // Logs that the rows of the table @param table_name are invalidated
+  void log_invalidation(const std::string& table_name, const AbstractPosList& row_ids);
+
+  // Logs that the rows at @param old_row_ids have been moved to @param new_row_ids
+  void log_relocation(const std::string& table_name, const AbstractPosList& old_row_ids,
+                      const AbstractPosList& new_row_ids);
+
+  bool empty() const;
+
+  // Payload of the log record, see write_ahead_log.cpp for the format
+  const std::string& data() const;
+
+ private:
+  std::string _data;
+};
+
+/**
+ * The write-ahead log (WAL) makes committed transactions durable. To enable it, load the tables, create the log, call
+ * recover(), and set Hyrise::write_ahead_log.
+ *
+ * When a transaction commits, its modifications are serialized into a WriteAheadLogRecord and appended to the log.
+ * The transaction only becomes visible (and commit() only returns) once the record has been written and synced to
+ * disk. Syncing is done by a dedicated thread: all records that arrive while a sync is in progress are written with
+ * the next sync (group commit). Thus, concurrent transactions share the costs of a sync. Optionally, the thread waits
+ * for group_commit_delay before each write to collect more records at the cost of latency.
+ *
+ * Recovery assumes that the tables are loaded (e.g., from the same binary files) in the same state as when the log was
+ * created, because positions of invalidated rows refer to the layout of the tables. Schema changes are not logged,
+ * i.e., tables created at runtime cannot be recovered. recover() replays the committed transactions in the order of
+ * the log, each within its own transaction. As rows are inserted sequentially during replay, they might end up at
+ * different positions than when they were logged. Therefore, the positions of inserted rows are translated for
+ * subsequent invalidations. Moved rows are not moved again during recovery; their new positions are translated to the
+ * positions of the old rows. Recovery is deterministic, so after a restart, the tables have the same layout as during
+ * the previous recovery. This is recorded in the log so that later positions are not translated again.
+ *
+ * Each record is stored with its size and a checksum. An incomplete record at the end of the log (e.g., after a
+ * crash during a write) belongs to a transaction that has not been reported as committed and is discarded.
+ */
+class WriteAheadLog : private Noncopyable {
+ public:
+  struct Statistics {
+    uint64_t commit_count{0};
+    uint64_t flush_count{0};
+    uint64_t written_bytes{0};
+    // Time between appending the records and their durability, summed up over all commits
+    std::chrono::nanoseconds accumulated_commit_latency{0};
+  };
+
+  explicit WriteAheadLog(const std::string& path,
+                         const std::chrono::microseconds group_commit_delay = std::chrono::microseconds{0});
+
+  // Writes the outstanding records before closing the log
+  ~WriteAheadLog();
+
+  // Replays the log. Has to be called once before commits are logged, and before any other transaction modifies the
+  // tables. Returns the number of replayed transactions.
+  uint64_t recover();
+
+  // Appends the record. on_durable is called from the log's thread once the record is synced to disk.
+  void append(const WriteAheadLogRecord& record, const std::function<void()>& on_durable);
+
+  Statistics statistics() const;
+
+ private:
+  void _flush_loop();
+
+  // Writes the data and waits until it is synced to disk
+  void _write(const std::string& data);
+
+  void _replay_commit(const std::string_view payload);
+
+  const std::string _path;
+  const std::chrono::microseconds _group_commit_delay;
+  int _file_descriptor;
+  bool _recovered{false};
+
+  // Positions of the rows inserted or moved since the last recovery, mapped to their positions during the current
+  // recovery.
+  // Only used during recover().
+  std::unordered_map<std::string, std::unordered_map<uint64_t, RowID>> _replayed_row_ids;
+
+  struct PendingCommit {
+    std::function<void()> on_durable;
+    std::chrono::steady_clock::time_point append_time;
+  };
+
+  mutable std::mutex _mutex;
+  std::condition_variable _pending_condition;
+  std::string _pending_data;
+  std::vector<PendingCommit> _pending_commits;
+  bool _shutdown{false};
+  Statistics _statistics;
+
+  std::thread _flush_thread;
+};
+
+}  // namespace opossum
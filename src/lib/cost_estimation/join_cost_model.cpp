@@ -0,0 +1,264 @@
+#include "join_cost_model.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+#include <magic_enum.hpp>
+
+#include "expression/abstract_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/operator_join_predicate.hpp"
+#include "statistics/abstract_cardinality_estimator.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Returns the stored table node that @param column_expression originates from if @param input is that node.
+std::shared_ptr<const StoredTableNode> originating_stored_table_node(
+    const std::shared_ptr<AbstractLQPNode>& input, const std::shared_ptr<AbstractExpression>& column_expression) {
+  if (input->type != LQPNodeType::StoredTable || column_expression->type != ExpressionType::LQPColumn) {
+    return nullptr;
+  }
+
+  const auto& lqp_column_expression = static_cast<const LQPColumnExpression&>(*column_expression);
+  if (lqp_column_expression.original_node.lock() != input) {
+    return nullptr;
+  }
+
+  return std::static_pointer_cast<const StoredTableNode>(input);
+}
+
+// Calls @param functor for each chunk of the stored table that is not pruned by the @param stored_table_node
+template <typename Functor>
+void for_each_unpruned_chunk(const StoredTableNode& stored_table_node, const Functor& functor) {
+  const auto table = Hyrise::get().storage_manager.get_table(stored_table_node.table_name);
+  const auto& pruned_chunk_ids = stored_table_node.pruned_chunk_ids();
+
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    if (!chunk || std::find(pruned_chunk_ids.cbegin(), pruned_chunk_ids.cend(), chunk_id) != pruned_chunk_ids.cend()) {
+      continue;
+    }
+    functor(*chunk);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+JoinCostModel::JoinCostModel(const std::shared_ptr<AbstractCardinalityEstimator>& init_cardinality_estimator)
+    : cardinality_estimator(init_cardinality_estimator) {}
+
+std::vector<JoinCostModel::JoinCostEstimate> JoinCostModel::estimate_join_costs(
+    const std::shared_ptr<JoinNode>& join_node, const OperatorJoinPredicate& primary_predicate,
+    const bool has_secondary_predicates) const {
+  const auto& left_input = join_node->left_input();
+  const auto& right_input = join_node->right_input();
+
+  const auto left_column_id = primary_predicate.column_ids.first;
+  const auto right_column_id = primary_predicate.column_ids.second;
+
+  const auto left_input_properties = input_properties(left_input, left_column_id);
+  const auto right_input_properties = input_properties(right_input, right_column_id);
+
+  const auto configuration =
+      JoinConfiguration{join_node->join_mode,
+                        primary_predicate.predicate_condition,
+                        left_input->output_expressions()[left_column_id]->data_type(),
+                        right_input->output_expressions()[right_column_id]->data_type(),
+                        has_secondary_predicates,
+                        left_input_properties.table_type,
+                        right_input_properties.table_type};
+
+  return estimate_join_costs(configuration, left_input_properties, right_input_properties,
+                             cardinality_estimator->estimate_cardinality(join_node));
+}
+
+std::vector<JoinCostModel::JoinCostEstimate> JoinCostModel::estimate_join_costs(const JoinConfiguration& configuration,
+                                                                                const InputProperties& left_input,
+                                                                                const InputProperties& right_input,
+                                                                                const Cardinality output_row_count) {
+  auto estimates = std::vector<JoinCostEstimate>{};
+
+  const auto left_row_count = left_input.row_count;
+  const auto right_row_count = right_input.row_count;
+  const auto output_cost = output_row_count * OUTPUT_COST;
+
+  if (JoinHash::supports(configuration)) {
+    // Mirrors the choice of the build side in JoinHash::_on_execute
+    const auto build_left_input = configuration.join_mode == JoinMode::Right ||
+                                  (configuration.join_mode == JoinMode::Inner && left_row_count <= right_row_count);
+    const auto build_row_count = build_left_input ? left_row_count : right_row_count;
+    const auto probe_row_count = build_left_input ? right_row_count : left_row_count;
+
+    auto cost = build_row_count * HASH_BUILD_COST + probe_row_count * HASH_PROBE_COST + output_cost;
+    if (build_row_count > HASH_CACHE_RESIDENT_ROW_COUNT) {
+      cost += (build_row_count + probe_row_count) * HASH_PARTITION_COST;
+    }
+    estimates.push_back({OperatorType::JoinHash, cost, std::nullopt});
+  }
+
+  if (JoinSortMerge::supports(configuration)) {
+    const auto sort_cost = [](const InputProperties& input) {
+      // Sorting n tuples requires about n * log2(n) comparisons. If the input consists of k sorted runs, about
+      // n * log2(k) comparisons are left. A single sorted run still has to be checked once.
+      const auto sort_unit_count =
+          input.sorted_run_count ? static_cast<Cardinality>(*input.sorted_run_count) + 1.0f : input.row_count;
+      return input.row_count * std::log2(std::max(sort_unit_count, 2.0f)) * SORT_MERGE_COMPARE_COST;
+    };
+
+    const auto cost = (left_row_count + right_row_count) * (SORT_MERGE_MATERIALIZE_COST + SORT_MERGE_MERGE_COST) +
+                      sort_cost(left_input) + sort_cost(right_input) + output_cost;
+    estimates.push_back({OperatorType::JoinSortMerge, cost, std::nullopt});
+  }
+
+  // Every tuple of the probe side is looked up in the index of every chunk of the index side
+  for (const auto index_side : {IndexSide::Left, IndexSide::Right}) {
+    const auto& index_input = index_side == IndexSide::Left ? left_input : right_input;
+    const auto& probe_input = index_side == IndexSide::Left ? right_input : left_input;
+    if (!index_input.indexed_chunk_count || configuration.left_data_type != configuration.right_data_type) {
+      continue;
+    }
+
+    auto index_configuration = configuration;
+    index_configuration.index_side = index_side;
+    if (!JoinIndex::supports(index_configuration)) {
+      continue;
+    }
+
+    const auto indexed_chunk_count = static_cast<Cardinality>(*index_input.indexed_chunk_count);
+    auto cost = probe_input.row_count * indexed_chunk_count * INDEX_LOOKUP_COST + output_cost;
+    if (index_input.table_type == TableType::References) {
+      // The indexes cover the referenced data chunks. The positions of each reference chunk are sorted once, and every
+      // index match is searched in them to filter the rows that are not part of the input.
+      const auto rows_per_chunk = index_input.row_count / std::max(indexed_chunk_count, 1.0f);
+      cost += (index_input.row_count + output_row_count) * std::log2(std::max(rows_per_chunk, 2.0f)) *
+              INDEX_REFERENCE_FILTER_COST;
+    }
+    estimates.push_back({OperatorType::JoinIndex, cost, index_side});
+  }
+
+  if (estimates.empty()) {
+    DebugAssert(JoinNestedLoop::supports(configuration), "JoinNestedLoop should support every join");
+    const auto cost = left_row_count * right_row_count * NESTED_LOOP_PAIR_COST + output_cost;
+    estimates.push_back({OperatorType::JoinNestedLoop, cost, std::nullopt});
+  }
+
+  std::stable_sort(estimates.begin(), estimates.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.cost < rhs.cost; });
+
+  return estimates;
+}
+
+JoinCostModel::InputProperties JoinCostModel::input_properties(const std::shared_ptr<AbstractLQPNode>& input,
+                                                               const ColumnID column_id) const {
+  const auto& column_expression = input->output_expressions()[column_id];
+
+  auto properties = InputProperties{};
+  properties.row_count = cardinality_estimator->estimate_cardinality(input);
+  properties.sorted_run_count = _sorted_run_count(input, column_expression);
+  properties.indexed_chunk_count = _indexed_chunk_count(input, column_expression);
+  properties.table_type = input->type == LQPNodeType::StoredTable ? TableType::Data : TableType::References;
+  return properties;
+}
+
+std::string JoinCostModel::estimates_to_string(const std::vector<JoinCostEstimate>& estimates) {
+  auto stream = std::stringstream{};
+  stream << "Estimated cost: " << std::fixed << std::setprecision(0);
+  for (auto estimate_iter = estimates.cbegin(); estimate_iter != estimates.cend(); ++estimate_iter) {
+    if (estimate_iter != estimates.cbegin()) {
+      stream << ", ";
+    }
+    stream << magic_enum::enum_name(estimate_iter->join_type);
+    if (estimate_iter->index_side) {
+      stream << (*estimate_iter->index_side == IndexSide::Left ? " (index left)" : " (index right)");
+    }
+    stream << " " << estimate_iter->cost;
+  }
+  return stream.str();
+}
+
+std::optional<size_t> JoinCostModel::_sorted_run_count(const std::shared_ptr<AbstractLQPNode>& input,
+                                                       const std::shared_ptr<AbstractExpression>& column_expression) {
+  // Operators that filter or forward their input keep the order of the values within each chunk (see, e.g.,
+  // TableScan and Validate, which forward individually_sorted_by)
+  auto node = input;
+  while (node->type == LQPNodeType::Predicate || node->type == LQPNodeType::Validate ||
+         node->type == LQPNodeType::Projection || node->type == LQPNodeType::Alias ||
+         node->type == LQPNodeType::Limit) {
+    node = node->left_input();
+  }
+
+  if (node->type == LQPNodeType::Sort) {
+    const auto& sort_node = static_cast<const SortNode&>(*node);
+    if (*sort_node.node_expressions.front() == *column_expression &&
+        sort_node.sort_modes.front() == SortMode::Ascending) {
+      return 1;
+    }
+    return std::nullopt;
+  }
+
+  const auto stored_table_node = originating_stored_table_node(node, column_expression);
+  if (!stored_table_node) {
+    return std::nullopt;
+  }
+
+  const auto sort_definition =
+      SortColumnDefinition{static_cast<const LQPColumnExpression&>(*column_expression).original_column_id};
+
+  auto run_count = size_t{0};
+  auto all_chunks_sorted = true;
+  for_each_unpruned_chunk(*stored_table_node, [&](const Chunk& chunk) {
+    const auto& sorted_by = chunk.individually_sorted_by();
+    all_chunks_sorted =
+        all_chunks_sorted && std::find(sorted_by.cbegin(), sorted_by.cend(), sort_definition) != sorted_by.cend();
+    ++run_count;
+  });
+
+  if (!all_chunks_sorted) {
+    return std::nullopt;
+  }
+  return run_count;
+}
+
+std::optional<size_t> JoinCostModel::_indexed_chunk_count(
+    const std::shared_ptr<AbstractLQPNode>& input, const std::shared_ptr<AbstractExpression>& column_expression) {
+  // JoinIndex uses the chunk indexes of a stored table. Validate forwards them, as its output references a single
+  // chunk per output chunk.
+  const auto node = input->type == LQPNodeType::Validate ? input->left_input() : input;
+  const auto stored_table_node = originating_stored_table_node(node, column_expression);
+  if (!stored_table_node) {
+    return std::nullopt;
+  }
+
+  const auto column_id = static_cast<const LQPColumnExpression&>(*column_expression).original_column_id;
+
+  auto indexed_chunk_count = size_t{0};
+  auto all_chunks_indexed = true;
+  for_each_unpruned_chunk(*stored_table_node, [&](const Chunk& chunk) {
+    all_chunks_indexed = all_chunks_indexed && !chunk.get_indexes(std::vector<ColumnID>{column_id}).empty();
+    ++indexed_chunk_count;
+  });
+
+  if (!all_chunks_indexed) {
+    return std::nullopt;
+  }
+  return indexed_chunk_count;
+}
+
+}  // namespace opossum
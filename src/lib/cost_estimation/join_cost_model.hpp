@@ -0,0 +1,122 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "operators/abstract_join_operator.hpp"
+#include "operators/abstract_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractCardinalityEstimator;
+class AbstractExpression;
+class AbstractLQPNode;
+class JoinNode;
+struct OperatorJoinPredicate;
+
+/**
+ * Physical cost model used by the LQPTranslator to choose the join operator for a JoinNode. Different from the
+ * CostEstimatorLogical, which compares logical plans, it compares the join algorithms for a given plan. The costs are
+ * in abstract units that roughly correspond to nanoseconds per processed tuple.
+ *
+ * Beyond the cardinalities of the inputs, the model considers physical properties of the inputs:
+ *  - JoinHash builds a hash table for one input and probes it with the other one. For inner joins, the smaller input
+ *    becomes the build side, for outer, semi, and anti joins, the side is fixed (see JoinHash::_on_execute). Large
+ *    build sides do not fit into the cache and are radix partitioned first.
+ *  - JoinSortMerge sorts both inputs. If an input consists of sorted runs (chunks that are individually sorted by the
+ *    join column or the output of a Sort), sorting is cheaper, as pdqsort degrades gracefully to linear time for
+ *    presorted data.
+ *  - JoinIndex probes the chunk indexes of one input (the index side) for every tuple of the other one. It is only
+ *    possible if every chunk of a stored table has an index on the join column. If the index side is validated, the
+ *    index matches additionally have to be filtered by the positions of the Validate output.
+ *  - JoinNestedLoop is quadratic. As cardinality estimation errors easily make it explode, it is only chosen if no
+ *    other operator supports the join.
+ *
+ * The coefficients below are relative per-tuple costs. They should be recalibrated with the join micro-benchmarks in
+ * src/benchmark/operators/join_benchmark.cpp when the operators change: Run the JoinHash and JoinSortMerge cases for
+ * unsorted and presorted inputs and the JoinIndex cases with a small probe side, and fit the coefficients to the
+ * measured runtime per input tuple.
+ */
+class JoinCostModel {
+ public:
+  static constexpr auto HASH_BUILD_COST = Cost{10.0f};
+  static constexpr auto HASH_PROBE_COST = Cost{5.0f};
+  static constexpr auto HASH_PARTITION_COST = Cost{5.0f};
+  // Number of build side rows up to which the hash table fits into the cache and no radix partitioning is needed.
+  // Derived from the L2 cache size assumed in JoinHash::calculate_radix_bits.
+  static constexpr auto HASH_CACHE_RESIDENT_ROW_COUNT = Cardinality{150'000.0f};
+
+  static constexpr auto SORT_MERGE_MATERIALIZE_COST = Cost{4.0f};
+  static constexpr auto SORT_MERGE_MERGE_COST = Cost{3.0f};
+  // Per comparison, i.e., per tuple and log2 of the number of tuples (or sorted runs) to sort
+  static constexpr auto SORT_MERGE_COMPARE_COST = Cost{1.0f};
+
+  // Per lookup of a probe tuple in the index of a chunk
+  static constexpr auto INDEX_LOOKUP_COST = Cost{20.0f};
+  // Per comparison when filtering the index matches by the positions of a reference input, see
+  // JoinIndex::_reference_join_two_segments_using_index
+  static constexpr auto INDEX_REFERENCE_FILTER_COST = Cost{1.0f};
+
+  static constexpr auto NESTED_LOOP_PAIR_COST = Cost{1.0f};
+
+  static constexpr auto OUTPUT_COST = Cost{1.0f};
+
+  // Physical properties of a join input that are relevant for the join algorithms
+  struct InputProperties {
+    Cardinality row_count{0.0f};
+
+    // Number of runs in which the input is sorted ascendingly by the join column (e.g., the number of chunks if each
+    // chunk is individually sorted). std::nullopt if the input is not known to be sorted.
+    std::optional<size_t> sorted_run_count;
+
+    // Number of chunks with an index on the join column if the input is a stored table (possibly validated) of which
+    // every chunk has such an index. std::nullopt otherwise.
+    std::optional<size_t> indexed_chunk_count;
+
+    TableType table_type{TableType::References};
+  };
+
+  struct JoinCostEstimate {
+    OperatorType join_type;
+    Cost cost;
+    // Only for JoinIndex
+    std::optional<IndexSide> index_side;
+  };
+
+  explicit JoinCostModel(const std::shared_ptr<AbstractCardinalityEstimator>& init_cardinality_estimator);
+
+  /**
+   * @return the estimates for all join operators that support the join with @param primary_predicate as the primary
+   *         predicate, cheapest first. JoinNestedLoop is only part of the result if no other operator supports it.
+   */
+  std::vector<JoinCostEstimate> estimate_join_costs(const std::shared_ptr<JoinNode>& join_node,
+                                                    const OperatorJoinPredicate& primary_predicate,
+                                                    const bool has_secondary_predicates) const;
+
+  /**
+   * The model itself, independent from an LQP
+   */
+  static std::vector<JoinCostEstimate> estimate_join_costs(const JoinConfiguration& configuration,
+                                                           const InputProperties& left_input,
+                                                           const InputProperties& right_input,
+                                                           const Cardinality output_row_count);
+
+  // Derives the properties of @param input with respect to the @param column_id of its output
+  InputProperties input_properties(const std::shared_ptr<AbstractLQPNode>& input, const ColumnID column_id) const;
+
+  // Human-readable summary of @param estimates, e.g., for the description of the chosen operator
+  static std::string estimates_to_string(const std::vector<JoinCostEstimate>& estimates);
+
+  const std::shared_ptr<AbstractCardinalityEstimator> cardinality_estimator;
+
+ private:
+  static std::optional<size_t> _sorted_run_count(const std::shared_ptr<AbstractLQPNode>& input,
+                                                  const std::shared_ptr<AbstractExpression>& column_expression);
+  static std::optional<size_t> _indexed_chunk_count(const std::shared_ptr<AbstractLQPNode>& input,
+                                                    const std::shared_ptr<AbstractExpression>& column_expression);
+};
+
+}  // namespace opossum
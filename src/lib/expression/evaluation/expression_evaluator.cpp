@@ -31,6 +31,7 @@
 #include "operators/abstract_operator.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
@@ -134,19 +135,99 @@ std::shared_ptr<AbstractExpression> rewrite_in_list_expression(const InExpressio
   return rewritten_expression;
 }
 
+// Subqueries are evaluated for the entire Chunk, as correlated subqueries are executed for each row (see
+// _evaluate_subquery_expression_for_row) and uncorrelated ones should only be executed once.
+bool contains_subquery(const AbstractExpression& expression) {
+  if (expression.type == ExpressionType::PQPSubquery) {
+    return true;
+  }
+  return std::any_of(expression.arguments.cbegin(), expression.arguments.cend(),
+                     [](const auto& argument) { return contains_subquery(*argument); });
+}
+
 }  // namespace
 
 namespace opossum {
 
 ExpressionEvaluator::ExpressionEvaluator(
     const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
-    const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results)
+    const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results,
+    const EvaluationMode evaluation_mode)
     : _table(table),
       _chunk(_table->get_chunk(chunk_id)),
       _chunk_id(chunk_id),
+      _evaluation_mode(evaluation_mode),
       _uncorrelated_subquery_results(uncorrelated_subquery_results) {
   _output_row_count = _chunk->size();
   _segment_materializations.resize(_chunk->column_count());
+  _chunk_segment_materializations.resize(_chunk->column_count());
+}
+
+void ExpressionEvaluator::set_chunk(const ChunkID chunk_id) {
+  Assert(_table, "Cannot set the Chunk of an evaluator that does not operate on a Table");
+
+  _chunk = _table->get_chunk(chunk_id);
+  Assert(_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+  _chunk_id = chunk_id;
+  std::fill(_chunk_segment_materializations.begin(), _chunk_segment_materializations.end(), nullptr);
+  _start_vector(ChunkOffset{0}, _chunk->size());
+}
+
+template <typename Functor>
+void ExpressionEvaluator::_for_each_vector(const std::vector<const AbstractExpression*>& expressions,
+                                           const Functor& fn) {
+  // If the Chunk fits into a single vector, the current state of the evaluator (i.e., all rows of the Chunk) is used
+  if (!_chunk || _evaluation_mode == EvaluationMode::Chunk || _chunk->size() <= VECTOR_SIZE ||
+      std::any_of(expressions.cbegin(), expressions.cend(),
+                  [](const auto* expression) { return contains_subquery(*expression); })) {
+    fn();
+    return;
+  }
+
+  const auto chunk_size = _chunk->size();
+  for (auto vector_begin = ChunkOffset{0}; vector_begin < chunk_size; vector_begin += VECTOR_SIZE) {
+    _start_vector(vector_begin, std::min(VECTOR_SIZE, static_cast<ChunkOffset>(chunk_size - vector_begin)));
+    fn();
+  }
+
+  // Outside of _for_each_vector(), the evaluator covers the entire Chunk
+  _start_vector(ChunkOffset{0}, chunk_size);
+}
+
+void ExpressionEvaluator::_start_vector(const ChunkOffset vector_begin, const ChunkOffset vector_size) {
+  _vector_begin = vector_begin;
+  _output_row_count = vector_size;
+
+  // Buffers that were not reused for the previous vector are released, so that the pool does not grow if some
+  // results are not created via _make_result()
+  for (auto& [type, results] : _result_pool) {
+    results.clear();
+  }
+
+  // Segment materializations are part of the cache as well
+  std::fill(_segment_materializations.begin(), _segment_materializations.end(), nullptr);
+
+  for (auto& [expression, result] : _cached_expression_results) {
+    // Results that are still referenced by a caller of evaluate_expression_to_result() cannot be reused
+    if (result.use_count() == 1) {
+      _result_pool[typeid(*result)].emplace_back(std::move(result));
+    }
+  }
+  _cached_expression_results.clear();
+}
+
+template <typename Result>
+std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_make_result() {
+  auto& pooled_results = _result_pool[typeid(ExpressionResult<Result>)];
+  if (pooled_results.empty()) {
+    return std::make_shared<ExpressionResult<Result>>();
+  }
+
+  auto result = std::static_pointer_cast<ExpressionResult<Result>>(std::move(pooled_results.back()));
+  pooled_results.pop_back();
+  result->values.clear();
+  result->nulls.clear();
+  return result;
 }
 
 template <typename Result>
@@ -344,7 +425,8 @@ ExpressionEvaluator::_evaluate_like_expression<ExpressionEvaluator::Bool>(const
     }
   }
 
-  auto result_nulls = _evaluate_default_null_logic(left_results->nulls, right_results->nulls);
+  auto result_nulls = pmr_vector<bool>{};
+  _evaluate_default_null_logic(left_results->nulls, right_results->nulls, result_nulls);
 
   return std::make_shared<ExpressionResult<ExpressionEvaluator::Bool>>(std::move(result_values),
                                                                        std::move(result_nulls));
@@ -642,8 +724,9 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_case_ex
     const CaseExpression& case_expression) {
   const auto when = evaluate_expression_to_result<ExpressionEvaluator::Bool>(*case_expression.when());
 
-  pmr_vector<Result> values;
-  pmr_vector<bool> nulls;
+  auto result = _make_result<Result>();
+  auto& values = result->values;
+  auto& nulls = result->nulls;
 
   _resolve_to_expression_results(
       *case_expression.then(), *case_expression.otherwise(), [&](const auto& then_result, const auto& else_result) {
@@ -670,7 +753,7 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_case_ex
         }
       });
 
-  return std::make_shared<ExpressionResult<Result>>(std::move(values), std::move(nulls));
+  return result;
 }
 
 template <typename Result>
@@ -691,8 +774,8 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_cast_ex
    *    NULL -> Any type                    A nulled value of the requested type is returned.
    */
 
-  auto values = pmr_vector<Result>{};
-  auto nulls = pmr_vector<bool>{};
+  auto result = _make_result<Result>();
+  auto& values = result->values;
 
   _resolve_to_expression_result(*cast_expression.argument(), [&](const auto& argument_result) {
     argument_result.as_view([&](const auto& argument_result_view) {
@@ -711,11 +794,11 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_cast_ex
           }
         }
       }
-      nulls = argument_result.nulls;
+      result->nulls.assign(argument_result.nulls.begin(), argument_result.nulls.end());
     });
   });
 
-  return std::make_shared<ExpressionResult<Result>>(std::move(values), std::move(nulls));
+  return result;
 }
 
 template <>
@@ -852,8 +935,8 @@ std::shared_ptr<ExpressionResult<pmr_string>> ExpressionEvaluator::_evaluate_ext
 template <typename Result>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_unary_minus_expression(
     const UnaryMinusExpression& unary_minus_expression) {
-  pmr_vector<Result> values;
-  pmr_vector<bool> nulls;
+  auto result = _make_result<Result>();
+  auto& values = result->values;
 
   _resolve_to_expression_result(*unary_minus_expression.argument(), [&](const auto& argument_result) {
     using ArgumentType = typename std::decay_t<decltype(argument_result)>::Type;
@@ -865,13 +948,13 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_unary_m
         // NOTE: Actual negation happens in this line
         values[chunk_offset] = -argument_result.values[chunk_offset];
       }
-      nulls = argument_result.nulls;
+      result->nulls.assign(argument_result.nulls.begin(), argument_result.nulls.end());
     } else {
       Fail("Can't negate a Strings, can't negate an argument to a different type");
     }
   });
 
-  return std::make_shared<ExpressionResult<Result>>(std::move(values), std::move(nulls));
+  return result;
 }
 
 template <typename Result>
@@ -987,39 +1070,100 @@ std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_subquery_expression_
 
 std::shared_ptr<BaseValueSegment> ExpressionEvaluator::evaluate_expression_to_segment(
     const AbstractExpression& expression) {
-  std::shared_ptr<BaseValueSegment> segment;
-  pmr_vector<bool> nulls;
+  return _evaluate_expressions_to_segments({&expression}).front();
+}
 
-  _resolve_to_expression_result_view(expression, [&](const auto& view) {
-    using ColumnDataType = typename std::decay_t<decltype(view)>::Type;
+std::vector<std::shared_ptr<BaseValueSegment>> ExpressionEvaluator::evaluate_expressions_to_segments(
+    const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+  auto expression_ptrs = std::vector<const AbstractExpression*>{};
+  expression_ptrs.reserve(expressions.size());
+  for (const auto& expression : expressions) {
+    expression_ptrs.emplace_back(expression.get());
+  }
+  return _evaluate_expressions_to_segments(expression_ptrs);
+}
 
-    if constexpr (std::is_same_v<ColumnDataType, NullValue>) {
-      Fail("Can't create a Segment from a NULL");
-    } else {
-      pmr_vector<ColumnDataType> values(_output_row_count);
+std::vector<std::shared_ptr<BaseValueSegment>> ExpressionEvaluator::_evaluate_expressions_to_segments(
+    const std::vector<const AbstractExpression*>& expressions) {
+  const auto expression_count = expressions.size();
+  for (const auto* expression : expressions) {
+    Assert(expression->data_type() != DataType::Null, "Can't create a Segment from a NULL");
+  }
 
-      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(_output_row_count);
-           ++chunk_offset) {
-        values[chunk_offset] = std::move(view.value(chunk_offset));
-      }
+  // The values and NULLs of each expression for all rows, filled one vector after the other
+  const auto row_count = _output_row_count;
+  auto outputs = std::vector<std::shared_ptr<BaseExpressionResult>>(expression_count);
+  auto output_is_nullable = std::vector<bool>(expression_count);
 
-      if (view.is_nullable()) {
-        nulls.resize(_output_row_count);
-        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(_output_row_count);
-             ++chunk_offset) {
-          nulls[chunk_offset] = view.is_null(chunk_offset);
+  _for_each_vector(expressions, [&]() {
+    for (auto expression_idx = size_t{0}; expression_idx < expression_count; ++expression_idx) {
+      const auto& expression = *expressions[expression_idx];
+
+      resolve_data_type(expression.data_type(), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        if (!outputs[expression_idx]) {
+          outputs[expression_idx] =
+              std::make_shared<ExpressionResult<ColumnDataType>>(pmr_vector<ColumnDataType>(row_count));
         }
-        segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(nulls));
+        auto& output = static_cast<ExpressionResult<ColumnDataType>&>(*outputs[expression_idx]);
+
+        evaluate_expression_to_result<ColumnDataType>(expression)->as_view([&](const auto& view) {
+          for (auto row_idx = ChunkOffset{0}; row_idx < static_cast<ChunkOffset>(_output_row_count); ++row_idx) {
+            output.values[_vector_begin + row_idx] = std::move(view.value(row_idx));
+          }
+
+          // NULLs are only materialized if the result of any vector is nullable
+          if (view.is_nullable()) {
+            output_is_nullable[expression_idx] = true;
+            output.nulls.resize(row_count);
+            for (auto row_idx = ChunkOffset{0}; row_idx < static_cast<ChunkOffset>(_output_row_count); ++row_idx) {
+              output.nulls[_vector_begin + row_idx] = view.is_null(row_idx);
+            }
+          }
+        });
+      });
+    }
+  });
+
+  auto segments = std::vector<std::shared_ptr<BaseValueSegment>>(expression_count);
+  for (auto expression_idx = size_t{0}; expression_idx < expression_count; ++expression_idx) {
+    resolve_data_type(expressions[expression_idx]->data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      auto& output = static_cast<ExpressionResult<ColumnDataType>&>(*outputs[expression_idx]);
+
+      if (output_is_nullable[expression_idx]) {
+        segments[expression_idx] =
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(output.values), std::move(output.nulls));
       } else {
-        segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+        segments[expression_idx] = std::make_shared<ValueSegment<ColumnDataType>>(std::move(output.values));
       }
+    });
+  }
+
+  return segments;
+}
+
+RowIDPosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpression& expression) {
+  auto result_pos_list = RowIDPosList{};
+
+  _for_each_vector({&expression}, [&]() {
+    auto vector_pos_list = _evaluate_expression_to_pos_list(expression);
+    if (_vector_begin == 0) {
+      result_pos_list = std::move(vector_pos_list);
+      return;
+    }
+
+    result_pos_list.reserve(result_pos_list.size() + vector_pos_list.size());
+    for (const auto& row_id : vector_pos_list) {
+      result_pos_list.emplace_back(RowID{_chunk_id, static_cast<ChunkOffset>(_vector_begin + row_id.chunk_offset)});
     }
   });
 
-  return segment;
+  return result_pos_list;
 }
 
-RowIDPosList ExpressionEvaluator::evaluate_expression_to_pos_list(const AbstractExpression& expression) {
+RowIDPosList ExpressionEvaluator::_evaluate_expression_to_pos_list(const AbstractExpression& expression) {
   /**
    * Only Expressions returning a Bool can be evaluated to a PosList of matches.
    *
@@ -1063,9 +1207,11 @@ RowIDPosList ExpressionEvaluator::evaluate_expression_to_pos_list(const Abstract
 
               if constexpr (ExpressionFunctorType::template supports<ExpressionEvaluator::Bool, LeftDataType,
                                                                      RightDataType>::value) {
+                // Skip the per-row NULL checks if both operands are non-nullable
+                const auto check_nulls = left_result.is_nullable() || right_result.is_nullable();
                 for (auto chunk_offset = ChunkOffset{0}; chunk_offset < static_cast<ChunkOffset>(_output_row_count);
                      ++chunk_offset) {
-                  if (left_result.is_null(chunk_offset) || right_result.is_null(chunk_offset)) {
+                  if (check_nulls && (left_result.is_null(chunk_offset) || right_result.is_null(chunk_offset))) {
                     continue;
                   }
 
@@ -1087,7 +1233,7 @@ RowIDPosList ExpressionEvaluator::evaluate_expression_to_pos_list(const Abstract
         case PredicateCondition::BetweenLowerExclusive:
         case PredicateCondition::BetweenUpperExclusive:
         case PredicateCondition::BetweenExclusive:
-          return evaluate_expression_to_pos_list(*rewrite_between_expression(expression));
+          return _evaluate_expression_to_pos_list(*rewrite_between_expression(expression));
 
         case PredicateCondition::IsNull:
         case PredicateCondition::IsNotNull: {
@@ -1138,8 +1284,44 @@ RowIDPosList ExpressionEvaluator::evaluate_expression_to_pos_list(const Abstract
     case ExpressionType::Logical: {
       const auto& logical_expression = static_cast<const LogicalExpression&>(expression);
 
-      const auto left_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[0]);
-      const auto right_pos_list = evaluate_expression_to_pos_list(*logical_expression.arguments[1]);
+      const auto left_pos_list = _evaluate_expression_to_pos_list(*logical_expression.arguments[0]);
+      const auto right_pos_list = _evaluate_expression_to_pos_list(*logical_expression.arguments[1]);
+
+      // If the positions cover a significant share of the rows, they are combined as bitmaps, i.e., with a bitwise
+      // AND/OR instead of a merge of the sorted lists.
+      if (BitmapPosList::is_more_compact(left_pos_list.size() + right_pos_list.size(), _output_row_count)) {
+        constexpr auto BITS_PER_WORD = BitmapPosList::BITS_PER_WORD;
+        const auto word_count = BitmapPosList::word_count(_output_row_count);
+
+        const auto to_bitmap = [&](const RowIDPosList& pos_list) {
+          auto bitmap = BitmapPosList::Bitmap(word_count);
+          for (const auto& row_id : pos_list) {
+            const auto offset = static_cast<size_t>(row_id.chunk_offset);
+            bitmap[offset / BITS_PER_WORD] |= uint64_t{1} << (offset % BITS_PER_WORD);
+          }
+          return bitmap;
+        };
+
+        auto bitmap = to_bitmap(left_pos_list);
+        const auto right_bitmap = to_bitmap(right_pos_list);
+        for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+          if (logical_expression.logical_operator == LogicalOperator::And) {
+            bitmap[word_index] &= right_bitmap[word_index];
+          } else {
+            bitmap[word_index] |= right_bitmap[word_index];
+          }
+        }
+
+        for (auto word_index = size_t{0}; word_index < word_count; ++word_index) {
+          auto word = bitmap[word_index];
+          while (word) {
+            const auto offset = word_index * BITS_PER_WORD + static_cast<size_t>(__builtin_ctzll(word));
+            result_pos_list.emplace_back(RowID{_chunk_id, static_cast<ChunkOffset>(offset)});
+            word &= word - 1;
+          }
+        }
+        break;
+      }
 
       switch (logical_expression.logical_operator) {
         case LogicalOperator::And:
@@ -1226,8 +1408,8 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_logical
 template <typename Result, typename Functor>
 std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_binary_with_default_null_logic(
     const AbstractExpression& left_expression, const AbstractExpression& right_expression) {
-  pmr_vector<Result> values;
-  pmr_vector<bool> nulls;
+  auto result = _make_result<Result>();
+  auto& values = result->values;
 
   _resolve_to_expression_results(left_expression, right_expression, [&](const auto& left, const auto& right) {
     using LeftDataType = typename std::decay_t<decltype(left)>::Type;
@@ -1236,7 +1418,7 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_binary_
     if constexpr (Functor::template supports<Result, LeftDataType, RightDataType>::value) {
       const auto result_size = _result_size(left.size(), right.size());
       values.resize(result_size);
-      nulls = _evaluate_default_null_logic(left.nulls, right.nulls);
+      _evaluate_default_null_logic(left.nulls, right.nulls, result->nulls);
 
       // Using three different branches instead of views, which would generate 9 cases.
       if (left.is_literal() == right.is_literal()) {
@@ -1257,7 +1439,7 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_binary_
     }
   });
 
-  return std::make_shared<ExpressionResult<Result>>(std::move(values), std::move(nulls));
+  return result;
 }
 
 template <typename Result, typename Functor>
@@ -1272,8 +1454,11 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_binary_
     if constexpr (Functor::template supports<Result, LeftDataType, RightDataType>::value) {
       const auto result_row_count = _result_size(left.size(), right.size());
 
-      pmr_vector<bool> nulls(result_row_count);
-      pmr_vector<Result> values(result_row_count);
+      result = _make_result<Result>();
+      auto& values = result->values;
+      auto& nulls = result->nulls;
+      values.resize(result_row_count);
+      nulls.resize(result_row_count);
 
       for (auto row_idx = ChunkOffset{0}; row_idx < result_row_count; ++row_idx) {
         bool null;
@@ -1282,8 +1467,6 @@ std::shared_ptr<ExpressionResult<Result>> ExpressionEvaluator::_evaluate_binary_
         nulls[row_idx] = null;
       }
 
-      result = std::make_shared<ExpressionResult<Result>>(std::move(values), std::move(nulls));
-
     } else {
       Fail("BinaryOperation not supported on the requested DataTypes");
     }
@@ -1359,29 +1542,29 @@ ChunkOffset ExpressionEvaluator::_result_size(const RowCounts... row_counts) {
   return static_cast<ChunkOffset>(std::max({row_counts...}));
 }
 
-pmr_vector<bool> ExpressionEvaluator::_evaluate_default_null_logic(const pmr_vector<bool>& left,
-                                                                   const pmr_vector<bool>& right) {
+void ExpressionEvaluator::_evaluate_default_null_logic(const pmr_vector<bool>& left, const pmr_vector<bool>& right,
+                                                       pmr_vector<bool>& nulls) {
   if (left.size() == right.size()) {
-    pmr_vector<bool> nulls(left.size());
+    // Both operands are non-nullable if they are empty, so that nothing has to be done
+    nulls.resize(left.size());
     std::transform(left.begin(), left.end(), right.begin(), nulls.begin(), [](auto l, auto r) { return l || r; });
-    return nulls;
   } else if (left.size() > right.size()) {
     DebugAssert(right.size() <= 1,
                 "Operand should have either the same row count as the other, 1 row (to represent a literal), or no "
                 "rows (to represent a non-nullable operand)");
     if (!right.empty() && right.front()) {
-      return pmr_vector<bool>({true});
+      nulls.assign(1, true);
     } else {
-      return left;
+      nulls.assign(left.begin(), left.end());
     }
   } else {
     DebugAssert(left.size() <= 1,
                 "Operand should have either the same row count as the other, 1 row (to represent a literal), or no "
                 "rows (to represent a non-nullable operand)");
     if (!left.empty() && left.front()) {
-      return pmr_vector<bool>({true});
+      nulls.assign(1, true);
     } else {
-      return right;
+      nulls.assign(right.begin(), right.end());
     }
   }
 }
@@ -1394,48 +1577,68 @@ void ExpressionEvaluator::_materialize_segment_if_not_yet_materialized(const Col
   }
 
   const auto& segment = *_chunk->get_segment(column_id);
+  const auto is_nullable = _table->column_is_nullable(column_id);
+
+  // Only the rows of the current vector are materialized
+  const auto begin_offset = static_cast<size_t>(_vector_begin);
+  const auto end_offset = begin_offset + _output_row_count;
 
   resolve_data_type(segment.data_type(), [&](const auto column_data_type_t) {
     using ColumnDataType = typename decltype(column_data_type_t)::type;
 
-    pmr_vector<ColumnDataType> values;
-    pmr_vector<bool> nulls;
+    auto result = _make_result<ColumnDataType>();
+    auto& values = result->values;
+    auto& nulls = result->nulls;
 
     if (const auto value_segment = dynamic_cast<const ValueSegment<ColumnDataType>*>(&segment)) {
       // Shortcut
-      values = pmr_vector<ColumnDataType>{value_segment->values()};
-      if (_table->column_is_nullable(column_id)) {
-        nulls = pmr_vector<bool>{value_segment->null_values()};
+      const auto& segment_values = value_segment->values();
+      values.assign(segment_values.begin() + begin_offset, segment_values.begin() + end_offset);
+      if (is_nullable) {
+        const auto& segment_nulls = value_segment->null_values();
+        nulls.assign(segment_nulls.begin() + begin_offset, segment_nulls.begin() + end_offset);
       }
     } else {
-      values.resize(segment.size());
-      auto chunk_offset = ChunkOffset{0};
-      if (_table->column_is_nullable(column_id)) {
-        nulls.resize(segment.size());
+      const auto materialize_chunk = [&](auto& chunk_values, auto& chunk_nulls) {
+        chunk_values.resize(segment.size());
+        if (is_nullable) {
+          chunk_nulls.resize(segment.size());
+        }
 
-        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
-          if (position.is_null()) {
-            nulls[chunk_offset] = true;
-          } else {
-            values[chunk_offset] = position.value();
+        segment_with_iterators<ColumnDataType>(segment, [&](auto iter, const auto end) {
+          for (auto chunk_offset = size_t{0}; iter != end; ++chunk_offset, ++iter) {
+            const auto& position = *iter;
+            if (is_nullable && position.is_null()) {
+              chunk_nulls[chunk_offset] = true;
+            } else {
+              DebugAssert(!position.is_null(), "Encountered NULL value in non-nullable column");
+              chunk_values[chunk_offset] = position.value();
+            }
           }
-          ++chunk_offset;
         });
+      };
+
+      if (_output_row_count == segment.size()) {
+        materialize_chunk(values, nulls);
       } else {
-        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
-          DebugAssert(!position.is_null(), "Encountered NULL value in non-nullable column");
-          values[chunk_offset] = position.value();
-          ++chunk_offset;
-        });
+        // Decoding a segment from an arbitrary offset can be expensive (e.g., LZ4 decompresses entire blocks), so
+        // the segment is materialized once for the Chunk and sliced for each vector.
+        auto& chunk_materialization = _chunk_segment_materializations[column_id];
+        if (!chunk_materialization) {
+          auto chunk_result = std::make_shared<ExpressionResult<ColumnDataType>>();
+          materialize_chunk(chunk_result->values, chunk_result->nulls);
+          chunk_materialization = std::move(chunk_result);
+        }
+
+        const auto& chunk_result = static_cast<const ExpressionResult<ColumnDataType>&>(*chunk_materialization);
+        values.assign(chunk_result.values.begin() + begin_offset, chunk_result.values.begin() + end_offset);
+        if (is_nullable) {
+          nulls.assign(chunk_result.nulls.begin() + begin_offset, chunk_result.nulls.begin() + end_offset);
+        }
       }
     }
 
-    if (_table->column_is_nullable(column_id)) {
-      _segment_materializations[column_id] =
-          std::make_shared<ExpressionResult<ColumnDataType>>(std::move(values), std::move(nulls));
-    } else {
-      _segment_materializations[column_id] = std::make_shared<ExpressionResult<ColumnDataType>>(std::move(values));
-    }
+    _segment_materializations[column_id] = std::move(result);
   });
 }
 
@@ -1633,6 +1836,35 @@ std::vector<std::shared_ptr<ExpressionResult<Result>>> ExpressionEvaluator::_pru
   return results;
 }
 
+ExpressionEvaluatorPool::ExpressionEvaluatorPool(
+    const std::shared_ptr<const Table>& table,
+    const std::shared_ptr<const ExpressionEvaluator::UncorrelatedSubqueryResults>& uncorrelated_subquery_results,
+    const ExpressionEvaluator::EvaluationMode evaluation_mode)
+    : _table(table), _uncorrelated_subquery_results(uncorrelated_subquery_results), _evaluation_mode(evaluation_mode) {}
+
+std::unique_ptr<ExpressionEvaluator> ExpressionEvaluatorPool::acquire(const ChunkID chunk_id) {
+  auto evaluator = std::unique_ptr<ExpressionEvaluator>{};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_evaluators.empty()) {
+      evaluator = std::move(_evaluators.back());
+      _evaluators.pop_back();
+    }
+  }
+
+  if (!evaluator) {
+    return std::make_unique<ExpressionEvaluator>(_table, chunk_id, _uncorrelated_subquery_results, _evaluation_mode);
+  }
+
+  evaluator->set_chunk(chunk_id);
+  return evaluator;
+}
+
+void ExpressionEvaluatorPool::release(std::unique_ptr<ExpressionEvaluator> evaluator) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _evaluators.emplace_back(std::move(evaluator));
+}
+
 // We explicitly instantiate these template functions because (at least) clang-12 does not instantiate them for us.
 template std::shared_ptr<ExpressionResult<int32_t>> ExpressionEvaluator::evaluate_expression_to_result<int32_t>(
     const AbstractExpression& expression);
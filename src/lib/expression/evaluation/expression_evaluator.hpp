@@ -1,6 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/variant.hpp>
@@ -41,6 +44,16 @@ class PQPColumnExpression;
  * Operates either
  *      - ...on a Chunk, thus returning a value for each row in it
  *      - ...without a Chunk, thus returning a single value (and failing if Columns are encountered in the Expression)
+ *
+ * On a Chunk, expressions are evaluated in one of two EvaluationModes
+ *      - Chunk: Each expression node produces an ExpressionResult covering all rows of the Chunk.
+ *      - Vectorized: evaluate_expression(s)_to_segment(s)() and evaluate_expression_to_pos_list() process the Chunk in
+ *                    vectors of VECTOR_SIZE rows. The intermediate ExpressionResults of a vector are small enough to
+ *                    stay in the CPU caches and their buffers are reused for the next vector. Expressions that
+ *                    contain subqueries are still evaluated for the entire Chunk.
+ *
+ * In both modes, an evaluator can be moved to another Chunk of the same table with set_chunk(), so that buffers are
+ * also reused across Chunks (see ExpressionEvaluatorPool).
  */
 class ExpressionEvaluator final {
  public:
@@ -49,6 +62,12 @@ class ExpressionEvaluator final {
   using Bool = int32_t;
   static constexpr auto DataTypeBool = DataType::Int;
 
+  enum class EvaluationMode { Chunk, Vectorized };
+
+  // Number of rows that are evaluated at a time in EvaluationMode::Vectorized. An ExpressionResult<double> of a vector
+  // takes 8 KB, so that the intermediate results of typical expression trees stay in the L1/L2 caches.
+  static constexpr auto VECTOR_SIZE = ChunkOffset{1024};
+
   // Performance Hack:
   //   For PQPSubqueryExpressions that are not correlated (i.e., that have no parameters), we pass previously
   //   calculated results into the per-chunk evaluator so that they are only evaluated once, not per-chunk.
@@ -64,11 +83,22 @@ class ExpressionEvaluator final {
    *                                     evaluated for every chunk. Solely for performance.
    */
   ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id,
-                      const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results = {});
+                      const std::shared_ptr<const UncorrelatedSubqueryResults>& uncorrelated_subquery_results = {},
+                      const EvaluationMode evaluation_mode = EvaluationMode::Chunk);
+
+  // Evaluates expressions on the Chunk @param chunk_id of the same table from now on. The results of the previous
+  // Chunk are discarded, their buffers are reused.
+  void set_chunk(const ChunkID chunk_id);
 
   std::shared_ptr<BaseValueSegment> evaluate_expression_to_segment(const AbstractExpression& expression);
   RowIDPosList evaluate_expression_to_pos_list(const AbstractExpression& expression);
 
+  // Evaluates multiple expressions at once. In EvaluationMode::Vectorized, all expressions are evaluated for one
+  // vector before the next vector is processed, so that common subexpressions (e.g., in TPC-H Q1) are only computed
+  // once.
+  std::vector<std::shared_ptr<BaseValueSegment>> evaluate_expressions_to_segments(
+      const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> evaluate_expression_to_result(const AbstractExpression& expression);
 
@@ -83,6 +113,27 @@ class ExpressionEvaluator final {
       const std::vector<std::shared_ptr<PQPSubqueryExpression>>& expressions);
 
  private:
+  std::vector<std::shared_ptr<BaseValueSegment>> _evaluate_expressions_to_segments(
+      const std::vector<const AbstractExpression*>& expressions);
+
+  // Evaluates @param expression to a PosList for the rows of the current vector. The chunk offsets of the returned
+  // RowIDs are relative to _vector_begin.
+  RowIDPosList _evaluate_expression_to_pos_list(const AbstractExpression& expression);
+
+  // Calls @param fn once for each vector of the Chunk (EvaluationMode::Vectorized) or once for the entire Chunk
+  // (EvaluationMode::Chunk, or if the @param expressions contain subqueries)
+  template <typename Functor>
+  void _for_each_vector(const std::vector<const AbstractExpression*>& expressions, const Functor& fn);
+
+  // Moves the evaluator to the rows [vector_begin, vector_begin + vector_size) of the Chunk. The ExpressionResults of
+  // the previous rows are discarded and kept for reuse by _make_result().
+  void _start_vector(const ChunkOffset vector_begin, const ChunkOffset vector_size);
+
+  // @return an empty ExpressionResult, if possible one that was used for a previous vector or Chunk, so that its
+  // buffers do not have to be allocated again
+  template <typename Result>
+  std::shared_ptr<ExpressionResult<Result>> _make_result();
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_arithmetic_expression(const ArithmeticExpression& expression);
 
@@ -182,7 +233,8 @@ class ExpressionEvaluator final {
    * Either operand can be either empty (the operand is not nullable), contain one element (the operand is a literal
    * with null info) or can have n rows (the operand is a nullable series)
    */
-  static pmr_vector<bool> _evaluate_default_null_logic(const pmr_vector<bool>& left, const pmr_vector<bool>& right);
+  static void _evaluate_default_null_logic(const pmr_vector<bool>& left, const pmr_vector<bool>& right,
+                                           pmr_vector<bool>& nulls);
 
   void _materialize_segment_if_not_yet_materialized(const ColumnID column_id);
 
@@ -197,12 +249,19 @@ class ExpressionEvaluator final {
 
   std::shared_ptr<const Table> _table;
   std::shared_ptr<const Chunk> _chunk;
-  const ChunkID _chunk_id;
+  ChunkID _chunk_id;
+  const EvaluationMode _evaluation_mode{EvaluationMode::Chunk};
+
+  // The rows of the Chunk that are currently evaluated. Outside of _for_each_vector(), these are all rows of the Chunk.
+  ChunkOffset _vector_begin{0};
   size_t _output_row_count{1};
 
   // One entry for each segment in the _chunk, may be nullptr if the segment hasn't been materialized
   std::vector<std::shared_ptr<BaseExpressionResult>> _segment_materializations;
 
+  // Materializations of non-ValueSegments for the entire Chunk, sliced into _segment_materializations for each vector
+  std::vector<std::shared_ptr<BaseExpressionResult>> _chunk_segment_materializations;
+
   // Optionally, uncorrelated selects can be evaluated by the caller and passed in to the evaluator. This way, they
   // do not have to be executed multiple times by different evaluators
   const std::shared_ptr<const UncorrelatedSubqueryResults> _uncorrelated_subquery_results;
@@ -210,6 +269,33 @@ class ExpressionEvaluator final {
   // Some expressions can be reused, either in the same result column (SELECT (a+3)*(a+3)), or across columns
   // (TPC-H Q1)
   ConstExpressionUnorderedMap<std::shared_ptr<BaseExpressionResult>> _cached_expression_results;
+
+  // ExpressionResults of the previous vector or Chunk that can be reused, by their type (ExpressionResult<T>)
+  std::unordered_map<std::type_index, std::vector<std::shared_ptr<BaseExpressionResult>>> _result_pool;
+};
+
+/**
+ * Hands out ExpressionEvaluators for the Chunks of a table and takes them back once a Chunk is evaluated. Operators
+ * that evaluate their Chunks in concurrent jobs use it so that each evaluator (and its buffers) is reused for multiple
+ * Chunks instead of creating a new evaluator per Chunk.
+ */
+class ExpressionEvaluatorPool final {
+ public:
+  ExpressionEvaluatorPool(
+      const std::shared_ptr<const Table>& table,
+      const std::shared_ptr<const ExpressionEvaluator::UncorrelatedSubqueryResults>& uncorrelated_subquery_results,
+      const ExpressionEvaluator::EvaluationMode evaluation_mode);
+
+  std::unique_ptr<ExpressionEvaluator> acquire(const ChunkID chunk_id);
+  void release(std::unique_ptr<ExpressionEvaluator> evaluator);
+
+ private:
+  const std::shared_ptr<const Table> _table;
+  const std::shared_ptr<const ExpressionEvaluator::UncorrelatedSubqueryResults> _uncorrelated_subquery_results;
+  const ExpressionEvaluator::EvaluationMode _evaluation_mode;
+
+  std::mutex _mutex;
+  std::vector<std::unique_ptr<ExpressionEvaluator>> _evaluators;
 };
 
 }  // namespace opossum
@@ -1,18 +1,51 @@
 #include "like_matcher.hpp"
 
+#if defined(__SSE2__)
+#include <x86intrin.h>
+#endif
+
+#include <cstring>
 #include <optional>
 #include <utility>
 
-#include <boost/algorithm/string/replace.hpp>
-
 #include "utils/assert.hpp"
 
-namespace opossum {
+namespace {
+
+#if defined(__AVX2__)
+
+constexpr auto SIMD_BLOCK_SIZE = size_t{32};
+
+// Bit i is set if first[i] == first_character and last[i] == last_character
+uint32_t candidate_mask(const char* first, const char* last, const char first_character, const char last_character) {
+  const auto first_block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));  // NOLINT
+  const auto last_block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(last));    // NOLINT
+  const auto equal = _mm256_and_si256(_mm256_cmpeq_epi8(first_block, _mm256_set1_epi8(first_character)),
+                                      _mm256_cmpeq_epi8(last_block, _mm256_set1_epi8(last_character)));
+  return static_cast<uint32_t>(_mm256_movemask_epi8(equal));
+}
+
+#elif defined(__SSE2__)
 
-LikeMatcher::LikeMatcher(const pmr_string& pattern) {
-  _pattern_variant = pattern_string_to_pattern_variant(pattern);
+constexpr auto SIMD_BLOCK_SIZE = size_t{16};
+
+// Bit i is set if first[i] == first_character and last[i] == last_character
+uint32_t candidate_mask(const char* first, const char* last, const char first_character, const char last_character) {
+  const auto first_block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));  // NOLINT
+  const auto last_block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(last));    // NOLINT
+  const auto equal = _mm_and_si128(_mm_cmpeq_epi8(first_block, _mm_set1_epi8(first_character)),
+                                   _mm_cmpeq_epi8(last_block, _mm_set1_epi8(last_character)));
+  return static_cast<uint32_t>(_mm_movemask_epi8(equal));
 }
 
+#endif
+
+}  // namespace
+
+namespace opossum {
+
+LikeMatcher::LikeMatcher(const pmr_string& pattern) : _pattern_variant(pattern_string_to_pattern_variant(pattern)) {}
+
 size_t LikeMatcher::get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset) {
   return pattern.find_first_of("_%", offset);
 }
@@ -90,12 +123,12 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
   } else {
     /**
      * Pattern is either MultipleContainsPattern, e.g., '%hello%world%how%are%you%' or we fall back to
-     * using a regex matcher.
+     * using a GeneralPattern.
      *
      * A MultipleContainsPattern begins and ends with '%' and  contains only strings and '%'.
      */
 
-    // Pick ContainsMultiple or Regex
+    // Pick ContainsMultiple or GeneralPattern
     auto pattern_is_contains_multiple = true;  // Set to false if tokens don't match %(, string, %)* pattern
     auto strings = std::vector<pmr_string>{};  // arguments used for ContainsMultiple, if it gets used
     auto expect_any_chars = true;              // If true, expect '%', if false, expect a string
@@ -118,37 +151,171 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
       expect_any_chars = !expect_any_chars;
     }
 
-    if (pattern_is_contains_multiple) {
+    // The last token has to be a '%' as well, otherwise the pattern is anchored at the end of the string
+    if (pattern_is_contains_multiple && !expect_any_chars) {
       return MultipleContainsPattern{strings};
     } else {
-      return std::regex(sql_like_to_regex(pattern));
+      return GeneralPattern{tokens};
+    }
+  }
+}
+
+LikeMatcher::GeneralPattern::Segment::Segment(const pmr_string& init_characters)
+    : characters(init_characters),
+      first_literal_position(characters.find_first_not_of('_')),
+      last_literal_position(characters.find_last_not_of('_')),
+      contains_single_char_wildcard(characters.find('_') != pmr_string::npos) {}
+
+LikeMatcher::GeneralPattern::GeneralPattern(const PatternTokens& tokens) {
+  if (tokens.empty()) {
+    return;
+  }
+  starts_with_any_chars = tokens.front() == PatternToken{Wildcard::AnyChars};
+  ends_with_any_chars = tokens.back() == PatternToken{Wildcard::AnyChars};
+
+  // Merge strings and '_' wildcards between two '%' wildcards into a single segment
+  auto characters = pmr_string{};
+  const auto finish_segment = [&]() {
+    if (characters.empty()) {
+      return;
+    }
+    min_length += characters.size();
+    segments.emplace_back(characters);
+    characters.clear();
+  };
+
+  for (const auto& token : tokens) {
+    if (token == PatternToken{Wildcard::AnyChars}) {
+      finish_segment();
+    } else if (token == PatternToken{Wildcard::SingleChar}) {
+      characters += '_';
+    } else {
+      characters += std::get<pmr_string>(token);
+    }
+  }
+  finish_segment();
+}
+
+bool LikeMatcher::GeneralPattern::matches(const std::string_view& string) const {
+  if (string.size() < min_length) {
+    return false;
+  }
+
+  if (segments.empty()) {
+    // The pattern is empty or only consists of '%' wildcards
+    return starts_with_any_chars || string.empty();
+  }
+
+  auto begin = size_t{0};
+  auto end = string.size();
+  auto first_unanchored_segment_idx = size_t{0};
+  auto last_unanchored_segment_idx = segments.size();
+
+  if (!starts_with_any_chars) {
+    const auto& segment = segments.front();
+    if (!segment_matches_at(segment, string, 0)) {
+      return false;
+    }
+    begin = segment.characters.size();
+    ++first_unanchored_segment_idx;
+
+    if (segments.size() == 1 && !ends_with_any_chars) {
+      // Pattern without '%', e.g., 'H_llo'
+      return string.size() == segment.characters.size();
+    }
+  }
+
+  if (!ends_with_any_chars) {
+    // As the string is at least min_length long, the last segment cannot overlap with the first one
+    const auto& segment = segments.back();
+    end -= segment.characters.size();
+    if (!segment_matches_at(segment, string, end)) {
+      return false;
+    }
+    --last_unanchored_segment_idx;
+  }
+
+  for (auto segment_idx = first_unanchored_segment_idx; segment_idx < last_unanchored_segment_idx; ++segment_idx) {
+    const auto& segment = segments[segment_idx];
+    const auto position = find_segment(segment, string, begin, end);
+    if (position == std::string_view::npos) {
+      return false;
+    }
+    begin = position + segment.characters.size();
+  }
+
+  return true;
+}
+
+bool LikeMatcher::GeneralPattern::segment_matches_at(const Segment& segment, const std::string_view& string,
+                                                     const size_t position) {
+  const auto* const characters = string.data() + position;
+  const auto size = segment.characters.size();
+  DebugAssert(position + size <= string.size(), "String too short for segment");
+
+  if (!segment.contains_single_char_wildcard) {
+    return std::memcmp(characters, segment.characters.data(), size) == 0;
+  }
+
+  if (segment.first_literal_position == pmr_string::npos) {
+    return true;
+  }
+
+  for (auto character_idx = segment.first_literal_position; character_idx <= segment.last_literal_position;
+       ++character_idx) {
+    const auto pattern_character = segment.characters[character_idx];
+    if (pattern_character != '_' && pattern_character != characters[character_idx]) {
+      return false;
     }
   }
+  return true;
 }
 
-std::string LikeMatcher::sql_like_to_regex(pmr_string sql_like) {
-  // Do substitution of <backslash> with <backslash><backslash> FIRST, because otherwise it will also replace
-  // backslashes introduced by the other substitutions
-  constexpr auto REPLACE_BY = std::array<std::pair<const char*, const char*>, 14u>{{{"\\", "\\\\"},
-                                                                                    {".", "\\."},
-                                                                                    {"^", "\\^"},
-                                                                                    {"$", "\\$"},
-                                                                                    {"+", "\\+"},
-                                                                                    {"?", "\\?"},
-                                                                                    {"(", "\\("},
-                                                                                    {")", "\\)"},
-                                                                                    {"{", "\\{"},
-                                                                                    {"}", "\\}"},
-                                                                                    {"|", "\\|"},
-                                                                                    {"*", "\\*"},
-                                                                                    {"%", ".*"},
-                                                                                    {"_", "."}}};
-
-  for (const auto& pair : REPLACE_BY) {
-    boost::replace_all(sql_like, pair.first, pair.second);
-  }
-
-  return std::string{"^" + sql_like + "$"};
+size_t LikeMatcher::GeneralPattern::find_segment(const Segment& segment, const std::string_view& string,
+                                                 const size_t begin, const size_t end) {
+  const auto size = segment.characters.size();
+  if (begin + size > end) {
+    return std::string_view::npos;
+  }
+
+  if (segment.first_literal_position == pmr_string::npos) {
+    // The segment only consists of '_' wildcards and matches at any position
+    return begin;
+  }
+
+  // Positions at which the segment would fit into [begin, end)
+  const auto last_candidate = end - size;
+  const auto first_offset = segment.first_literal_position;
+  const auto last_offset = segment.last_literal_position;
+  const auto first_character = segment.characters[first_offset];
+  const auto last_character = segment.characters[last_offset];
+  const auto* const data = string.data();
+
+  auto candidate = begin;
+
+#if defined(__SSE2__)
+  for (; candidate + SIMD_BLOCK_SIZE - 1 <= last_candidate; candidate += SIMD_BLOCK_SIZE) {
+    // Each set bit is a candidate whose first and last literal characters match
+    auto mask = candidate_mask(data + candidate + first_offset, data + candidate + last_offset, first_character,
+                               last_character);
+    while (mask != 0) {
+      const auto match = candidate + static_cast<size_t>(__builtin_ctz(mask));
+      if (segment_matches_at(segment, string, match)) {
+        return match;
+      }
+      mask &= mask - 1;
+    }
+  }
+#endif
+
+  for (; candidate <= last_candidate; ++candidate) {
+    if (data[candidate + first_offset] == first_character && data[candidate + last_offset] == last_character &&
+        segment_matches_at(segment, string, candidate)) {
+      return candidate;
+    }
+  }
+
+  return std::string_view::npos;
 }
 
 std::ostream& operator<<(std::ostream& stream, const LikeMatcher::Wildcard& wildcard) {
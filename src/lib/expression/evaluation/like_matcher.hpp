@@ -2,8 +2,8 @@
 
 #include <experimental/functional>
 #include <optional>
-#include <regex>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -17,7 +17,7 @@ namespace opossum {
  * Wraps an SQL LIKE pattern (e.g. "Hello%Wo_ld") which strings can be tested against.
  *
  * Performance optimizations exist for several simple patterns, such as "Hello%" - which is really just a starts_with()
- * check.
+ * check. All other patterns are compiled into a GeneralPattern.
  */
 class LikeMatcher {
   // A faster search algorithm than the typical byte-wise search if we can reuse the searcher
@@ -28,11 +28,6 @@ class LikeMatcher {
 #endif
 
  public:
-  /**
-   * Turn SQL LIKE-pattern into a C++ regex.
-   */
-  static std::string sql_like_to_regex(pmr_string sql_like);
-
   static size_t get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset = 0);
   static bool contains_wildcard(const pmr_string& pattern);
 
@@ -59,7 +54,7 @@ class LikeMatcher {
 
   /**
    * To speed up LIKE there are special implementations available for simple, common patterns.
-   * Any other pattern will fall back to regex.
+   * Any other pattern is matched as a GeneralPattern.
    */
   // 'hello%'
   struct StartsWithPattern final {
@@ -79,11 +74,55 @@ class LikeMatcher {
   };
 
   /**
-   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to std::regex for a
-   * general pattern.
+   * Any other pattern, e.g., 'H_llo%W%ld' or 'Hello'. The pattern is split at its '%' wildcards into segments of
+   * literal characters and '_' wildcards. The first segment has to match at the beginning of the string (unless the
+   * pattern starts with '%'), the last one at its end (unless the pattern ends with '%'). The segments in between are
+   * searched from left to right. As all segments have a fixed length, matching the leftmost occurrence of each segment
+   * never rules out a match.
+   *
+   * Occurrences of a segment are searched for by comparing the first and the last literal character of the segment
+   * with 16 (SSE2) or 32 (AVX2) positions of the string at once. Only the positions where both characters match are
+   * compared entirely.
+   */
+  struct GeneralPattern final {
+    struct Segment {
+      explicit Segment(const pmr_string& init_characters);
+
+      // Literal characters and '_' wildcards
+      pmr_string characters;
+
+      // Positions of the first and the last literal character within the segment, both are npos if the segment only
+      // consists of '_' wildcards
+      size_t first_literal_position;
+      size_t last_literal_position;
+
+      bool contains_single_char_wildcard;
+    };
+
+    explicit GeneralPattern(const PatternTokens& tokens);
+
+    bool matches(const std::string_view& string) const;
+
+    // @return whether @param segment matches the @param string at @param position. The string has to be long enough.
+    static bool segment_matches_at(const Segment& segment, const std::string_view& string, const size_t position);
+
+    // @return the first position within [@param begin, @param end) at which @param segment matches @param string
+    static size_t find_segment(const Segment& segment, const std::string_view& string, const size_t begin,
+                               const size_t end);
+
+    std::vector<Segment> segments;
+    bool starts_with_any_chars{false};
+    bool ends_with_any_chars{false};
+
+    // Sum of the segment lengths. Shorter strings cannot match.
+    size_t min_length{0};
+  };
+
+  /**
+   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or a GeneralPattern.
    */
   using AllPatternVariant =
-      std::variant<std::regex, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
+      std::variant<GeneralPattern, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
 
   static AllPatternVariant pattern_string_to_pattern_variant(const pmr_string& pattern);
 
@@ -143,11 +182,11 @@ class LikeMatcher {
         return !invert_results;
       });
 
-    } else if (std::holds_alternative<std::regex>(_pattern_variant)) {
-      const auto& regex = std::get<std::regex>(_pattern_variant);
+    } else if (std::holds_alternative<GeneralPattern>(_pattern_variant)) {
+      const auto& general_pattern = std::get<GeneralPattern>(_pattern_variant);
 
       functor([&](const auto& string) -> bool {
-        return std::regex_match(string.cbegin(), string.cend(), regex) ^ invert_results;
+        return general_pattern.matches(std::string_view{string.data(), string.size()}) ^ invert_results;
       });
 
     } else {
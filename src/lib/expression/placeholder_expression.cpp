@@ -29,7 +29,9 @@ bool PlaceholderExpression::requires_computation() const {
 }
 
 DataType PlaceholderExpression::data_type() const {
-  Fail("Cannot obtain DataType of placeholder");
+  // Placeholders are only valid where the data type is not needed to translate and optimize the statement (e.g., not
+  // in `SELECT ? + 1`). This is a limitation of the statement, not a bug.
+  FailInput("Cannot obtain DataType of placeholder");
 }
 
 bool PlaceholderExpression::_shallow_equals(const AbstractExpression& expression) const {
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include <boost/container/pmr/memory_resource.hpp>
 
 #include "concurrency/transaction_manager.hpp"
@@ -17,6 +19,7 @@ namespace opossum {
 
 class AbstractScheduler;
 class BenchmarkRunner;
+class WriteAheadLog;
 
 // This should be the only singleton in the src/lib world. It provides a unified way of accessing components like the
 // storage manager, the transaction manager, and more. Encapsulating this in one class avoids the static initialization
@@ -53,6 +56,19 @@ class Hyrise : public Singleton<Hyrise> {
   std::shared_ptr<SQLPhysicalPlanCache> default_pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> default_lqp_cache;
 
+  // Parameterized plan cache used by the SQLPipelineBuilder if `with_parameterized_plan_cache()` is not used. As plans
+  // retrieved from it are optimized without knowing the literals of the query, it is disabled (nullptr) by default.
+  std::shared_ptr<SQLParameterizedPlanCache> default_parameterized_plan_cache;
+
+  // Memory budget (in bytes) of each statement used by the SQLPipelineBuilder if `with_memory_budget()` is not used.
+  // Statements are not limited (std::nullopt) by default. See MemoryBudget::default_limit for a limit that is derived
+  // from the available memory.
+  std::optional<size_t> default_memory_budget;
+
+  // Write-ahead log that makes committed transactions durable. Logging is disabled (nullptr) by default. See
+  // WriteAheadLog for how to enable it.
+  std::shared_ptr<WriteAheadLog> write_ahead_log;
+
   // The BenchmarkRunner is available here so that non-benchmark components can add information to the benchmark
   // result JSON.
   std::weak_ptr<BenchmarkRunner> benchmark_runner;
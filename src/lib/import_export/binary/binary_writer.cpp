@@ -105,9 +105,14 @@ void BinaryWriter::write(const Table& table, const std::string& filename) {
 
   _write_header(table, ofstream);
 
+  auto chunk_offsets = std::vector<uint64_t>{};
+  chunk_offsets.reserve(table.chunk_count());
   for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); chunk_id++) {
+    chunk_offsets.emplace_back(static_cast<uint64_t>(ofstream.tellp()));
     _write_chunk(table, ofstream, chunk_id);
   }
+
+  _write_chunk_offset_index(chunk_offsets, ofstream);
 }
 
 void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
@@ -153,6 +158,11 @@ void BinaryWriter::_write_chunk(const Table& table, std::ofstream& ofstream, con
   }
 }
 
+void BinaryWriter::_write_chunk_offset_index(const std::vector<uint64_t>& chunk_offsets, std::ofstream& ofstream) {
+  export_values(ofstream, chunk_offsets);
+  export_value(ofstream, CHUNK_OFFSET_INDEX_MAGIC_NUMBER);
+}
+
 template <typename T>
 void BinaryWriter::_write_segment(const ValueSegment<T>& value_segment, bool column_is_nullable,
                                   std::ofstream& ofstream) {
@@ -20,8 +20,24 @@ enum class CompressedVectorType : uint8_t;
 
 class BinaryWriter {
  public:
+  /**
+   * Writes the given table into a binary file of the following form:
+   *
+   * ------------------------
+   * |        Header        |
+   * |----------------------|
+   * |        Chunks¹       |
+   * |----------------------|
+   * |  Chunk offset index  |
+   * ------------------------
+   *
+   * ¹ Zero or more chunks
+   */
   static void write(const Table& table, const std::string& filename);
 
+  // Marks the end of the chunk offset index. Files written before the index was introduced do not end with it.
+  static constexpr uint64_t CHUNK_OFFSET_INDEX_MAGIC_NUMBER = 0x5844494B4E554843;  // "CHUNKIDX" in little endian
+
  private:
   /**
    * This methods writes the header of this table into the given ofstream.
@@ -53,6 +69,19 @@ class BinaryWriter {
    */
   static void _write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id);
 
+  /**
+   * Writes the positions of the chunks in the file, so that the BinaryParser can read the chunks in parallel.
+   *
+   * Description                 | Type                                | Size in bytes
+   * --------------------------------------------------------------------------------------------------------
+   * Chunk offsets               | uint64_t array                      | Chunk count * 8
+   * Magic number                | uint64_t                            | 8
+   *
+   * The chunk offsets are the positions of the chunk headers relative to the beginning of the file. As the number of
+   * chunks is written in the header of the file, the index can be located from the end of the file.
+   */
+  static void _write_chunk_offset_index(const std::vector<uint64_t>& chunk_offsets, std::ofstream& ofstream);
+
   /**
    * ValueSegments are dumped with the following layout:
    *
@@ -1,5 +1,7 @@
 #include "csv_parser.hpp"
 
+#include <algorithm>
+#include <deque>
 #include <fstream>
 #include <list>
 #include <memory>
@@ -15,6 +17,7 @@
 #include "import_export/csv/csv_meta.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/load_table.hpp"
@@ -22,7 +25,21 @@
 namespace opossum {
 
 std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const ChunkOffset chunk_size,
-                                        const std::optional<CsvMeta>& csv_meta) {
+                                        const std::optional<CsvMeta>& csv_meta,
+                                        const std::optional<ChunkEncodingSpec>& encoding_spec) {
+  return _parse(filename, chunk_size, csv_meta, encoding_spec, READ_WINDOW_SIZE);
+}
+
+std::shared_ptr<Table> CsvParser::create_table_from_meta_file(const std::string& filename,
+                                                              const ChunkOffset chunk_size) {
+  const auto meta = process_csv_meta_file(filename);
+  return _create_table_from_meta(chunk_size, meta);
+}
+
+std::shared_ptr<Table> CsvParser::_parse(const std::string& filename, const ChunkOffset chunk_size,
+                                         const std::optional<CsvMeta>& csv_meta,
+                                         const std::optional<ChunkEncodingSpec>& encoding_spec,
+                                         const size_t read_window_size) {
   // If no meta info is given as a parameter, look for a json file
   CsvMeta meta;
   if (csv_meta == std::nullopt) {
@@ -34,6 +51,8 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
   auto escaped_linebreak = std::string(1, meta.config.delimiter_escape) + std::string(1, meta.config.delimiter);
 
   auto table = _create_table_from_meta(chunk_size, meta);
+  Assert(!encoding_spec || encoding_spec->size() == table->column_count(),
+         "Encoding specification does not match the number of columns");
 
   std::ifstream csvfile{filename};
 
@@ -47,47 +66,88 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
     std::getline(csvfile, line);
     Assert(line.find('\r') == std::string::npos, "Windows encoding is not supported, use dos2unix");
   }
-
-  /**
-   * Load the whole file(!) into a std::string using the, hopefully, fastest method to do so.
-   * TODO(anybody) Maybe use mmap() in the future. The current approach needs to have the entire file in RAM, mmap might
-   *               be cleverer, dunno.
-   */
-  csvfile.seekg(0, std::ios::end);
-  const auto csvfile_size = csvfile.tellg();
-  std::string content(csvfile_size, ' ');
+  csvfile.clear();
   csvfile.seekg(0);
-  csvfile.read(content.data(), csvfile_size);
 
-  // make sure content ends with a delimiter for better row processing later
-  if (content.back() != meta.config.delimiter) {
-    content.push_back(meta.config.delimiter);
-  }
+  const auto column_count = table->column_count();
+  const auto max_chunks_in_flight = std::max(size_t{1}, 2 * Hyrise::get().topology.num_cpus());
 
-  std::string_view content_view{content.c_str(), content.size()};
+  // The file is read in windows. `content` holds the part of the file that has not been assigned to a chunk yet (i.e.,
+  // starting from `content_offset`), which is usually less than a window plus a chunk.
+  auto content = std::string{};
+  auto content_offset = size_t{0};
+  auto end_of_file = false;
 
   // Save chunks in list to avoid memory relocation
   std::list<Segments> segments_by_chunks;
   std::vector<std::shared_ptr<AbstractTask>> tasks;
+  std::deque<std::shared_ptr<AbstractTask>> tasks_in_flight;
   std::vector<size_t> field_ends;
   std::mutex append_chunk_mutex;
-  while (_find_fields_in_chunk(content_view, *table, field_ends, meta)) {
+  while (true) {
+    const auto content_view = std::string_view{content}.substr(content_offset);
+    _find_fields_in_chunk(content_view, *table, field_ends, meta);
+
+    if (!end_of_file) {
+      // The last row might be cut off by the end of the window. Only complete rows are assigned to the chunk.
+      if (column_count > 0) {
+        field_ends.resize(field_ends.size() / column_count * column_count);
+      }
+
+      if (field_ends.size() < size_t{table->target_chunk_size()} * column_count) {
+        // The chunk is not full yet, read the next window and search again
+        content.erase(0, content_offset);
+        content_offset = 0;
+        const auto content_size = content.size();
+        content.resize(content_size + read_window_size);
+        csvfile.read(content.data() + content_size, static_cast<std::streamsize>(read_window_size));
+        content.resize(content_size + static_cast<size_t>(csvfile.gcount()));
+
+        if (!csvfile) {
+          end_of_file = true;
+          // make sure content ends with a delimiter for better row processing later
+          if (!content.empty() && content.back() != meta.config.delimiter) {
+            content.push_back(meta.config.delimiter);
+          }
+        }
+        continue;
+      }
+    }
+
+    if (field_ends.empty()) {
+      break;
+    }
+
+    // Only pass the part of the content that is actually needed to the parsing task. The task owns its part, so that
+    // the processed part can be removed from the content.
+    const auto relevant_content = std::make_shared<const std::string>(content_view.substr(0, field_ends.back()));
+    content_offset += field_ends.back() + 1;
+
     // create empty chunk
     segments_by_chunks.emplace_back();
     auto& segments = segments_by_chunks.back();
 
-    // Only pass the part of the string that is actually needed to the parsing task
-    std::string_view relevant_content = content_view.substr(0, field_ends.back());
-
-    // Remove processed part of the csv content
-    content_view = content_view.substr(field_ends.back() + 1);
-
-    // create and start parsing task to fill chunk
+    // create and start parsing task to fill chunk. If requested, the segments are encoded while the following chunks
+    // are parsed.
     tasks.emplace_back(std::make_shared<JobTask>([relevant_content, field_ends, &table, &segments, &meta,
-                                                  &escaped_linebreak, &append_chunk_mutex]() {
-      _parse_into_chunk(relevant_content, field_ends, *table, segments, meta, escaped_linebreak, append_chunk_mutex);
+                                                  &escaped_linebreak, &append_chunk_mutex, &encoding_spec]() {
+      _parse_into_chunk(*relevant_content, field_ends, *table, segments, meta, escaped_linebreak, append_chunk_mutex);
+
+      if (encoding_spec) {
+        for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+          segments[column_id] = ChunkEncoder::encode_segment(segments[column_id], table->column_data_type(column_id),
+                                                             (*encoding_spec)[column_id]);
+        }
+      }
     }));
     tasks.back()->schedule();
+
+    // Limit the number of chunks whose content is held in memory while waiting to be parsed
+    tasks_in_flight.emplace_back(tasks.back());
+    if (tasks_in_flight.size() > max_chunks_in_flight) {
+      Hyrise::get().scheduler()->wait_for_tasks({tasks_in_flight.front()});
+      tasks_in_flight.pop_front();
+    }
   }
 
   Hyrise::get().scheduler()->wait_for_tasks(tasks);
@@ -102,12 +162,6 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
   return table;
 }
 
-std::shared_ptr<Table> CsvParser::create_table_from_meta_file(const std::string& filename,
-                                                              const ChunkOffset chunk_size) {
-  const auto meta = process_csv_meta_file(filename);
-  return _create_table_from_meta(chunk_size, meta);
-}
-
 std::shared_ptr<Table> CsvParser::_create_table_from_meta(const ChunkOffset chunk_size, const CsvMeta& meta) {
   TableColumnDefinitions column_definitions;
   for (const auto& column_meta : meta.columns) {
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include "import_export/csv/csv_meta.hpp"
+#include "storage/encoding_type.hpp"
 
 namespace opossum {
 
@@ -21,23 +22,37 @@ class Chunk;
  * For non-RFC 4180, all linebreaks within quoted strings are further escaped with an escape character.
  * For the structure of the meta csv file see export_csv.hpp
  *
- * This parser reads the whole csv file and iterates over it to separate the data into chunks that are aligned with the
- * csv rows.
- * Each data chunk is parsed and converted into a opossum chunk. In the end all chunks are combined to the final table.
+ * This parser reads the csv file in windows and iterates over them to separate the data into chunks that are aligned
+ * with the csv rows.
+ * Each data chunk is parsed and converted into a opossum chunk by a separate task while the next chunks are separated.
+ * The number of data chunks waiting to be parsed is limited, so that the memory needed for the csv content does not
+ * depend on the size of the file. In the end all chunks are combined to the final table.
  */
 class CsvParser {
  public:
   /*
    * @param filename      Path to the input file.
    * @param csv_meta      Custom csv meta information which will be used instead of the default "filename" + ".json" meta.
+   * @param encoding_spec If given, the segments of each chunk are encoded right after the chunk has been parsed, so
+   *                      that the unencoded segments of the whole table are never held in memory at the same time.
    * @returns             The table that was created from the csv file.
    */
   static std::shared_ptr<Table> parse(const std::string& filename, const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE,
-                                      const std::optional<CsvMeta>& csv_meta = std::nullopt);
+                                      const std::optional<CsvMeta>& csv_meta = std::nullopt,
+                                      const std::optional<ChunkEncodingSpec>& encoding_spec = std::nullopt);
   static std::shared_ptr<Table> create_table_from_meta_file(const std::string& filename,
                                                             const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
 
  protected:
+  // Number of bytes read from the file at once
+  static constexpr size_t READ_WINDOW_SIZE = 16 * 1024 * 1024;
+
+  // Implements parse(). The window size can be reduced for testing.
+  static std::shared_ptr<Table> _parse(const std::string& filename, const ChunkOffset chunk_size,
+                                       const std::optional<CsvMeta>& csv_meta,
+                                       const std::optional<ChunkEncodingSpec>& encoding_spec,
+                                       const size_t read_window_size);
+
   /*
    * Use the meta information stored in _meta to create a new table with according column description.
    */
@@ -68,5 +83,7 @@ class CsvParser {
    * @param field The field that needs to be modified to be RFC 4180 compliant.
    */
   static void _sanitize_field(std::string& field, const CsvMeta& meta, const std::string& escaped_linebreak);
+
+  friend class CsvParserTest;
 };
 }  // namespace opossum
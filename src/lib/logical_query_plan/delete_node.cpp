@@ -9,10 +9,15 @@
 
 namespace opossum {
 
-DeleteNode::DeleteNode() : AbstractNonQueryNode(LQPNodeType::Delete) {}
+DeleteNode::DeleteNode(const std::string& init_table_name)
+    : AbstractNonQueryNode(LQPNodeType::Delete), table_name(init_table_name) {}
 
 std::string DeleteNode::description(const DescriptionMode mode) const {
-  return "[Delete]";
+  std::ostringstream desc;
+
+  desc << "[Delete] Table: '" << table_name << "'";
+
+  return desc.str();
 }
 
 bool DeleteNode::is_column_nullable(const ColumnID column_id) const {
@@ -24,11 +29,16 @@ std::vector<std::shared_ptr<AbstractExpression>> DeleteNode::output_expressions(
 }
 
 std::shared_ptr<AbstractLQPNode> DeleteNode::_on_shallow_copy(LQPNodeMapping& node_mapping) const {
-  return DeleteNode::make();
+  return DeleteNode::make(table_name);
+}
+
+size_t DeleteNode::_on_shallow_hash() const {
+  return boost::hash_value(table_name);
 }
 
 bool DeleteNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const {
-  return true;
+  const auto& delete_node_rhs = static_cast<const DeleteNode&>(rhs);
+  return table_name == delete_node_rhs.table_name;
 }
 
 }  // namespace opossum
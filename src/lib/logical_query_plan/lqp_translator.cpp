@@ -1,16 +1,16 @@
 #include "lqp_translator.hpp"
 
+#include <algorithm>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
-#include <boost/hana/for_each.hpp>
-#include <boost/hana/tuple.hpp>
-
 #include "abstract_lqp_node.hpp"
 #include "aggregate_node.hpp"
 #include "alias_node.hpp"
 #include "change_meta_table_node.hpp"
+#include "cost_estimation/join_cost_model.hpp"
 #include "create_prepared_plan_node.hpp"
 #include "create_table_node.hpp"
 #include "create_view_node.hpp"
@@ -21,7 +21,9 @@
 #include "export_node.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/abstract_predicate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
@@ -33,9 +35,11 @@
 #include "intersect_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lossless_cast.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/change_meta_table.hpp"
+#include "operators/chunk_pipeline.hpp"
 #include "operators/delete.hpp"
 #include "operators/export.hpp"
 #include "operators/get_table.hpp"
@@ -43,8 +47,10 @@
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
+#include "operators/key_index_scan.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
 #include "operators/maintenance/create_table.hpp"
@@ -53,11 +59,14 @@
 #include "operators/maintenance/drop_view.hpp"
 #include "operators/operator_join_predicate.hpp"
 #include "operators/operator_scan_predicate.hpp"
+#include "operators/pqp_utils.hpp"
 #include "operators/product.hpp"
 #include "operators/projection.hpp"
+#include "operators/runtime_filter.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
@@ -66,6 +75,8 @@
 #include "projection_node.hpp"
 #include "sort_node.hpp"
 #include "static_table_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "storage/index/table_key/table_key_index.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
@@ -74,6 +85,8 @@ using namespace std::string_literals;  // NOLINT
 
 namespace opossum {
 
+LQPTranslator::LQPTranslator(const bool pipelined_execution) : _pipelined_execution(pipelined_execution) {}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
   /**
    * Translate a node (i.e. call `_translate_by_node_type`) only if it hasn't been translated before, otherwise just
@@ -193,8 +206,16 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   // Our IndexScan implementation does not work on reference segments yet.
   Assert(node->left_input()->type == LQPNodeType::StoredTable, "IndexScan must follow a StoredTableNode.");
 
+  if (const auto key_index_scan = _translate_predicate_node_to_key_index_scan(node, input_operator)) {
+    return key_index_scan;
+  }
+
+  // Conjunctions are only created by the IndexScanRule for key indexes. If the key index is not there anymore, fall
+  // back to a TableScan.
   const auto predicate = std::dynamic_pointer_cast<AbstractPredicateExpression>(node->predicate());
-  Assert(predicate, "Expected predicate");
+  if (!predicate) {
+    return _translate_predicate_node_to_table_scan(node, input_operator);
+  }
   Assert(!predicate->arguments.empty(), "Expected arguments");
 
   column_id = node->left_input()->get_column_id(*predicate->arguments[0]);
@@ -264,6 +285,53 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   return std::make_shared<UnionAll>(index_scan, table_scan);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_key_index_scan(
+    const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(node->left_input());
+  const auto key_indexes = Hyrise::get().storage_manager.get_table(stored_table_node->table_name)->key_indexes();
+  if (key_indexes.empty()) {
+    return nullptr;
+  }
+
+  // Placeholders have been replaced by values when a prepared plan was instantiated
+  auto values_by_column_id = std::map<ColumnID, AllTypeVariant>{};
+  for (const auto& expression : flatten_logical_expressions(node->predicate(), LogicalOperator::And)) {
+    const auto predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(expression);
+    if (!predicate || predicate->predicate_condition != PredicateCondition::Equals) {
+      return nullptr;
+    }
+
+    auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(predicate->left_operand());
+    auto value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->right_operand());
+    if (!column_expression) {
+      column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(predicate->right_operand());
+      value_expression = std::dynamic_pointer_cast<ValueExpression>(predicate->left_operand());
+    }
+
+    if (!column_expression || !value_expression || column_expression->original_node.lock() != stored_table_node ||
+        !values_by_column_id.emplace(column_expression->original_column_id, value_expression->value).second) {
+      return nullptr;
+    }
+  }
+
+  for (const auto& key_index : key_indexes) {
+    const auto& column_ids = key_index->column_ids();
+    if (column_ids.size() != values_by_column_id.size() ||
+        !std::all_of(column_ids.cbegin(), column_ids.cend(),
+                     [&](const auto column_id) { return values_by_column_id.contains(column_id); })) {
+      continue;
+    }
+
+    auto values = std::vector<AllTypeVariant>{};
+    for (const auto column_id : column_ids) {
+      values.emplace_back(values_by_column_id[column_id]);
+    }
+    return std::make_shared<KeyIndexScan>(input_operator, column_ids, values);
+  }
+
+  return nullptr;
+}
+
 std::shared_ptr<TableScan> LQPTranslator::_translate_predicate_node_to_table_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
   return std::make_shared<TableScan>(input_operator, _translate_expression(node->predicate(), node->left_input(),
@@ -305,8 +373,12 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
   const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
   auto input_operator = translate_node(node->left_input());
 
-  std::shared_ptr<AbstractOperator> current_pqp = input_operator;
-  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
+  return std::make_shared<Sort>(input_operator, _translate_sort_column_definitions(sort_node));
+}
+
+std::vector<SortColumnDefinition> LQPTranslator::_translate_sort_column_definitions(
+    const std::shared_ptr<SortNode>& sort_node) const {
+  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, sort_node->left_input());
 
   auto pqp_expression_iter = pqp_expressions.begin();
   auto sort_mode_iter = sort_node->sort_modes.begin();
@@ -321,9 +393,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
 
     column_definitions.emplace_back(SortColumnDefinition{pqp_column_expression->column_id, *sort_mode_iter});
   }
-  current_pqp = std::make_shared<Sort>(current_pqp, column_definitions);
 
-  return current_pqp;
+  return column_definitions;
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -355,39 +426,154 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   const auto& primary_join_predicate = join_predicates.front();
   std::vector<OperatorJoinPredicate> secondary_join_predicates(join_predicates.cbegin() + 1, join_predicates.cend());
 
-  auto join_operator = std::shared_ptr<AbstractOperator>{};
-
-  const auto left_data_type = join_node->join_predicates().front()->arguments[0]->data_type();
-  const auto right_data_type = join_node->join_predicates().front()->arguments[1]->data_type();
+  // Choose the join operator with the lowest estimated cost. The estimates consider the input cardinalities, whether
+  // the inputs are sorted by the join columns, and whether chunk indexes are available (see JoinCostModel).
+  const auto join_cost_model = JoinCostModel{std::make_shared<CardinalityEstimator>()};
+  const auto join_cost_estimates =
+      join_cost_model.estimate_join_costs(join_node, primary_join_predicate, !secondary_join_predicates.empty());
+  Assert(!join_cost_estimates.empty(),
+         "No operator implementation available for join '"s + join_node->description() + "'");
+  const auto& cheapest_join = join_cost_estimates.front();
+
+  auto join_operator = std::shared_ptr<AbstractJoinOperator>{};
+  switch (cheapest_join.join_type) {
+    case OperatorType::JoinHash:
+      join_operator = std::make_shared<JoinHash>(left_input_operator, right_input_operator, join_node->join_mode,
+                                                 primary_join_predicate, std::move(secondary_join_predicates));
+      break;
+    case OperatorType::JoinSortMerge:
+      join_operator = std::make_shared<JoinSortMerge>(left_input_operator, right_input_operator, join_node->join_mode,
+                                                      primary_join_predicate, std::move(secondary_join_predicates));
+      break;
+    case OperatorType::JoinIndex:
+      join_operator = std::make_shared<JoinIndex>(left_input_operator, right_input_operator, join_node->join_mode,
+                                                  primary_join_predicate, std::move(secondary_join_predicates),
+                                                  *cheapest_join.index_side);
+      break;
+    case OperatorType::JoinNestedLoop:
+      join_operator = std::make_shared<JoinNestedLoop>(left_input_operator, right_input_operator, join_node->join_mode,
+                                                       primary_join_predicate, std::move(secondary_join_predicates));
+      break;
+    default:
+      Fail("Unexpected join operator");
+  }
+  join_operator->cost_estimates = JoinCostModel::estimates_to_string(join_cost_estimates);
 
-  // Lacking a proper cost model, we assume JoinHash is always faster than JoinSortMerge, which is faster than
-  // JoinNestedLoop and thus check for an operator compatible with the JoinNode in that order
-  constexpr auto JOIN_OPERATOR_PREFERENCE_ORDER =
-      hana::to_tuple(hana::tuple_t<JoinHash, JoinSortMerge, JoinNestedLoop>);
+  if (cheapest_join.join_type == OperatorType::JoinHash) {
+    _add_runtime_filter(std::static_pointer_cast<JoinHash>(join_operator), join_node,
+                        *join_cost_model.cardinality_estimator);
+  }
 
-  boost::hana::for_each(JOIN_OPERATOR_PREFERENCE_ORDER, [&](const auto join_operator_t) {
-    using JoinOperator = typename decltype(join_operator_t)::type;
+  return join_operator;
+}
 
-    if (join_operator) {
+void LQPTranslator::_add_runtime_filter(const std::shared_ptr<JoinHash>& join_hash,
+                                        const std::shared_ptr<JoinNode>& join_node,
+                                        const AbstractCardinalityEstimator& cardinality_estimator) const {
+  /**
+   * The input that is not filtered (the source) has to be executed before the filtered input (the probe side). Thus,
+   * we only publish a filter if the source is small and the probe side is larger, so that the time that is saved by
+   * dropping probe side rows early outweighs the lost parallelism. The unmatched rows of the probe side must not be
+   * part of the join result.
+   */
+  const auto& primary_predicate = join_hash->primary_predicate();
+  auto source_is_left = false;
+  switch (join_node->join_mode) {
+    case JoinMode::Inner:
+      source_is_left = cardinality_estimator.estimate_cardinality(join_node->left_input()) <
+                       cardinality_estimator.estimate_cardinality(join_node->right_input());
+      break;
+    case JoinMode::Left:
+      source_is_left = true;
+      break;
+    case JoinMode::Right:
+    case JoinMode::Semi:
+      source_is_left = false;
+      break;
+    default:
       return;
+  }
+
+  const auto& source_node = source_is_left ? join_node->left_input() : join_node->right_input();
+  const auto& probe_node = source_is_left ? join_node->right_input() : join_node->left_input();
+  const auto& [left_column_id, right_column_id] = primary_predicate.column_ids;
+  const auto source_column_id = source_is_left ? left_column_id : right_column_id;
+  const auto probe_column_id = source_is_left ? right_column_id : left_column_id;
+
+  // The filter only supports comparisons of equal data types
+  if (source_node->output_expressions()[source_column_id]->data_type() !=
+      probe_node->output_expressions()[probe_column_id]->data_type()) {
+    return;
+  }
+
+  const auto source_row_count = cardinality_estimator.estimate_cardinality(source_node);
+  if (source_row_count > static_cast<Cardinality>(RuntimeFilter::MAX_SOURCE_ROW_COUNT) ||
+      source_row_count >= cardinality_estimator.estimate_cardinality(probe_node)) {
+    return;
+  }
+
+  // Follow the probe side down through TableScans and Validates, which keep the column ids, to the GetTable. The
+  // topmost TableScan and the GetTable use the filter. Operators that are shared with other parts of the plan end the
+  // chain, as their output must not be filtered.
+  auto probe_chain = std::vector<std::shared_ptr<const AbstractOperator>>{};
+  auto table_scan = std::shared_ptr<TableScan>{};
+  auto get_table = std::shared_ptr<GetTable>{};
+  auto op = source_is_left ? join_hash->mutable_right_input() : join_hash->mutable_left_input();
+  while (op && op->consumer_count() == 1) {
+    if (op->type() == OperatorType::TableScan) {
+      probe_chain.emplace_back(op);
+      if (!table_scan) {
+        table_scan = std::static_pointer_cast<TableScan>(op);
+      }
+    } else if (op->type() == OperatorType::Validate) {
+      probe_chain.emplace_back(op);
+    } else if (op->type() == OperatorType::GetTable) {
+      probe_chain.emplace_back(op);
+      get_table = std::static_pointer_cast<GetTable>(op);
+      break;
+    } else {
+      break;
     }
+    op = op->mutable_left_input();
+  }
+
+  if (!table_scan && !get_table) {
+    return;
+  }
 
-    if (JoinOperator::supports({join_node->join_mode, primary_join_predicate.predicate_condition, left_data_type,
-                                right_data_type, !secondary_join_predicates.empty()})) {
-      join_operator = std::make_shared<JoinOperator>(left_input_operator, right_input_operator, join_node->join_mode,
-                                                     primary_join_predicate, std::move(secondary_join_predicates));
+  // Operators below the lowest consumer are not affected by the filter
+  while (probe_chain.back() != get_table && probe_chain.back() != table_scan) {
+    probe_chain.pop_back();
+  }
+
+  // If the probe chain was part of the source's subtree, the source would have to wait for itself
+  const auto& source_operator = source_is_left ? join_hash->left_input() : join_hash->right_input();
+  auto probe_chain_is_shared = false;
+  visit_pqp(source_operator, [&](const auto& source_subtree_op) {
+    if (std::find(probe_chain.cbegin(), probe_chain.cend(), source_subtree_op) != probe_chain.cend()) {
+      probe_chain_is_shared = true;
     }
+    return probe_chain_is_shared ? PQPVisitation::DoNotVisitInputs : PQPVisitation::VisitInputs;
   });
-  Assert(join_operator, "No operator implementation available for join '"s + join_node->description() + "'");
+  if (probe_chain_is_shared) {
+    return;
+  }
 
-  return join_operator;
+  std::reverse(probe_chain.begin(), probe_chain.end());
+  const auto runtime_filter = std::make_shared<RuntimeFilter>(source_operator, source_column_id, probe_chain);
+  if (table_scan) {
+    table_scan->add_runtime_filter(runtime_filter, probe_column_id);
+  }
+  if (get_table) {
+    get_table->add_runtime_filter(runtime_filter, probe_column_id);
+  }
+  join_hash->add_runtime_filter(runtime_filter);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
 
-  const auto input_operator = translate_node(node->left_input());
   const auto& input_expressions = node->left_input()->output_expressions();
   const auto& node_expressions = aggregate_node->node_expressions;
   const auto node_expression_count = node_expressions.size();
@@ -419,17 +605,106 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     Assert(column_id, "GroupBy expression '"s + expression->as_column_name() + "' not available as column");
     group_by_column_ids.emplace_back(*column_id);
   }
+
+  if (_pipelined_execution) {
+    const auto chunk_pipeline =
+        _translate_aggregate_node_to_chunk_pipeline(aggregate_node, pqp_aggregate_expressions, group_by_column_ids);
+    if (chunk_pipeline) {
+      return chunk_pipeline;
+    }
+  }
+
+  const auto input_operator = translate_node(node->left_input());
   return std::make_shared<AggregateHash>(input_operator, pqp_aggregate_expressions, group_by_column_ids);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node_to_chunk_pipeline(
+    const std::shared_ptr<AggregateNode>& aggregate_node,
+    const std::vector<std::shared_ptr<AggregateExpression>>& aggregate_expressions,
+    const std::vector<ColumnID>& group_by_column_ids) const {
+  if (!ChunkPipeline::supports_aggregates(aggregate_expressions, group_by_column_ids)) {
+    return nullptr;
+  }
+
+  // Collect the chain of nodes below the aggregate. Nodes with multiple outputs are translated into regular operators
+  // as their results are needed by other operators as well.
+  auto stages = std::vector<ChunkPipeline::Stage>{};
+  auto input_node = aggregate_node->left_input();
+  while (input_node->output_count() == 1) {
+    const auto stage_input_node = input_node->left_input();
+    auto stage = ChunkPipeline::Stage{};
+
+    if (input_node->type == LQPNodeType::Predicate &&
+        static_cast<const PredicateNode&>(*input_node).scan_type == ScanType::TableScan) {
+      stage.type = OperatorType::TableScan;
+      stage.expressions = _translate_expressions({static_cast<const PredicateNode&>(*input_node).predicate()},
+                                                 stage_input_node);
+    } else if (input_node->type == LQPNodeType::Validate) {
+      stage.type = OperatorType::Validate;
+    } else if (input_node->type == LQPNodeType::Projection) {
+      stage.type = OperatorType::Projection;
+      stage.expressions = _translate_expressions(input_node->node_expressions, stage_input_node);
+    } else {
+      break;
+    }
+
+    // Uncorrelated subqueries would be executed for each chunk
+    if (std::any_of(stage.expressions.cbegin(), stage.expressions.cend(),
+                    [](const auto& expression) { return !find_pqp_subquery_expressions(expression).empty(); })) {
+      break;
+    }
+
+    stages.emplace_back(std::move(stage));
+    input_node = stage_input_node;
+  }
+
+  if (stages.empty()) {
+    return nullptr;
+  }
+
+  std::reverse(stages.begin(), stages.end());
+  return std::make_shared<ChunkPipeline>(translate_node(input_node), stages, aggregate_expressions,
+                                         group_by_column_ids);
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
+  const auto top_k = _translate_limit_node_to_top_k(limit_node);
+  if (top_k) {
+    return top_k;
+  }
+
+  const auto input_operator = translate_node(node->left_input());
   return std::make_shared<Limit>(
       input_operator, _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front());
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node_to_top_k(
+    const std::shared_ptr<LimitNode>& limit_node) const {
+  // The sorted table must not be needed by other operators, as the TopK only produces its first rows
+  const auto sort_node = std::dynamic_pointer_cast<SortNode>(limit_node->left_input());
+  if (!sort_node || sort_node->output_count() != 1) {
+    return nullptr;
+  }
+
+  // Only constant row counts are supported. Parameters (e.g., in prepared statements) are only known at execution.
+  // Invalid row counts are left to the Limit operator, which reports them.
+  const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(limit_node->num_rows_expression());
+  if (!value_expression ||
+      (value_expression->data_type() != DataType::Int && value_expression->data_type() != DataType::Long)) {
+    return nullptr;
+  }
+  const auto row_count = lossless_variant_cast<int64_t>(value_expression->value);
+  if (!row_count || *row_count < 0 || static_cast<size_t>(*row_count) > TopK::MAX_K) {
+    return nullptr;
+  }
+
+  const auto input_operator = translate_node(sort_node->left_input());
+  return std::make_shared<TopK>(input_operator, _translate_sort_column_definitions(sort_node),
+                                static_cast<size_t>(*row_count));
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator = translate_node(node->left_input());
@@ -441,7 +716,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_delete_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator = translate_node(node->left_input());
   auto delete_node = std::dynamic_pointer_cast<DeleteNode>(node);
-  return std::make_shared<Delete>(input_operator);
+  return std::make_shared<Delete>(delete_node->table_name, input_operator);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_update_node(
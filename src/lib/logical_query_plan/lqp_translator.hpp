@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "abstract_lqp_node.hpp"
 #include "all_type_variant.hpp"
@@ -9,10 +10,17 @@
 
 namespace opossum {
 
+class AbstractCardinalityEstimator;
 class AbstractOperator;
+class AggregateNode;
 class TransactionContext;
 class AbstractExpression;
+class AggregateExpression;
+class JoinHash;
+class JoinNode;
+class LimitNode;
 class PredicateNode;
+class SortNode;
 class TableScan;
 struct OperatorScanPredicate;
 struct OperatorJoinPredicate;
@@ -20,9 +28,13 @@ struct OperatorJoinPredicate;
 /**
  * Translates an LQP (Logical Query Plan), represented by its root node, into an Operator tree for the execution
  * engine, which in return is represented by its root Operator.
+ *
+ * With @param pipelined_execution, chains of Predicate, Validate, and Projection nodes below an AggregateNode are
+ * translated into a single ChunkPipeline that processes the input chunk by chunk.
  */
 class LQPTranslator {
  public:
+  explicit LQPTranslator(const bool pipelined_execution = false);
   virtual ~LQPTranslator() = default;
 
   virtual std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -35,14 +47,29 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_predicate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_predicate_node_to_index_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
+  // Returns nullptr if the predicate is not an equality lookup on all columns of a key index
+  std::shared_ptr<AbstractOperator> _translate_predicate_node_to_key_index_scan(
+      const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
   std::shared_ptr<TableScan> _translate_predicate_node_to_table_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
   std::shared_ptr<AbstractOperator> _translate_alias_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::vector<SortColumnDefinition> _translate_sort_column_definitions(
+      const std::shared_ptr<SortNode>& sort_node) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  // Publishes a RuntimeFilter from one input of @param join_hash to the scans of the other input if that is promising
+  void _add_runtime_filter(const std::shared_ptr<JoinHash>& join_hash, const std::shared_ptr<JoinNode>& join_node,
+                           const AbstractCardinalityEstimator& cardinality_estimator) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  // Returns nullptr if the nodes below the aggregate cannot be fused
+  std::shared_ptr<AbstractOperator> _translate_aggregate_node_to_chunk_pipeline(
+      const std::shared_ptr<AggregateNode>& aggregate_node,
+      const std::vector<std::shared_ptr<AggregateExpression>>& aggregate_expressions,
+      const std::vector<ColumnID>& group_by_column_ids) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  // Returns nullptr if the LimitNode and the SortNode below it cannot be fused into a TopK
+  std::shared_ptr<AbstractOperator> _translate_limit_node_to_top_k(const std::shared_ptr<LimitNode>& limit_node) const;
   std::shared_ptr<AbstractOperator> _translate_insert_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_delete_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_dummy_table_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -80,6 +107,8 @@ class LQPTranslator {
   //   - identical operators (operators below a diamond shape)
   //   - equal but not identical operators
   mutable LQPNodeUnorderedMap<std::shared_ptr<AbstractOperator>> _operator_by_lqp_node;
+
+  const bool _pipelined_execution;
 };
 
 }  // namespace opossum
@@ -5,6 +5,7 @@
 #include "expression/expression_utils.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "logical_query_plan/change_meta_table_node.hpp"
+#include "logical_query_plan/delete_node.hpp"
 #include "logical_query_plan/insert_node.hpp"
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
@@ -282,18 +283,9 @@ std::set<std::string> lqp_find_modified_tables(const std::shared_ptr<AbstractLQP
       case LQPNodeType::Update:
         modified_tables.insert(static_cast<UpdateNode&>(*node).table_name);
         break;
-      case LQPNodeType::Delete: {
-        visit_lqp(node->left_input(), [&](const auto& sub_delete_node) {
-          if (const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(sub_delete_node)) {
-            modified_tables.insert(stored_table_node->table_name);
-          } else if (const auto mock_node = std::dynamic_pointer_cast<MockNode>(sub_delete_node)) {
-            if (mock_node->name) {
-              modified_tables.insert(*mock_node->name);
-            }
-          }
-          return LQPVisitation::VisitInputs;
-        });
-      } break;
+      case LQPNodeType::Delete:
+        modified_tables.insert(static_cast<DeleteNode&>(*node).table_name);
+        break;
       case LQPNodeType::ChangeMetaTable:
         modified_tables.insert(static_cast<ChangeMetaTableNode&>(*node).table_name);
         break;
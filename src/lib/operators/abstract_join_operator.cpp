@@ -84,6 +84,10 @@ std::string AbstractJoinOperator::description(DescriptionMode description_mode)
     stream << column_name(false, secondary_predicate.column_ids.second);
   }
 
+  if (description_mode == DescriptionMode::MultiLine && !cost_estimates.empty()) {
+    stream << separator << cost_estimates;
+  }
+
   return stream.str();
 }
 
@@ -48,6 +48,10 @@ class AbstractJoinOperator : public AbstractReadOnlyOperator {
 
   std::string description(DescriptionMode description_mode) const override;
 
+  // Estimated costs of the join operators that the LQPTranslator considered for this join (see JoinCostModel). Part of
+  // the multi-line description, so that the choice is visible in the PQPVisualizer. Empty if not created from an LQP.
+  std::string cost_estimates;
+
  protected:
   const JoinMode _mode;
   const OperatorJoinPredicate _primary_predicate;
@@ -292,6 +292,27 @@ void AbstractOperator::set_transaction_context_recursively(
   }
 }
 
+const std::shared_ptr<MemoryBudget>& AbstractOperator::memory_budget() const {
+  return _memory_budget;
+}
+
+void AbstractOperator::set_memory_budget(const std::shared_ptr<MemoryBudget>& memory_budget) {
+  Assert(_state == OperatorState::Created, "Setting the MemoryBudget is allowed for OperatorState::Created only.");
+  _memory_budget = memory_budget;
+}
+
+void AbstractOperator::set_memory_budget_recursively(const std::shared_ptr<MemoryBudget>& memory_budget) {
+  set_memory_budget(memory_budget);
+
+  if (_left_input) {
+    mutable_left_input()->set_memory_budget_recursively(memory_budget);
+  }
+
+  if (_right_input) {
+    mutable_right_input()->set_memory_budget_recursively(memory_budget);
+  }
+}
+
 std::shared_ptr<AbstractOperator> AbstractOperator::mutable_left_input() const {
   return std::const_pointer_cast<AbstractOperator>(_left_input);
 }
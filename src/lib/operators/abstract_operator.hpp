@@ -14,6 +14,7 @@
 
 namespace opossum {
 
+class MemoryBudget;
 class OperatorTask;
 class Table;
 class TransactionContext;
@@ -22,6 +23,7 @@ enum class OperatorType {
   Aggregate,
   Alias,
   ChangeMetaTable,
+  ChunkPipeline,
   CreateTable,
   CreatePreparedPlan,
   CreateView,
@@ -39,13 +41,16 @@ enum class OperatorType {
   JoinNestedLoop,
   JoinSortMerge,
   JoinVerification,
+  KeyIndexScan,
   Limit,
   Print,
   Product,
   Projection,
+  ReplaceChunk,
   Sort,
   TableScan,
   TableWrapper,
+  TopK,
   UnionAll,
   UnionPositions,
   Update,
@@ -159,6 +164,16 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Calls set_transaction_context on itself and both input operators recursively
   void set_transaction_context_recursively(const std::weak_ptr<TransactionContext>& transaction_context);
 
+  // The MemoryBudget that limits the intermediate data structures of the operator (see MemoryBudget). nullptr if the
+  // memory usage is not limited.
+  const std::shared_ptr<MemoryBudget>& memory_budget() const;
+  void set_memory_budget(const std::shared_ptr<MemoryBudget>& memory_budget);
+
+  // Calls set_memory_budget on itself and both input operators recursively, so that they share the budget. Subqueries
+  // do not get the budget. It is not copied by deep_copy, i.e., the owner of a (cached) plan has to set the budget
+  // for each execution.
+  void set_memory_budget_recursively(const std::shared_ptr<MemoryBudget>& memory_budget);
+
   /**
    * Recursively copies the input operators and
    * @returns a new instance of the same operator with the same configuration. Deduplication of operator plans will be
@@ -251,6 +266,8 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Weak pointer breaks cyclical dependency between operators and context
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
 
+  std::shared_ptr<MemoryBudget> _memory_budget;
+
  private:
   // We track the number of consuming operators to automate the clearing of operator results.
   std::atomic_int32_t _consumer_count = 0;
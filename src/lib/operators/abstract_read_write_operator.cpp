@@ -53,6 +53,13 @@ void AbstractReadWriteOperator::rollback_records() {
   _rw_state = ReadWriteOperatorState::RolledBack;
 }
 
+void AbstractReadWriteOperator::log_records(WriteAheadLogRecord& record) const {
+  Assert(_rw_state == ReadWriteOperatorState::Committed,
+         "Operator needs to have state Committed in order to be logged.");
+
+  _on_log_records(record);
+}
+
 bool AbstractReadWriteOperator::execute_failed() const {
   return _rw_state == ReadWriteOperatorState::Conflicted || _rw_state == ReadWriteOperatorState::RolledBack;
 }
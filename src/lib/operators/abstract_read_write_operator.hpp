@@ -7,6 +7,7 @@
 #include "abstract_operator.hpp"
 
 #include "concurrency/transaction_context.hpp"
+#include "concurrency/write_ahead_log.hpp"
 #include "storage/table.hpp"
 
 #include "utils/assert.hpp"
@@ -48,6 +49,11 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   void rollback_records();
 
+  /**
+   * Adds the committed modifications to the transaction's record for the write-ahead log (see WriteAheadLog).
+   */
+  void log_records(WriteAheadLogRecord& record) const;
+
   /**
    * Returns true if a previous call to _on_execute produced an error.
    */
@@ -80,6 +86,13 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   virtual void _on_rollback_records() = 0;
 
+  /**
+   * Called by log_records. Operators that modify stored tables log their modifications so that they can be recovered.
+   * Operators whose modifications are not persisted (e.g., changes of meta tables) or are logged by other operators
+   * (e.g., Update) do not need to override this.
+   */
+  virtual void _on_log_records(WriteAheadLogRecord& record) const {}
+
   /**
    * This method is used in sub classes in their _on_execute() method.
    *
@@ -137,6 +137,64 @@ AggregateKey& get_aggregate_key([[maybe_unused]] KeysPerChunk<AggregateKey>& key
   }
 }
 
+// Used by the parallel aggregation to combine the results that multiple jobs have calculated for the same group.
+template <typename ColumnDataType, AggregateFunction aggregate_function>
+void merge_aggregate_results(AggregateResult<ColumnDataType, aggregate_function>& target,
+                             const AggregateResult<ColumnDataType, aggregate_function>& source) {
+  // NULL_ROW_ID means that the source is either a gap or the result of overallocating the result vector. Otherwise, any
+  // row of the group can be used to restore the GROUP BY values.
+  if (source.row_id.is_null()) {
+    return;
+  }
+
+  if (target.row_id.is_null()) {
+    target.row_id = source.row_id;
+  }
+
+  // Only aggregate_count is relevant for COUNT. For ANY, nothing has been aggregated.
+  if constexpr (aggregate_function == AggregateFunction::Min) {
+    if (source.aggregate_count > 0 &&
+        (target.aggregate_count == 0 || value_smaller(source.accumulator, target.accumulator))) {
+      target.accumulator = source.accumulator;
+    }
+  } else if constexpr (aggregate_function == AggregateFunction::Max) {
+    if (source.aggregate_count > 0 &&
+        (target.aggregate_count == 0 || value_greater(source.accumulator, target.accumulator))) {
+      target.accumulator = source.accumulator;
+    }
+  } else if constexpr (aggregate_function == AggregateFunction::Sum || aggregate_function == AggregateFunction::Avg) {
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      target.accumulator += source.accumulator;
+    } else {
+      Fail("SUM and AVG are not available for non-arithmetic types.");
+    }
+  } else if constexpr (aggregate_function == AggregateFunction::CountDistinct) {
+    target.accumulator.insert(source.accumulator.begin(), source.accumulator.end());
+  } else if constexpr (aggregate_function == AggregateFunction::StandardDeviationSample) {
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      // Combine the partial results of Welford's algorithm, see
+      // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+      const auto& source_data = source.accumulator;
+      auto& target_data = target.accumulator;
+      if (source_data[0] > 0) {
+        const auto count = target_data[0] + source_data[0];
+        const auto delta = source_data[1] - target_data[1];
+        target_data[1] += delta * source_data[0] / count;
+        target_data[2] += source_data[2] + delta * delta * target_data[0] * source_data[0] / count;
+        target_data[0] = count;
+
+        if (count > 1) {
+          target_data[3] = std::sqrt(target_data[2] / (count - 1));
+        }
+      }
+    } else {
+      Fail("StandardDeviationSample not available for non-arithmetic types.");
+    }
+  }
+
+  target.aggregate_count += source.aggregate_count;
+}
+
 }  // namespace
 
 namespace opossum {
@@ -203,16 +261,16 @@ struct AggregateContext : public AggregateResultContext<ColumnDataType, aggregat
 };
 
 template <typename ColumnDataType, AggregateFunction aggregate_function, typename AggregateKey>
-__attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, ColumnID column_index,
-                                                            const AbstractSegment& abstract_segment,
-                                                            KeysPerChunk<AggregateKey>& keys_per_chunk) {
+__attribute__((hot)) void AggregateHash::_aggregate_segment(
+    ChunkID chunk_id, ColumnID column_index, const AbstractSegment& abstract_segment,
+    KeysPerChunk<AggregateKey>& keys_per_chunk, const std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) {
   using AggregateType = typename AggregateTraits<ColumnDataType, aggregate_function>::AggregateType;
 
   auto aggregator =
       AggregateFunctionBuilder<ColumnDataType, AggregateType, aggregate_function>().get_aggregate_function();
 
   auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, aggregate_function, AggregateKey>>(
-      _contexts_per_column[column_index]);
+      contexts[column_index]);
 
   auto& result_ids = *context.result_ids;
   auto& results = context.results;
@@ -245,7 +303,7 @@ __attribute__((hot)) void AggregateHash::_aggregate_segment(ChunkID chunk_id, Co
   // (and thus more than one context), it makes sense to cache the results indexes, see get_or_add_result for details.
   // Furthermore, if we use the immediate key shortcut (which uses the same code path as caching), we need to pass
   // true_type so that the aggregate keys are checked for immediate access values.
-  if (_contexts_per_column.size() > 1 || _use_immediate_key_shortcut) {
+  if (contexts.size() > 1 || _use_immediate_key_shortcut) {
     segment_iterate<ColumnDataType>(abstract_segment,
                                     [&](const auto& position) { process_position(std::true_type{}, position); });
   } else {
@@ -570,208 +628,330 @@ void AggregateHash::_aggregate() {
 
   /**
    * AGGREGATION STEP
+   *
+   * If multiple workers are available, the chunks are aggregated in parallel (see _aggregate_parallel). The immediate
+   * key shortcut is excluded from this: As its keys are direct indexes into the results vector, each job would need a
+   * results vector covering the entire key range. Aggregating with immediate keys does not involve any hash map
+   * lookups, so the sequential variant is comparatively cheap anyway.
    */
-  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
-
-  if (!_has_aggregate_functions) {
-    /*
-    Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
-    This is important later on when we write the group keys into the table.
-    The template parameters (int32_t, AggregateFunction::Min) do not matter, as we do not calculate an aggregate anyway.
-    */
-    auto context =
-        std::make_shared<AggregateContext<int32_t, AggregateFunction::Min, AggregateKey>>(_expected_result_size);
-
-    _contexts_per_column.push_back(context);
-  }
-
-  /**
-   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
-   * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
-   * and _write_aggregate_output() needs these contexts anyway.
-   */
-  for (ColumnID aggregate_idx{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
-    const auto& aggregate = _aggregates[aggregate_idx];
-
-    const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
-    const auto input_column_id = pqp_column.column_id;
-
-    if (input_column_id == INVALID_COLUMN_ID) {
-      Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
-      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
-      auto context = std::make_shared<AggregateContext<CountColumnType, AggregateFunction::Count, AggregateKey>>(
-          _expected_result_size);
+  const auto chunk_count = input_table->chunk_count();
+  const auto job_count = std::min(size_t{chunk_count}, size_t{Hyrise::get().topology.num_cpus()});
+  if (Hyrise::get().is_multi_threaded() && job_count > 1 && !_use_immediate_key_shortcut) {
+    _aggregate_parallel<AggregateKey>(keys_per_chunk, job_count);
+  } else {
+    _contexts_per_column = _create_aggregate_contexts<AggregateKey>(_expected_result_size);
 
-      _contexts_per_column[aggregate_idx] = context;
-      continue;
+    // Process Chunks and perform aggregations
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      _aggregate_chunk<AggregateKey>(chunk_id, keys_per_chunk, _contexts_per_column);
     }
-    const auto data_type = input_table->column_data_type(input_column_id);
-    _contexts_per_column[aggregate_idx] =
-        _create_aggregate_context<AggregateKey>(data_type, aggregate->aggregate_function);
   }
+  step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
+}
 
-  // Process Chunks and perform aggregations
-  const auto chunk_count = input_table->chunk_count();
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto chunk_in = input_table->get_chunk(chunk_id);
-    if (!chunk_in) {
-      continue;
-    }
+template <typename AggregateKey>
+void AggregateHash::_aggregate_chunk(const ChunkID chunk_id, KeysPerChunk<AggregateKey>& keys_per_chunk,
+                                     const std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) {
+  const auto& input_table = left_input_table();
+  const auto chunk_in = input_table->get_chunk(chunk_id);
+  if (!chunk_in) {
+    return;
+  }
 
-    // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
-    const auto input_chunk_size = chunk_in->size();
+  // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
+  const auto input_chunk_size = chunk_in->size();
 
-    if (!_has_aggregate_functions) {
-      /**
-       * DISTINCT implementation
-       *
-       * In Opossum we handle the SQL keyword DISTINCT by using an aggregate operator with grouping but without 
-       * aggregate functions. All input columns (either explicitly specified as `SELECT DISTINCT a, b, c` OR implicitly
-       * as `SELECT DISTINCT *` are passed as `groupby_column_ids`).
-       *
-       * As the grouping happens as part of the aggregation but no aggregate function exists, we use
-       * `AggregateFunction::Min` as a fake aggregate function whose result will be discarded. From here on, the steps
-       * are the same as they are for a regular grouped aggregate.
-       */
+  if (!_has_aggregate_functions) {
+    /**
+     * DISTINCT implementation
+     *
+     * In Opossum we handle the SQL keyword DISTINCT by using an aggregate operator with grouping but without 
+     * aggregate functions. All input columns (either explicitly specified as `SELECT DISTINCT a, b, c` OR implicitly
+     * as `SELECT DISTINCT *` are passed as `groupby_column_ids`).
+     *
+     * As the grouping happens as part of the aggregation but no aggregate function exists, we use
+     * `AggregateFunction::Min` as a fake aggregate function whose result will be discarded. From here on, the steps
+     * are the same as they are for a regular grouped aggregate.
+     */
 
-      auto context =
-          std::static_pointer_cast<AggregateContext<DistinctColumnType, AggregateFunction::Min, AggregateKey>>(
-              _contexts_per_column[0]);
-
-      auto& result_ids = *context->result_ids;
-      auto& results = context->results;
-
-      // Add value or combination of values is added to the list of distinct value(s). This is done by calling
-      // get_or_add_result, which adds the corresponding entry in the list of GROUP BY values.
-      if (_use_immediate_key_shortcut) {
-        for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-          // We are able to use immediate keys, so pass true_type so that the combined caching/immediate key code path
-          // is enabled in get_or_add_result.
-          get_or_add_result(std::true_type{}, result_ids, results,
-                            get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                            RowID{chunk_id, chunk_offset});
-        }
-      } else {
-        // Same as above, but we do not have immediate keys, so we disable that code path to reduce the complexity of
-        // get_aggregate_key.
-        for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-          get_or_add_result(std::false_type{}, result_ids, results,
-                            get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                            RowID{chunk_id, chunk_offset});
-        }
+    auto context =
+        std::static_pointer_cast<AggregateContext<DistinctColumnType, AggregateFunction::Min, AggregateKey>>(
+            contexts[0]);
+
+    auto& result_ids = *context->result_ids;
+    auto& results = context->results;
+
+    // Add value or combination of values is added to the list of distinct value(s). This is done by calling
+    // get_or_add_result, which adds the corresponding entry in the list of GROUP BY values.
+    if (_use_immediate_key_shortcut) {
+      for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+        // We are able to use immediate keys, so pass true_type so that the combined caching/immediate key code path
+        // is enabled in get_or_add_result.
+        get_or_add_result(std::true_type{}, result_ids, results,
+                          get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                          RowID{chunk_id, chunk_offset});
       }
     } else {
-      ColumnID aggregate_idx{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
-         * We then go through the keys_per_chunk map and count the occurrences of each group key.
-         * The results are saved in the regular aggregate_count variable so that we don't need a
-         * specific output logic for COUNT(*).
-         */
+      // Same as above, but we do not have immediate keys, so we disable that code path to reduce the complexity of
+      // get_aggregate_key.
+      for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+        get_or_add_result(std::false_type{}, result_ids, results,
+                          get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                          RowID{chunk_id, chunk_offset});
+      }
+    }
+  } else {
+    ColumnID aggregate_idx{0};
+    for (const auto& aggregate : _aggregates) {
+      /**
+       * Special COUNT(*) implementation.
+       * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
+       * We then go through the keys_per_chunk map and count the occurrences of each group key.
+       * The results are saved in the regular aggregate_count variable so that we don't need a
+       * specific output logic for COUNT(*).
+       */
 
-        const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
-        const auto input_column_id = pqp_column.column_id;
+      const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+      const auto input_column_id = pqp_column.column_id;
 
-        if (input_column_id == INVALID_COLUMN_ID) {
-          Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
-          auto context =
-              std::static_pointer_cast<AggregateContext<CountColumnType, AggregateFunction::Count, AggregateKey>>(
-                  _contexts_per_column[aggregate_idx]);
+      if (input_column_id == INVALID_COLUMN_ID) {
+        Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
+        auto context =
+            std::static_pointer_cast<AggregateContext<CountColumnType, AggregateFunction::Count, AggregateKey>>(
+                contexts[aggregate_idx]);
 
-          auto& result_ids = *context->result_ids;
-          auto& results = context->results;
+        auto& result_ids = *context->result_ids;
+        auto& results = context->results;
 
-          if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
-            // Not grouped by anything, simply count the number of rows
-            results.resize(1);
-            results[0].aggregate_count += input_chunk_size;
+        if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+          // Not grouped by anything, simply count the number of rows
+          results.resize(1);
+          results[0].aggregate_count += input_chunk_size;
 
-            // We need to set any RowID because the default value (NULL_ROW_ID) would later be skipped. As we are not
-            // reconstructing the GROUP BY values later, the exact value of this row_id does not matter, as long as it
-            // not NULL_ROW_ID.
-            results[0].row_id = RowID{ChunkID{0}, ChunkOffset{0}};
+          // We need to set any RowID because the default value (NULL_ROW_ID) would later be skipped. As we are not
+          // reconstructing the GROUP BY values later, the exact value of this row_id does not matter, as long as it
+          // not NULL_ROW_ID.
+          results[0].row_id = RowID{ChunkID{0}, ChunkOffset{0}};
+        } else {
+          // Count occurrences for each group key -  If we have more than one aggregate function (and thus more than
+          // one context), it makes sense to cache the results indexes, see get_or_add_result for details.
+          if (contexts.size() > 1 || _use_immediate_key_shortcut) {
+            for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+              // Use CacheResultIds==true_type if we have more than one group by column or if the cached result ids
+              // have been written by the immediate key shortcut
+              auto& result =
+                  get_or_add_result(std::true_type{}, result_ids, results,
+                                    get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                                    RowID{chunk_id, chunk_offset});
+              ++result.aggregate_count;
+            }
           } else {
-            // Count occurrences for each group key -  If we have more than one aggregate function (and thus more than
-            // one context), it makes sense to cache the results indexes, see get_or_add_result for details.
-            if (_contexts_per_column.size() > 1 || _use_immediate_key_shortcut) {
-              for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-                // Use CacheResultIds==true_type if we have more than one group by column or if the cached result ids
-                // have been written by the immediate key shortcut
-                auto& result =
-                    get_or_add_result(std::true_type{}, result_ids, results,
-                                      get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                                      RowID{chunk_id, chunk_offset});
-                ++result.aggregate_count;
-              }
-            } else {
-              for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-                auto& result =
-                    get_or_add_result(std::false_type{}, result_ids, results,
-                                      get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                                      RowID{chunk_id, chunk_offset});
-                ++result.aggregate_count;
-              }
+            for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
+              auto& result =
+                  get_or_add_result(std::false_type{}, result_ids, results,
+                                    get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
+                                    RowID{chunk_id, chunk_offset});
+              ++result.aggregate_count;
             }
           }
+        }
 
-          ++aggregate_idx;
-          continue;
+        ++aggregate_idx;
+        continue;
+      }
+
+      const auto abstract_segment = chunk_in->get_segment(input_column_id);
+      const auto data_type = input_table->column_data_type(input_column_id);
+
+      /*
+      Invoke correct aggregator for each segment
+      */
+
+      resolve_data_type(data_type, [&, aggregate](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        switch (aggregate->aggregate_function) {
+          case AggregateFunction::Min:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Max:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Sum:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Avg:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Count:
+            _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::CountDistinct:
+            _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::StandardDeviationSample:
+            _aggregate_segment<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>(
+                chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk, contexts);
+            break;
+          case AggregateFunction::Any:
+            // ANY is a pseudo-function and is handled by _write_groupby_output
+            break;
         }
+      });
 
-        const auto abstract_segment = chunk_in->get_segment(input_column_id);
-        const auto data_type = input_table->column_data_type(input_column_id);
+      ++aggregate_idx;
+    }
+  }
+}  // NOLINT(readability/fn_size)
 
-        /*
-        Invoke correct aggregator for each segment
-        */
+template <typename AggregateKey>
+void AggregateHash::_aggregate_parallel(KeysPerChunk<AggregateKey>& keys_per_chunk, const size_t job_count) {
+  const auto chunk_count = left_input_table()->chunk_count();
+
+  // The index of the context whose result_ids map sees every group first. If more than one context is used, the
+  // following contexts might only see cached result ids (see get_or_add_result) and thus have incomplete maps.
+  auto key_context_index = ColumnID{0};
+  if (_has_aggregate_functions) {
+    while (_aggregates[key_context_index]->aggregate_function == AggregateFunction::Any) {
+      ++key_context_index;
+    }
+  }
 
-        resolve_data_type(data_type, [&, aggregate](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
+  // Groups are assigned to partitions by their hash. Each partition is merged by a separate job.
+  const auto partition_count = std::is_same_v<AggregateKey, EmptyAggregateKey> ? size_t{1} : job_count;
 
-          switch (aggregate->aggregate_function) {
-            case AggregateFunction::Min:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Max:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Sum:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Avg:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Count:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::CountDistinct:
-              _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::StandardDeviationSample:
-              _aggregate_segment<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>(
-                  chunk_id, aggregate_idx, *abstract_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Any:
-              // ANY is a pseudo-function and is handled by _write_groupby_output
-              break;
+  /**
+   * LOCAL AGGREGATION: Each job aggregates a consecutive range of chunks into its own contexts. Afterwards, it scatters
+   * the (AggregateKey, local AggregateResultId) pairs of its groups into the partitions.
+   */
+  auto contexts_per_job = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(job_count);
+  auto keys_per_job_and_partition =
+      std::vector<std::vector<std::vector<std::pair<AggregateKey, AggregateResultId>>>>(job_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(job_count);
+  for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, job_id]() {
+      auto& contexts = contexts_per_job[job_id];
+      contexts = _create_aggregate_contexts<AggregateKey>(0);
+
+      const auto first_chunk_id = static_cast<ChunkID::base_type>(chunk_count * job_id / job_count);
+      const auto last_chunk_id = static_cast<ChunkID::base_type>(chunk_count * (job_id + 1) / job_count);
+      for (auto chunk_id = ChunkID{first_chunk_id}; chunk_id < last_chunk_id; ++chunk_id) {
+        _aggregate_chunk<AggregateKey>(chunk_id, keys_per_chunk, contexts);
+      }
+
+      if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+        auto& keys_per_partition = keys_per_job_and_partition[job_id];
+        keys_per_partition.resize(partition_count);
+
+        _visit_result_contexts<AggregateKey>([&](const ColumnID context_index, const auto context_type) {
+          if (context_index != key_context_index) {
+            return;
+          }
+
+          using Context = typename decltype(context_type)::type;
+          const auto& result_ids = *static_cast<const Context&>(*contexts[context_index]).result_ids;
+          for (const auto& [key, result_id] : result_ids) {
+            keys_per_partition[std::hash<AggregateKey>{}(key) % partition_count].emplace_back(key, result_id);
           }
         });
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
 
-        ++aggregate_idx;
+  /**
+   * PARTITION MAPPING: For each partition, the groups seen by the different jobs are mapped to a dense range of
+   * partition-local ids. For each job, we store pairs of (local AggregateResultId, partition-local id).
+   */
+  auto assignments_per_partition =
+      std::vector<std::vector<std::vector<std::pair<AggregateResultId, AggregateResultId>>>>(partition_count);
+  auto group_count_per_partition = std::vector<size_t>(partition_count);
+
+  jobs.clear();
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto& assignments_per_job = assignments_per_partition[partition_id];
+      assignments_per_job.resize(job_count);
+
+      if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+        // There is only a single group. Jobs that did not see any row have no valid result, which is checked when
+        // merging.
+        for (auto& assignments : assignments_per_job) {
+          assignments.emplace_back(0, 0);
+        }
+        group_count_per_partition[partition_id] = 1;
+      } else {
+        auto buffer = boost::container::pmr::monotonic_buffer_resource{};
+        auto partition_result_ids =
+            AggregateResultIdMap<AggregateKey>{AggregateResultIdMapAllocator<AggregateKey>{&buffer}};
+
+        for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+          const auto& keys = keys_per_job_and_partition[job_id][partition_id];
+          auto& assignments = assignments_per_job[job_id];
+          assignments.reserve(keys.size());
+
+          for (const auto& [key, result_id] : keys) {
+            const auto [iter, _] = partition_result_ids.try_emplace(key, partition_result_ids.size());
+            assignments.emplace_back(result_id, iter->second);
+          }
+        }
+
+        group_count_per_partition[partition_id] = partition_result_ids.size();
       }
-    }
+    }));
   }
-  step_performance_data.set_step_runtime(OperatorSteps::Aggregating, timer.lap());
-}  // NOLINT(readability/fn_size)
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  /**
+   * MERGING: The partitions are written to consecutive ranges of the final results, so that the partitions can be
+   * merged in parallel without further synchronization.
+   */
+  auto offset_per_partition = std::vector<size_t>(partition_count);
+  auto total_group_count = size_t{0};
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    offset_per_partition[partition_id] = total_group_count;
+    total_group_count += group_count_per_partition[partition_id];
+  }
+
+  _contexts_per_column = _create_aggregate_contexts<AggregateKey>(0);
+  _visit_result_contexts<AggregateKey>([&](const ColumnID context_index, const auto context_type) {
+    using Context = typename decltype(context_type)::type;
+    static_cast<Context&>(*_contexts_per_column[context_index]).results.resize(total_group_count);
+  });
+
+  jobs.clear();
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      const auto offset = offset_per_partition[partition_id];
+      const auto& assignments_per_job = assignments_per_partition[partition_id];
+
+      _visit_result_contexts<AggregateKey>([&](const ColumnID context_index, const auto context_type) {
+        using Context = typename decltype(context_type)::type;
+        auto& target_results = static_cast<Context&>(*_contexts_per_column[context_index]).results;
+
+        for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+          const auto& source_results = static_cast<const Context&>(*contexts_per_job[job_id][context_index]).results;
+          for (const auto& [source_result_id, target_result_id] : assignments_per_job[job_id]) {
+            // The results vector of following contexts might be shorter if the last groups have not been seen.
+            if (source_result_id >= source_results.size()) {
+              continue;
+            }
+            merge_aggregate_results(target_results[offset + target_result_id], source_results[source_result_id]);
+          }
+        }
+      });
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
 
 std::shared_ptr<const Table> AggregateHash::_on_execute() {
   // We do not want the overhead of a vector with heap storage when we have a limited number of aggregate columns.
@@ -1186,10 +1366,10 @@ void AggregateHash::write_aggregate_output(ColumnID aggregate_index) {
 
 template <typename AggregateKey>
 std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
-    const DataType data_type, const AggregateFunction aggregate_function) const {
+    const DataType data_type, const AggregateFunction aggregate_function, const size_t preallocated_size) const {
   std::shared_ptr<SegmentVisitorContext> context;
   resolve_data_type(data_type, [&](auto type) {
-    const auto size = _expected_result_size.load();
+    const auto size = preallocated_size;
     using ColumnDataType = typename decltype(type)::type;
     switch (aggregate_function) {
       case AggregateFunction::Min:
@@ -1224,4 +1404,107 @@ std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
   return context;
 }
 
+template <typename AggregateKey>
+std::vector<std::shared_ptr<SegmentVisitorContext>> AggregateHash::_create_aggregate_contexts(
+    const size_t preallocated_size) const {
+  const auto& input_table = left_input_table();
+
+  auto contexts = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+
+  if (!_has_aggregate_functions) {
+    /*
+    Insert a dummy context for the DISTINCT implementation.
+    That way, contexts will always have at least one context with results.
+    This is important later on when we write the group keys into the table.
+    The template parameters (int32_t, AggregateFunction::Min) do not matter, as we do not calculate an aggregate anyway.
+    */
+    auto context = std::make_shared<AggregateContext<int32_t, AggregateFunction::Min, AggregateKey>>(preallocated_size);
+
+    contexts.push_back(context);
+  }
+
+  /**
+   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
+   * created on. We do this before iterating over the chunks because there might be no Chunks in the input and
+   * _write_aggregate_output() needs these contexts anyway.
+   */
+  for (ColumnID aggregate_idx{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+    const auto& aggregate = _aggregates[aggregate_idx];
+
+    const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+    const auto input_column_id = pqp_column.column_id;
+
+    if (input_column_id == INVALID_COLUMN_ID) {
+      Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
+      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
+      auto context = std::make_shared<AggregateContext<CountColumnType, AggregateFunction::Count, AggregateKey>>(
+          preallocated_size);
+
+      contexts[aggregate_idx] = context;
+      continue;
+    }
+    const auto data_type = input_table->column_data_type(input_column_id);
+    contexts[aggregate_idx] =
+        _create_aggregate_context<AggregateKey>(data_type, aggregate->aggregate_function, preallocated_size);
+  }
+
+  return contexts;
+}
+
+template <typename AggregateKey, typename Functor>
+void AggregateHash::_visit_result_contexts(const Functor& functor) const {
+  if (!_has_aggregate_functions) {
+    // The DISTINCT implementation only uses the first context, see _aggregate_chunk.
+    functor(ColumnID{0}, hana::type_c<AggregateContext<DistinctColumnType, AggregateFunction::Min, AggregateKey>>);
+    return;
+  }
+
+  const auto& input_table = left_input_table();
+  for (ColumnID aggregate_idx{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+    const auto& aggregate = _aggregates[aggregate_idx];
+
+    const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+    const auto input_column_id = pqp_column.column_id;
+
+    if (input_column_id == INVALID_COLUMN_ID) {
+      functor(aggregate_idx, hana::type_c<AggregateContext<CountColumnType, AggregateFunction::Count, AggregateKey>>);
+      continue;
+    }
+
+    resolve_data_type(input_table->column_data_type(input_column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      switch (aggregate->aggregate_function) {
+        case AggregateFunction::Min:
+          functor(aggregate_idx, hana::type_c<AggregateContext<ColumnDataType, AggregateFunction::Min, AggregateKey>>);
+          break;
+        case AggregateFunction::Max:
+          functor(aggregate_idx, hana::type_c<AggregateContext<ColumnDataType, AggregateFunction::Max, AggregateKey>>);
+          break;
+        case AggregateFunction::Sum:
+          functor(aggregate_idx, hana::type_c<AggregateContext<ColumnDataType, AggregateFunction::Sum, AggregateKey>>);
+          break;
+        case AggregateFunction::Avg:
+          functor(aggregate_idx, hana::type_c<AggregateContext<ColumnDataType, AggregateFunction::Avg, AggregateKey>>);
+          break;
+        case AggregateFunction::Count:
+          functor(aggregate_idx,
+                  hana::type_c<AggregateContext<ColumnDataType, AggregateFunction::Count, AggregateKey>>);
+          break;
+        case AggregateFunction::CountDistinct:
+          functor(aggregate_idx,
+                  hana::type_c<AggregateContext<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>>);
+          break;
+        case AggregateFunction::StandardDeviationSample:
+          functor(
+              aggregate_idx,
+              hana::type_c<AggregateContext<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>>);
+          break;
+        case AggregateFunction::Any:
+          // ANY is a pseudo-function and is handled by _write_groupby_output
+          break;
+      }
+    });
+  }
+}
+
 }  // namespace opossum
@@ -165,6 +165,16 @@ class AggregateHash : public AbstractAggregateOperator {
   template <typename AggregateKey>
   void _aggregate();
 
+  // Aggregates the given chunk into the given contexts (one per aggregate, plus the DISTINCT dummy context).
+  template <typename AggregateKey>
+  void _aggregate_chunk(ChunkID chunk_id, KeysPerChunk<AggregateKey>& keys_per_chunk,
+                        const std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts);
+
+  // Parallel aggregation: Ranges of chunks are aggregated into job-local contexts, which are then merged by
+  // hash-partitioning the groups. The result is written to _contexts_per_column.
+  template <typename AggregateKey>
+  void _aggregate_parallel(KeysPerChunk<AggregateKey>& keys_per_chunk, size_t job_count);
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
       const std::shared_ptr<AbstractOperator>& copied_right_input,
@@ -182,11 +192,21 @@ class AggregateHash : public AbstractAggregateOperator {
 
   template <typename ColumnDataType, AggregateFunction aggregate_function, typename AggregateKey>
   void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const AbstractSegment& abstract_segment,
-                          KeysPerChunk<AggregateKey>& keys_per_chunk);
+                          KeysPerChunk<AggregateKey>& keys_per_chunk,
+                          const std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts);
 
   template <typename AggregateKey>
   std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
-                                                                   const AggregateFunction aggregate_function) const;
+                                                                   const AggregateFunction aggregate_function,
+                                                                   const size_t preallocated_size) const;
+
+  template <typename AggregateKey>
+  std::vector<std::shared_ptr<SegmentVisitorContext>> _create_aggregate_contexts(size_t preallocated_size) const;
+
+  // Calls functor(context_index, hana::type<AggregateContext<...>>) for every context that holds aggregate results,
+  // i.e., for the DISTINCT context or for all non-ANY aggregates.
+  template <typename AggregateKey, typename Functor>
+  void _visit_result_contexts(const Functor& functor) const;
 
   std::vector<std::shared_ptr<BaseValueSegment>> _groupby_segments;
   std::vector<std::shared_ptr<SegmentVisitorContext>> _contexts_per_column;
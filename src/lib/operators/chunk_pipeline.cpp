@@ -0,0 +1,357 @@
+#include "chunk_pipeline.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace opossum {
+
+ChunkPipeline::ChunkPipeline(const std::shared_ptr<const AbstractOperator>& input_operator,
+                             const std::vector<Stage>& init_stages,
+                             const std::vector<std::shared_ptr<AggregateExpression>>& init_aggregates,
+                             const std::vector<ColumnID>& init_groupby_column_ids)
+    : AbstractReadOnlyOperator(OperatorType::ChunkPipeline, input_operator, nullptr,
+                               std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
+      stages(init_stages),
+      aggregates(init_aggregates),
+      groupby_column_ids(init_groupby_column_ids) {
+  Assert(supports_aggregates(aggregates, groupby_column_ids), "Aggregates cannot be merged from partial aggregates");
+  for (const auto& stage : stages) {
+    Assert(stage.type == OperatorType::TableScan || stage.type == OperatorType::Validate ||
+               stage.type == OperatorType::Projection,
+           "Only TableScans, Validates, and Projections can be pipelined");
+    Assert(stage.type != OperatorType::TableScan || stage.expressions.size() == 1, "Expected a single scan predicate");
+    for (const auto& expression : stage.expressions) {
+      // Uncorrelated subqueries would be executed again for each chunk
+      Assert(find_pqp_subquery_expressions(expression).empty(), "Pipelined expressions must not contain subqueries");
+    }
+  }
+
+  // The partial result consists of the group-by columns followed by the partial aggregates
+  auto partial_column_id = static_cast<ColumnID::base_type>(groupby_column_ids.size());
+  for (const auto& aggregate : aggregates) {
+    _partial_column_ids.emplace_back(partial_column_id);
+    if (aggregate->aggregate_function == AggregateFunction::Avg) {
+      _partial_aggregates.emplace_back(
+          std::make_shared<AggregateExpression>(AggregateFunction::Sum, aggregate->argument()));
+      _partial_aggregates.emplace_back(
+          std::make_shared<AggregateExpression>(AggregateFunction::Count, aggregate->argument()));
+      partial_column_id += 2;
+    } else {
+      _partial_aggregates.emplace_back(aggregate);
+      ++partial_column_id;
+    }
+  }
+}
+
+const std::string& ChunkPipeline::name() const {
+  static const auto name = std::string{"ChunkPipeline"};
+  return name;
+}
+
+std::string ChunkPipeline::description(DescriptionMode description_mode) const {
+  const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+
+  std::stringstream stream;
+  stream << AbstractOperator::description(description_mode);
+  for (const auto& stage : stages) {
+    stream << separator;
+    switch (stage.type) {
+      case OperatorType::TableScan:
+        stream << "-> TableScan " << stage.expressions.front()->as_column_name();
+        break;
+      case OperatorType::Validate:
+        stream << "-> Validate";
+        break;
+      default:
+        stream << "-> Projection "
+               << expression_descriptions(stage.expressions, AbstractExpression::DescriptionMode::ColumnName);
+    }
+  }
+
+  stream << separator << "-> Aggregate GroupBy {";
+  for (auto groupby_column_idx = size_t{0}; groupby_column_idx < groupby_column_ids.size(); ++groupby_column_idx) {
+    stream << (groupby_column_idx > 0 ? ", " : "") << "Column #" << groupby_column_ids[groupby_column_idx];
+  }
+  stream << "}";
+  for (const auto& aggregate : aggregates) {
+    stream << " " << aggregate->as_column_name();
+  }
+  return stream.str();
+}
+
+bool ChunkPipeline::supports_aggregates(const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
+                                        const std::vector<ColumnID>& groupby_column_ids) {
+  return std::all_of(aggregates.cbegin(), aggregates.cend(), [&](const auto& aggregate) {
+    switch (aggregate->aggregate_function) {
+      case AggregateFunction::Min:
+      case AggregateFunction::Max:
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+      case AggregateFunction::Count:
+        return true;
+      case AggregateFunction::Any:
+        // Without GROUP BY, each chunk contributes a row, even if it does not have any (matching) rows. ANY() would
+        // pick the NULL value of such a row.
+        return !groupby_column_ids.empty();
+      case AggregateFunction::CountDistinct:
+      case AggregateFunction::StandardDeviationSample:
+        return false;
+    }
+    Fail("Invalid enum value");
+  });
+}
+
+std::shared_ptr<AbstractOperator> ChunkPipeline::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  auto copied_stages = std::vector<Stage>{};
+  copied_stages.reserve(stages.size());
+  for (const auto& stage : stages) {
+    copied_stages.emplace_back(Stage{stage.type, expressions_deep_copy(stage.expressions, copied_ops)});
+  }
+
+  auto copied_aggregates = std::vector<std::shared_ptr<AggregateExpression>>{};
+  copied_aggregates.reserve(aggregates.size());
+  for (const auto& aggregate : aggregates) {
+    copied_aggregates.emplace_back(std::static_pointer_cast<AggregateExpression>(aggregate->deep_copy(copied_ops)));
+  }
+
+  return std::make_shared<ChunkPipeline>(copied_left_input, copied_stages, copied_aggregates, groupby_column_ids);
+}
+
+void ChunkPipeline::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  // The operators of each chunk share the expressions of the stages
+  for (const auto& stage : stages) {
+    expressions_set_parameters(stage.expressions, parameters);
+  }
+}
+
+void ChunkPipeline::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  for (const auto& stage : stages) {
+    expressions_set_transaction_context(stage.expressions, transaction_context);
+  }
+}
+
+std::shared_ptr<const Table> ChunkPipeline::_on_execute() {
+  Timer timer;
+  const auto input_table = left_input_table();
+  const auto chunk_count = input_table->chunk_count();
+
+  auto partial_results = std::vector<std::shared_ptr<const Table>>(chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    if (!chunk || chunk->size() == 0) {
+      continue;
+    }
+
+    // The morsel holds the chunk itself, so that the TableScan can use the scan implementations for (encoded) data
+    // segments instead of dereferencing ReferenceSegments. The output of the pipeline only holds aggregated values,
+    // so that no ReferenceSegments that point to the morsel can escape.
+    auto morsel_chunks = std::vector<std::shared_ptr<Chunk>>{std::const_pointer_cast<Chunk>(chunk)};
+    const auto morsel = std::make_shared<Table>(input_table->column_definitions(), input_table->type(),
+                                                std::move(morsel_chunks), input_table->uses_mvcc());
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, morsel, chunk_id]() {
+      partial_results[chunk_id] = _execute_pipeline(morsel);
+    }));
+  }
+
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  partial_results.erase(std::remove(partial_results.begin(), partial_results.end(), nullptr), partial_results.end());
+  if (partial_results.empty()) {
+    // Execute the pipeline on an empty table to retrieve the column definitions of the partial result and, without
+    // GROUP BY, the aggregates of an empty input (e.g., COUNT(*) = 0)
+    partial_results.emplace_back(
+        _execute_pipeline(std::make_shared<Table>(input_table->column_definitions(), input_table->type(),
+                                                  std::vector<std::shared_ptr<Chunk>>{}, input_table->uses_mvcc())));
+  }
+
+  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
+  step_performance_data.set_step_runtime(OperatorSteps::ExecutePipelines, timer.lap());
+
+  auto output = _merge_partial_aggregates(partial_results);
+  step_performance_data.set_step_runtime(OperatorSteps::MergeAggregates, timer.lap());
+
+  return output;
+}
+
+std::shared_ptr<const Table> ChunkPipeline::_execute_pipeline(const std::shared_ptr<Table>& morsel) const {
+  auto current_operator = std::shared_ptr<AbstractOperator>{std::make_shared<TableWrapper>(morsel)};
+  current_operator->execute();
+
+  // Each operator deregisters from its input when it is executed, so that the intermediate result of the previous
+  // stage is released right away.
+  for (const auto& stage : stages) {
+    switch (stage.type) {
+      case OperatorType::TableScan:
+        current_operator = std::make_shared<TableScan>(current_operator, stage.expressions.front());
+        break;
+      case OperatorType::Validate:
+        current_operator = std::make_shared<Validate>(current_operator);
+        current_operator->set_transaction_context(transaction_context());
+        break;
+      default:
+        current_operator = std::make_shared<Projection>(current_operator, stage.expressions);
+    }
+    current_operator->execute();
+  }
+
+  const auto partial_aggregate = std::make_shared<AggregateHash>(current_operator, _partial_aggregates,
+                                                                 groupby_column_ids);
+  partial_aggregate->execute();
+  return partial_aggregate->get_output();
+}
+
+std::shared_ptr<const Table> ChunkPipeline::_merge_partial_aggregates(
+    const std::vector<std::shared_ptr<const Table>>& partial_results) const {
+  const auto& partial_column_definitions = partial_results.front()->column_definitions();
+
+  auto partial_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  for (const auto& partial_result : partial_results) {
+    const auto chunk_count = partial_result->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      partial_chunks.emplace_back(std::const_pointer_cast<Chunk>(partial_result->get_chunk(chunk_id)));
+    }
+  }
+  const auto partial_table =
+      std::make_shared<Table>(partial_column_definitions, TableType::Data, std::move(partial_chunks));
+
+  // Merge the partial aggregates of each group: partial COUNTs and SUMs are summed up, MIN, MAX, and ANY are applied
+  // again.
+  const auto groupby_column_count = groupby_column_ids.size();
+  auto merge_groupby_column_ids = std::vector<ColumnID>(groupby_column_count);
+  std::iota(merge_groupby_column_ids.begin(), merge_groupby_column_ids.end(), ColumnID{0});
+
+  auto merge_aggregates = std::vector<std::shared_ptr<AggregateExpression>>{};
+  merge_aggregates.reserve(_partial_aggregates.size());
+  for (auto partial_aggregate_idx = size_t{0}; partial_aggregate_idx < _partial_aggregates.size();
+       ++partial_aggregate_idx) {
+    const auto column_id = static_cast<ColumnID>(groupby_column_count + partial_aggregate_idx);
+    const auto partial_column = std::make_shared<PQPColumnExpression>(
+        column_id, partial_table->column_data_type(column_id), partial_table->column_is_nullable(column_id),
+        partial_table->column_name(column_id));
+
+    auto merge_function = AggregateFunction::Sum;
+    const auto partial_function = _partial_aggregates[partial_aggregate_idx]->aggregate_function;
+    if (partial_function == AggregateFunction::Min || partial_function == AggregateFunction::Max ||
+        partial_function == AggregateFunction::Any) {
+      merge_function = partial_function;
+    }
+    merge_aggregates.emplace_back(std::make_shared<AggregateExpression>(merge_function, partial_column));
+  }
+
+  const auto partial_table_wrapper = std::make_shared<TableWrapper>(partial_table);
+  partial_table_wrapper->execute();
+  const auto merge_aggregate =
+      std::make_shared<AggregateHash>(partial_table_wrapper, merge_aggregates, merge_groupby_column_ids);
+  merge_aggregate->execute();
+  const auto merged_table = merge_aggregate->get_output();
+
+  // Build the output with the columns of the replaced AggregateHash. The merged COUNTs are SUMs, which are nullable.
+  // The AVGs still have to be computed from their SUMs and COUNTs.
+  auto output_column_definitions = TableColumnDefinitions{};
+  for (auto column_id = ColumnID{0}; column_id < groupby_column_count; ++column_id) {
+    output_column_definitions.emplace_back(merged_table->column_definitions()[column_id]);
+  }
+  for (const auto& aggregate : aggregates) {
+    const auto nullable = aggregate->aggregate_function != AggregateFunction::Count;
+    output_column_definitions.emplace_back(aggregate->as_column_name(), aggregate->data_type(), nullable);
+  }
+
+  const auto output = std::make_shared<Table>(output_column_definitions, TableType::Data);
+  const auto chunk_count = merged_table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto merged_chunk = merged_table->get_chunk(chunk_id);
+
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < groupby_column_count; ++column_id) {
+      segments.emplace_back(merged_chunk->get_segment(column_id));
+    }
+
+    const auto aggregate_count = aggregates.size();
+    for (auto aggregate_idx = size_t{0}; aggregate_idx < aggregate_count; ++aggregate_idx) {
+      const auto column_id = _partial_column_ids[aggregate_idx];
+      const auto& segment = merged_chunk->get_segment(column_id);
+
+      switch (aggregates[aggregate_idx]->aggregate_function) {
+        case AggregateFunction::Count: {
+          // A group without any partial COUNT only exists without GROUP BY if the input is empty
+          const auto& sum_segment = static_cast<const ValueSegment<int64_t>&>(*segment);
+          auto counts = pmr_vector<int64_t>(sum_segment.values().begin(), sum_segment.values().end());
+          if (sum_segment.is_nullable()) {
+            const auto& null_values = sum_segment.null_values();
+            for (auto row = size_t{0}; row < counts.size(); ++row) {
+              if (null_values[row]) {
+                counts[row] = 0;
+              }
+            }
+          }
+          segments.emplace_back(std::make_shared<ValueSegment<int64_t>>(std::move(counts)));
+        } break;
+
+        case AggregateFunction::Avg: {
+          const auto count_column_id = static_cast<ColumnID>(column_id + 1);
+          const auto& count_segment =
+              static_cast<const ValueSegment<int64_t>&>(*merged_chunk->get_segment(count_column_id));
+          const auto row_count = count_segment.size();
+          auto averages = pmr_vector<double>(row_count);
+          auto null_values = pmr_vector<bool>(row_count);
+
+          resolve_data_type(merged_table->column_data_type(column_id), [&](const auto data_type_t) {
+            using SumDataType = typename decltype(data_type_t)::type;
+            if constexpr (std::is_arithmetic_v<SumDataType>) {
+              const auto& sum_segment = static_cast<const ValueSegment<SumDataType>&>(*segment);
+              for (auto row = ChunkOffset{0}; row < row_count; ++row) {
+                const auto sum = sum_segment.get_typed_value(row);
+                const auto count = count_segment.get_typed_value(row).value_or(0);
+                if (!sum || count == 0) {
+                  null_values[row] = true;
+                  continue;
+                }
+                averages[row] = static_cast<double>(*sum) / static_cast<double>(count);
+              }
+            } else {
+              Fail("AVG requires a numerical argument");
+            }
+          });
+          segments.emplace_back(std::make_shared<ValueSegment<double>>(std::move(averages), std::move(null_values)));
+        } break;
+
+        default:
+          segments.emplace_back(segment);
+      }
+    }
+
+    output->append_chunk(segments);
+  }
+
+  return output;
+}
+
+}  // namespace opossum
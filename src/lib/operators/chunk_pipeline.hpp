@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstdint>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/abstract_expression.hpp"
+#include "expression/aggregate_expression.hpp"
+
+namespace opossum {
+
+/**
+ * Fused execution of a chain of TableScans, Validates, and Projections that ends in a hash aggregation, e.g.,
+ *
+ *   GetTable -> Validate -> TableScan -> Projection -> AggregateHash      (TPC-H Q1, Q6)
+ *
+ * Instead of materializing the complete output table of each operator before the next one starts, each chunk of the
+ * input table flows through the entire chain within a single JobTask (morsel-driven execution). For each chunk,
+ * the operators of the chain are instantiated on a table that only holds this chunk, so that their intermediate
+ * position lists and segments are small and released as soon as the next operator has consumed them. The chain ends
+ * with a partial AggregateHash per chunk. Once all chunks are processed, the partial aggregates are merged into the
+ * final result, e.g., the partial SUMs of each group are summed up and an AVG is the sum of the partial SUMs divided
+ * by the sum of the partial COUNTs. Hence, only decomposable aggregate functions are supported (see
+ * supports_aggregates).
+ *
+ * The output has the same columns as the AggregateHash that it replaces. ChunkPipelines are created by the
+ * LQPTranslator if pipelined execution is enabled (see SQLPipelineBuilder::with_pipelined_execution).
+ */
+class ChunkPipeline : public AbstractReadOnlyOperator {
+ public:
+  // A TableScan, Validate, or Projection that is executed for each chunk. Stages are ordered from the input to the
+  // aggregate.
+  struct Stage {
+    OperatorType type;
+
+    // The predicate of a TableScan (single element) or the expressions of a Projection. Empty for a Validate.
+    std::vector<std::shared_ptr<AbstractExpression>> expressions;
+  };
+
+  ChunkPipeline(const std::shared_ptr<const AbstractOperator>& input_operator, const std::vector<Stage>& init_stages,
+                const std::vector<std::shared_ptr<AggregateExpression>>& init_aggregates,
+                const std::vector<ColumnID>& init_groupby_column_ids);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  // @return whether the @param aggregates can be computed per chunk and merged afterwards
+  static bool supports_aggregates(const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
+                                  const std::vector<ColumnID>& groupby_column_ids);
+
+  enum class OperatorSteps : uint8_t { ExecutePipelines, MergeAggregates };
+
+  const std::vector<Stage> stages;
+  const std::vector<std::shared_ptr<AggregateExpression>> aggregates;
+  const std::vector<ColumnID> groupby_column_ids;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const override;
+
+  // Executes the stages and the partial aggregation on @param morsel, a table with (at most) one chunk of the input
+  std::shared_ptr<const Table> _execute_pipeline(const std::shared_ptr<Table>& morsel) const;
+
+  // Merges the partial aggregates of all chunks into the output table
+  std::shared_ptr<const Table> _merge_partial_aggregates(
+      const std::vector<std::shared_ptr<const Table>>& partial_results) const;
+
+  // The aggregates that are computed per chunk. AVG is split into SUM and COUNT, all other aggregates are computed as
+  // they are. _partial_column_ids[aggregate_idx] is the column of the first partial aggregate of each aggregate in the
+  // partial result.
+  std::vector<std::shared_ptr<AggregateExpression>> _partial_aggregates;
+  std::vector<ColumnID> _partial_column_ids;
+};
+
+}  // namespace opossum
@@ -12,14 +12,20 @@
 
 namespace opossum {
 
-Delete::Delete(const std::shared_ptr<const AbstractOperator>& referencing_table_op)
-    : AbstractReadWriteOperator{OperatorType::Delete, referencing_table_op}, _transaction_id{0} {}
+Delete::Delete(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& referencing_table_op)
+    : AbstractReadWriteOperator{OperatorType::Delete, referencing_table_op},
+      _table_name{table_name},
+      _transaction_id{0} {}
 
 const std::string& Delete::name() const {
   static const auto name = std::string{"Delete"};
   return name;
 }
 
+void Delete::disable_write_ahead_logging() {
+  _write_ahead_logging_enabled = false;
+}
+
 std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionContext> context) {
   _referencing_table = left_input_table();
 
@@ -134,11 +140,26 @@ void Delete::_on_rollback_records() {
   }
 }
 
+void Delete::_on_log_records(WriteAheadLogRecord& record) const {
+  if (!_write_ahead_logging_enabled) {
+    return;
+  }
+
+  const auto chunk_count = _referencing_table->chunk_count();
+  for (auto referencing_chunk_id = ChunkID{0}; referencing_chunk_id < chunk_count; ++referencing_chunk_id) {
+    const auto referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
+    const auto referencing_segment =
+        std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
+
+    record.log_invalidation(_table_name, *referencing_segment->pos_list());
+  }
+}
+
 std::shared_ptr<AbstractOperator> Delete::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input,
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
-  return std::make_shared<Delete>(copied_left_input);
+  return std::make_shared<Delete>(_table_name, copied_left_input);
 }
 
 void Delete::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -16,10 +16,14 @@ namespace opossum {
  */
 class Delete : public AbstractReadWriteOperator {
  public:
-  explicit Delete(const std::shared_ptr<const AbstractOperator>& referencing_table_op);
+  Delete(const std::string& table_name, const std::shared_ptr<const AbstractOperator>& referencing_table_op);
 
   const std::string& name() const override;
 
+  // The invalidated rows are not written to the WriteAheadLog. Operators that only move rows (see ReplaceChunk) log
+  // the move instead.
+  void disable_write_ahead_logging();
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
@@ -29,9 +33,12 @@ class Delete : public AbstractReadWriteOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(const CommitID commit_id) override;
   void _on_rollback_records() override;
+  void _on_log_records(WriteAheadLogRecord& record) const override;
 
  private:
+  const std::string _table_name;
   TransactionID _transaction_id;
   std::shared_ptr<const Table> _referencing_table;
+  bool _write_ahead_logging_enabled{true};
 };
 }  // namespace opossum
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "hyrise.hpp"
+#include "operators/runtime_filter.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -67,6 +68,15 @@ const std::vector<ColumnID>& GetTable::pruned_column_ids() const {
   return _pruned_column_ids;
 }
 
+void GetTable::add_runtime_filter(const std::shared_ptr<RuntimeFilter>& runtime_filter, const ColumnID column_id) {
+  runtime_filter->add_consumer(shared_from_this(), column_id);
+  _runtime_filters.emplace_back(runtime_filter, column_id);
+}
+
+const std::vector<std::pair<std::shared_ptr<RuntimeFilter>, ColumnID>>& GetTable::runtime_filters() const {
+  return _runtime_filters;
+}
+
 std::shared_ptr<AbstractOperator> GetTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input,
@@ -102,6 +112,24 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
   // flag, too, it needs to be forwarded here; otherwise it would be completely invisible in the PQP.
   DebugAssert(stored_table->value_clustered_by().empty(), "GetTable does not forward value_clustered_by");
 
+  // Only use the runtime filters whose source has been executed and whose join is the only consumer of this operator's
+  // output (see RuntimeFilter::can_filter). The filters refer to output columns, the pruning statistics to the stored
+  // columns.
+  auto runtime_filters = std::vector<std::pair<std::shared_ptr<RuntimeFilter>, ColumnID>>{};
+  for (const auto& [runtime_filter, column_id] : _runtime_filters) {
+    auto stored_column_id = column_id;
+    for (const auto pruned_column_id : _pruned_column_ids) {
+      if (pruned_column_id <= stored_column_id) {
+        ++stored_column_id;
+      }
+    }
+
+    if (runtime_filter->can_filter(*this) &&
+        runtime_filter->data_type() == stored_table->column_data_type(stored_column_id)) {
+      runtime_filters.emplace_back(runtime_filter, stored_column_id);
+    }
+  }
+
   auto excluded_chunk_ids = std::vector<ChunkID>{};
   auto pruned_chunk_ids_iter = _pruned_chunk_ids.begin();
   for (ChunkID stored_chunk_id{0}; stored_chunk_id < chunk_count; ++stored_chunk_id) {
@@ -132,6 +160,14 @@ std::shared_ptr<const Table> GetTable::_on_execute() {
       excluded_chunk_ids.emplace_back(stored_chunk_id);
       continue;
     }
+
+    // Skip chunks that do not contain any join partner for a runtime filter
+    if (std::any_of(runtime_filters.cbegin(), runtime_filters.cend(), [&](const auto& runtime_filter_and_column_id) {
+          return !runtime_filter_and_column_id.first->chunk_may_match(*chunk, runtime_filter_and_column_id.second);
+        })) {
+      excluded_chunk_ids.emplace_back(stored_chunk_id);
+      continue;
+    }
   }
 
   // We cannot create a Table without columns - since Chunks rely on their first column to determine their row count
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
@@ -10,6 +11,8 @@
 
 namespace opossum {
 
+class RuntimeFilter;
+
 // Operator to retrieve a table from the StorageManager by specifying its name. Depending on how the operator was
 // constructed, chunks and columns may be pruned if they are irrelevant for the final result. The returned table is NOT
 // the same table as stored in the StorageManager. If that stored table is changed (most importantly: if a chunk is
@@ -34,6 +37,12 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::vector<ChunkID>& pruned_chunk_ids() const;
   const std::vector<ColumnID>& pruned_column_ids() const;
 
+  // Adds a filter published by a JoinHash (see RuntimeFilter). If it can be used once GetTable executes, chunks whose
+  // pruning statistics show that the values of @param column_id (an output column) cannot be contained in the filter
+  // are skipped.
+  void add_runtime_filter(const std::shared_ptr<RuntimeFilter>& runtime_filter, const ColumnID column_id);
+  const std::vector<std::pair<std::shared_ptr<RuntimeFilter>, ColumnID>>& runtime_filters() const;
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_left_input,
       const std::shared_ptr<AbstractOperator>& copied_right_input,
@@ -47,5 +56,7 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::string _name;
   const std::vector<ChunkID> _pruned_chunk_ids;
   const std::vector<ColumnID> _pruned_column_ids;
+
+  std::vector<std::pair<std::shared_ptr<RuntimeFilter>, ColumnID>> _runtime_filters;
 };
 }  // namespace opossum
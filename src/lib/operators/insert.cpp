@@ -9,6 +9,7 @@
 #include "hyrise.hpp"
 #include "resolve_type.hpp"
 #include "storage/abstract_encoded_segment.hpp"
+#include "storage/index/table_key/table_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
@@ -93,6 +94,9 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
            "Cannot handle inserts into column of different type");
   }
 
+  // Key indexes must not be created while rows are appended, but not added to the indexes yet (see step 3)
+  const auto key_index_lock = _target_table->acquire_shared_key_index_mutex();
+
   /**
    * 1. Allocate the required rows in the target Table, without actually copying data to them.
    *    Do so while locking the table to prevent multiple threads modifying the table's size simultaneously.
@@ -104,17 +108,16 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
 
     auto remaining_rows = left_input_table()->row_count();
 
-    if (_target_table->chunk_count() == 0) {
-      _target_table->append_mutable_chunk();
-    }
     while (remaining_rows > 0) {
-      auto target_chunk_id = ChunkID{_target_table->chunk_count() - 1};
-      auto target_chunk = _target_table->get_chunk(target_chunk_id);
+      // Rows are appended to the last mutable Chunk, which is not necessarily the last Chunk (see ReplaceChunk)
+      const auto last_mutable_chunk_id = _target_table->last_mutable_chunk_id();
+      auto target_chunk_id = last_mutable_chunk_id.value_or(INVALID_CHUNK_ID);
+      auto target_chunk = last_mutable_chunk_id ? _target_table->get_chunk(target_chunk_id) : nullptr;
 
-      // If the last Chunk of the target Table is either immutable or full, append a new mutable Chunk
-      if (!target_chunk->is_mutable() || target_chunk->size() == _target_table->target_chunk_size()) {
+      // If the target Table has no mutable Chunk or it is full, append a new mutable Chunk
+      if (!target_chunk || target_chunk->size() == _target_table->target_chunk_size()) {
         _target_table->append_mutable_chunk();
-        ++target_chunk_id;
+        target_chunk_id = ChunkID{_target_table->chunk_count() - 1};
         target_chunk = _target_table->get_chunk(target_chunk_id);
       }
 
@@ -218,6 +221,30 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     }
   }
 
+  /**
+   * 3. Add the new rows to the key indexes of the target Table. If a key conflicts with an existing row (see
+   *    TableKeyIndex), the Insert fails. The rollback removes the entries that were added until then.
+   */
+  const auto transaction_id = context->transaction_id();
+  for (const auto& key_index : _target_table->key_indexes()) {
+    for (const auto& target_chunk_range : _target_chunk_ranges) {
+      const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+
+      for (auto chunk_offset = target_chunk_range.begin_chunk_offset;
+           chunk_offset < target_chunk_range.end_chunk_offset; ++chunk_offset) {
+        const auto key = key_index->key_of_row(*target_chunk, chunk_offset);
+        if (!key) {
+          continue;
+        }
+
+        if (!key_index->try_insert(*key, RowID{target_chunk_range.chunk_id, chunk_offset}, transaction_id)) {
+          _mark_as_failed();
+          return nullptr;
+        }
+      }
+    }
+  }
+
   return nullptr;
 }
 
@@ -275,6 +302,25 @@ void Insert::_on_rollback_records() {
 
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
+
+    // The rows are invisible now, so their key index entries are not needed for conflict detection anymore. Entries
+    // of rows that were not indexed because the Insert failed are ignored by erase().
+    for (const auto& key_index : _target_table->key_indexes()) {
+      for (auto chunk_offset = target_chunk_range.begin_chunk_offset;
+           chunk_offset < target_chunk_range.end_chunk_offset; ++chunk_offset) {
+        const auto key = key_index->key_of_row(*target_chunk, chunk_offset);
+        if (key) {
+          key_index->erase(*key, RowID{target_chunk_range.chunk_id, chunk_offset});
+        }
+      }
+    }
+  }
+}
+
+void Insert::_on_log_records(WriteAheadLogRecord& record) const {
+  for (const auto& target_chunk_range : _target_chunk_ranges) {
+    record.log_insert(_target_table_name, *_target_table, target_chunk_range.chunk_id,
+                      target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset);
   }
 }
 
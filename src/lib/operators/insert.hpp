@@ -18,6 +18,9 @@ class TransactionContext;
  * the values to insert in a separate table using the same column layout.
  *
  * Assumption: The input has been validated before.
+ *
+ * If the target table has key indexes (see Table::create_key_index), the Insert fails when a new row violates one of
+ * the keys, e.g., because another transaction has inserted the same key before.
  */
 class Insert : public AbstractReadWriteOperator {
  public:
@@ -35,6 +38,7 @@ class Insert : public AbstractReadWriteOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(const CommitID cid) override;
   void _on_rollback_records() override;
+  void _on_log_records(WriteAheadLogRecord& record) const override;
 
  private:
   const std::string _target_table_name;
@@ -1,5 +1,7 @@
 #include "join_hash.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <memory>
 #include <numeric>
@@ -11,14 +13,21 @@
 
 #include "bytell_hash_map.hpp"
 #include "hyrise.hpp"
+#include "join_hash/join_hash_spilling.hpp"
 #include "join_hash/join_hash_steps.hpp"
 #include "join_hash/join_hash_traits.hpp"
 #include "join_helper/join_output_writing.hpp"
+#include "operators/get_table.hpp"
+#include "operators/runtime_filter.hpp"
+#include "operators/table_scan.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
+#include "utils/format_bytes.hpp"
 #include "utils/format_duration.hpp"
+#include "utils/memory_budget.hpp"
+#include "utils/performance_warning.hpp"
 #include "utils/timer.hpp"
 
 namespace opossum {
@@ -45,12 +54,61 @@ const std::string& JoinHash::name() const {
   return name;
 }
 
+void JoinHash::add_runtime_filter(const std::shared_ptr<RuntimeFilter>& runtime_filter) {
+  const auto source = runtime_filter->source();
+  if (source == left_input()) {
+    Assert(_mode == JoinMode::Inner || _mode == JoinMode::Left, "Right input cannot be filtered for this join mode");
+    Assert(runtime_filter->source_column_id() == _primary_predicate.column_ids.first,
+           "RuntimeFilter has to be on the join column");
+  } else {
+    Assert(source == right_input(), "Source of the RuntimeFilter has to be an input of the join");
+    Assert(_mode == JoinMode::Inner || _mode == JoinMode::Right || _mode == JoinMode::Semi,
+           "Left input cannot be filtered for this join mode");
+    Assert(runtime_filter->source_column_id() == _primary_predicate.column_ids.second,
+           "RuntimeFilter has to be on the join column");
+  }
+
+  _runtime_filters.emplace_back(runtime_filter);
+}
+
+const std::vector<std::shared_ptr<RuntimeFilter>>& JoinHash::runtime_filters() const {
+  return _runtime_filters;
+}
+
 std::shared_ptr<AbstractOperator> JoinHash::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_left_input,
     const std::shared_ptr<AbstractOperator>& copied_right_input,
     std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
-  return std::make_shared<JoinHash>(copied_left_input, copied_right_input, _mode, _primary_predicate,
-                                    _secondary_predicates, _radix_bits);
+  const auto copied_join_hash = std::make_shared<JoinHash>(copied_left_input, copied_right_input, _mode,
+                                                           _primary_predicate, _secondary_predicates, _radix_bits);
+
+  // The inputs, and with them the consumers of the runtime filters, have already been copied. Filters that are built
+  // from the output of the original source cannot be reused, as the copied source is executed separately.
+  for (const auto& runtime_filter : _runtime_filters) {
+    const auto& copied_source = runtime_filter->source() == left_input() ? copied_left_input : copied_right_input;
+
+    auto copied_probe_chain = std::vector<std::shared_ptr<const AbstractOperator>>{};
+    for (const auto& op : runtime_filter->probe_chain()) {
+      copied_probe_chain.emplace_back(copied_ops.at(op.get()));
+    }
+
+    const auto copied_runtime_filter =
+        std::make_shared<RuntimeFilter>(copied_source, runtime_filter->source_column_id(), copied_probe_chain);
+    for (const auto& [consumer, column_id] : runtime_filter->consumers()) {
+      const auto& copied_consumer = copied_ops.at(consumer.get());
+      if (const auto table_scan = std::dynamic_pointer_cast<TableScan>(copied_consumer)) {
+        table_scan->add_runtime_filter(copied_runtime_filter, column_id);
+      } else if (const auto get_table = std::dynamic_pointer_cast<GetTable>(copied_consumer)) {
+        get_table->add_runtime_filter(copied_runtime_filter, column_id);
+      } else {
+        Fail("Unexpected consumer of a RuntimeFilter");
+      }
+    }
+
+    copied_join_hash->add_runtime_filter(copied_runtime_filter);
+  }
+
+  return copied_join_hash;
 }
 
 void JoinHash::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
@@ -271,6 +329,25 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
     const auto keep_nulls_probe_column = _mode == JoinMode::Left || _mode == JoinMode::Right ||
                                          _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse;
 
+    /**
+     * 0. Reserve the memory for the materialized inputs and the hash tables. If the MemoryBudget of the query is too
+     *    small, the inputs are partitioned into temporary files and joined partition by partition.
+     */
+    auto memory_reservation = MemoryReservation{_join_hash.memory_budget()};
+    const auto required_memory =
+        _required_memory(_build_input_table->row_count(), _probe_input_table->row_count(), 2);
+    if (!memory_reservation.try_grow(required_memory)) {
+      PerformanceWarning("Hash join exceeds the memory budget and spills to disk");
+      DebugAssert(!keep_nulls_build_column || keep_nulls_probe_column, "Unexpected combination of NULL handling");
+      if (keep_nulls_build_column) {
+        return _on_execute_spilling<true, true>(required_memory);
+      }
+      if (keep_nulls_probe_column) {
+        return _on_execute_spilling<false, true>(required_memory);
+      }
+      return _on_execute_spilling<false, false>(required_memory);
+    }
+
     // Containers used to store histograms for (potentially subsequent) radix partitioning step (in cases
     // _radix_bits > 0). Created during materialization step.
     std::vector<std::vector<size_t>> histograms_build_column;
@@ -434,31 +511,13 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
      *    probe step.
      */
     Timer timer_hash_map_building;
-    if (_secondary_predicates.empty() &&
-        (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse)) {
-      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::ExistenceOnly,
-                                                       _radix_bits, probe_side_bloom_filter);
-    } else {
-      hash_tables = build<BuildColumnType, HashedType>(radix_build_column, JoinHashBuildMode::AllPositions, _radix_bits,
-                                                       probe_side_bloom_filter);
-    }
+    hash_tables =
+        build<BuildColumnType, HashedType>(radix_build_column, _build_mode(), _radix_bits, probe_side_bloom_filter);
     _performance_data.set_step_runtime(OperatorSteps::Building, timer_hash_map_building.lap());
 
     // Store the element counts of the built hash tables. Depending on the Bloom filter, we might have significantly
     // less values stored than in the initial input table.
-    for (const auto& hash_table : hash_tables) {
-      if (!hash_table) {
-        continue;
-      }
-
-      _performance_data.hash_tables_distinct_value_count += hash_table->distinct_value_count();
-      const auto position_count = hash_table->position_count();
-      if (position_count) {
-        // Update or set hash_tables_position_count if hash table stores positions.
-        _performance_data.hash_tables_position_count =
-            _performance_data.hash_tables_position_count.value_or(0) + *position_count;
-      }
-    }
+    _record_hash_table_statistics(hash_tables);
 
     /**
      * Short cut for AntiNullAsTrue:
@@ -500,6 +559,54 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
     }
 
     Timer timer_probing;
+    _probe(radix_probe_column, hash_tables, build_side_pos_lists, probe_side_pos_lists);
+    _performance_data.set_step_runtime(OperatorSteps::Probing, timer_probing.lap());
+
+    radix_probe_column.clear();
+    hash_tables.clear();
+
+    /**
+     * 5. Write output Table
+     */
+
+    /**
+     * After the probe step build_side_pos_lists and probe_side_pos_lists contain all pairs of joined rows grouped by
+     * partition. Let p be a partition index and r a row index. The value of build_side_pos_lists[p][r] will match
+     * probe_side_pos_lists[p][r].
+     */
+
+    return _write_output_table(build_side_pos_lists, probe_side_pos_lists);
+  }
+
+  // In the case of semi or anti joins, we do not need to track all rows on the hashed side, just one per value.
+  // However, if we have secondary predicates, those might fail on that single row. In that case, we DO need all rows.
+  JoinHashBuildMode _build_mode() const {
+    if (_secondary_predicates.empty() &&
+        (_mode == JoinMode::Semi || _mode == JoinMode::AntiNullAsTrue || _mode == JoinMode::AntiNullAsFalse)) {
+      return JoinHashBuildMode::ExistenceOnly;
+    }
+    return JoinHashBuildMode::AllPositions;
+  }
+
+  void _record_hash_table_statistics(const std::vector<std::optional<PosHashTable<HashedType>>>& hash_tables) {
+    for (const auto& hash_table : hash_tables) {
+      if (!hash_table) {
+        continue;
+      }
+
+      _performance_data.hash_tables_distinct_value_count += hash_table->distinct_value_count();
+      const auto position_count = hash_table->position_count();
+      if (position_count) {
+        // Update or set hash_tables_position_count if hash table stores positions.
+        _performance_data.hash_tables_position_count =
+            _performance_data.hash_tables_position_count.value_or(0) + *position_count;
+      }
+    }
+  }
+
+  void _probe(const RadixContainer<ProbeColumnType>& radix_probe_column,
+              const std::vector<std::optional<PosHashTable<HashedType>>>& hash_tables,
+              std::vector<RowIDPosList>& build_side_pos_lists, std::vector<RowIDPosList>& probe_side_pos_lists) {
     switch (_mode) {
       case JoinMode::Inner:
         probe<ProbeColumnType, HashedType, false>(radix_probe_column, hash_tables, build_side_pos_lists,
@@ -535,21 +642,10 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
       default:
         Fail("JoinMode not supported by JoinHash");
     }
-    _performance_data.set_step_runtime(OperatorSteps::Probing, timer_probing.lap());
-
-    radix_probe_column.clear();
-    hash_tables.clear();
-
-    /**
-     * 5. Write output Table
-     */
-
-    /**
-     * After the probe step build_side_pos_lists and probe_side_pos_lists contain all pairs of joined rows grouped by
-     * partition. Let p be a partition index and r a row index. The value of build_side_pos_lists[p][r] will match
-     * probe_side_pos_lists[p][r].
-     */
+  }
 
+  std::shared_ptr<const Table> _write_output_table(std::vector<RowIDPosList>& build_side_pos_lists,
+                                                   std::vector<RowIDPosList>& probe_side_pos_lists) {
     Timer timer_output_writing;
 
     const auto create_left_side_pos_lists_by_segment =
@@ -568,6 +664,311 @@ class JoinHash::JoinHashImpl : public AbstractReadOnlyOperatorImpl {
 
     return _join_hash._build_output_table(std::move(output_chunks));
   }
+
+  // Estimates the bytes needed to join the given numbers of build and probe elements. Each element is materialized
+  // @param copy_count times (radix partitioning copies the materialized elements). As in calculate_radix_bits, we
+  // assume that each build value is distinct. This is an estimation only, e.g., the heap memory of strings is ignored.
+  static size_t _required_memory(const size_t build_element_count, const size_t probe_element_count,
+                                 const size_t copy_count) {
+    constexpr auto HASH_TABLE_BYTES_PER_ELEMENT =
+        static_cast<size_t>(static_cast<double>(sizeof(HashedType) + sizeof(uint32_t)) / 0.8) + sizeof(RowID);
+    return build_element_count *
+               (copy_count * sizeof(PartitionedElement<BuildColumnType>) + HASH_TABLE_BYTES_PER_ELEMENT) +
+           probe_element_count * copy_count * sizeof(PartitionedElement<ProbeColumnType>);
+  }
+
+  // Chooses the number of spill partitions so that a pair of partitions needs about half of the budget, assuming
+  // uniformly distributed hash values. This leaves room for skew and for other operators of the query.
+  size_t _spill_radix_bits(const size_t required_memory) const {
+    const auto limit = std::max(_join_hash.memory_budget()->limit(), size_t{1});
+    const auto partition_count =
+        std::max(2.0, 2.0 * static_cast<double>(required_memory) / static_cast<double>(limit));
+    return std::min(JoinHash::MAX_SPILL_RADIX_BITS, static_cast<size_t>(std::ceil(std::log2(partition_count))));
+  }
+
+  void _record_spilled_partitions(const std::vector<SpilledPartition>& build_partitions,
+                                  const std::vector<SpilledPartition>& probe_partitions) {
+    const auto partition_count = build_partitions.size();
+    for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+      const auto& build_file = build_partitions[partition_idx].file;
+      const auto& probe_file = probe_partitions[partition_idx].file;
+      if (!build_file && !probe_file) {
+        continue;
+      }
+
+      ++_performance_data.spilled_partition_count;
+      _performance_data.spilled_bytes += (build_file ? build_file->size() : 0) + (probe_file ? probe_file->size() : 0);
+    }
+  }
+
+  template <bool keep_nulls_build_column, bool keep_nulls_probe_column>
+  std::shared_ptr<const Table> _on_execute_spilling(const size_t required_memory) {
+    const auto radix_bits = _spill_radix_bits(required_memory);
+    const auto partition_count = size_t{1} << radix_bits;
+
+    /**
+     * 1. Partition the build input one chunk after the other. Each partition stays in memory (resident) as long as
+     *    the budget allows for its elements and its hash table. If a reservation is denied, the largest resident
+     *    partition is written to disk, including all of its future elements. Evicting the largest partition frees the
+     *    most memory per spilled partition.
+     */
+    Timer timer_materialization;
+    const auto bytes_per_build_element = _required_memory(1, 0, 1);
+    auto resident_reservation = MemoryReservation{_join_hash.memory_budget()};
+    auto resident_build_column = RadixContainer<BuildColumnType>(partition_count);
+    auto partition_is_resident = std::vector<bool>(partition_count, true);
+    auto build_partitions = std::vector<SpilledPartition>(partition_count);
+
+    const auto spill_resident_partition = [&](const size_t partition_idx) {
+      auto& resident_partition = resident_build_column[partition_idx];
+      spill_elements<BuildColumnType, keep_nulls_build_column>(build_partitions[partition_idx], resident_partition);
+      resident_reservation.shrink(resident_partition.elements.size() * bytes_per_build_element);
+      resident_partition = Partition<BuildColumnType>();
+      partition_is_resident[partition_idx] = false;
+    };
+
+    auto build_column_contains_null = false;
+    auto chunk_build_column = RadixContainer<BuildColumnType>{};
+    const auto build_chunk_count = _build_input_table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < build_chunk_count; ++chunk_id) {
+      build_column_contains_null |= partition_chunk<BuildColumnType, HashedType, keep_nulls_build_column>(
+          *_build_input_table, chunk_id, _column_ids.first, radix_bits, chunk_build_column);
+
+      for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+        const auto& chunk_partition = chunk_build_column[partition_idx];
+        const auto element_count = chunk_partition.elements.size();
+        if (element_count == 0) {
+          continue;
+        }
+        _performance_data.build_side_materialized_value_count += element_count;
+
+        while (partition_is_resident[partition_idx] &&
+               !resident_reservation.try_grow(element_count * bytes_per_build_element)) {
+          auto evicted_partition_idx = partition_idx;
+          auto evicted_partition_size = resident_build_column[partition_idx].elements.size() + element_count;
+          for (auto resident_partition_idx = size_t{0}; resident_partition_idx < partition_count;
+               ++resident_partition_idx) {
+            const auto resident_partition_size = resident_build_column[resident_partition_idx].elements.size();
+            if (partition_is_resident[resident_partition_idx] && resident_partition_size > evicted_partition_size) {
+              evicted_partition_idx = resident_partition_idx;
+              evicted_partition_size = resident_partition_size;
+            }
+          }
+          spill_resident_partition(evicted_partition_idx);
+        }
+
+        if (partition_is_resident[partition_idx]) {
+          auto& resident_partition = resident_build_column[partition_idx];
+          resident_partition.elements.insert(resident_partition.elements.end(), chunk_partition.elements.begin(),
+                                             chunk_partition.elements.end());
+          if constexpr (keep_nulls_build_column) {
+            resident_partition.null_values.insert(resident_partition.null_values.end(),
+                                                  chunk_partition.null_values.begin(),
+                                                  chunk_partition.null_values.end());
+          }
+        } else {
+          spill_elements<BuildColumnType, keep_nulls_build_column>(build_partitions[partition_idx], chunk_partition);
+        }
+      }
+    }
+    chunk_build_column.clear();
+    _performance_data.set_step_runtime(OperatorSteps::BuildSideMaterializing, timer_materialization.lap());
+
+    // Short cut for AntiNullAsTrue, see _on_execute()
+    if (_mode == JoinMode::AntiNullAsTrue && build_column_contains_null) {
+      Timer timer_output_writing;
+      const auto result = _join_hash._build_output_table({});
+      _performance_data.set_step_runtime(OperatorSteps::OutputWriting, timer_output_writing.lap());
+      return result;
+    }
+
+    for (auto& partition : build_partitions) {
+      if (partition.file) {
+        partition.file->finish_writing();
+      }
+    }
+
+    /**
+     * 2. Build the hash tables of the resident partitions. Afterwards, only the hash tables remain in memory. Spilled
+     *    and empty partitions do not have a hash table.
+     */
+    Timer timer_hash_map_building;
+    auto hash_tables =
+        build<BuildColumnType, HashedType>(resident_build_column, _build_mode(), radix_bits, ALL_TRUE_BLOOM_FILTER);
+    _record_hash_table_statistics(hash_tables);
+    auto resident_element_count = size_t{0};
+    for (const auto& partition : resident_build_column) {
+      resident_element_count += partition.elements.size();
+    }
+    resident_build_column.clear();
+    resident_reservation.shrink(resident_element_count * sizeof(PartitionedElement<BuildColumnType>));
+    _spill_building_runtime += timer_hash_map_building.lap();
+
+    /**
+     * 3. Partition the probe input one chunk after the other. Elements of resident partitions are probed right away,
+     *    the others are written to disk. The positions of each chunk are concatenated, which keeps build and probe
+     *    positions aligned, so that each probe chunk yields at most one output chunk.
+     */
+    auto build_side_pos_lists = std::vector<RowIDPosList>{};
+    auto probe_side_pos_lists = std::vector<RowIDPosList>{};
+    auto probe_partitions = std::vector<SpilledPartition>(partition_count);
+    Timer timer_probe_side_materialization;
+    auto chunk_probe_column = RadixContainer<ProbeColumnType>{};
+    const auto probe_chunk_count = _probe_input_table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < probe_chunk_count; ++chunk_id) {
+      partition_chunk<ProbeColumnType, HashedType, keep_nulls_probe_column>(*_probe_input_table, chunk_id,
+                                                                            _column_ids.second, radix_bits,
+                                                                            chunk_probe_column);
+
+      auto has_resident_elements = false;
+      for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+        auto& chunk_partition = chunk_probe_column[partition_idx];
+        _performance_data.probe_side_materialized_value_count += chunk_partition.elements.size();
+        if (partition_is_resident[partition_idx]) {
+          has_resident_elements |= !chunk_partition.elements.empty();
+          continue;
+        }
+
+        spill_elements<ProbeColumnType, keep_nulls_probe_column>(probe_partitions[partition_idx], chunk_partition);
+        chunk_partition.elements.clear();
+        chunk_partition.null_values.clear();
+      }
+
+      if (!has_resident_elements) {
+        continue;
+      }
+
+      Timer timer_probing;
+      auto chunk_build_side_pos_lists = std::vector<RowIDPosList>(partition_count);
+      auto chunk_probe_side_pos_lists = std::vector<RowIDPosList>(partition_count);
+      _probe(chunk_probe_column, hash_tables, chunk_build_side_pos_lists, chunk_probe_side_pos_lists);
+
+      auto build_side_pos_list = RowIDPosList{};
+      auto probe_side_pos_list = RowIDPosList{};
+      for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+        const auto& partition_build_side_pos_list = chunk_build_side_pos_lists[partition_idx];
+        const auto& partition_probe_side_pos_list = chunk_probe_side_pos_lists[partition_idx];
+        build_side_pos_list.insert(build_side_pos_list.end(), partition_build_side_pos_list.begin(),
+                                   partition_build_side_pos_list.end());
+        probe_side_pos_list.insert(probe_side_pos_list.end(), partition_probe_side_pos_list.begin(),
+                                   partition_probe_side_pos_list.end());
+      }
+      if (!probe_side_pos_list.empty()) {
+        build_side_pos_lists.emplace_back(std::move(build_side_pos_list));
+        probe_side_pos_lists.emplace_back(std::move(probe_side_pos_list));
+      }
+      _spill_probing_runtime += timer_probing.lap();
+    }
+    chunk_probe_column.clear();
+
+    for (auto& partition : probe_partitions) {
+      if (partition.file) {
+        partition.file->finish_writing();
+      }
+    }
+    _performance_data.set_step_runtime(OperatorSteps::ProbeSideMaterializing,
+                                       timer_probe_side_materialization.lap() - _spill_probing_runtime);
+
+    // The hash tables of the resident partitions are not needed anymore. Their memory is available to the spilled
+    // partitions.
+    hash_tables.clear();
+    resident_reservation.shrink(resident_reservation.bytes());
+
+    /**
+     * 4. Join the spilled pairs of partitions
+     */
+    _record_spilled_partitions(build_partitions, probe_partitions);
+    _join_spilled_partitions<keep_nulls_build_column, keep_nulls_probe_column>(
+        build_partitions, probe_partitions, radix_bits, 1, build_side_pos_lists, probe_side_pos_lists);
+
+    _performance_data.set_step_runtime(OperatorSteps::Clustering, _spill_clustering_runtime);
+    _performance_data.set_step_runtime(OperatorSteps::Building, _spill_building_runtime);
+    _performance_data.set_step_runtime(OperatorSteps::Probing, _spill_probing_runtime);
+
+    return _write_output_table(build_side_pos_lists, probe_side_pos_lists);
+  }
+
+  // Joins one pair of spilled partitions after the other. Pairs that do not fit into the MemoryBudget are partitioned
+  // again, using the bits of the hash value that follow the @param skipped_bits.
+  template <bool keep_nulls_build_column, bool keep_nulls_probe_column>
+  void _join_spilled_partitions(std::vector<SpilledPartition>& build_partitions,
+                                std::vector<SpilledPartition>& probe_partitions, const size_t skipped_bits,
+                                const size_t depth, std::vector<RowIDPosList>& build_side_pos_lists,
+                                std::vector<RowIDPosList>& probe_side_pos_lists) {
+    const auto partition_count = build_partitions.size();
+    for (auto partition_idx = size_t{0}; partition_idx < partition_count; ++partition_idx) {
+      auto& build_partition = build_partitions[partition_idx];
+      auto& probe_partition = probe_partitions[partition_idx];
+
+      // Every output row contains a row of the probe side. For inner and semi joins, it also needs a join partner.
+      if (probe_partition.element_count == 0 ||
+          (build_partition.element_count == 0 && (_mode == JoinMode::Inner || _mode == JoinMode::Semi))) {
+        continue;
+      }
+
+      auto memory_reservation = MemoryReservation{_join_hash.memory_budget()};
+      const auto required_memory = _required_memory(
+          build_partition.element_count, std::min(probe_partition.element_count, JoinHash::SPILL_PROBE_BLOCK_SIZE), 1);
+      if (!memory_reservation.try_grow(required_memory)) {
+        if (depth < JoinHash::MAX_SPILL_DEPTH && build_partition.element_count > 1) {
+          Timer timer_clustering;
+          const auto radix_bits = _spill_radix_bits(required_memory);
+          auto build_subpartitions =
+              repartition_spilled_partition<BuildColumnType, HashedType, keep_nulls_build_column>(
+                  build_partition, skipped_bits, radix_bits);
+          auto probe_subpartitions =
+              repartition_spilled_partition<ProbeColumnType, HashedType, keep_nulls_probe_column>(
+                  probe_partition, skipped_bits, radix_bits);
+          _spill_clustering_runtime += timer_clustering.lap();
+          _record_spilled_partitions(build_subpartitions, probe_subpartitions);
+
+          _join_spilled_partitions<keep_nulls_build_column, keep_nulls_probe_column>(
+              build_subpartitions, probe_subpartitions, skipped_bits + radix_bits, depth + 1, build_side_pos_lists,
+              probe_side_pos_lists);
+          continue;
+        }
+
+        PerformanceWarning("Partition of spilling hash join exceeds the memory budget");
+      }
+
+      Timer timer_hash_map_building;
+      auto hash_tables = std::vector<std::optional<PosHashTable<HashedType>>>{};
+      if (build_partition.element_count > 0) {
+        auto radix_build_column = RadixContainer<BuildColumnType>{};
+        radix_build_column.emplace_back(read_spilled_elements<BuildColumnType, keep_nulls_build_column>(
+            build_partition, build_partition.element_count));
+        hash_tables = build<BuildColumnType, HashedType>(radix_build_column, _build_mode(), 0, ALL_TRUE_BLOOM_FILTER);
+        _record_hash_table_statistics(hash_tables);
+      }
+      build_partition = SpilledPartition{};
+      _spill_building_runtime += timer_hash_map_building.lap();
+
+      // The probe partition is read and probed in blocks, each of which yields its own pos lists
+      Timer timer_probing;
+      auto remaining_element_count = probe_partition.element_count;
+      while (remaining_element_count > 0) {
+        const auto block_size = std::min(remaining_element_count, JoinHash::SPILL_PROBE_BLOCK_SIZE);
+        remaining_element_count -= block_size;
+
+        auto radix_probe_column = RadixContainer<ProbeColumnType>{};
+        radix_probe_column.emplace_back(
+            read_spilled_elements<ProbeColumnType, keep_nulls_probe_column>(probe_partition, block_size));
+
+        auto block_build_side_pos_lists = std::vector<RowIDPosList>(1);
+        auto block_probe_side_pos_lists = std::vector<RowIDPosList>(1);
+        _probe(radix_probe_column, hash_tables, block_build_side_pos_lists, block_probe_side_pos_lists);
+        build_side_pos_lists.emplace_back(std::move(block_build_side_pos_lists.front()));
+        probe_side_pos_lists.emplace_back(std::move(block_probe_side_pos_lists.front()));
+      }
+      probe_partition = SpilledPartition{};
+      _spill_probing_runtime += timer_probing.lap();
+    }
+  }
+
+  // Step runtimes of the spilling join, which are summed up over all partitions
+  std::chrono::nanoseconds _spill_clustering_runtime{0};
+  std::chrono::nanoseconds _spill_building_runtime{0};
+  std::chrono::nanoseconds _spill_probing_runtime{0};
 };
 
 void JoinHash::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
@@ -576,6 +977,10 @@ void JoinHash::PerformanceData::output_to_stream(std::ostream& stream, Descripti
   const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
   stream << separator << "Radix bits: " << radix_bits << ".";
   stream << separator << "Build side is " << (left_input_is_build_side ? "left." : "right.");
+  if (spilled_partition_count > 0) {
+    stream << separator << "Spilled " << spilled_partition_count << " partitions (" << format_bytes(spilled_bytes)
+           << ") to disk.";
+  }
 }
 
 }  // namespace opossum
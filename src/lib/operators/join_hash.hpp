@@ -1,6 +1,8 @@
 #pragma once
 
+#include <memory>
 #include <optional>
+#include <vector>
 
 #include "abstract_join_operator.hpp"
 #include "operator_join_predicate.hpp"
@@ -8,6 +10,8 @@
 
 namespace opossum {
 
+class RuntimeFilter;
+
 /**
  * This operator joins two tables using one column of each table.
  * The output is a new table with referenced columns for all columns of the two inputs and filtered pos_lists.
@@ -15,6 +19,12 @@ namespace opossum {
  * As with most operators, we do not guarantee a stable operation with regards to positions -
  * i.e., your sorting order might be disturbed.
  *
+ * If the operator has a MemoryBudget (see AbstractOperator::memory_budget) that is too small for the materialized
+ * inputs and the hash tables, both inputs are radix partitioned chunk by chunk instead (hybrid hash join, see
+ * join_hash_spilling.hpp). Build partitions that fit into the budget stay in memory and are probed right away. Only
+ * the remaining partitions of both inputs are written to temporary files and joined pair by pair afterwards.
+ * Partitions that still exceed the budget are partitioned recursively. The positions of the output are kept in memory.
+ *
  * Find more information in our Wiki: https://github.com/hyrise/hyrise/wiki/Hash-Join-Operator
  */
 class JoinHash : public AbstractJoinOperator {
@@ -26,6 +36,15 @@ class JoinHash : public AbstractJoinOperator {
   // directly. This threshold needs to be re-evaluated over time to find the value which gives the best performance.
   static constexpr auto JOB_SPAWN_THRESHOLD = 500;
 
+  // When spilling, each partitioning pass creates at most 2^MAX_SPILL_RADIX_BITS partitions (and temporary files) per
+  // input. Partitions are partitioned again up to MAX_SPILL_DEPTH times. After that, usually all of their values are
+  // equal and further partitioning does not help. The join then exceeds the budget.
+  static constexpr auto MAX_SPILL_RADIX_BITS = size_t{6};
+  static constexpr auto MAX_SPILL_DEPTH = size_t{3};
+
+  // Number of elements of a spilled probe partition that are read and probed at once
+  static constexpr auto SPILL_PROBE_BLOCK_SIZE = size_t{1} << 16;
+
   JoinHash(const std::shared_ptr<const AbstractOperator>& left, const std::shared_ptr<const AbstractOperator>& right,
            const JoinMode mode, const OperatorJoinPredicate& primary_predicate,
            const std::vector<OperatorJoinPredicate>& secondary_predicates = {},
@@ -35,6 +54,15 @@ class JoinHash : public AbstractJoinOperator {
 
   static size_t calculate_radix_bits(const size_t build_side_size, const size_t probe_side_size, const JoinMode mode);
 
+  /**
+   * Publishes a RuntimeFilter on the join column of one input (the source) to operators of the other input, which use
+   * it to drop rows without a join partner before they reach the join (see RuntimeFilter). The consumers have to be
+   * added to the filter first. Only inputs whose unmatched rows are not part of the output can be filtered. Deep copies
+   * of the join get their own filters.
+   */
+  void add_runtime_filter(const std::shared_ptr<RuntimeFilter>& runtime_filter);
+  const std::vector<std::shared_ptr<RuntimeFilter>>& runtime_filters() const;
+
   enum class OperatorSteps : uint8_t {
     BuildSideMaterializing,
     ProbeSideMaterializing,
@@ -63,6 +91,12 @@ class JoinHash : public AbstractJoinOperator {
     // build_side_position_count (see order of materialization in hash_join.cpp).
     size_t hash_tables_distinct_value_count{0};
     std::optional<size_t> hash_tables_position_count;
+
+    // Number of partitions that were written to temporary files (on all recursion levels) and the number of bytes
+    // written for both inputs. Partitions that stayed in memory are not counted. Zero if the join did not exceed its
+    // MemoryBudget.
+    size_t spilled_partition_count{0};
+    size_t spilled_bytes{0};
   };
 
  protected:
@@ -76,6 +110,7 @@ class JoinHash : public AbstractJoinOperator {
 
   std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
   std::optional<size_t> _radix_bits;
+  std::vector<std::shared_ptr<RuntimeFilter>> _runtime_filters;
 
   template <typename LeftType, typename RightType>
   class JoinHashImpl;
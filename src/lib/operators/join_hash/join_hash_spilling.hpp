@@ -0,0 +1,170 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "join_hash_steps.hpp"
+#include "utils/spill_file.hpp"
+
+/*
+  This file includes the steps of the hash join that are used if the inputs do not fit into the MemoryBudget of the
+  query (hybrid hash join). Both inputs are radix partitioned one chunk after the other, without being fully
+  materialized. Build partitions stay in memory as long as they fit into the budget, the others are written to
+  SpillFiles together with the matching probe partitions. The spilled pairs of partitions are joined afterwards (see
+  JoinHash::JoinHashImpl::_join_spilled_partitions). Partitions that still do not fit are partitioned again using the
+  next bits of the hash value.
+*/
+namespace opossum {
+
+// A radix partition of a join column that has been written to disk. Each element is stored as its RowID, its value,
+// and, if NULL values are kept, its NULL flag. The file is only created once the first element is written.
+struct SpilledPartition {
+  std::unique_ptr<SpillFile> file;
+  size_t element_count{0};
+};
+
+// The partition of a hashed value in a partitioning pass that uses @param radix_bits bits of the hash value. The
+// @param skipped_bits have been used by the previous passes. Note that the in-memory radix partitioning (see
+// partition_by_radix) uses the lowest bits as well. It is not combined with spilling.
+inline size_t spill_partition_index(const Hash hash, const size_t skipped_bits, const size_t radix_bits) {
+  return (hash >> skipped_bits) & ((size_t{1} << radix_bits) - 1);
+}
+
+template <typename T, bool keep_null_values>
+void spill_element(SpilledPartition& partition, const RowID& row_id, const T& value, const bool is_null) {
+  if (!partition.file) {
+    partition.file = std::make_unique<SpillFile>();
+  }
+
+  partition.file->write(row_id);
+  partition.file->write(value);
+  if constexpr (keep_null_values) {
+    partition.file->write(is_null);
+  }
+  ++partition.element_count;
+}
+
+template <typename T, bool keep_null_values>
+void read_spilled_element(SpilledPartition& partition, RowID& row_id, T& value, bool& is_null) {
+  partition.file->read(row_id);
+  partition.file->read(value);
+  if constexpr (keep_null_values) {
+    partition.file->read(is_null);
+  }
+}
+
+// Reads the next @param element_count elements of @param partition into a Partition that can be passed to build() or
+// probe(). finish_writing() has to be called on the file before the first read.
+template <typename T, bool keep_null_values>
+Partition<T> read_spilled_elements(SpilledPartition& partition, const size_t element_count) {
+  auto result = Partition<T>();
+  result.elements.resize(element_count);
+  if constexpr (keep_null_values) {
+    result.null_values.resize(element_count);
+  }
+
+  for (auto element_idx = size_t{0}; element_idx < element_count; ++element_idx) {
+    auto& element = result.elements[element_idx];
+    auto is_null = false;
+    read_spilled_element<T, keep_null_values>(partition, element.row_id, element.value, is_null);
+    if constexpr (keep_null_values) {
+      result.null_values[element_idx] = is_null;
+    }
+  }
+
+  return result;
+}
+
+// Appends the elements of the in-memory @param elements to @param partition
+template <typename T, bool keep_null_values>
+void spill_elements(SpilledPartition& partition, const Partition<T>& elements) {
+  const auto element_count = elements.elements.size();
+  for (auto element_idx = size_t{0}; element_idx < element_count; ++element_idx) {
+    const auto& element = elements.elements[element_idx];
+    auto is_null = false;
+    if constexpr (keep_null_values) {
+      is_null = elements.null_values[element_idx];
+    }
+    spill_element<T, keep_null_values>(partition, element.row_id, element.value, is_null);
+  }
+}
+
+// Materializes the column @param column_id of the chunk @param chunk_id into the 2^radix_bits partitions of
+// @param partitions, which are cleared first. Other than materialize_input(), it processes a single chunk, so that the
+// input is never held in memory entirely. Like materialize_input(), it uses the offset within the input as the RowID,
+// also for ReferenceSegments. The partition of a value is spill_partition_index(hash, 0, radix_bits), so that it
+// matches the partitions that are spilled.
+// @return whether the chunk contains NULL values (only if they are kept)
+template <typename T, typename HashedType, bool keep_null_values>
+bool partition_chunk(const Table& in_table, const ChunkID chunk_id, const ColumnID column_id, const size_t radix_bits,
+                     RadixContainer<T>& partitions) {
+  partitions.resize(size_t{1} << radix_bits);
+  for (auto& partition : partitions) {
+    partition.elements.clear();
+    partition.null_values.clear();
+  }
+
+  const auto chunk = in_table.get_chunk(chunk_id);
+  if (!chunk) {
+    return false;
+  }
+
+  const std::hash<HashedType> hash_function;
+  auto contains_null = false;
+
+  // Rows that are concurrently inserted into the last chunk are not visible to our transaction, see
+  // materialize_input().
+  const auto row_count = chunk->size();
+
+  auto chunk_offset = ChunkOffset{0};
+  segment_with_iterators<T>(*chunk->get_segment(column_id), [&](auto iter, const auto end) {
+    for (; iter != end && chunk_offset < row_count; ++iter, ++chunk_offset) {
+      const auto& value = *iter;
+      if (value.is_null()) {
+        if constexpr (!keep_null_values) {
+          continue;
+        }
+        contains_null = true;
+      }
+
+      const auto hashed_value = hash_function(static_cast<HashedType>(value.value()));
+      auto& partition = partitions[spill_partition_index(hashed_value, 0, radix_bits)];
+      partition.elements.push_back(PartitionedElement<T>{RowID{chunk_id, chunk_offset}, value.value()});
+      if constexpr (keep_null_values) {
+        partition.null_values.push_back(value.is_null());
+      }
+    }
+  });
+
+  return contains_null;
+}
+
+// Partitions the elements of a SpilledPartition further, using the next @param radix_bits bits after the
+// @param skipped_bits of the hash value. The file of @param partition is deleted afterwards.
+template <typename T, typename HashedType, bool keep_null_values>
+std::vector<SpilledPartition> repartition_spilled_partition(SpilledPartition& partition, const size_t skipped_bits,
+                                                            const size_t radix_bits) {
+  auto partitions = std::vector<SpilledPartition>(size_t{1} << radix_bits);
+
+  const std::hash<HashedType> hash_function;
+  auto row_id = RowID{};
+  auto value = T{};
+  auto is_null = false;
+  for (auto element_idx = size_t{0}; element_idx < partition.element_count; ++element_idx) {
+    read_spilled_element<T, keep_null_values>(partition, row_id, value, is_null);
+    const auto hashed_value = hash_function(static_cast<HashedType>(value));
+    spill_element<T, keep_null_values>(partitions[spill_partition_index(hashed_value, skipped_bits, radix_bits)],
+                                       row_id, value, is_null);
+  }
+
+  for (auto& spilled_partition : partitions) {
+    if (spilled_partition.file) {
+      spilled_partition.file->finish_writing();
+    }
+  }
+
+  partition = SpilledPartition{};
+  return partitions;
+}
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include "join_index.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -158,7 +159,8 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
       Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
       const auto& reference_segment =
-          std::dynamic_pointer_cast<ReferenceSegment>(index_chunk->get_segment(_primary_predicate.column_ids.second));
+          std::dynamic_pointer_cast<ReferenceSegment>(
+              index_chunk->get_segment(_adjusted_primary_predicate.column_ids.second));
       Assert(reference_segment != nullptr,
              "Non-empty index input table (reference table) has to have only reference segments.");
       auto index_data_table = reference_segment->referenced_table();
@@ -166,7 +168,8 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
       const auto& reference_segment_pos_list = reference_segment->pos_list();
 
       if (reference_segment_pos_list->references_single_chunk()) {
-        const auto index_data_table_chunk = index_data_table->get_chunk((*reference_segment_pos_list)[0].chunk_id);
+        const auto index_data_chunk_id = (*reference_segment_pos_list)[0].chunk_id;
+        const auto index_data_table_chunk = index_data_table->get_chunk(index_data_chunk_id);
         Assert(index_data_table_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
         const auto& indexes = index_data_table_chunk->get_indexes(index_data_table_column_ids);
 
@@ -175,6 +178,12 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
           // as we do not want to spend time on evaluating the best index inside of this join loop
           const auto& index = indexes.front();
 
+          // The index matches of each probe tuple are filtered by the positions of the reference segment. Sorting them
+          // once allows for binary searches.
+          auto sorted_reference_pos_list = RowIDPosList(reference_segment_pos_list->begin(),
+                                                        reference_segment_pos_list->end());
+          std::sort(sorted_reference_pos_list.begin(), sorted_reference_pos_list.end());
+
           // Scan all chunks from the probe side input
           const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
           for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
@@ -183,8 +192,8 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
 
             const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
             segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
-              _reference_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id, index,
-                                                       reference_segment_pos_list);
+              _reference_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_data_chunk_id,
+                                                       index, sorted_reference_pos_list);
             });
           }
           index_joining_duration += timer.lap();
@@ -326,29 +335,27 @@ void JoinIndex::_data_join_two_segments_using_index(ProbeIterator probe_iter, Pr
 }
 
 template <typename ProbeIterator>
-void JoinIndex::_reference_join_two_segments_using_index(
-    ProbeIterator probe_iter, ProbeIterator probe_end, const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
-    const std::shared_ptr<AbstractIndex>& index,
-    const std::shared_ptr<const AbstractPosList>& reference_segment_pos_list) {
+void JoinIndex::_reference_join_two_segments_using_index(ProbeIterator probe_iter, ProbeIterator probe_end,
+                                                         const ChunkID probe_chunk_id,
+                                                         const ChunkID index_data_chunk_id,
+                                                         const std::shared_ptr<AbstractIndex>& index,
+                                                         const RowIDPosList& sorted_reference_pos_list) {
+  RowIDPosList index_table_matches;
   for (; probe_iter != probe_end; ++probe_iter) {
-    RowIDPosList index_scan_pos_list;
+    index_table_matches.clear();
     const auto probe_side_position = *probe_iter;
     const auto index_ranges = _index_ranges_for_value(probe_side_position, index);
     for (const auto& [index_begin, index_end] : index_ranges) {
-      std::transform(index_begin, index_end, std::back_inserter(index_scan_pos_list),
-                     [index_chunk_id](ChunkOffset index_chunk_offset) {
-                       return RowID{index_chunk_id, index_chunk_offset};
-                     });
+      // The index covers the whole data chunk. Only the rows referenced by the index input are matches.
+      std::for_each(index_begin, index_end, [&](const ChunkOffset index_chunk_offset) {
+        const auto row_id = RowID{index_data_chunk_id, index_chunk_offset};
+        if (std::binary_search(sorted_reference_pos_list.begin(), sorted_reference_pos_list.end(), row_id)) {
+          index_table_matches.emplace_back(row_id);
+        }
+      });
     }
 
-    RowIDPosList mutable_ref_seg_pos_list(reference_segment_pos_list->size());
-    std::copy(reference_segment_pos_list->begin(), reference_segment_pos_list->end(), mutable_ref_seg_pos_list.begin());
-    std::sort(mutable_ref_seg_pos_list.begin(), mutable_ref_seg_pos_list.end());
-    std::sort(index_scan_pos_list.begin(), index_scan_pos_list.end());
-
-    RowIDPosList index_table_matches{};
-    std::set_intersection(mutable_ref_seg_pos_list.begin(), mutable_ref_seg_pos_list.end(), index_scan_pos_list.begin(),
-                          index_scan_pos_list.end(), std::back_inserter(index_table_matches));
+    std::sort(index_table_matches.begin(), index_table_matches.end());
     _append_matches_dereferenced(probe_chunk_id, probe_side_position.chunk_offset(), index_table_matches);
   }
 }
@@ -68,10 +68,10 @@ class JoinIndex : public AbstractJoinOperator {
                                            const std::shared_ptr<AbstractIndex>& index);
 
   template <typename ProbeIterator>
-  void _reference_join_two_segments_using_index(
-      ProbeIterator probe_iter, ProbeIterator probe_end, const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
-      const std::shared_ptr<AbstractIndex>& index,
-      const std::shared_ptr<const AbstractPosList>& reference_segment_pos_list);
+  void _reference_join_two_segments_using_index(ProbeIterator probe_iter, ProbeIterator probe_end,
+                                                const ChunkID probe_chunk_id, const ChunkID index_data_chunk_id,
+                                                const std::shared_ptr<AbstractIndex>& index,
+                                                const RowIDPosList& sorted_reference_pos_list);
 
   template <typename SegmentPosition>
   std::vector<IndexRange> _index_ranges_for_value(const SegmentPosition probe_side_position,
@@ -0,0 +1,130 @@
+#include "key_index_scan.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "lossless_cast.hpp"
+#include "operators/get_table.hpp"
+#include "storage/index/table_key/table_key_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+KeyIndexScan::KeyIndexScan(const std::shared_ptr<const AbstractOperator>& in, const std::vector<ColumnID>& column_ids,
+                           const std::vector<AllTypeVariant>& values)
+    : AbstractReadOnlyOperator{OperatorType::KeyIndexScan, in}, _column_ids{column_ids}, _values{values} {
+  Assert(_column_ids.size() == _values.size(), "Count mismatch: column IDs and values don't have the same size.");
+}
+
+const std::string& KeyIndexScan::name() const {
+  static const auto name = std::string{"KeyIndexScan"};
+  return name;
+}
+
+std::string KeyIndexScan::description(DescriptionMode description_mode) const {
+  const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+  std::stringstream stream;
+
+  stream << AbstractOperator::description(description_mode) << separator << "(";
+  for (auto column_index = size_t{0}; column_index < _column_ids.size(); ++column_index) {
+    stream << (column_index > 0 ? ", " : "") << "Column #" << _column_ids[column_index] << " = "
+           << _values[column_index];
+  }
+  stream << ")";
+
+  return stream.str();
+}
+
+const std::vector<ColumnID>& KeyIndexScan::column_ids() const {
+  return _column_ids;
+}
+
+const std::vector<AllTypeVariant>& KeyIndexScan::values() const {
+  return _values;
+}
+
+std::shared_ptr<const Table> KeyIndexScan::_on_execute() {
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(left_input());
+  Assert(get_table, "KeyIndexScan requires a GetTable as input.");
+
+  const auto stored_table = Hyrise::get().storage_manager.get_table(get_table->table_name());
+
+  auto sorted_column_ids = _column_ids;
+  std::sort(sorted_column_ids.begin(), sorted_column_ids.end());
+
+  const auto key_indexes = stored_table->key_indexes();
+  const auto key_index_iter = std::find_if(key_indexes.cbegin(), key_indexes.cend(), [&](const auto& key_index) {
+    return key_index->column_ids() == sorted_column_ids;
+  });
+  Assert(key_index_iter != key_indexes.cend(), "No key index found for the given columns.");
+  const auto& key_index = **key_index_iter;
+
+  // Bring the values into the order of the index. If a value cannot be represented in the column's data type (or is
+  // NULL), no row can match.
+  auto key = TableKeyIndex::Key{};
+  key.reserve(_values.size());
+  for (const auto column_id : key_index.column_ids()) {
+    const auto column_iter = std::find(_column_ids.cbegin(), _column_ids.cend(), column_id);
+    const auto& value = _values[std::distance(_column_ids.cbegin(), column_iter)];
+    const auto value_in_column_type =
+        variant_is_null(value) ? std::nullopt : lossless_variant_cast(value, stored_table->column_data_type(column_id));
+    if (!value_in_column_type) {
+      break;
+    }
+    key.emplace_back(*value_in_column_type);
+  }
+
+  auto matches = std::make_shared<RowIDPosList>();
+  if (key.size() == _values.size()) {
+    const auto& pruned_chunk_ids = get_table->pruned_chunk_ids();
+    for (const auto& row_id : key_index.lookup(key)) {
+      if (std::binary_search(pruned_chunk_ids.cbegin(), pruned_chunk_ids.cend(), row_id.chunk_id) ||
+          !stored_table->get_chunk(row_id.chunk_id)) {
+        continue;
+      }
+      matches->emplace_back(row_id);
+    }
+  }
+
+  // The input table only differs from the stored table by the pruned chunks and columns. The output references the
+  // stored table directly so that the RowIDs do not need to be adjusted for the pruned chunks.
+  const auto& input_table = left_input_table();
+  auto output_table = std::make_shared<Table>(input_table->column_definitions(), TableType::References);
+  if (matches->empty()) {
+    return output_table;
+  }
+
+  std::sort(matches->begin(), matches->end());
+  if (matches->front().chunk_id == matches->back().chunk_id) {
+    matches->guarantee_single_chunk();
+  }
+
+  const auto& pruned_column_ids = get_table->pruned_column_ids();
+  auto segments = Segments{};
+  segments.reserve(input_table->column_count());
+  for (auto stored_column_id = ColumnID{0}; stored_column_id < stored_table->column_count(); ++stored_column_id) {
+    if (std::binary_search(pruned_column_ids.cbegin(), pruned_column_ids.cend(), stored_column_id)) {
+      continue;
+    }
+    segments.emplace_back(std::make_shared<ReferenceSegment>(stored_table, stored_column_id, matches));
+  }
+
+  output_table->append_chunk(segments);
+  return output_table;
+}
+
+std::shared_ptr<AbstractOperator> KeyIndexScan::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  return std::make_shared<KeyIndexScan>(copied_left_input, _column_ids, _values);
+}
+
+void KeyIndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that looks up the rows with the given key in a TableKeyIndex (see Table::create_key_index) instead of
+ * scanning the table. Its input has to be the GetTable operator of the indexed table. Chunks and columns pruned by the
+ * GetTable are respected.
+ *
+ * The column ids refer to the stored table, not to the output of the GetTable. They have to match the columns of a key
+ * index, the values are given in the same order. As the index contains all versions of a key, the output has to be
+ * validated.
+ */
+class KeyIndexScan : public AbstractReadOnlyOperator {
+ public:
+  KeyIndexScan(const std::shared_ptr<const AbstractOperator>& in, const std::vector<ColumnID>& column_ids,
+               const std::vector<AllTypeVariant>& values);
+
+  const std::string& name() const final;
+  std::string description(DescriptionMode description_mode) const override;
+
+  const std::vector<ColumnID>& column_ids() const;
+  const std::vector<AllTypeVariant>& values() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() final;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  const std::vector<ColumnID> _column_ids;
+  const std::vector<AllTypeVariant> _values;
+};
+
+}  // namespace opossum
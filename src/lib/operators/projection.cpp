@@ -146,6 +146,19 @@ std::shared_ptr<const Table> Projection::_on_execute() {
   // vector stores atomic bool values. This allows parallel write operation per thread.
   auto column_is_nullable = std::vector<std::atomic_bool>(expressions.size());
 
+  // The newly generated columns are evaluated together, one vector of rows at a time. The evaluators are reused for
+  // multiple chunks.
+  auto evaluated_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  auto evaluated_column_ids = std::vector<ColumnID>{};
+  for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
+    if (!forwarded_pqp_columns.contains(expressions[column_id])) {
+      evaluated_expressions.emplace_back(expressions[column_id]);
+      evaluated_column_ids.emplace_back(column_id);
+    }
+  }
+  auto evaluator_pool = ExpressionEvaluatorPool{left_input_table(), uncorrelated_subquery_results,
+                                                ExpressionEvaluator::EvaluationMode::Vectorized};
+
   for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
     const auto input_chunk = input_table.get_chunk(chunk_id);
     Assert(input_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
@@ -180,21 +193,19 @@ std::shared_ptr<const Table> Projection::_on_execute() {
     }
 
     // Defines the job that performs the evaluation if the columns are newly generated.
-    auto perform_projection_evaluation = [this, chunk_id, &uncorrelated_subquery_results, expression_count,
-                                          &output_segments_by_chunk, &column_is_nullable, &forwarded_pqp_columns]() {
-      auto evaluator = ExpressionEvaluator{left_input_table(), chunk_id, uncorrelated_subquery_results};
-
-      for (auto column_id = ColumnID{0}; column_id < expression_count; ++column_id) {
-        const auto& expression = expressions[column_id];
-
-        if (!forwarded_pqp_columns.contains(expression)) {
-          // Newly generated column - the expression needs to be evaluated
-          auto output_segment = evaluator.evaluate_expression_to_segment(*expression);
-          column_is_nullable[column_id] = column_is_nullable[column_id] || output_segment->is_nullable();
-          // Storing the result in output_segments_by_chunk means that the vector for the separate chunks may contain
-          // both ReferenceSegments and ValueSegments. We deal with this later.
-          output_segments_by_chunk[chunk_id][column_id] = std::move(output_segment);
-        }
+    auto perform_projection_evaluation = [chunk_id, &evaluator_pool, &evaluated_expressions, &evaluated_column_ids,
+                                          &output_segments_by_chunk, &column_is_nullable]() {
+      auto evaluator = evaluator_pool.acquire(chunk_id);
+      auto evaluated_segments = evaluator->evaluate_expressions_to_segments(evaluated_expressions);
+      evaluator_pool.release(std::move(evaluator));
+
+      for (auto expression_idx = size_t{0}; expression_idx < evaluated_column_ids.size(); ++expression_idx) {
+        const auto column_id = evaluated_column_ids[expression_idx];
+        auto& output_segment = evaluated_segments[expression_idx];
+        column_is_nullable[column_id] = column_is_nullable[column_id] || output_segment->is_nullable();
+        // Storing the result in output_segments_by_chunk means that the vector for the separate chunks may contain
+        // both ReferenceSegments and ValueSegments. We deal with this later.
+        output_segments_by_chunk[chunk_id][column_id] = std::move(output_segment);
       }
     };
     // Evaluate the expression immediately if it contains less than `JOB_SPAWN_THRESHOLD` rows, otherwise wrap
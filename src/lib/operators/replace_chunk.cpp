@@ -0,0 +1,214 @@
+#include "replace_chunk.hpp"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "delete.hpp"
+#include "hyrise.hpp"
+#include "storage/index/table_key/table_key_index.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/reference_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ReplaceChunk::ReplaceChunk(const std::string& target_table_name,
+                           const std::shared_ptr<const AbstractOperator>& rows_to_replace,
+                           const std::shared_ptr<const AbstractOperator>& replacement_rows)
+    : AbstractReadWriteOperator(OperatorType::ReplaceChunk, rows_to_replace, replacement_rows),
+      _target_table_name{target_table_name} {}
+
+const std::string& ReplaceChunk::name() const {
+  static const auto name = std::string{"ReplaceChunk"};
+  return name;
+}
+
+const std::vector<ChunkID>& ReplaceChunk::appended_chunk_ids() const {
+  return _appended_chunk_ids;
+}
+
+std::shared_ptr<const Table> ReplaceChunk::_on_execute(std::shared_ptr<TransactionContext> context) {
+  _target_table = Hyrise::get().storage_manager.get_table(_target_table_name);
+  const auto& replacement_table = right_input_table();
+
+  // 0. Validate input
+  DebugAssert(context, "ReplaceChunk needs a transaction context");
+  Assert(_target_table->uses_mvcc() == UseMvcc::Yes, "ReplaceChunk requires a table with MVCC data");
+  Assert(replacement_table->type() == TableType::Data, "Expected replacement rows to be a data table");
+  Assert(left_input_table()->row_count() == replacement_table->row_count(),
+         "ReplaceChunk requires the same number of rows in both inputs");
+  Assert(replacement_table->column_data_types() == _target_table->column_data_types(),
+         "ReplaceChunk requires the replacement rows to have the layout of the target table");
+
+  // 1. Invalidate the old rows with the Delete operator. Delete doesn't accept empty input data.
+  if (left_input_table()->row_count() > 0) {
+    _delete = std::make_shared<Delete>(_target_table_name, _left_input);
+    _delete->disable_write_ahead_logging();
+    _delete->set_transaction_context(context);
+    _delete->execute();
+
+    if (_delete->execute_failed()) {
+      _mark_as_failed();
+      return nullptr;
+    }
+  }
+
+  // 2. Append the chunks of the replacement rows. Their rows are locked by the current transaction and invisible to
+  //    others until the commit. The chunks are immutable before they are appended, so Insert never writes to them.
+  //    As their rows are not committed yet, max_begin_cid is set to MAX_COMMIT_ID. Validate thus checks each row
+  //    until the commit sets max_begin_cid.
+  const auto transaction_id = context->transaction_id();
+  const auto column_count = _target_table->column_count();
+  const auto replacement_chunk_count = replacement_table->chunk_count();
+
+  // As for Insert, key indexes must not be created while the rows are appended, but not added to the indexes yet
+  const auto key_index_lock = _target_table->acquire_shared_key_index_mutex();
+  {
+    const auto append_lock = _target_table->acquire_append_mutex();
+
+    for (auto replacement_chunk_id = ChunkID{0}; replacement_chunk_id < replacement_chunk_count;
+         ++replacement_chunk_id) {
+      const auto replacement_chunk = replacement_table->get_chunk(replacement_chunk_id);
+      const auto chunk_size = replacement_chunk->size();
+      if (chunk_size == 0) {
+        continue;
+      }
+
+      auto segments = Segments{};
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        segments.emplace_back(replacement_chunk->get_segment(column_id));
+      }
+
+      const auto mvcc_data = std::make_shared<MvccData>(chunk_size, MvccData::MAX_COMMIT_ID);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        mvcc_data->set_tid(chunk_offset, transaction_id, std::memory_order_relaxed);
+      }
+      mvcc_data->max_begin_cid = MvccData::MAX_COMMIT_ID;
+
+      const auto chunk = std::make_shared<Chunk>(segments, mvcc_data);
+      chunk->finalize();
+      if (!replacement_chunk->individually_sorted_by().empty()) {
+        chunk->set_individually_sorted_by(replacement_chunk->individually_sorted_by());
+      }
+      chunk->set_pruning_statistics(replacement_chunk->pruning_statistics());
+
+      // Make sure the MVCC data is written before the chunk becomes visible
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+
+      _appended_chunk_ids.emplace_back(_target_table->chunk_count());
+      _target_table->append_chunk(chunk);
+    }
+  }
+
+  // 3. Add the new rows to the key indexes of the target table. They have the same keys as the old rows, which were
+  //    deleted by this transaction and thus do not conflict (see TableKeyIndex).
+  for (const auto& key_index : _target_table->key_indexes()) {
+    for (const auto chunk_id : _appended_chunk_ids) {
+      const auto chunk = _target_table->get_chunk(chunk_id);
+      const auto chunk_size = chunk->size();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        const auto key = key_index->key_of_row(*chunk, chunk_offset);
+        if (!key) {
+          continue;
+        }
+
+        if (!key_index->try_insert(*key, RowID{chunk_id, chunk_offset}, transaction_id)) {
+          _mark_as_failed();
+          return nullptr;
+        }
+      }
+    }
+  }
+
+  return nullptr;
+}
+
+void ReplaceChunk::_on_commit_records(const CommitID cid) {
+  for (const auto chunk_id : _appended_chunk_ids) {
+    const auto chunk = _target_table->get_chunk(chunk_id);
+    auto mvcc_data = chunk->mvcc_data();
+
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      mvcc_data->set_begin_cid(chunk_offset, cid);
+      mvcc_data->set_tid(chunk_offset, TransactionID{0}, std::memory_order_relaxed);
+    }
+
+    // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // The commit ID is only visible to transactions that start after the commit, which see all rows of the chunk
+    mvcc_data->max_begin_cid = cid;
+  }
+}
+
+void ReplaceChunk::_on_rollback_records() {
+  for (const auto chunk_id : _appended_chunk_ids) {
+    const auto chunk = _target_table->get_chunk(chunk_id);
+    auto mvcc_data = chunk->mvcc_data();
+    const auto chunk_size = chunk->size();
+
+    // As in Insert::_on_rollback_records, the end_cids have to be set to 0 BEFORE the begin_cids are set to 0.
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      mvcc_data->set_end_cid(chunk_offset, CommitID{0});
+    }
+    chunk->increase_invalid_row_count(chunk_size);
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      mvcc_data->set_begin_cid(chunk_offset, CommitID{0});
+      mvcc_data->set_tid(chunk_offset, TransactionID{0}, std::memory_order_relaxed);
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    // Entries of rows that were not indexed because the execution failed are ignored by erase()
+    for (const auto& key_index : _target_table->key_indexes()) {
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        const auto key = key_index->key_of_row(*chunk, chunk_offset);
+        if (key) {
+          key_index->erase(*key, RowID{chunk_id, chunk_offset});
+        }
+      }
+    }
+  }
+}
+
+void ReplaceChunk::_on_log_records(WriteAheadLogRecord& record) const {
+  // The n-th new row is a copy of the n-th old row, see the class comment
+  auto old_row_ids = RowIDPosList{};
+  const auto& rows_to_replace = left_input_table();
+  const auto chunk_count = rows_to_replace->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& reference_segment =
+        static_cast<const ReferenceSegment&>(*rows_to_replace->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+    const auto& pos_list = *reference_segment.pos_list();
+    old_row_ids.insert(old_row_ids.end(), pos_list.begin(), pos_list.end());
+  }
+
+  auto new_row_ids = RowIDPosList{};
+  new_row_ids.reserve(old_row_ids.size());
+  for (const auto chunk_id : _appended_chunk_ids) {
+    const auto chunk_size = _target_table->get_chunk(chunk_id)->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      new_row_ids.emplace_back(chunk_id, chunk_offset);
+    }
+  }
+
+  record.log_relocation(_target_table_name, old_row_ids, new_row_ids);
+}
+
+std::shared_ptr<AbstractOperator> ReplaceChunk::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  return std::make_shared<ReplaceChunk>(_target_table_name, copied_left_input, copied_right_input);
+}
+
+void ReplaceChunk::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_write_operator.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class Delete;
+
+/**
+ * Operator that atomically replaces rows of a stored table by a reorganized copy of them, e.g., a chunk by a sorted
+ * and encoded version of its rows. The first input references the rows that are replaced, the second input contains
+ * the rows that replace them. The n-th row of the second input is a copy of the n-th row of the first input.
+ *
+ * Like Update, the old rows are invalidated by a Delete. Different from Insert, the chunks of the second input are not
+ * copied into the mutable chunk of the table, but appended as new immutable chunks, so that their encoding, sort
+ * order, and pruning statistics are preserved. Insert keeps appending to the last mutable chunk, which now precedes
+ * the new chunks (see Table::last_mutable_chunk_id). As the begin CIDs of the new rows and the end CIDs of the old
+ * rows are set by the same commit, every transaction sees exactly one version of the rows.
+ *
+ * As the values do not change, the WriteAheadLog only records where the rows were moved to, not an insertion and an
+ * invalidation. Recovery thus does not copy the rows again.
+ *
+ * Assumption: The first input has been validated before.
+ */
+class ReplaceChunk : public AbstractReadWriteOperator {
+ public:
+  explicit ReplaceChunk(const std::string& target_table_name,
+                        const std::shared_ptr<const AbstractOperator>& rows_to_replace,
+                        const std::shared_ptr<const AbstractOperator>& replacement_rows);
+
+  const std::string& name() const override;
+
+  // The IDs of the chunks that were appended to the target table
+  const std::vector<ChunkID>& appended_chunk_ids() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  // Commit and rollback only handle the new rows. The old rows are committed and rolled back by the Delete operator.
+  void _on_commit_records(const CommitID cid) override;
+  void _on_rollback_records() override;
+  void _on_log_records(WriteAheadLogRecord& record) const override;
+
+ private:
+  const std::string _target_table_name;
+
+  std::shared_ptr<Table> _target_table;
+  std::shared_ptr<Delete> _delete;
+  std::vector<ChunkID> _appended_chunk_ids;
+};
+
+}  // namespace opossum
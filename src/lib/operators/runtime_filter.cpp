@@ -0,0 +1,207 @@
+#include "runtime_filter.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "operators/abstract_operator.hpp"
+#include "resolve_type.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "storage/chunk.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+RuntimeFilter::RuntimeFilter(const std::shared_ptr<const AbstractOperator>& source, const ColumnID source_column_id,
+                             const std::vector<std::shared_ptr<const AbstractOperator>>& probe_chain)
+    : _source(source), _source_column_id(source_column_id), _probe_chain(probe_chain.cbegin(), probe_chain.cend()) {
+  Assert(!probe_chain.empty(), "Expected at least one operator on the probe side");
+}
+
+std::shared_ptr<const AbstractOperator> RuntimeFilter::source() const {
+  return _source.lock();
+}
+
+ColumnID RuntimeFilter::source_column_id() const {
+  return _source_column_id;
+}
+
+std::vector<std::shared_ptr<const AbstractOperator>> RuntimeFilter::probe_chain() const {
+  auto probe_chain = std::vector<std::shared_ptr<const AbstractOperator>>{};
+  probe_chain.reserve(_probe_chain.size());
+  for (const auto& op : _probe_chain) {
+    if (const auto locked_op = op.lock()) {
+      probe_chain.emplace_back(locked_op);
+    }
+  }
+  return probe_chain;
+}
+
+void RuntimeFilter::add_consumer(const std::shared_ptr<const AbstractOperator>& consumer, const ColumnID column_id) {
+  Assert(std::any_of(_probe_chain.cbegin(), _probe_chain.cend(),
+                     [&](const auto& op) { return op.lock() == consumer; }),
+         "Consumers of a RuntimeFilter have to be part of its probe chain");
+  _consumers.emplace_back(consumer, column_id);
+}
+
+std::vector<std::pair<std::shared_ptr<const AbstractOperator>, ColumnID>> RuntimeFilter::consumers() const {
+  auto consumers = std::vector<std::pair<std::shared_ptr<const AbstractOperator>, ColumnID>>{};
+  consumers.reserve(_consumers.size());
+  for (const auto& [consumer, column_id] : _consumers) {
+    if (const auto locked_consumer = consumer.lock()) {
+      consumers.emplace_back(locked_consumer, column_id);
+    }
+  }
+  return consumers;
+}
+
+bool RuntimeFilter::can_filter(const AbstractOperator& consumer) const {
+  const auto source = _source.lock();
+  if (!source || !source->executed() || !source->get_output()) {
+    return false;
+  }
+
+  // The consumer and all operators above it must only be consumed by the next operator of the chain (or the join)
+  const auto consumer_iter = std::find_if(_probe_chain.cbegin(), _probe_chain.cend(),
+                                          [&](const auto& op) { return op.lock().get() == &consumer; });
+  if (consumer_iter == _probe_chain.cend()) {
+    return false;
+  }
+
+  for (auto probe_chain_iter = consumer_iter; probe_chain_iter != _probe_chain.cend(); ++probe_chain_iter) {
+    const auto op = probe_chain_iter->lock();
+    if (!op || op->consumer_count() != 1) {
+      return false;
+    }
+  }
+
+  std::call_once(_build_flag, [&]() { _build(); });
+  return true;
+}
+
+bool RuntimeFilter::chunk_may_match(const Chunk& chunk, const ColumnID column_id) const {
+  DebugAssert(_is_built, "RuntimeFilter has not been built");
+  if (_is_empty) {
+    return false;
+  }
+
+  const auto pruning_statistics = chunk.pruning_statistics();
+  if (!pruning_statistics) {
+    return true;
+  }
+
+  // Same as in the ChunkPruningRule: If the values of the chunk are not between the minimum and the maximum of the
+  // source, the chunk cannot contain any join partner.
+  auto may_match = true;
+  const auto& base_segment_statistics = *(*pruning_statistics)[column_id];
+  resolve_data_type(base_segment_statistics.data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto& segment_statistics = static_cast<const AttributeStatistics<ColumnDataType>&>(base_segment_statistics);
+
+    // Range filters are only available for arithmetic (non-string) types.
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      if (segment_statistics.range_filter &&
+          segment_statistics.range_filter->does_not_contain(PredicateCondition::BetweenInclusive, _min, _max)) {
+        may_match = false;
+      }
+    }
+
+    if (segment_statistics.min_max_filter &&
+        segment_statistics.min_max_filter->does_not_contain(PredicateCondition::BetweenInclusive, _min, _max)) {
+      may_match = false;
+    }
+  });
+
+  return may_match;
+}
+
+bool RuntimeFilter::chunk_within_range(const Chunk& chunk, const ColumnID column_id) const {
+  DebugAssert(_is_built, "RuntimeFilter has not been built");
+  if (_is_empty) {
+    return false;
+  }
+
+  const auto pruning_statistics = chunk.pruning_statistics();
+  if (!pruning_statistics) {
+    return false;
+  }
+
+  auto within_range = false;
+  const auto& base_segment_statistics = *(*pruning_statistics)[column_id];
+  resolve_data_type(base_segment_statistics.data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto& segment_statistics = static_cast<const AttributeStatistics<ColumnDataType>&>(base_segment_statistics);
+    if (segment_statistics.min_max_filter) {
+      const auto& min_max_filter = *segment_statistics.min_max_filter;
+      within_range = !(min_max_filter.min < boost::get<ColumnDataType>(_min)) &&
+                     !(boost::get<ColumnDataType>(_max) < min_max_filter.max);
+    }
+  });
+
+  return within_range;
+}
+
+DataType RuntimeFilter::data_type() const {
+  DebugAssert(_is_built, "RuntimeFilter has not been built");
+  return _data_type;
+}
+
+void RuntimeFilter::_build() const {
+  const auto source_table = _source.lock()->get_output();
+  _data_type = source_table->column_data_type(_source_column_id);
+
+  // Size the filter for the number of rows, which is an upper bound for the number of distinct values
+  auto bit_count = BITS_PER_BLOCK;
+  while (bit_count < MAX_BLOOM_FILTER_SIZE && bit_count < source_table->row_count() * BITS_PER_VALUE) {
+    bit_count *= 2;
+  }
+  _blocks.resize(bit_count / BITS_PER_BLOCK);
+
+  resolve_data_type(_data_type, [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    auto min = ColumnDataType{};
+    auto max = ColumnDataType{};
+
+    const auto chunk_count = source_table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = source_table->get_chunk(chunk_id);
+      if (!chunk) {
+        continue;
+      }
+
+      segment_iterate<ColumnDataType>(*chunk->get_segment(_source_column_id), [&](const auto& position) {
+        if (position.is_null()) {
+          return;
+        }
+
+        const auto& value = position.value();
+        if (_is_empty) {
+          min = value;
+          max = value;
+          _is_empty = false;
+        } else if (value < min) {
+          min = value;
+        } else if (max < value) {
+          max = value;
+        }
+
+        const auto hash = _hash<ColumnDataType>(value);
+        _blocks[_block_index(hash)] |= _bit_mask(hash);
+      });
+    }
+
+    _min = min;
+    _max = max;
+  });
+
+  _is_built = true;
+}
+
+}  // namespace opossum
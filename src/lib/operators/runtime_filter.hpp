@@ -0,0 +1,146 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Chunk;
+
+/**
+ * Filter that is published by a JoinHash to the operators that produce its probe side (sideways information passing).
+ * It summarizes the join column of the other input (the source), which is executed first: Rows of the probe side
+ * whose join value is not contained in the source cannot have a join partner and are dropped before they are
+ * materialized and radix partitioned by the join. Only joins that do not emit unmatched probe side rows (i.e., inner
+ * and semi joins as well as the null-supplying side of left and right outer joins) use runtime filters.
+ *
+ * The filter consists of the minimum and maximum of the source values, which are used to skip entire chunks (with the
+ * help of their pruning statistics), and of a blocked Bloom filter for individual values. In a blocked Bloom filter,
+ * all bits of a value are set in the same 64-bit word, so that a lookup requires a single memory access.
+ *
+ * The operators that use the filter (TableScan and GetTable, see add_runtime_filter) are called consumers. Before a
+ * consumer drops rows, it checks with can_filter whether it is safe to do so:
+ *  - The source has to be executed. This is ensured by the OperatorTasks (see make_tasks_from_operator), but not if
+ *    the operators are executed manually or the consumer has been executed before. Then, nothing is filtered.
+ *  - The output of the consumer has to reach the join only, i.e., the consumer and all operators on the way to the
+ *    join (the probe chain) must not have other consumers. Operators might be shared with other parts of the plan (see
+ *    LQPTranslator::translate_node), which is only known once the entire plan has been translated. As the consumers of
+ *    an operator have not been executed when the operator is executed, the number of consumers is final by then.
+ */
+class RuntimeFilter : private Noncopyable {
+ public:
+  // The Bloom filter uses BITS_PER_VALUE bits per source row (rounded up to a power of two), but at most
+  // MAX_BLOOM_FILTER_SIZE bits. With three bits per value, the false positive rate is about 1% for 16 bits per value.
+  static constexpr auto BITS_PER_VALUE = size_t{16};
+  static constexpr auto MAX_BLOOM_FILTER_SIZE = size_t{1} << 24;
+  static constexpr auto BITS_PER_BLOCK = size_t{64};
+
+  // The LQPTranslator publishes filters only for sources with up to this many (estimated) rows. For larger sources,
+  // the filter gets too inaccurate and waiting for the source before the consumers run costs too much parallelism.
+  static constexpr auto MAX_SOURCE_ROW_COUNT = MAX_BLOOM_FILTER_SIZE / BITS_PER_VALUE;
+
+  /**
+   * @param source             operator whose output column @param source_column_id is summarized
+   * @param probe_chain        operators from the lowest consumer up to (and including) the probe side input of the join
+   */
+  RuntimeFilter(const std::shared_ptr<const AbstractOperator>& source, const ColumnID source_column_id,
+                const std::vector<std::shared_ptr<const AbstractOperator>>& probe_chain);
+
+  std::shared_ptr<const AbstractOperator> source() const;
+  ColumnID source_column_id() const;
+  std::vector<std::shared_ptr<const AbstractOperator>> probe_chain() const;
+
+  // Registers @param consumer as an operator that uses this filter for its output column @param column_id. Called by
+  // the consumer. Used to order the execution of the source and the consumers (see
+  // OperatorTask::make_tasks_from_operator) and to copy the filter along with the join (see JoinHash::_on_deep_copy).
+  void add_consumer(const std::shared_ptr<const AbstractOperator>& consumer, const ColumnID column_id);
+  std::vector<std::pair<std::shared_ptr<const AbstractOperator>, ColumnID>> consumers() const;
+
+  /**
+   * @return whether @param consumer may drop rows that are not contained in the filter (see class comment). Builds the
+   *         filter on the first call after the source has been executed. Thread-safe.
+   */
+  bool can_filter(const AbstractOperator& consumer) const;
+
+  // @return false if no row of the source has the join value @param value. Only valid if can_filter returned true.
+  template <typename ColumnDataType>
+  bool may_contain(const ColumnDataType& value) const {
+    DebugAssert(_is_built, "RuntimeFilter has not been built");
+    if (_is_empty) {
+      return false;
+    }
+
+    if (value < boost::get<ColumnDataType>(_min) || boost::get<ColumnDataType>(_max) < value) {
+      return false;
+    }
+
+    return bloom_filter_may_contain(value);
+  }
+
+  // Same as may_contain, but skips the comparison with the minimum and maximum. Meant for values of chunks for which
+  // chunk_within_range returned true.
+  template <typename ColumnDataType>
+  bool bloom_filter_may_contain(const ColumnDataType& value) const {
+    DebugAssert(_is_built, "RuntimeFilter has not been built");
+    if (_is_empty) {
+      return false;
+    }
+
+    const auto hash = _hash(value);
+    const auto bit_mask = _bit_mask(hash);
+    return (_blocks[_block_index(hash)] & bit_mask) == bit_mask;
+  }
+
+  // @return false if the pruning statistics of @param column_id prove that no value of @param chunk is between the
+  //         minimum and maximum of the source. Only valid if can_filter returned true.
+  bool chunk_may_match(const Chunk& chunk, const ColumnID column_id) const;
+
+  // @return true if the pruning statistics of @param column_id prove that all values of @param chunk are between the
+  //         minimum and maximum of the source. Only valid if can_filter returned true.
+  bool chunk_within_range(const Chunk& chunk, const ColumnID column_id) const;
+
+  DataType data_type() const;
+
+ protected:
+  void _build() const;
+
+  template <typename ColumnDataType>
+  static size_t _hash(const ColumnDataType& value) {
+    // std::hash is the identity for integers. Mixing the bits makes them usable for the block index and the bit mask.
+    return std::hash<ColumnDataType>{}(value) * size_t{0x9E3779B97F4A7C15};
+  }
+
+  // Three bits out of the 64 bits of a block, taken from the lower 18 bits of the hash
+  static uint64_t _bit_mask(const size_t hash) {
+    return (uint64_t{1} << (hash & 63u)) | (uint64_t{1} << ((hash >> 6u) & 63u)) |
+           (uint64_t{1} << ((hash >> 12u) & 63u));
+  }
+
+  // The block is taken from the upper 32 bits of the hash, which are independent of the bit mask
+  size_t _block_index(const size_t hash) const {
+    return (hash >> 32u) & (_blocks.size() - 1);
+  }
+
+  const std::weak_ptr<const AbstractOperator> _source;
+  const ColumnID _source_column_id;
+  std::vector<std::weak_ptr<const AbstractOperator>> _probe_chain;
+  std::vector<std::pair<std::weak_ptr<const AbstractOperator>, ColumnID>> _consumers;
+
+  // Built lazily by _build(). An empty source contains nothing, not even NULLs.
+  mutable std::once_flag _build_flag;
+  mutable bool _is_built{false};
+  mutable bool _is_empty{true};
+  mutable DataType _data_type{DataType::Null};
+  mutable AllTypeVariant _min;
+  mutable AllTypeVariant _max;
+  mutable std::vector<uint64_t> _blocks;
+};
+
+}  // namespace opossum
@@ -1,5 +1,14 @@
 #include "sort.hpp"
 
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include <boost/sort/sort.hpp>
+
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/segment_iterate.hpp"
 #include "utils/timer.hpp"
 
@@ -7,6 +16,270 @@ namespace {
 
 using namespace opossum;  // NOLINT
 
+// Jobs are only spawned if they process at least JOB_SPAWN_THRESHOLD rows. Otherwise, the work is done by the calling
+// thread.
+constexpr auto JOB_SPAWN_THRESHOLD = size_t{500};
+
+// Each sorted row is represented by a SortEntry. The key is the normalized first sort column (see
+// normalize_sort_key), so that most comparisons do not have to access the materialized values of the sort columns.
+struct SortEntry {
+  uint64_t key;
+  RowID row_id;
+  bool key_is_null;
+};
+
+// Encodes @param value as an unsigned integer so that comparing the integers yields the same order as comparing the
+// values. For strings, only the first eight bytes are encoded, so that equal keys have to be resolved by comparing the
+// full strings.
+template <typename ColumnDataType>
+uint64_t normalize_sort_key(const ColumnDataType& value) {
+  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+    // char_traits<char> compares characters as unsigned chars, which matches the big endian byte order of the key
+    auto key = uint64_t{0};
+    const auto byte_count = std::min(value.size(), sizeof(key));
+    for (auto byte_idx = size_t{0}; byte_idx < byte_count; ++byte_idx) {
+      key |= uint64_t{static_cast<unsigned char>(value[byte_idx])} << (8 * (sizeof(key) - 1 - byte_idx));
+    }
+    return key;
+  } else if constexpr (std::is_floating_point_v<ColumnDataType>) {
+    using Bits = std::conditional_t<sizeof(ColumnDataType) == 4, uint32_t, uint64_t>;
+    constexpr auto SIGN_BIT = Bits{1} << (sizeof(Bits) * 8 - 1);
+
+    // -0.0 and 0.0 are equal and must get the same key
+    const auto normalized_value = value == ColumnDataType{0} ? ColumnDataType{0} : value;
+    auto bits = Bits{};
+    std::memcpy(&bits, &normalized_value, sizeof(bits));
+
+    // Negative values are ordered inversely by their bits and come before positive values
+    return (bits & SIGN_BIT) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | SIGN_BIT);
+  } else {
+    using UnsignedType = std::make_unsigned_t<ColumnDataType>;
+    constexpr auto SIGN_BIT = UnsignedType{1} << (sizeof(UnsignedType) * 8 - 1);
+    return static_cast<UnsignedType>(static_cast<UnsignedType>(value) ^ SIGN_BIT);
+  }
+}
+
+// A sort column materialized chunk by chunk, so that its values can be accessed by their RowID in the input table
+class BaseSortColumn {
+ public:
+  virtual ~BaseSortColumn() = default;
+
+  // Materializes the first @param row_count values of @param chunk_id. Rows that have been appended to the chunk
+  // afterwards are ignored. Different chunks can be materialized in parallel.
+  virtual void materialize_chunk(const Table& table, const ChunkID chunk_id, const ChunkOffset row_count) = 0;
+
+  // Writes a SortEntry for each row of @param chunk_id, starting at @param entries. Used for the first sort column.
+  virtual void write_entries(const ChunkID chunk_id, std::vector<SortEntry>::iterator entries) const = 0;
+
+  // Whether equal keys (see write_entries) imply equal values
+  virtual bool key_is_exact() const = 0;
+
+  // @return a negative number if @param lhs comes before @param rhs, a positive number if it comes after, and 0 if
+  // both rows have the same value
+  virtual int compare(const RowID& lhs, const RowID& rhs) const = 0;
+};
+
+template <typename ColumnDataType>
+class SortColumn : public BaseSortColumn {
+ public:
+  SortColumn(const SortColumnDefinition& sort_definition, const ChunkID chunk_count)
+      : _column_id(sort_definition.column),
+        _ascending(sort_definition.sort_mode == SortMode::Ascending),
+        _values(chunk_count),
+        _null_values(chunk_count) {}
+
+  void materialize_chunk(const Table& table, const ChunkID chunk_id, const ChunkOffset row_count) override {
+    const auto& segment = *table.get_chunk(chunk_id)->get_segment(_column_id);
+    auto& values = _values[chunk_id];
+    auto& null_values = _null_values[chunk_id];
+    values.resize(row_count);
+    null_values.resize(row_count);
+
+    segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+      const auto chunk_offset = position.chunk_offset();
+      if (chunk_offset >= row_count) {
+        return;
+      }
+
+      if (position.is_null()) {
+        null_values[chunk_offset] = true;
+      } else {
+        values[chunk_offset] = position.value();
+      }
+    });
+  }
+
+  void write_entries(const ChunkID chunk_id, std::vector<SortEntry>::iterator entries) const override {
+    const auto& values = _values[chunk_id];
+    const auto& null_values = _null_values[chunk_id];
+    const auto row_count = static_cast<ChunkOffset>(values.size());
+
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      auto& entry = *(entries + chunk_offset);
+      entry.row_id = RowID{chunk_id, chunk_offset};
+      entry.key_is_null = null_values[chunk_offset];
+      entry.key = 0;
+      if (!entry.key_is_null) {
+        entry.key = normalize_sort_key(values[chunk_offset]);
+        if (!_ascending) {
+          entry.key = ~entry.key;
+        }
+      }
+    }
+  }
+
+  bool key_is_exact() const override {
+    return !std::is_same_v<ColumnDataType, pmr_string>;
+  }
+
+  int compare(const RowID& lhs, const RowID& rhs) const override {
+    const auto lhs_is_null = _null_values[lhs.chunk_id][lhs.chunk_offset];
+    const auto rhs_is_null = _null_values[rhs.chunk_id][rhs.chunk_offset];
+    if (lhs_is_null || rhs_is_null) {
+      // NULLs come first, see Sort
+      return static_cast<int>(rhs_is_null) - static_cast<int>(lhs_is_null);
+    }
+
+    const auto& lhs_value = _values[lhs.chunk_id][lhs.chunk_offset];
+    const auto& rhs_value = _values[rhs.chunk_id][rhs.chunk_offset];
+    if (lhs_value < rhs_value) {
+      return _ascending ? -1 : 1;
+    }
+    if (rhs_value < lhs_value) {
+      return _ascending ? 1 : -1;
+    }
+    return 0;
+  }
+
+ private:
+  const ColumnID _column_id;
+  const bool _ascending;
+
+  std::vector<std::vector<ColumnDataType>> _values;
+  std::vector<std::vector<bool>> _null_values;
+};
+
+// Calls @param function for each index in [0, @param count), using a JobTask for each index whose @param job_size
+// (i.e., number of rows to process) is at least JOB_SPAWN_THRESHOLD.
+template <typename JobSize, typename Function>
+void for_each_job(const size_t count, const JobSize& job_size, const Function& function) {
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto index = size_t{0}; index < count; ++index) {
+    if (job_size(index) >= JOB_SPAWN_THRESHOLD) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, index] { function(index); }));
+    } else {
+      function(index);
+    }
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+}
+
+// Each bucket of the sample sort holds about 256 KB of SortEntries, so that it can be sorted in the L2 cache (see
+// JoinSortMerge's _determine_number_of_clusters).
+constexpr auto MAX_BUCKET_SIZE = size_t{256'000} / sizeof(SortEntry);
+
+// Limits the size of the histograms (one counter per slice and bucket). Larger inputs result in buckets that exceed
+// MAX_BUCKET_SIZE, which are sample sorted recursively.
+constexpr auto MAX_BUCKET_COUNT = size_t{1'024};
+
+// The input is partitioned in slices, each of which is processed by a job. A few slices per worker balance the load
+// without the overhead of many small jobs.
+constexpr auto SLICES_PER_WORKER = size_t{4};
+
+// The number of sampled entries per bucket that are used to determine the bucket boundaries
+constexpr auto SAMPLES_PER_BUCKET = size_t{64};
+
+// Sorts the entries in [@param begin, @param end) with a parallel sample sort: Using a sorted sample of the entries,
+// the entries are partitioned into buckets that cover non-overlapping ranges. The buckets are then sorted in parallel.
+// As the buckets are stored one after another, they form the sorted result without a final merge. @param comparator
+// has to be a total order (i.e., no two entries are equal), which also keeps the buckets balanced if the sort columns
+// contain many duplicates.
+template <typename Comparator>
+void sample_sort(const std::vector<SortEntry>::iterator begin, const std::vector<SortEntry>::iterator end,
+                 const Comparator& comparator) {
+  const auto entry_count = static_cast<size_t>(std::distance(begin, end));
+  if (entry_count <= MAX_BUCKET_SIZE) {
+    boost::sort::pdqsort(begin, end, comparator);
+    return;
+  }
+
+  // Ceiling of integer division
+  const auto div_ceil = [](const size_t dividend, const size_t divisor) { return (dividend + divisor - 1) / divisor; };
+  const auto bucket_count = std::min(div_ceil(entry_count, MAX_BUCKET_SIZE), MAX_BUCKET_COUNT);
+  const auto worker_count = Hyrise::get().is_multi_threaded() ? Hyrise::get().topology.num_cpus() : size_t{1};
+  const auto slice_count =
+      std::min(div_ceil(entry_count, MAX_BUCKET_SIZE), std::max(size_t{1}, worker_count * SLICES_PER_WORKER));
+
+  // Pick bucket_count - 1 splitters from an evenly spaced sample. Each splitter is the exclusive upper bound of its
+  // bucket.
+  const auto sample_count = std::min(entry_count, bucket_count * SAMPLES_PER_BUCKET);
+  auto samples = std::vector<SortEntry>(sample_count);
+  for (auto sample_idx = size_t{0}; sample_idx < sample_count; ++sample_idx) {
+    samples[sample_idx] = *(begin + sample_idx * entry_count / sample_count);
+  }
+  boost::sort::pdqsort(samples.begin(), samples.end(), comparator);
+
+  auto splitters = std::vector<SortEntry>(bucket_count - 1);
+  for (auto bucket_id = size_t{0}; bucket_id < bucket_count - 1; ++bucket_id) {
+    splitters[bucket_id] = samples[(bucket_id + 1) * sample_count / bucket_count];
+  }
+
+  // For each slice, we first determine the bucket of each entry and count the entries per bucket.
+  const auto slice_begin = [&](const size_t slice_id) { return slice_id * entry_count / slice_count; };
+  const auto slice_size = [&](const size_t slice_id) { return slice_begin(slice_id + 1) - slice_begin(slice_id); };
+
+  static_assert(MAX_BUCKET_COUNT <= std::numeric_limits<uint16_t>::max() + size_t{1}, "Bucket ids do not fit");
+  auto bucket_ids = std::vector<uint16_t>(entry_count);
+  auto histograms = std::vector<std::vector<size_t>>(slice_count, std::vector<size_t>(bucket_count));
+  for_each_job(slice_count, slice_size, [&](const size_t slice_id) {
+    auto& histogram = histograms[slice_id];
+    for (auto entry_idx = slice_begin(slice_id); entry_idx < slice_begin(slice_id + 1); ++entry_idx) {
+      const auto bucket_id = std::upper_bound(splitters.begin(), splitters.end(), *(begin + entry_idx), comparator) -
+                             splitters.begin();
+      bucket_ids[entry_idx] = static_cast<uint16_t>(bucket_id);
+      ++histogram[bucket_id];
+    }
+  });
+
+  // Turn the histograms into the insert positions of each slice in each bucket
+  auto bucket_begins = std::vector<size_t>(bucket_count + 1);
+  auto insert_position = size_t{0};
+  for (auto bucket_id = size_t{0}; bucket_id < bucket_count; ++bucket_id) {
+    bucket_begins[bucket_id] = insert_position;
+    for (auto& histogram : histograms) {
+      const auto slice_bucket_size = histogram[bucket_id];
+      histogram[bucket_id] = insert_position;
+      insert_position += slice_bucket_size;
+    }
+  }
+  bucket_begins[bucket_count] = entry_count;
+
+  auto partitioned_entries = std::vector<SortEntry>(entry_count);
+  for_each_job(slice_count, slice_size, [&](const size_t slice_id) {
+    auto& insert_positions = histograms[slice_id];
+    for (auto entry_idx = slice_begin(slice_id); entry_idx < slice_begin(slice_id + 1); ++entry_idx) {
+      partitioned_entries[insert_positions[bucket_ids[entry_idx]]++] = *(begin + entry_idx);
+    }
+  });
+
+  // Sort each bucket and copy it back. Buckets that are considerably larger than MAX_BUCKET_SIZE, which is expected if
+  // the bucket count is capped, are sample sorted recursively. If the partitioning made no progress (which requires a
+  // sample that does not represent the entries at all), the bucket is sorted directly.
+  const auto bucket_size = [&](const size_t bucket_id) {
+    return bucket_begins[bucket_id + 1] - bucket_begins[bucket_id];
+  };
+  for_each_job(bucket_count, bucket_size, [&](const size_t bucket_id) {
+    const auto bucket_begin = partitioned_entries.begin() + bucket_begins[bucket_id];
+    const auto bucket_end = partitioned_entries.begin() + bucket_begins[bucket_id + 1];
+    if (bucket_size(bucket_id) > 2 * MAX_BUCKET_SIZE && bucket_size(bucket_id) < entry_count) {
+      sample_sort(bucket_begin, bucket_end, comparator);
+    } else {
+      boost::sort::pdqsort(bucket_begin, bucket_end, comparator);
+    }
+    std::copy(bucket_begin, bucket_end, begin + bucket_begins[bucket_id]);
+  });
+}
+
 // Given an unsorted_table and a pos_list that defines the output order, this materializes all columns in the table,
 // creating chunks of output_chunk_size rows at maximum.
 std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<const Table>& unsorted_table,
@@ -25,12 +298,16 @@ std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<con
   Assert(pos_list.size() == unsorted_table->row_count(), "Mismatching size of input table and PosList");
 
   // Vector of segments for each chunk
-  std::vector<Segments> output_segments_by_chunk(output_chunk_count);
+  const auto column_count = output->column_count();
+  auto output_segments_by_chunk = std::vector<Segments>(output_chunk_count, Segments(column_count));
 
-  // Materialize column by column, starting a new ValueSegment whenever output_chunk_size is reached
+  // Materialize column by column, starting a new ValueSegment whenever output_chunk_size is reached. Each column is
+  // written by a separate job.
   const auto input_chunk_count = unsorted_table->chunk_count();
   const auto row_count = unsorted_table->row_count();
-  for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
+  const auto column_job_size = [&](const size_t /*column_idx*/) { return row_count; };
+  for_each_job(column_count, column_job_size, [&](const size_t column_idx) {
+    const auto column_id = static_cast<ColumnID>(column_idx);
     const auto column_data_type = output->column_data_type(column_id);
     const auto column_is_nullable = unsorted_table->column_is_nullable(column_id);
 
@@ -83,7 +360,7 @@ std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<con
             value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector));
           }
 
-          chunk_it->push_back(value_segment);
+          (*chunk_it)[column_id] = value_segment;
           value_segment_value_vector = pmr_vector<ColumnDataType>();
           value_segment_null_vector = pmr_vector<bool>();
 
@@ -107,10 +384,10 @@ std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<con
         } else {
           value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector));
         }
-        chunk_it->push_back(value_segment);
+        (*chunk_it)[column_id] = value_segment;
       }
     });
-  }
+  });
 
   for (auto& segments : output_segments_by_chunk) {
     output->append_chunk(segments);
@@ -152,12 +429,15 @@ std::shared_ptr<Table> write_reference_output_table(const std::shared_ptr<const
       output_segments[column_id] = std::make_shared<ReferenceSegment>(unsorted_table, column_id, output_pos_list);
     }
   } else {
-    for (ColumnID column_id{0u}; column_id < column_count; ++column_id) {
+    const auto column_job_size = [&](const size_t /*column_idx*/) { return input_pos_list.size(); };
+    for_each_job(column_count, column_job_size, [&](const size_t column_idx) {
+      const auto column_id = static_cast<ColumnID>(column_idx);
+
       // To keep the implementation simple, we write the output ReferenceSegments column by column. This means that even
       // if input ReferenceSegments share a PosList, the output will contain independent PosLists. While this is
       // slightly more expensive to generate and slightly less efficient for following operators, we assume that the
       // lion's share of the work has been done before the Sort operator is executed and that the relative cost of this
-      // is acceptable. In the future, this could be improved.
+      // is acceptable. In the future, this could be improved. Columns are written by separate jobs.
       auto output_pos_list = std::make_shared<RowIDPosList>();
       output_pos_list->reserve(output_chunk_size);
 
@@ -211,7 +491,7 @@ std::shared_ptr<Table> write_reference_output_table(const std::shared_ptr<const
       if (!output_pos_list->empty()) {
         write_output_pos_list();
       }
-    }
+    });
   }
 
   for (auto& segments : output_segments_by_chunk) {
@@ -272,42 +552,90 @@ std::shared_ptr<const Table> Sort::_on_execute() {
 
   std::shared_ptr<Table> sorted_table;
 
-  // After the first (least significant) sort operation has been completed, this holds the order of the table as it has
-  // been determined so far. This is not a completely proper PosList on the input table as it might point to
-  // ReferenceSegments.
-  auto previously_sorted_pos_list = std::optional<RowIDPosList>{};
+  // All sort columns are sorted at once. First, the sort columns are materialized and a SortEntry is created for each
+  // row. Each chunk is processed by a separate job.
+  Timer timer;
+  const auto chunk_count = input_table->chunk_count();
+  auto sort_columns = std::vector<std::unique_ptr<BaseSortColumn>>{};
+  for (const auto& sort_definition : _sort_definitions) {
+    resolve_data_type(input_table->column_data_type(sort_definition.column), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      sort_columns.emplace_back(std::make_unique<SortColumn<ColumnDataType>>(sort_definition, chunk_count));
+    });
+  }
 
-  auto total_materialization_time = std::chrono::nanoseconds{};
-  auto total_temporary_result_writing_time = std::chrono::nanoseconds{};
-  auto total_sort_time = std::chrono::nanoseconds{};
+  // Rows that are concurrently appended to the last chunk are not sorted, so the chunk sizes are fixed upfront
+  auto chunk_sizes = std::vector<ChunkOffset>(chunk_count);
+  auto chunk_begins = std::vector<size_t>(chunk_count);
+  auto entry_count = size_t{0};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
+
+    chunk_sizes[chunk_id] = chunk->size();
+    chunk_begins[chunk_id] = entry_count;
+    entry_count += chunk_sizes[chunk_id];
+  }
 
-  for (auto sort_step = static_cast<int64_t>(_sort_definitions.size() - 1); sort_step >= 0; --sort_step) {
-    const auto& sort_definition = _sort_definitions[sort_step];
-    const auto data_type = input_table->column_data_type(sort_definition.column);
+  auto entries = std::vector<SortEntry>(entry_count);
+  for_each_job(
+      chunk_count, [&](const size_t chunk_idx) { return chunk_sizes[chunk_idx]; },
+      [&](const size_t chunk_idx) {
+        const auto chunk_id = static_cast<ChunkID>(chunk_idx);
+        for (const auto& sort_column : sort_columns) {
+          sort_column->materialize_chunk(*input_table, chunk_id, chunk_sizes[chunk_id]);
+        }
+        sort_columns.front()->write_entries(chunk_id, entries.begin() + chunk_begins[chunk_id]);
+      });
 
-    resolve_data_type(data_type, [&](auto type) {
-      using ColumnDataType = typename decltype(type)::type;
+  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
+  step_performance_data.set_step_runtime(OperatorSteps::MaterializeSortColumns, timer.lap());
+
+  // Entries are compared by the normalized key of the first sort column. Only if the keys are equal, the values of the
+  // sort columns are compared.
+  const auto first_compared_column_idx = sort_columns.front()->key_is_exact() ? size_t{1} : size_t{0};
+  const auto sort_column_count = sort_columns.size();
+  const auto comparator = [&](const SortEntry& lhs, const SortEntry& rhs) {
+    // NULLs come before all values. The SQL standard allows for this to be implementation-defined. We used to have
+    // a NULLS LAST mode, but never used it over multiple years. Different databases have different behaviors, and
+    // storing NULLs first even for descending orders is somewhat uncommon:
+    //   https://docs.mendix.com/refguide/ordering-behavior#null-ordering-behavior
+    // For Hyrise, we found that storing NULLs first is the method that requires the least amount of code.
+    if (lhs.key_is_null != rhs.key_is_null) {
+      return lhs.key_is_null;
+    }
+    if (lhs.key != rhs.key) {
+      return lhs.key < rhs.key;
+    }
 
-      auto sort_impl = SortImpl<ColumnDataType>(input_table, sort_definition.column, sort_definition.sort_mode);
-      previously_sorted_pos_list = sort_impl.sort(previously_sorted_pos_list);
+    for (auto column_idx = first_compared_column_idx; column_idx < sort_column_count; ++column_idx) {
+      const auto result = sort_columns[column_idx]->compare(lhs.row_id, rhs.row_id);
+      if (result != 0) {
+        return result < 0;
+      }
+    }
 
-      total_materialization_time += sort_impl.materialization_time;
-      total_temporary_result_writing_time += sort_impl.temporary_result_writing_time;
-      total_sort_time += sort_impl.sort_time;
-    });
+    // Rows with equal values keep their order from the input table, which makes the sort stable
+    return lhs.row_id < rhs.row_id;
+  };
+  sample_sort(entries.begin(), entries.end(), comparator);
+  step_performance_data.set_step_runtime(OperatorSteps::Sort, timer.lap());
+
+  // The sorted RowIDs point into the input table, which might be a reference table. The output writers resolve this
+  // indirection.
+  auto sorted_pos_list = RowIDPosList(entry_count);
+  for (auto entry_idx = size_t{0}; entry_idx < entry_count; ++entry_idx) {
+    sorted_pos_list[entry_idx] = entries[entry_idx].row_id;
   }
-
-  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
-  step_performance_data.set_step_runtime(OperatorSteps::MaterializeSortColumns, total_materialization_time);
-  step_performance_data.set_step_runtime(OperatorSteps::TemporaryResultWriting, total_temporary_result_writing_time);
-  step_performance_data.set_step_runtime(OperatorSteps::Sort, total_sort_time);
+  entries = std::vector<SortEntry>{};
+  sort_columns.clear();
+  step_performance_data.set_step_runtime(OperatorSteps::TemporaryResultWriting, timer.lap());
 
   // We have to materialize the output (i.e., write ValueSegments) if
   //  (a) it is requested by the user,
   //  (b) a column in the table references multiple tables (see write_reference_output_table for details), or
   //  (c) a column in the table references multiple columns in the same table (which is an unlikely edge case).
   // Cases (b) and (c) can only occur if there is more than one ReferenceSegment in an input chunk.
-  Timer timer;
   auto must_materialize = _force_materialization == ForceMaterialization::Yes;
   const auto input_chunk_count = input_table->chunk_count();
   if (!must_materialize && input_table->type() == TableType::References && input_chunk_count > 1) {
@@ -337,16 +665,13 @@ std::shared_ptr<const Table> Sort::_on_execute() {
   }
 
   if (must_materialize) {
-    sorted_table =
-        write_materialized_output_table(input_table, std::move(*previously_sorted_pos_list), _output_chunk_size);
+    sorted_table = write_materialized_output_table(input_table, std::move(sorted_pos_list), _output_chunk_size);
   } else {
-    sorted_table =
-        write_reference_output_table(input_table, std::move(*previously_sorted_pos_list), _output_chunk_size);
+    sorted_table = write_reference_output_table(input_table, std::move(sorted_pos_list), _output_chunk_size);
   }
 
   const auto& final_sort_definition = _sort_definitions[0];
-  // Set the sorted_by attribute of the output's chunks according to the most significant sort operation, which is the
-  // column the table was sorted by last.
+  // Set the sorted_by attribute of the output's chunks according to the most significant sort column.
   const auto output_chunk_count = sorted_table->chunk_count();
   for (auto output_chunk_id = ChunkID{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
     const auto& output_chunk = sorted_table->get_chunk(output_chunk_id);
@@ -358,123 +683,4 @@ std::shared_ptr<const Table> Sort::_on_execute() {
   return sorted_table;
 }
 
-template <typename SortColumnType>
-class Sort::SortImpl {
- public:
-  using RowIDValuePair = std::pair<RowID, SortColumnType>;
-
-  std::chrono::nanoseconds materialization_time{};
-  std::chrono::nanoseconds temporary_result_writing_time{};
-  std::chrono::nanoseconds sort_time{};
-
-  SortImpl(const std::shared_ptr<const Table>& table_in, const ColumnID column_id,
-           const SortMode sort_mode = SortMode::Ascending)
-      : _table_in(table_in), _column_id(column_id), _sort_mode(sort_mode) {
-    const auto row_count = _table_in->row_count();
-    _row_id_value_vector.reserve(row_count);
-    _null_value_rows.reserve(row_count);
-  }
-
-  // Sorts table_in, potentially taking the pre-existing order of previously_sorted_pos_list into account.
-  // Returns a PosList, which can either be used as an input to the next call of sort or for materializing the
-  // output table.
-  RowIDPosList sort(const std::optional<RowIDPosList>& previously_sorted_pos_list) {
-    Timer timer;
-    // 1. Prepare Sort: Creating RowID-value-Structure
-    _materialize_sort_column(previously_sorted_pos_list);
-    materialization_time = timer.lap();
-
-    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    const auto sort_with_comparator = [&](auto comparator) {
-      std::stable_sort(_row_id_value_vector.begin(), _row_id_value_vector.end(),
-                       [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
-    };
-    if (_sort_mode == SortMode::Ascending) {
-      sort_with_comparator(std::less<>{});
-    } else {
-      sort_with_comparator(std::greater<>{});
-    }
-    sort_time = timer.lap();
-
-    // 2b. Insert null rows in front of all non-NULL rows
-    if (!_null_value_rows.empty()) {
-      // NULLs come before all values. The SQL standard allows for this to be implementation-defined. We used to have
-      // a NULLS LAST mode, but never used it over multiple years. Different databases have different behaviors, and
-      // storing NULLs first even for descending orders is somewhat uncommon:
-      //   https://docs.mendix.com/refguide/ordering-behavior#null-ordering-behavior
-      // For Hyrise, we found that storing NULLs first is the method that requires the least amount of code.
-      _row_id_value_vector.insert(_row_id_value_vector.begin(), _null_value_rows.begin(), _null_value_rows.end());
-    }
-
-    RowIDPosList pos_list{};
-    pos_list.reserve(_row_id_value_vector.size());
-    for (const auto& [row_id, _] : _row_id_value_vector) {
-      pos_list.emplace_back(row_id);
-    }
-    temporary_result_writing_time = timer.lap();
-    return pos_list;
-  }
-
- protected:
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column(const std::optional<RowIDPosList>& previously_sorted_pos_list) {
-    // If there was no PosList passed, this is the first sorting run and we simply fill our values and nulls data
-    // structures from our input table. Otherwise we will materialize according to the PosList which is the result of
-    // the last run.
-    if (previously_sorted_pos_list) {
-      _materialize_column_from_pos_list(*previously_sorted_pos_list);
-    } else {
-      const auto chunk_count = _table_in->chunk_count();
-      for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-        const auto chunk = _table_in->get_chunk(chunk_id);
-        Assert(chunk, "Did not expect deleted chunk here.");  // see https://github.com/hyrise/hyrise/issues/1686
-
-        auto abstract_segment = chunk->get_segment(_column_id);
-
-        segment_iterate<SortColumnType>(*abstract_segment, [&](const auto& position) {
-          if (position.is_null()) {
-            _null_value_rows.emplace_back(RowID{chunk_id, position.chunk_offset()}, SortColumnType{});
-          } else {
-            _row_id_value_vector.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
-          }
-        });
-      }
-    }
-  }
-
-  // When there was a preceding sorting run, we materialize by retaining the order of the values in the passed PosList.
-  void _materialize_column_from_pos_list(const RowIDPosList& pos_list) {
-    const auto input_chunk_count = _table_in->chunk_count();
-    auto accessor_by_chunk_id =
-        std::vector<std::unique_ptr<AbstractSegmentAccessor<SortColumnType>>>(input_chunk_count);
-    for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
-      const auto& abstract_segment = _table_in->get_chunk(input_chunk_id)->get_segment(_column_id);
-      accessor_by_chunk_id[input_chunk_id] = create_segment_accessor<SortColumnType>(abstract_segment);
-    }
-
-    for (auto row_id : pos_list) {
-      const auto [chunk_id, chunk_offset] = row_id;
-
-      auto& accessor = accessor_by_chunk_id[chunk_id];
-      const auto typed_value = accessor->access(chunk_offset);
-      if (!typed_value) {
-        _null_value_rows.emplace_back(row_id, SortColumnType{});
-      } else {
-        _row_id_value_vector.emplace_back(row_id, typed_value.value());
-      }
-    }
-  }
-
-  const std::shared_ptr<const Table> _table_in;
-
-  // column to sort by
-  const ColumnID _column_id;
-  const SortMode _sort_mode;
-
-  std::vector<RowIDValuePair> _row_id_value_vector;
-
-  // Stored as RowIDValuePair for better type compatibility even if value is unused
-  std::vector<RowIDValuePair> _null_value_rows;
-};
-
 }  // namespace opossum
@@ -18,6 +18,11 @@ namespace opossum {
  * Operator to sort a table by one or multiple columns. This implements a stable sort, i.e., rows that share the same
  * value will maintain their relative order.
  * By passing multiple sort column definitions it is possible to sort multiple columns with one operator run.
+ *
+ * All sort columns are sorted in a single pass. Each row is represented by a normalized key of the first sort column
+ * (an unsigned integer that compares like the value, or the first bytes of a string) and its RowID. Other sort columns
+ * are only compared if the keys are equal. The rows are sorted by a parallel sample sort: a sample of the rows
+ * determines the boundaries of buckets, which are sorted in parallel and written to the output one after another.
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
@@ -41,12 +46,6 @@ class Sort : public AbstractReadOnlyOperator {
       std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
-  template <typename SortColumnType>
-  class SortImpl;
-
-  template <typename SortColumnType>
-  class SortImplMaterializeOutput;
-
   const std::vector<SortColumnDefinition> _sort_definitions;
   const ChunkOffset _output_chunk_size;
   const ForceMaterialization _force_materialization;
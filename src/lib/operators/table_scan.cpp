@@ -22,11 +22,15 @@
 #include "hyrise.hpp"
 #include "lossless_cast.hpp"
 #include "operators/operator_scan_predicate.hpp"
+#include "operators/runtime_filter.hpp"
+#include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/chunk.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/reference_segment.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
 #include "table_scan/column_between_table_scan_impl.hpp"
 #include "table_scan/column_is_null_table_scan_impl.hpp"
@@ -38,6 +42,68 @@
 #include "utils/lossless_predicate_cast.hpp"
 #include "utils/performance_warning.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Removes the @param matches of @param chunk whose value in @param column_id is not contained in the @param
+// runtime_filter. @param matches must not be empty.
+std::shared_ptr<RowIDPosList> apply_runtime_filter(const RuntimeFilter& runtime_filter, const Chunk& chunk,
+                                                   const ColumnID column_id,
+                                                   const std::shared_ptr<RowIDPosList>& matches) {
+  auto filtered_matches = std::make_shared<RowIDPosList>();
+  filtered_matches->reserve(matches->size());
+
+  const auto& segment = *chunk.get_segment(column_id);
+  resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    // If the pruning statistics show that all values are between the minimum and maximum of the source, only the
+    // Bloom filter is probed. The chunk offset of a position is its index in the matches.
+    auto within_range = false;
+    const auto keep_match = [&](const auto& position) {
+      if (position.is_null()) {
+        return;
+      }
+      if (within_range ? runtime_filter.bloom_filter_may_contain<ColumnDataType>(position.value())
+                       : runtime_filter.may_contain<ColumnDataType>(position.value())) {
+        filtered_matches->emplace_back((*matches)[position.chunk_offset()]);
+      }
+    };
+
+    const auto* reference_segment = dynamic_cast<const ReferenceSegment*>(&segment);
+    if (!reference_segment) {
+      within_range = runtime_filter.chunk_within_range(chunk, column_id);
+      segment_iterate_filtered<ColumnDataType>(segment, matches, keep_match);
+      return;
+    }
+
+    // ReferenceSegments do not support filtered iterations. Iterate over a ReferenceSegment that references only the
+    // rows of the matches instead.
+    const auto& pos_list = *reference_segment->pos_list();
+    const auto matched_pos_list = std::make_shared<RowIDPosList>();
+    matched_pos_list->reserve(matches->size());
+    for (const auto& match : *matches) {
+      matched_pos_list->emplace_back(pos_list[match.chunk_offset]);
+    }
+
+    const auto& referenced_table = reference_segment->referenced_table();
+    const auto referenced_column_id = reference_segment->referenced_column_id();
+    if (pos_list.references_single_chunk()) {
+      matched_pos_list->guarantee_single_chunk();
+      const auto referenced_chunk = referenced_table->get_chunk(pos_list.common_chunk_id());
+      within_range = runtime_filter.chunk_within_range(*referenced_chunk, referenced_column_id);
+    }
+
+    const auto matched_segment = ReferenceSegment{referenced_table, referenced_column_id, matched_pos_list};
+    segment_iterate<ColumnDataType>(matched_segment, keep_match);
+  });
+
+  return filtered_matches;
+}
+
+}  // namespace
+
 namespace opossum {
 
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in,
@@ -85,6 +151,15 @@ std::string TableScan::description(DescriptionMode description_mode) const {
   return stream.str();
 }
 
+void TableScan::add_runtime_filter(const std::shared_ptr<RuntimeFilter>& runtime_filter, const ColumnID column_id) {
+  runtime_filter->add_consumer(shared_from_this(), column_id);
+  _runtime_filters.emplace_back(runtime_filter, column_id);
+}
+
+const std::vector<std::pair<std::shared_ptr<RuntimeFilter>, ColumnID>>& TableScan::runtime_filters() const {
+  return _runtime_filters;
+}
+
 void TableScan::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
   expressions_set_transaction_context({_predicate}, transaction_context);
 }
@@ -108,6 +183,16 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
 
   std::mutex output_mutex;
 
+  // Only use the runtime filters whose source has been executed and whose join is the only consumer of this scan's
+  // output (see RuntimeFilter::can_filter)
+  auto runtime_filters = std::vector<std::pair<std::shared_ptr<RuntimeFilter>, ColumnID>>{};
+  for (const auto& [runtime_filter, column_id] : _runtime_filters) {
+    if (runtime_filter->can_filter(*this) && runtime_filter->data_type() == in_table->column_data_type(column_id)) {
+      runtime_filters.emplace_back(runtime_filter, column_id);
+    }
+  }
+  auto num_rows_dropped_by_runtime_filters = std::atomic_size_t{0};
+
   const auto excluded_chunk_set = std::unordered_set<ChunkID>{excluded_chunk_ids.cbegin(), excluded_chunk_ids.cend()};
 
   auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
@@ -125,9 +210,20 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
     Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
     // chunk_in – Copy by value since copy by reference is not possible due to the limited scope of the for-iteration.
-    auto perform_table_scan = [this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks]() {
+    auto perform_table_scan = [this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks, &runtime_filters,
+                               &num_rows_dropped_by_runtime_filters]() {
       // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = _impl->scan_chunk(chunk_id);
+      auto matches_out = _impl->scan_chunk(chunk_id);
+
+      for (const auto& [runtime_filter, column_id] : runtime_filters) {
+        if (matches_out->empty()) {
+          break;
+        }
+        const auto match_count = matches_out->size();
+        matches_out = apply_runtime_filter(*runtime_filter, *chunk_in, column_id, matches_out);
+        num_rows_dropped_by_runtime_filters += match_count - matches_out->size();
+      }
+
       if (matches_out->empty()) {
         return;
       }
@@ -153,7 +249,8 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
             out_segments.emplace_back(segment_in);
           }
         } else {
-          auto filtered_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<RowIDPosList>>{};
+          auto filtered_pos_lists =
+              std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<const AbstractPosList>>{};
 
           for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
             const auto segment_in = chunk_in->get_segment(column_id);
@@ -169,9 +266,9 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
             auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
 
             if (!filtered_pos_list) {
-              filtered_pos_list = std::make_shared<RowIDPosList>(matches_out->size());
+              auto row_id_pos_list = RowIDPosList(matches_out->size());
               if (pos_list_in->references_single_chunk()) {
-                filtered_pos_list->guarantee_single_chunk();
+                row_id_pos_list.guarantee_single_chunk();
               } else {
                 // When segments reference multiple chunks, we do not keep the sort order of the input chunk. The main
                 // reason is that several table scan implementations split the pos lists by chunks (see
@@ -181,10 +278,37 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
               }
 
               size_t offset = 0;
-              for (const auto& match : *matches_out) {
-                const auto row_id = (*pos_list_in)[match.chunk_offset];
-                (*filtered_pos_list)[offset] = row_id;
-                ++offset;
+              if (const auto bitmap_pos_list_in = std::dynamic_pointer_cast<const BitmapPosList>(pos_list_in)) {
+                // Random accesses to a BitmapPosList need a select, so we walk it alongside the (usually ascending)
+                // matches instead. Small steps only clear bits of the current word.
+                auto pos_list_in_it = bitmap_pos_list_in->begin();
+                auto pos_list_in_offset = ChunkOffset{0};
+                for (const auto& match : *matches_out) {
+                  pos_list_in_it += static_cast<std::ptrdiff_t>(match.chunk_offset) -
+                                    static_cast<std::ptrdiff_t>(pos_list_in_offset);
+                  pos_list_in_offset = match.chunk_offset;
+                  row_id_pos_list[offset] = *pos_list_in_it;
+                  ++offset;
+                }
+              } else {
+                for (const auto& match : *matches_out) {
+                  const auto row_id = (*pos_list_in)[match.chunk_offset];
+                  row_id_pos_list[offset] = row_id;
+                  ++offset;
+                }
+              }
+
+              // Store the filtered positions of a single chunk as a bitmap if that is more compact.
+              auto bitmap_pos_list = std::shared_ptr<BitmapPosList>{};
+              if (pos_list_in->references_single_chunk()) {
+                const auto referenced_chunk = table_out->get_chunk(pos_list_in->common_chunk_id());
+                bitmap_pos_list = BitmapPosList::try_create(row_id_pos_list, referenced_chunk->size());
+              }
+
+              if (bitmap_pos_list) {
+                filtered_pos_list = bitmap_pos_list;
+              } else {
+                filtered_pos_list = std::make_shared<const RowIDPosList>(std::move(row_id_pos_list));
               }
             }
 
@@ -196,11 +320,16 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
       } else {
         matches_out->guarantee_single_chunk();
 
-        // If the entire chunk is matched, create an EntireChunkPosList instead
-        const auto output_pos_list = matches_out->size() == chunk_in->size()
-                                         ? static_cast<std::shared_ptr<AbstractPosList>>(
-                                               std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size()))
-                                         : static_cast<std::shared_ptr<AbstractPosList>>(matches_out);
+        // If the entire chunk is matched, create an EntireChunkPosList instead. If many rows are matched, a bitmap
+        // of the matches is smaller than the matches themselves.
+        auto output_pos_list = std::shared_ptr<AbstractPosList>{};
+        if (matches_out->size() == chunk_in->size()) {
+          output_pos_list = std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size());
+        } else if (auto bitmap_pos_list = BitmapPosList::try_create(*matches_out, chunk_in->size())) {
+          output_pos_list = std::move(bitmap_pos_list);
+        } else {
+          output_pos_list = matches_out;
+        }
 
         for (auto column_id = ColumnID{0u}; column_id < in_table->column_count(); ++column_id) {
           const auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, output_pos_list);
@@ -233,6 +362,7 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   scan_performance_data.num_chunks_with_early_out = _impl->num_chunks_with_early_out.load();
   scan_performance_data.num_chunks_with_all_rows_matching = _impl->num_chunks_with_all_rows_matching.load();
   scan_performance_data.num_chunks_with_binary_search = _impl->num_chunks_with_binary_search.load();
+  scan_performance_data.num_rows_dropped_by_runtime_filters = num_rows_dropped_by_runtime_filters.load();
 
   return std::make_shared<Table>(in_table->column_definitions(), TableType::References, std::move(output_chunks));
 }
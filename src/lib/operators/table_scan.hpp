@@ -3,6 +3,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
@@ -15,6 +16,7 @@
 namespace opossum {
 
 class PQPSubqueryExpression;
+class RuntimeFilter;
 class Table;
 
 class TableScan : public AbstractReadOnlyOperator {
@@ -51,10 +53,19 @@ class TableScan : public AbstractReadOnlyOperator {
    */
   std::vector<ChunkID> excluded_chunk_ids;
 
+  /**
+   * Adds a filter published by a JoinHash that consumes the output of this scan (see RuntimeFilter). If the filter can
+   * be used once the scan executes, matching rows whose value in @param column_id is not contained in the filter are
+   * dropped as well.
+   */
+  void add_runtime_filter(const std::shared_ptr<RuntimeFilter>& runtime_filter, const ColumnID column_id);
+  const std::vector<std::pair<std::shared_ptr<RuntimeFilter>, ColumnID>>& runtime_filters() const;
+
   struct PerformanceData : public OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps> {
     std::atomic_size_t num_chunks_with_early_out{0};
     std::atomic_size_t num_chunks_with_all_rows_matching{0};
     std::atomic_size_t num_chunks_with_binary_search{0};
+    std::atomic_size_t num_rows_dropped_by_runtime_filters{0};
 
     void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override {
       OperatorPerformanceData<AbstractOperatorPerformanceData::NoSteps>::output_to_stream(stream, description_mode);
@@ -63,6 +74,9 @@ class TableScan : public AbstractReadOnlyOperator {
       stream << separator << "Chunks: " << num_chunks_with_early_out.load() << " skipped with no results, ";
       stream << separator << num_chunks_with_all_rows_matching.load() << " skipped with all matching, ";
       stream << num_chunks_with_binary_search.load() << " scanned using binary search.";
+      if (num_rows_dropped_by_runtime_filters > 0) {
+        stream << separator << "Rows: " << num_rows_dropped_by_runtime_filters.load() << " dropped by runtime filters.";
+      }
     }
   };
 
@@ -90,6 +104,8 @@ class TableScan : public AbstractReadOnlyOperator {
 
   std::unique_ptr<AbstractTableScanImpl> _impl;
 
+  std::vector<std::pair<std::shared_ptr<RuntimeFilter>, ColumnID>> _runtime_filters;
+
   // The description of the impl, so that it still available after the _impl is resetted in _on_cleanup()
   std::string _impl_description{"Unset"};
 };
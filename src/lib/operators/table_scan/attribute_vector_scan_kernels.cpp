@@ -0,0 +1,329 @@
+#include "attribute_vector_scan_kernels.hpp"
+
+#if defined(__AVX2__) || defined(__AVX512BW__)
+#include <x86intrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <type_traits>
+
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto ROWS_PER_MASK = size_t{64};
+
+// Bit-packed value ids with more bits might not fit into a 32-bit lane after shifting them by up to seven bits
+constexpr auto MAX_BITS_FOR_SIMD_UNPACKING = 25u;
+
+// A value id v is within [lower, lower + range] iff the unsigned difference v - lower is at most range. This way, each
+// row needs a single comparison.
+template <typename UnsignedIntType>
+uint64_t scan_fixed_width_rows(const UnsignedIntType* value_ids, const size_t row_count,
+                               const UnsignedIntType lower_value_id, const UnsignedIntType range) {
+  auto mask = uint64_t{0};
+
+  // NOLINTNEXTLINE
+  {}  // clang-format off
+  #pragma omp simd reduction(|:mask)
+  // clang-format on
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    const auto difference = static_cast<UnsignedIntType>(value_ids[row] - lower_value_id);
+    mask |= static_cast<uint64_t>(difference <= range) << row;
+  }
+
+  return mask;
+}
+
+#if defined(__AVX512BW__)
+
+template <typename UnsignedIntType>
+uint64_t scan_fixed_width_block(const UnsignedIntType* value_ids, const UnsignedIntType lower_value_id,
+                                const UnsignedIntType range) {
+  if constexpr (std::is_same_v<UnsignedIntType, uint8_t>) {
+    const auto lower = _mm512_set1_epi8(static_cast<char>(lower_value_id));
+    const auto upper = _mm512_set1_epi8(static_cast<char>(range));
+    const auto values = _mm512_loadu_si512(value_ids);
+    return _mm512_cmple_epu8_mask(_mm512_sub_epi8(values, lower), upper);
+  } else if constexpr (std::is_same_v<UnsignedIntType, uint16_t>) {
+    const auto lower = _mm512_set1_epi16(static_cast<int16_t>(lower_value_id));
+    const auto upper = _mm512_set1_epi16(static_cast<int16_t>(range));
+    auto mask = uint64_t{0};
+    for (auto part = size_t{0}; part < 2; ++part) {
+      const auto values = _mm512_loadu_si512(value_ids + part * 32);
+      mask |= static_cast<uint64_t>(_mm512_cmple_epu16_mask(_mm512_sub_epi16(values, lower), upper)) << (part * 32);
+    }
+    return mask;
+  } else {
+    const auto lower = _mm512_set1_epi32(static_cast<int32_t>(lower_value_id));
+    const auto upper = _mm512_set1_epi32(static_cast<int32_t>(range));
+    auto mask = uint64_t{0};
+    for (auto part = size_t{0}; part < 4; ++part) {
+      const auto values = _mm512_loadu_si512(value_ids + part * 16);
+      mask |= static_cast<uint64_t>(_mm512_cmple_epu32_mask(_mm512_sub_epi32(values, lower), upper)) << (part * 16);
+    }
+    return mask;
+  }
+}
+
+#elif defined(__AVX2__)
+
+// AVX2 has no unsigned comparison. Instead, difference <= range iff min(difference, range) == difference.
+template <typename UnsignedIntType>
+uint64_t scan_fixed_width_block(const UnsignedIntType* value_ids, const UnsignedIntType lower_value_id,
+                                const UnsignedIntType range) {
+  const auto* vectors = reinterpret_cast<const __m256i*>(value_ids);
+  auto mask = uint64_t{0};
+
+  if constexpr (std::is_same_v<UnsignedIntType, uint8_t>) {
+    const auto lower = _mm256_set1_epi8(static_cast<char>(lower_value_id));
+    const auto upper = _mm256_set1_epi8(static_cast<char>(range));
+    for (auto part = size_t{0}; part < 2; ++part) {
+      const auto difference = _mm256_sub_epi8(_mm256_loadu_si256(vectors + part), lower);
+      const auto matches = _mm256_cmpeq_epi8(_mm256_min_epu8(difference, upper), difference);
+      mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(matches))) << (part * 32);
+    }
+  } else if constexpr (std::is_same_v<UnsignedIntType, uint16_t>) {
+    const auto lower = _mm256_set1_epi16(static_cast<int16_t>(lower_value_id));
+    const auto upper = _mm256_set1_epi16(static_cast<int16_t>(range));
+    const auto matches_of = [&](const size_t index) {
+      const auto difference = _mm256_sub_epi16(_mm256_loadu_si256(vectors + index), lower);
+      return _mm256_cmpeq_epi16(_mm256_min_epu16(difference, upper), difference);
+    };
+    for (auto part = size_t{0}; part < 2; ++part) {
+      // Narrow the 16-bit lanes of two vectors to bytes so that a single movemask covers 32 rows. packs works within
+      // 128-bit lanes, so the 64-bit quarters have to be put back into row order.
+      const auto packed = _mm256_packs_epi16(matches_of(part * 2), matches_of(part * 2 + 1));
+      const auto ordered = _mm256_permute4x64_epi64(packed, 0b11011000);
+      mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(ordered))) << (part * 32);
+    }
+  } else {
+    const auto lower = _mm256_set1_epi32(static_cast<int32_t>(lower_value_id));
+    const auto upper = _mm256_set1_epi32(static_cast<int32_t>(range));
+    for (auto part = size_t{0}; part < 8; ++part) {
+      const auto difference = _mm256_sub_epi32(_mm256_loadu_si256(vectors + part), lower);
+      const auto matches = _mm256_cmpeq_epi32(_mm256_min_epu32(difference, upper), difference);
+      mask |= static_cast<uint64_t>(_mm256_movemask_ps(_mm256_castsi256_ps(matches))) << (part * 8);
+    }
+  }
+
+  return mask;
+}
+
+#else
+
+template <typename UnsignedIntType>
+uint64_t scan_fixed_width_block(const UnsignedIntType* value_ids, const UnsignedIntType lower_value_id,
+                                const UnsignedIntType range) {
+  return scan_fixed_width_rows(value_ids, ROWS_PER_MASK, lower_value_id, range);
+}
+
+#endif
+
+template <typename UnsignedIntType>
+void scan_fixed_width_integer_vector(const FixedWidthIntegerVector<UnsignedIntType>& vector,
+                                     const ValueID lower_value_id, const ValueID upper_value_id,
+                                     ValueIDMatchMasks& match_masks) {
+  constexpr auto MAX_VALUE_ID = ValueID::base_type{std::numeric_limits<UnsignedIntType>::max()};
+  if (static_cast<ValueID::base_type>(lower_value_id) > MAX_VALUE_ID) {
+    // The vector cannot hold value ids from the range
+    return;
+  }
+
+  const auto typed_lower_value_id = static_cast<UnsignedIntType>(lower_value_id);
+  const auto typed_upper_value_id =
+      static_cast<UnsignedIntType>(std::min(static_cast<ValueID::base_type>(upper_value_id), MAX_VALUE_ID));
+  const auto range = static_cast<UnsignedIntType>(typed_upper_value_id - typed_lower_value_id);
+
+  const auto* value_ids = vector.data().data();
+  const auto row_count = vector.data().size();
+  const auto block_count = row_count / ROWS_PER_MASK;
+
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    match_masks[block_index] |=
+        scan_fixed_width_block(value_ids + block_index * ROWS_PER_MASK, typed_lower_value_id, range);
+  }
+
+  const auto remaining_row_count = row_count % ROWS_PER_MASK;
+  if (remaining_row_count > 0) {
+    match_masks[block_count] |= scan_fixed_width_rows(value_ids + block_count * ROWS_PER_MASK, remaining_row_count,
+                                                      typed_lower_value_id, range);
+  }
+}
+
+// Extracts the value ids of rows [first_row, first_row + row_count) from the bit-packed words one by one.
+uint64_t scan_bit_packed_rows(const uint64_t* words, const uint32_t bits, const size_t first_row,
+                              const size_t row_count, const uint32_t lower_value_id, const uint32_t range) {
+  const auto value_mask = (uint64_t{1} << bits) - 1;
+  auto mask = uint64_t{0};
+
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    const auto bit_offset = (first_row + row) * bits;
+    const auto word_index = bit_offset / 64;
+    const auto shift = bit_offset % 64;
+
+    auto value_id = words[word_index] >> shift;
+    if (shift + bits > 64) {
+      value_id |= words[word_index + 1] << (64 - shift);
+    }
+
+    const auto difference = static_cast<uint32_t>(value_id & value_mask) - lower_value_id;
+    mask |= static_cast<uint64_t>(difference <= range) << row;
+  }
+
+  return mask;
+}
+
+#if defined(__AVX2__)
+
+/**
+ * Unpacks and compares 64 bit-packed value ids at a time. With b bits per value id, a block of 64 rows starts at a
+ * multiple of b words, and each group of eight rows within it starts at a multiple of b bytes. For the j-th row of a
+ * group, the four bytes starting at byte (j * b) / 8 contain the entire value id, which starts at bit (j * b) % 8 of
+ * them. As the byte shuffle cannot cross 128-bit lanes, the lower lane is loaded from the start of the group and the
+ * upper lane from the byte of row four.
+ */
+class BitPackedBlockScanner {
+ public:
+  BitPackedBlockScanner(const uint32_t bits, const uint32_t lower_value_id, const uint32_t range)
+      : _bits(bits), _upper_lane_byte_offset((4 * bits) / 8) {
+    auto shuffle_control = std::array<uint8_t, 32>{};
+    auto shifts = std::array<uint32_t, 8>{};
+
+    for (auto row = uint32_t{0}; row < 8; ++row) {
+      const auto first_byte = (row * bits) / 8 - (row < 4 ? 0 : _upper_lane_byte_offset);
+      for (auto byte = uint32_t{0}; byte < 4; ++byte) {
+        shuffle_control[row * 4 + byte] = static_cast<uint8_t>(first_byte + byte);
+      }
+      shifts[row] = (row * bits) % 8;
+    }
+
+    _shuffle_control = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(shuffle_control.data()));
+    _shifts = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(shifts.data()));
+    _value_mask = _mm256_set1_epi32(static_cast<int32_t>((uint32_t{1} << bits) - 1));
+    _lower = _mm256_set1_epi32(static_cast<int32_t>(lower_value_id));
+    _upper = _mm256_set1_epi32(static_cast<int32_t>(range));
+  }
+
+  // Number of bytes after the start of a block that scan() may read
+  size_t bytes_read_per_block() const {
+    return 7 * _bits + _upper_lane_byte_offset + 16;
+  }
+
+  uint64_t scan(const uint64_t* block_words) const {
+    const auto* block_bytes = reinterpret_cast<const uint8_t*>(block_words);
+    auto mask = uint64_t{0};
+
+    for (auto group = uint32_t{0}; group < 8; ++group) {
+      const auto* group_bytes = block_bytes + group * _bits;
+      const auto lower_lane = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group_bytes));
+      const auto upper_lane = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group_bytes + _upper_lane_byte_offset));
+      const auto bytes = _mm256_inserti128_si256(_mm256_castsi128_si256(lower_lane), upper_lane, 1);
+
+      const auto shuffled = _mm256_shuffle_epi8(bytes, _shuffle_control);
+      const auto value_ids = _mm256_and_si256(_mm256_srlv_epi32(shuffled, _shifts), _value_mask);
+
+#if defined(__AVX512VL__)
+      const auto group_mask = _mm256_cmple_epu32_mask(_mm256_sub_epi32(value_ids, _lower), _upper);
+#else
+      const auto difference = _mm256_sub_epi32(value_ids, _lower);
+      const auto matches = _mm256_cmpeq_epi32(_mm256_min_epu32(difference, _upper), difference);
+      const auto group_mask = _mm256_movemask_ps(_mm256_castsi256_ps(matches));
+#endif
+      mask |= static_cast<uint64_t>(static_cast<uint8_t>(group_mask)) << (group * 8);
+    }
+
+    return mask;
+  }
+
+ private:
+  const uint32_t _bits;
+  const uint32_t _upper_lane_byte_offset;
+  __m256i _shuffle_control;
+  __m256i _shifts;
+  __m256i _value_mask;
+  __m256i _lower;
+  __m256i _upper;
+};
+
+#endif
+
+void scan_bit_packing_vector(const BitPackingVector& vector, const ValueID lower_value_id,
+                             const ValueID upper_value_id, ValueIDMatchMasks& match_masks) {
+  const auto& data = vector.data();
+  const auto row_count = data.size();
+  const auto bits = static_cast<uint32_t>(data.bits());
+  const auto lower = static_cast<uint32_t>(lower_value_id);
+  const auto range = static_cast<uint32_t>(upper_value_id) - lower;
+
+  const auto* words = data.get();
+  auto first_scalar_block = size_t{0};
+
+#if defined(__AVX2__)
+  if (bits <= MAX_BITS_FOR_SIMD_UNPACKING) {
+    const auto block_count = row_count / ROWS_PER_MASK;
+    const auto scanner = BitPackedBlockScanner{bits, lower, range};
+
+    // The loads of the last group reach a few bytes past its block. Blocks for which this would read past the end of
+    // the vector's memory are left to the scalar code.
+    const auto block_bytes = size_t{bits} * sizeof(uint64_t);
+    const auto readable_bytes = data.bytes();
+    while (first_scalar_block < block_count &&
+           first_scalar_block * block_bytes + scanner.bytes_read_per_block() <= readable_bytes) {
+      match_masks[first_scalar_block] |= scanner.scan(words + first_scalar_block * bits);
+      ++first_scalar_block;
+    }
+  }
+#endif
+
+  for (auto block_index = first_scalar_block; block_index < match_masks.size(); ++block_index) {
+    const auto first_row = block_index * ROWS_PER_MASK;
+    const auto block_row_count = std::min(ROWS_PER_MASK, row_count - first_row);
+    match_masks[block_index] |= scan_bit_packed_rows(words, bits, first_row, block_row_count, lower, range);
+  }
+}
+
+}  // namespace
+
+void scan_attribute_vector_for_value_id_range(const BaseCompressedVector& attribute_vector,
+                                              const ValueID lower_value_id, const ValueID upper_value_id,
+                                              ValueIDMatchMasks& match_masks) {
+  DebugAssert(lower_value_id <= upper_value_id, "Value id range must not be empty");
+  match_masks.resize((attribute_vector.size() + ROWS_PER_MASK - 1) / ROWS_PER_MASK);
+
+  resolve_compressed_vector_type(attribute_vector, [&](const auto& vector) {
+    using VectorType = std::decay_t<decltype(vector)>;
+
+    if constexpr (std::is_same_v<VectorType, BitPackingVector>) {
+      scan_bit_packing_vector(vector, lower_value_id, upper_value_id, match_masks);
+    } else {
+      scan_fixed_width_integer_vector(vector, lower_value_id, upper_value_id, match_masks);
+    }
+  });
+}
+
+void append_match_masks_to_matches(const ValueIDMatchMasks& match_masks, const ChunkID chunk_id,
+                                   RowIDPosList& matches) {
+  auto match_count = size_t{0};
+  for (const auto mask : match_masks) {
+    match_count += static_cast<size_t>(__builtin_popcountll(mask));
+  }
+
+  auto output_index = matches.size();
+  matches.resize(output_index + match_count);
+
+  for (auto block_index = size_t{0}; block_index < match_masks.size(); ++block_index) {
+    const auto first_offset = static_cast<ChunkOffset::base_type>(block_index * ROWS_PER_MASK);
+    for (auto mask = match_masks[block_index]; mask; mask &= mask - 1) {
+      const auto offset = first_offset + static_cast<ChunkOffset::base_type>(__builtin_ctzll(mask));
+      matches[output_index++] = RowID{chunk_id, ChunkOffset{offset}};
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+
+#include "storage/pos_lists/row_id_pos_list.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Kernels that evaluate a value id range on the compressed attribute vector of a dictionary segment in bulk. Instead of
+ * decompressing one value id after another to uint32_t through an iterator, they compare the packed value ids in SIMD
+ * registers and produce one match mask per 64 rows:
+ *
+ *  - FixedWidthIntegerVectors are compared in their 8, 16, or 32-bit lanes.
+ *  - For BitPackingVectors, 64 rows occupy exactly `bits` words. Eight value ids at a time are moved into 32-bit lanes
+ *    with a byte shuffle and a variable shift, so the vector is never written out as uint32_t. This requires value ids
+ *    of at most 25 bits, which is the case for dictionaries with fewer than 33 million values.
+ *
+ * Which code is used depends on the instruction sets the library is compiled for (release builds use -march=native):
+ * AVX-512BW, AVX2, or scalar code that the compiler may still auto-vectorize. Rows that do not fill an entire block
+ * are always handled by the scalar code.
+ */
+
+// One bit per row, bit i % 64 of word i / 64 representing row i. Same layout as BitmapPosList::Bitmap.
+using ValueIDMatchMasks = std::vector<uint64_t>;
+
+// Sets the bits of all rows whose value id lies within [lower_value_id, upper_value_id]. Bits that are already set are
+// kept so that multiple ranges can be combined. match_masks is resized to the size of the attribute vector.
+void scan_attribute_vector_for_value_id_range(const BaseCompressedVector& attribute_vector,
+                                              const ValueID lower_value_id, const ValueID upper_value_id,
+                                              ValueIDMatchMasks& match_masks);
+
+// Appends a RowID for each set bit of match_masks to matches.
+void append_match_masks_to_matches(const ValueIDMatchMasks& match_masks, const ChunkID chunk_id,
+                                   RowIDPosList& matches);
+
+}  // namespace opossum
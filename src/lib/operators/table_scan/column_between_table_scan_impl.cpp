@@ -4,6 +4,7 @@
 #include <string>
 #include <type_traits>
 
+#include "attribute_vector_scan_kernels.hpp"
 #include "expression/between_expression.hpp"
 #include "sorted_segment_search.hpp"
 #include "storage/chunk.hpp"
@@ -163,6 +164,16 @@ void ColumnBetweenTableScanImpl::_scan_dictionary_segment(
     upper_bound_value_id = segment.unique_values_count();
   }
 
+  if (!position_filter) {
+    // The entire attribute vector is scanned, so the packed value ids can be compared in bulk (see
+    // attribute_vector_scan_kernels.hpp)
+    auto match_masks = ValueIDMatchMasks{};
+    scan_attribute_vector_for_value_id_range(*segment.attribute_vector(), lower_bound_value_id,
+                                             ValueID{upper_bound_value_id - 1}, match_masks);
+    append_match_masks_to_matches(match_masks, chunk_id, matches);
+    return;
+  }
+
   const auto value_id_diff = upper_bound_value_id - lower_bound_value_id;
   const auto comparator = [lower_bound_value_id, value_id_diff](const auto& position) {
     // Using < here because the right value id is the upper_bound. Also, because the value ids are integers, we can do
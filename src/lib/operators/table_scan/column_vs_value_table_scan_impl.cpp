@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "attribute_vector_scan_kernels.hpp"
 #include "sorted_segment_search.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/create_iterable_from_segment.hpp"
@@ -151,6 +152,48 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(
     return;
   }
 
+  if (!position_filter) {
+    // The entire attribute vector is scanned, so the packed value ids can be compared in bulk (see
+    // attribute_vector_scan_kernels.hpp). None of the ranges includes the NULL value id, unique_values_count().
+    const auto& attribute_vector = *segment.attribute_vector();
+    const auto max_value_id = ValueID{static_cast<ValueID::base_type>(segment.unique_values_count() - 1)};
+    auto match_masks = ValueIDMatchMasks{};
+
+    switch (predicate_condition) {
+      case PredicateCondition::Equals:
+        scan_attribute_vector_for_value_id_range(attribute_vector, search_value_id, search_value_id, match_masks);
+        break;
+
+      case PredicateCondition::NotEquals:
+        if (search_value_id > ValueID{0}) {
+          scan_attribute_vector_for_value_id_range(attribute_vector, ValueID{0}, ValueID{search_value_id - 1},
+                                                   match_masks);
+        }
+        if (search_value_id < max_value_id) {
+          scan_attribute_vector_for_value_id_range(attribute_vector, ValueID{search_value_id + 1}, max_value_id,
+                                                   match_masks);
+        }
+        break;
+
+      case PredicateCondition::LessThan:
+      case PredicateCondition::LessThanEquals:
+        scan_attribute_vector_for_value_id_range(attribute_vector, ValueID{0}, ValueID{search_value_id - 1},
+                                                 match_masks);
+        break;
+
+      case PredicateCondition::GreaterThan:
+      case PredicateCondition::GreaterThanEquals:
+        scan_attribute_vector_for_value_id_range(attribute_vector, search_value_id, max_value_id, match_masks);
+        break;
+
+      default:
+        Fail("Unsupported comparison type encountered");
+    }
+
+    append_match_masks_to_matches(match_masks, chunk_id, matches);
+    return;
+  }
+
   _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
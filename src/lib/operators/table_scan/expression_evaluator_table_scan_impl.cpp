@@ -8,16 +8,19 @@ namespace opossum {
 ExpressionEvaluatorTableScanImpl::ExpressionEvaluatorTableScanImpl(
     const std::shared_ptr<const Table>& in_table, const std::shared_ptr<const AbstractExpression>& expression,
     const std::shared_ptr<const ExpressionEvaluator::UncorrelatedSubqueryResults>& uncorrelated_subquery_results)
-    : _in_table(in_table), _expression(expression), _uncorrelated_subquery_results(uncorrelated_subquery_results) {}
+    : _in_table(in_table),
+      _expression(expression),
+      _evaluator_pool(in_table, uncorrelated_subquery_results, ExpressionEvaluator::EvaluationMode::Vectorized) {}
 
 std::string ExpressionEvaluatorTableScanImpl::description() const {
   return "ExpressionEvaluator";
 }
 
 std::shared_ptr<RowIDPosList> ExpressionEvaluatorTableScanImpl::scan_chunk(ChunkID chunk_id) {
-  return std::make_shared<RowIDPosList>(
-      ExpressionEvaluator{_in_table, chunk_id, _uncorrelated_subquery_results}.evaluate_expression_to_pos_list(
-          *_expression));
+  auto evaluator = _evaluator_pool.acquire(chunk_id);
+  auto pos_list = std::make_shared<RowIDPosList>(evaluator->evaluate_expression_to_pos_list(*_expression));
+  _evaluator_pool.release(std::move(evaluator));
+  return pos_list;
 }
 
 }  // namespace opossum
@@ -26,7 +26,9 @@ class ExpressionEvaluatorTableScanImpl : public AbstractTableScanImpl {
  private:
   std::shared_ptr<const Table> _in_table;
   std::shared_ptr<const AbstractExpression> _expression;
-  const std::shared_ptr<const ExpressionEvaluator::UncorrelatedSubqueryResults> _uncorrelated_subquery_results;
+
+  // scan_chunk() is called concurrently for different chunks. The evaluators are reused for multiple chunks.
+  ExpressionEvaluatorPool _evaluator_pool;
 };
 
 }  // namespace opossum
@@ -0,0 +1,456 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/timer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// A sort column of the TopK. Each job materializes the chunk it currently scans into its own buffer. Rows that are
+// kept in a heap are copied into a slot, so that they can be compared after the job has moved on to the next chunk.
+// Each job owns a distinct range of k slots.
+class BaseTopKColumn {
+ public:
+  virtual ~BaseTopKColumn() = default;
+
+  // Materializes the first @param row_count values of @param chunk into the buffer of @param job_id
+  virtual void materialize_chunk(const size_t job_id, const Chunk& chunk, const ChunkOffset row_count) = 0;
+
+  // Copies the value at @param chunk_offset of the current chunk of @param job_id into @param slot
+  virtual void store(const size_t job_id, const ChunkOffset chunk_offset, const size_t slot) = 0;
+
+  // @return a negative number if the row at @param chunk_offset of the current chunk of @param job_id comes before the
+  // row in @param slot, a positive number if it comes after, and 0 if both rows have the same value
+  virtual int compare_to_slot(const size_t job_id, const ChunkOffset chunk_offset, const size_t slot) const = 0;
+
+  // Same as compare_to_slot, but for two rows in slots
+  virtual int compare_slots(const size_t lhs_slot, const size_t rhs_slot) const = 0;
+
+  // @return whether the pruning statistics of @param chunk show that none of its rows comes before the row in
+  // @param slot. Only called for the first sort column.
+  virtual bool chunk_comes_after_slot(const Table& table, const Chunk& chunk, const size_t slot) const = 0;
+};
+
+template <typename ColumnDataType>
+class TopKColumn : public BaseTopKColumn {
+ public:
+  TopKColumn(const SortColumnDefinition& sort_definition, const size_t job_count, const size_t k)
+      : _column_id(sort_definition.column),
+        _ascending(sort_definition.sort_mode == SortMode::Ascending),
+        _chunk_values(job_count),
+        _chunk_null_values(job_count),
+        _slot_values(job_count * k) {}
+
+  void materialize_chunk(const size_t job_id, const Chunk& chunk, const ChunkOffset row_count) override {
+    auto& values = _chunk_values[job_id];
+    auto& null_values = _chunk_null_values[job_id];
+    values.resize(row_count);
+    null_values.resize(row_count);
+
+    segment_iterate<ColumnDataType>(*chunk.get_segment(_column_id), [&](const auto& position) {
+      const auto chunk_offset = position.chunk_offset();
+      if (chunk_offset >= row_count) {
+        return;
+      }
+
+      null_values[chunk_offset] = position.is_null();
+      if (!position.is_null()) {
+        values[chunk_offset] = position.value();
+      }
+    });
+  }
+
+  void store(const size_t job_id, const ChunkOffset chunk_offset, const size_t slot) override {
+    if (_chunk_null_values[job_id][chunk_offset]) {
+      _slot_values[slot] = std::nullopt;
+    } else {
+      _slot_values[slot] = _chunk_values[job_id][chunk_offset];
+    }
+  }
+
+  int compare_to_slot(const size_t job_id, const ChunkOffset chunk_offset, const size_t slot) const override {
+    const auto& slot_value = _slot_values[slot];
+    if (_chunk_null_values[job_id][chunk_offset]) {
+      return slot_value ? -1 : 0;
+    }
+    return slot_value ? _compare(_chunk_values[job_id][chunk_offset], *slot_value) : 1;
+  }
+
+  int compare_slots(const size_t lhs_slot, const size_t rhs_slot) const override {
+    const auto& lhs_value = _slot_values[lhs_slot];
+    const auto& rhs_value = _slot_values[rhs_slot];
+    if (!lhs_value || !rhs_value) {
+      // NULLs come first, see Sort
+      return static_cast<int>(static_cast<bool>(lhs_value)) - static_cast<int>(static_cast<bool>(rhs_value));
+    }
+    return _compare(*lhs_value, *rhs_value);
+  }
+
+  bool chunk_comes_after_slot(const Table& table, const Chunk& chunk, const size_t slot) const override {
+    const auto& slot_value = _slot_values[slot];
+    if (!slot_value) {
+      return false;
+    }
+
+    // The pruning statistics are only maintained for stored chunks. If a reference segment points to a single chunk,
+    // the statistics of that chunk cover a superset of the referenced values.
+    const auto* statistics_chunk = &chunk;
+    auto statistics_column_id = _column_id;
+    auto column_is_nullable = table.column_is_nullable(_column_id);
+    const auto& segment = chunk.get_segment(_column_id);
+    if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+      const auto& pos_list = reference_segment->pos_list();
+      if (pos_list->empty() || !pos_list->references_single_chunk()) {
+        return false;
+      }
+
+      const auto& referenced_table = *reference_segment->referenced_table();
+      const auto referenced_chunk = referenced_table.get_chunk(pos_list->common_chunk_id());
+      if (!referenced_chunk) {
+        return false;
+      }
+      statistics_chunk = referenced_chunk.get();
+      statistics_column_id = reference_segment->referenced_column_id();
+      column_is_nullable = referenced_table.column_is_nullable(statistics_column_id);
+    }
+
+    const auto& pruning_statistics = statistics_chunk->pruning_statistics();
+    if (!pruning_statistics || !(*pruning_statistics)[statistics_column_id]) {
+      return false;
+    }
+    const auto& segment_statistics =
+        static_cast<const AttributeStatistics<ColumnDataType>&>(*(*pruning_statistics)[statistics_column_id]);
+
+    // NULLs come before all values. Dictionaries (and thus the pruning statistics) do not cover them.
+    if (column_is_nullable &&
+        !(segment_statistics.null_value_ratio && segment_statistics.null_value_ratio->ratio == 0.0f)) {
+      return false;
+    }
+
+    auto min = std::optional<ColumnDataType>{};
+    auto max = std::optional<ColumnDataType>{};
+    if (segment_statistics.min_max_filter) {
+      min = segment_statistics.min_max_filter->min;
+      max = segment_statistics.min_max_filter->max;
+    }
+    // Range filters are only available for arithmetic (non-string) types.
+    if constexpr (std::is_arithmetic_v<ColumnDataType>) {
+      if (!min && segment_statistics.range_filter && !segment_statistics.range_filter->ranges.empty()) {
+        min = segment_statistics.range_filter->ranges.front().first;
+        max = segment_statistics.range_filter->ranges.back().second;
+      }
+    }
+    if (!min) {
+      return false;
+    }
+
+    // Rows with the same value as the slot might still come first because of the other sort columns
+    return _ascending ? *slot_value < *min : *max < *slot_value;
+  }
+
+ private:
+  int _compare(const ColumnDataType& lhs, const ColumnDataType& rhs) const {
+    if (lhs < rhs) {
+      return _ascending ? -1 : 1;
+    }
+    if (rhs < lhs) {
+      return _ascending ? 1 : -1;
+    }
+    return 0;
+  }
+
+  const ColumnID _column_id;
+  const bool _ascending;
+
+  std::vector<std::vector<ColumnDataType>> _chunk_values;
+  std::vector<std::vector<bool>> _chunk_null_values;
+  std::vector<std::optional<ColumnDataType>> _slot_values;
+};
+
+// Writes the rows at @param row_ids of @param input_table into a new data table with chunks of at most
+// Chunk::DEFAULT_SIZE rows.
+std::shared_ptr<Table> write_materialized_output_table(const std::shared_ptr<const Table>& input_table,
+                                                       const std::vector<RowID>& row_ids) {
+  auto output_table = std::make_shared<Table>(input_table->column_definitions(), TableType::Data);
+  const auto column_count = input_table->column_count();
+  const auto row_count = row_ids.size();
+
+  const auto output_chunk_size = static_cast<size_t>(Chunk::DEFAULT_SIZE);
+  for (auto chunk_begin = size_t{0}; chunk_begin < row_count; chunk_begin += output_chunk_size) {
+    const auto chunk_end = std::min(chunk_begin + output_chunk_size, row_count);
+
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto column_is_nullable = input_table->column_is_nullable(column_id);
+
+      resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+
+        auto values = pmr_vector<ColumnDataType>{};
+        auto null_values = pmr_vector<bool>{};
+        values.reserve(chunk_end - chunk_begin);
+        if (column_is_nullable) {
+          null_values.reserve(chunk_end - chunk_begin);
+        }
+
+        // The rows are spread over few input chunks, so accessors are only created for the chunks that are accessed
+        auto accessor_by_chunk_id =
+            std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(input_table->chunk_count());
+        for (auto row_idx = chunk_begin; row_idx < chunk_end; ++row_idx) {
+          const auto [chunk_id, chunk_offset] = row_ids[row_idx];
+          auto& accessor = accessor_by_chunk_id[chunk_id];
+          if (!accessor) {
+            const auto& segment = input_table->get_chunk(chunk_id)->get_segment(column_id);
+            accessor = create_segment_accessor<ColumnDataType>(segment);
+          }
+
+          const auto typed_value = accessor->access(chunk_offset);
+          values.push_back(typed_value ? *typed_value : ColumnDataType{});
+          if (column_is_nullable) {
+            null_values.push_back(!typed_value);
+          }
+        }
+
+        if (column_is_nullable) {
+          segments.emplace_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+        } else {
+          segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+        }
+      });
+    }
+
+    output_table->append_chunk(segments);
+  }
+
+  return output_table;
+}
+
+}  // namespace
+
+namespace opossum {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t k)
+    : AbstractReadOnlyOperator(OperatorType::TopK, in, nullptr,
+                               std::make_unique<OperatorPerformanceData<OperatorSteps>>()),
+      _sort_definitions(sort_definitions),
+      _k(k) {
+  DebugAssert(!_sort_definitions.empty(), "Expected at least one sort criterion");
+}
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const {
+  return _sort_definitions;
+}
+
+size_t TopK::k() const {
+  return _k;
+}
+
+const std::string& TopK::name() const {
+  static const auto name = std::string{"TopK"};
+  return name;
+}
+
+std::string TopK::description(DescriptionMode description_mode) const {
+  const auto separator = (description_mode == DescriptionMode::SingleLine ? ' ' : '\n');
+
+  std::stringstream stream;
+  stream << AbstractOperator::description(description_mode) << separator << "k: " << _k << separator << "{";
+  for (auto sort_definition_idx = size_t{0}; sort_definition_idx < _sort_definitions.size(); ++sort_definition_idx) {
+    const auto& sort_definition = _sort_definitions[sort_definition_idx];
+    stream << (sort_definition_idx > 0 ? ", " : "") << "Column #" << sort_definition.column << " "
+           << sort_definition.sort_mode;
+  }
+  stream << "}";
+  return stream.str();
+}
+
+std::shared_ptr<AbstractOperator> TopK::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_left_input,
+    const std::shared_ptr<AbstractOperator>& copied_right_input,
+    std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const {
+  return std::make_shared<TopK>(copied_left_input, _sort_definitions, _k);
+}
+
+void TopK::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto& input_table = left_input_table();
+
+  for (const auto& sort_definition : _sort_definitions) {
+    Assert(sort_definition.column != INVALID_COLUMN_ID, "TopK: Invalid column in sort definition");
+    Assert(sort_definition.column < input_table->column_count(),
+           "TopK: Column ID is greater than table's column count");
+  }
+
+  const auto chunk_count = input_table->chunk_count();
+  if (_k == 0 || input_table->row_count() == 0) {
+    return Table::create_dummy_table(input_table->column_definitions());
+  }
+
+  Timer timer;
+
+  // Each job scans a consecutive range of chunks, so that rows within a job are visited in RowID order
+  const auto job_count =
+      Hyrise::get().is_multi_threaded() ? std::min(size_t{chunk_count}, size_t{Hyrise::get().topology.num_cpus()}) : 1;
+
+  auto columns = std::vector<std::unique_ptr<BaseTopKColumn>>{};
+  for (const auto& sort_definition : _sort_definitions) {
+    resolve_data_type(input_table->column_data_type(sort_definition.column), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      columns.emplace_back(std::make_unique<TopKColumn<ColumnDataType>>(sort_definition, job_count, _k));
+    });
+  }
+  const auto& first_column = *columns.front();
+  const auto& first_sort_definition = _sort_definitions.front();
+
+  auto slot_row_ids = std::vector<RowID>(job_count * _k);
+
+  // A slot comes before another slot if it has better values or, for equal values, a lower RowID. This keeps the
+  // order of Sort, which is stable.
+  const auto slot_comes_first = [&](const size_t lhs_slot, const size_t rhs_slot) {
+    for (const auto& column : columns) {
+      const auto result = column->compare_slots(lhs_slot, rhs_slot);
+      if (result != 0) {
+        return result < 0;
+      }
+    }
+    return slot_row_ids[lhs_slot] < slot_row_ids[rhs_slot];
+  };
+
+  // The heap of each job holds the slots of the best rows seen so far. With slot_comes_first as the comparator, the
+  // worst of these rows is at the front.
+  auto heaps = std::vector<std::vector<size_t>>(job_count);
+
+  const auto collect_candidates = [&](const size_t job_id) {
+    auto& heap = heaps[job_id];
+    heap.reserve(_k);
+    const auto heap_is_full = [&] { return heap.size() == _k; };
+
+    const auto first_chunk_id = static_cast<ChunkID::base_type>(chunk_count * job_id / job_count);
+    const auto last_chunk_id = static_cast<ChunkID::base_type>(chunk_count * (job_id + 1) / job_count);
+    for (auto chunk_id = ChunkID{first_chunk_id}; chunk_id < last_chunk_id; ++chunk_id) {
+      const auto chunk = input_table->get_chunk(chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+      if (heap_is_full() && first_column.chunk_comes_after_slot(*input_table, *chunk, heap.front())) {
+        continue;
+      }
+
+      const auto& sorted_by = chunk->individually_sorted_by();
+      const auto chunk_is_sorted =
+          std::find(sorted_by.cbegin(), sorted_by.cend(), first_sort_definition) != sorted_by.cend();
+
+      // Rows that are concurrently appended to the chunk are ignored
+      const auto row_count = chunk->size();
+      for (const auto& column : columns) {
+        column->materialize_chunk(job_id, *chunk, row_count);
+      }
+
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+        const auto row_id = RowID{chunk_id, chunk_offset};
+        if (!heap_is_full()) {
+          const auto slot = job_id * _k + heap.size();
+          for (const auto& column : columns) {
+            column->store(job_id, chunk_offset, slot);
+          }
+          slot_row_ids[slot] = row_id;
+          heap.emplace_back(slot);
+          std::push_heap(heap.begin(), heap.end(), slot_comes_first);
+          continue;
+        }
+
+        // Compare the row to the worst row in the heap. As rows are visited in RowID order, a row with the same values
+        // comes after the rows in the heap.
+        const auto worst_slot = heap.front();
+        auto comparison = 0;
+        for (const auto& column : columns) {
+          comparison = column->compare_to_slot(job_id, chunk_offset, worst_slot);
+          if (comparison != 0) {
+            break;
+          }
+        }
+
+        if (comparison < 0) {
+          std::pop_heap(heap.begin(), heap.end(), slot_comes_first);
+          for (const auto& column : columns) {
+            column->store(job_id, chunk_offset, worst_slot);
+          }
+          slot_row_ids[worst_slot] = row_id;
+          std::push_heap(heap.begin(), heap.end(), slot_comes_first);
+        } else if (chunk_is_sorted && first_column.compare_to_slot(job_id, chunk_offset, worst_slot) > 0) {
+          // All remaining rows of the sorted chunk are at least as bad in the first sort column
+          break;
+        }
+      }
+    }
+  };
+
+  if (job_count == 1) {
+    collect_candidates(0);
+  } else {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(job_count);
+    for (auto job_id = size_t{0}; job_id < job_count; ++job_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, job_id]() { collect_candidates(job_id); }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  }
+
+  auto& step_performance_data = dynamic_cast<OperatorPerformanceData<OperatorSteps>&>(*performance_data);
+  step_performance_data.set_step_runtime(OperatorSteps::CollectCandidates, timer.lap());
+
+  // Merge the heaps of all jobs. At most job_count * k candidates are left, so that sorting them is cheap.
+  auto candidate_slots = std::vector<size_t>{};
+  for (const auto& heap : heaps) {
+    candidate_slots.insert(candidate_slots.end(), heap.cbegin(), heap.cend());
+  }
+  const auto output_row_count = std::min(_k, candidate_slots.size());
+  std::partial_sort(candidate_slots.begin(), candidate_slots.begin() + output_row_count, candidate_slots.end(),
+                    slot_comes_first);
+
+  auto output_row_ids = std::vector<RowID>(output_row_count);
+  for (auto row_idx = size_t{0}; row_idx < output_row_count; ++row_idx) {
+    output_row_ids[row_idx] = slot_row_ids[candidate_slots[row_idx]];
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::MergeCandidates, timer.lap());
+
+  const auto output_table = write_materialized_output_table(input_table, output_row_ids);
+
+  // As for Sort, only the most significant sort column is recorded
+  const auto output_chunk_count = output_table->chunk_count();
+  for (auto output_chunk_id = ChunkID{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
+    const auto& output_chunk = output_table->get_chunk(output_chunk_id);
+    output_chunk->finalize();
+    output_chunk->set_individually_sorted_by(first_sort_definition);
+  }
+  step_performance_data.set_step_runtime(OperatorSteps::WriteOutput, timer.lap());
+
+  return output_table;
+}
+
+}  // namespace opossum
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that returns the first k rows of a table when ordered by one or multiple columns, i.e., it is equivalent to
+ * a Sort followed by a Limit of k rows (ORDER BY ... LIMIT k). Like Sort, NULLs come first and rows that share the
+ * same values keep their relative order.
+ *
+ * Instead of sorting the entire input, each job scans a range of input chunks and keeps the best k rows it has seen in
+ * a bounded max-heap, whose top is the worst of these rows. Rows that are not better than the top are dropped without
+ * being stored. Once all jobs are done, their heaps are merged. Chunks are skipped if their pruning statistics show
+ * that no value of the first sort column beats the current top. If a chunk is sorted by the first sort column, it is
+ * only scanned until its values become worse than the top.
+ *
+ * As k is expected to be small, the output is always materialized. TopKs are created by the LQPTranslator for a
+ * LimitNode with a constant row count of at most MAX_K above a SortNode.
+ */
+class TopK : public AbstractReadOnlyOperator {
+ public:
+  static constexpr auto MAX_K = size_t{100'000};
+
+  enum class OperatorSteps : uint8_t { CollectCandidates, MergeCandidates, WriteOutput };
+
+  TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t k);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  size_t k() const;
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_left_input,
+      const std::shared_ptr<AbstractOperator>& copied_right_input,
+      std::unordered_map<const AbstractOperator*, std::shared_ptr<AbstractOperator>>& copied_ops) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  const size_t _k;
+};
+
+}  // namespace opossum
@@ -10,7 +10,9 @@
 
 #include <boost/sort/sort.hpp>
 
+#include "resolve_type.hpp"
 #include "storage/chunk.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -49,6 +51,13 @@
  *      _column_cluster_offsets = {0, 2, 3}
  *
  *
+ * ### Bitmap union
+ * If there is only a single ColumnCluster and each chunk of the inputs references a single chunk, the rows do not
+ * need to be sorted. Instead, the positions of each referenced chunk are ORed into a bitmap with one bit per row of
+ * that chunk. BitmapPosLists, which the TableScan and the Validate operator create for many matches, are ORed word by
+ * word. The result contains one chunk per referenced chunk, whose positions are ordered just as in the merged output.
+ *
+ *
  * ### TODO(anybody) for potential performance improvements
  * Instead of using a ReferenceMatrix, consider using a linked list of RowIDs for each row. Since most of the sorting
  *      will depend on the leftmost column, this way most of the time no remote memory would need to be accessed
@@ -85,6 +94,10 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
     return early_result;
   }
 
+  if (const auto bitmap_union_result = _try_bitmap_union()) {
+    return bitmap_union_result;
+  }
+
   const auto& left_in_table = *left_input_table();
 
   /**
@@ -326,6 +339,100 @@ std::shared_ptr<const Table> UnionPositions::_prepare_operator() {
   return nullptr;
 }
 
+std::shared_ptr<const Table> UnionPositions::_try_bitmap_union() const {
+  if (_column_cluster_offsets.size() != 1) {
+    return nullptr;
+  }
+
+  const auto references_single_chunks = [](const Table& table) {
+    const auto chunk_count = table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto segment = table.get_chunk(chunk_id)->get_segment(ColumnID{0});
+      if (!std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list()->references_single_chunk()) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  const auto& left_in_table = *left_input_table();
+  const auto& right_in_table = *right_input_table();
+  if (!references_single_chunks(left_in_table) || !references_single_chunks(right_in_table)) {
+    return nullptr;
+  }
+
+  const auto& referenced_table = _referenced_tables.front();
+  auto bitmaps = std::vector<BitmapPosList::Bitmap>(referenced_table->chunk_count());
+
+  const auto add_positions = [&](const Table& table) {
+    const auto chunk_count = table.chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto segment = table.get_chunk(chunk_id)->get_segment(ColumnID{0});
+      const auto pos_list = std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+      if (pos_list->empty()) {
+        continue;
+      }
+
+      const auto referenced_chunk_id = pos_list->common_chunk_id();
+      const auto referenced_chunk_size = referenced_table->get_chunk(referenced_chunk_id)->size();
+      auto& bitmap = bitmaps[referenced_chunk_id];
+      bitmap.resize(BitmapPosList::word_count(referenced_chunk_size));
+
+      if (const auto bitmap_pos_list = std::dynamic_pointer_cast<const BitmapPosList>(pos_list)) {
+        const auto& words = bitmap_pos_list->bitmap();
+        DebugAssert(words.size() <= bitmap.size(), "BitmapPosList exceeds the referenced chunk");
+        for (auto word_index = size_t{0}; word_index < words.size(); ++word_index) {
+          bitmap[word_index] |= words[word_index];
+        }
+        continue;
+      }
+
+      resolve_pos_list_type(pos_list, [&](const auto& resolved_pos_list) {
+        for (const auto row_id : *resolved_pos_list) {
+          DebugAssert(row_id.chunk_offset < referenced_chunk_size, "RowID exceeds the referenced chunk");
+          const auto offset = static_cast<size_t>(row_id.chunk_offset);
+          bitmap[offset / BitmapPosList::BITS_PER_WORD] |= uint64_t{1} << (offset % BitmapPosList::BITS_PER_WORD);
+        }
+      });
+    }
+  };
+  add_positions(left_in_table);
+  add_positions(right_in_table);
+
+  auto out_table = std::make_shared<Table>(left_in_table.column_definitions(), TableType::References);
+  const auto column_count = left_in_table.column_count();
+
+  for (auto referenced_chunk_id = ChunkID{0}; referenced_chunk_id < bitmaps.size(); ++referenced_chunk_id) {
+    auto& bitmap = bitmaps[referenced_chunk_id];
+    if (bitmap.empty()) {
+      continue;
+    }
+
+    const auto referenced_chunk_size = referenced_table->get_chunk(referenced_chunk_id)->size();
+    auto pos_list = std::make_shared<const BitmapPosList>(referenced_chunk_id, std::move(bitmap));
+    if (pos_list->empty()) {
+      continue;
+    }
+
+    auto output_pos_list = std::shared_ptr<const AbstractPosList>{pos_list};
+    if (!BitmapPosList::is_more_compact(pos_list->size(), referenced_chunk_size)) {
+      auto row_id_pos_list = std::make_shared<RowIDPosList>(pos_list->begin(), pos_list->end());
+      row_id_pos_list->guarantee_single_chunk();
+      output_pos_list = row_id_pos_list;
+    }
+
+    auto output_segments = Segments{};
+    output_segments.reserve(column_count);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_segments.emplace_back(
+          std::make_shared<ReferenceSegment>(referenced_table, _referenced_column_ids[column_id], output_pos_list));
+    }
+    out_table->append_chunk(output_segments);
+  }
+
+  return out_table;
+}
+
 UnionPositions::ReferenceMatrix UnionPositions::_build_reference_matrix(
     const std::shared_ptr<const Table>& input_table) const {
   ReferenceMatrix reference_matrix;
@@ -110,6 +110,15 @@ class UnionPositions : public AbstractReadOnlyOperator {
    */
   std::shared_ptr<const Table> _prepare_operator();
 
+  /**
+   * If both inputs consist of a single ColumnCluster and all their PosLists reference a single chunk (as, e.g., the
+   * outputs of TableScans and Validates on stored tables do), the positions of each referenced chunk are combined as
+   * bitmaps (see the "Bitmap union" doc in the cpp).
+   *
+   * @returns the result table or nullptr if the inputs do not qualify for this
+   */
+  std::shared_ptr<const Table> _try_bitmap_union() const;
+
   UnionPositions::ReferenceMatrix _build_reference_matrix(const std::shared_ptr<const Table>& input_table) const;
   static bool _compare_reference_matrix_rows(const ReferenceMatrix& left_matrix, size_t left_row_idx,
                                              const ReferenceMatrix& right_matrix, size_t right_row_idx);
@@ -38,7 +38,7 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
   // 1. Delete obsolete data with the Delete operator.
   //    Delete doesn't accept empty input data
   if (left_input_table()->row_count() > 0) {
-    _delete = std::make_shared<Delete>(_left_input);
+    _delete = std::make_shared<Delete>(_table_to_update_name, _left_input);
     _delete->set_transaction_context(context);
     _delete->execute();
 
@@ -52,7 +52,11 @@ std::shared_ptr<const Table> Update::_on_execute(std::shared_ptr<TransactionCont
   _insert = std::make_shared<Insert>(_table_to_update_name, _right_input);
   _insert->set_transaction_context(context);
   _insert->execute();
-  // Insert cannot fail in the MVCC sense, no check necessary
+
+  // Insert fails if the new values violate a key of the table
+  if (_insert->execute_failed()) {
+    _mark_as_failed();
+  }
 
   return nullptr;
 }
@@ -1,6 +1,8 @@
 #include "validate.hpp"
 
+#include <algorithm>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
@@ -9,6 +11,8 @@
 #include "hyrise.hpp"
 #include "operators/delete.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
@@ -25,8 +29,102 @@ bool is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, ChunkOff
   return Validate::is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid);
 }
 
+// Visibility of a chunk's rows as determined by Validate::_determine_visible_rows. It uses the layout of
+// BitmapPosList's bitmap so that it can become the output PosList directly.
+using VisibleRows = BitmapPosList::Bitmap;
+constexpr auto VISIBLE_ROWS_BLOCK_SIZE = BitmapPosList::BITS_PER_WORD;
+
+// If at least every n-th row of a chunk is referenced, determining the visibility of all rows in blocks is faster than
+// checking the referenced rows one by one, which requires random accesses to three vectors per row.
+constexpr auto REFERENCED_ROWS_FOR_BLOCKWISE_VALIDATION = size_t{8};
+
+bool is_visible(const VisibleRows& visible_rows, const ChunkOffset chunk_offset) {
+  const auto offset = static_cast<size_t>(chunk_offset);
+  return (visible_rows[offset / VISIBLE_ROWS_BLOCK_SIZE] >> (offset % VISIBLE_ROWS_BLOCK_SIZE)) & 1u;
+}
+
+size_t count_visible_rows(const VisibleRows& visible_rows) {
+  return std::accumulate(visible_rows.begin(), visible_rows.end(), size_t{0}, [](const auto sum, const auto block) {
+    return sum + static_cast<size_t>(__builtin_popcountll(block));
+  });
+}
+
+// Converts the visible rows to positions. The positions are written in one pass into a list of the final size.
+void visible_rows_to_pos_list(const VisibleRows& visible_rows, const size_t visible_row_count, const ChunkID chunk_id,
+                              RowIDPosList& pos_list) {
+  pos_list.resize(visible_row_count);
+
+  auto pos_list_index = size_t{0};
+  const auto block_count = visible_rows.size();
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    auto block = visible_rows[block_index];
+    const auto block_begin = static_cast<ChunkOffset::base_type>(block_index * VISIBLE_ROWS_BLOCK_SIZE);
+    while (block) {
+      const auto offset_in_block = static_cast<ChunkOffset::base_type>(__builtin_ctzll(block));
+      pos_list[pos_list_index++] = RowID{chunk_id, ChunkOffset{block_begin + offset_in_block}};
+      block &= block - 1;
+    }
+  }
+}
+
+// Creates the output PosList for the visible rows of a chunk with chunk_size rows. If many rows are visible, the
+// visible rows are moved into a BitmapPosList.
+std::shared_ptr<const AbstractPosList> create_pos_list_for_visible_rows(VisibleRows& visible_rows,
+                                                                       const ChunkID chunk_id,
+                                                                       const ChunkOffset chunk_size) {
+  const auto visible_row_count = count_visible_rows(visible_rows);
+  if (BitmapPosList::is_more_compact(visible_row_count, chunk_size)) {
+    auto pos_list = std::make_shared<const BitmapPosList>(chunk_id, std::move(visible_rows));
+    visible_rows = VisibleRows{};
+    return pos_list;
+  }
+
+  auto pos_list = std::make_shared<RowIDPosList>();
+  pos_list->guarantee_single_chunk();
+  visible_rows_to_pos_list(visible_rows, visible_row_count, chunk_id, *pos_list);
+  return pos_list;
+}
+
 }  // namespace
 
+void Validate::_determine_visible_rows(const MvccData& mvcc_data, const ChunkOffset row_count,
+                                       const TransactionID our_tid, const CommitID snapshot_commit_id,
+                                       std::vector<uint64_t>& visible_rows) {
+  DebugAssert(row_count <= mvcc_data._begin_cids.size(), "Rows are out of bounds of the MVCC data");
+
+  // The vectors are read as arrays of their base types so that the compiler can vectorize the comparisons. Reading the
+  // transaction ids without atomic loads is fine for the same reason that MvccData's getters are (see mvcc_data.hpp).
+  static_assert(sizeof(copyable_atomic<TransactionID>) == sizeof(TransactionID::base_type));
+  const auto* const begin_cids = reinterpret_cast<const CommitID::base_type*>(mvcc_data._begin_cids.data());
+  const auto* const end_cids = reinterpret_cast<const CommitID::base_type*>(mvcc_data._end_cids.data());
+  const auto* const tids = reinterpret_cast<const TransactionID::base_type*>(mvcc_data._tids.data());
+  const auto our_tid_value = static_cast<TransactionID::base_type>(our_tid);
+  const auto snapshot_commit_id_value = static_cast<CommitID::base_type>(snapshot_commit_id);
+
+  const auto block_count = (row_count + VISIBLE_ROWS_BLOCK_SIZE - 1) / VISIBLE_ROWS_BLOCK_SIZE;
+  visible_rows.resize(block_count);
+
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto block_begin = block_index * VISIBLE_ROWS_BLOCK_SIZE;
+    const auto block_size = std::min(VISIBLE_ROWS_BLOCK_SIZE, row_count - block_begin);
+    auto block = uint64_t{0};
+
+    // Same as is_row_visible. See AbstractTableScanImpl::_scan_with_iterators for the pragma.
+    // NOLINTNEXTLINE
+    {}  // clang-format off
+    #pragma omp simd reduction(|:block) safelen(VISIBLE_ROWS_BLOCK_SIZE)
+    // clang-format on
+    for (auto offset_in_block = size_t{0}; offset_in_block < block_size; ++offset_in_block) {
+      const auto row = block_begin + offset_in_block;
+      const auto visible = snapshot_commit_id_value < end_cids[row] &&
+                           ((snapshot_commit_id_value >= begin_cids[row]) != (tids[row] == our_tid_value));
+      block |= static_cast<uint64_t>(visible) << offset_in_block;
+    }
+
+    visible_rows[block_index] = block;
+  }
+}
+
 bool Validate::is_row_visible(TransactionID our_tid, CommitID snapshot_commit_id, const TransactionID row_tid,
                               const CommitID begin_cid, const CommitID end_cid) {
   // Taken from: https://github.com/hyrise/hyrise-v1/blob/master/docs/documentation/queryexecution/tx.rst
@@ -154,6 +252,9 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
   auto entirely_visible_chunks = std::vector<bool>{};
   auto entirely_visible_chunks_table = std::shared_ptr<const Table>{};  // used only for sanity check
 
+  // Reused for all chunks to avoid reallocations
+  auto visible_rows = VisibleRows{};
+
   for (auto chunk_id = chunk_id_start; chunk_id <= chunk_id_end; ++chunk_id) {
     const auto chunk_in = in_table->get_chunk(chunk_id);
     Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
@@ -194,12 +295,34 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
           // We can reuse the old PosList since it is entirely visible. Not using the entirely_visible_chunks cache for
           // this shortcut to keep the code short.
           pos_list_out = pos_list_in;
+        } else if (const auto bitmap_pos_list_in = std::dynamic_pointer_cast<const BitmapPosList>(pos_list_in)) {
+          // The referenced rows are a bitmap as well, so the visible ones are determined by a bitwise AND.
+          _determine_visible_rows(*mvcc_data, referenced_chunk->size(), our_tid, snapshot_commit_id, visible_rows);
+          const auto& bitmap_in = bitmap_pos_list_in->bitmap();
+          visible_rows.resize(bitmap_in.size());
+          for (auto word_index = size_t{0}; word_index < bitmap_in.size(); ++word_index) {
+            visible_rows[word_index] &= bitmap_in[word_index];
+          }
+          pos_list_out = create_pos_list_for_visible_rows(visible_rows, pos_list_in->common_chunk_id(),
+                                                          referenced_chunk->size());
         } else {
           RowIDPosList temp_pos_list;
           temp_pos_list.guarantee_single_chunk();
-          for (auto row_id : *pos_list_in) {
-            if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
-              temp_pos_list.emplace_back(row_id);
+          if (pos_list_in->size() * REFERENCED_ROWS_FOR_BLOCKWISE_VALIDATION >= referenced_chunk->size()) {
+            // Many rows of the referenced chunk are referenced, so checking all rows of the chunk in blocks and looking
+            // up the referenced ones is cheaper than checking the referenced rows one by one.
+            _determine_visible_rows(*mvcc_data, referenced_chunk->size(), our_tid, snapshot_commit_id, visible_rows);
+            temp_pos_list.reserve(pos_list_in->size());
+            for (auto row_id : *pos_list_in) {
+              if (is_visible(visible_rows, row_id.chunk_offset)) {
+                temp_pos_list.emplace_back(row_id);
+              }
+            }
+          } else {
+            for (auto row_id : *pos_list_in) {
+              if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
+                temp_pos_list.emplace_back(row_id);
+              }
             }
           }
           pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
@@ -225,15 +348,21 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
           }
         }
 
+        // Positions referencing the same chunk are usually adjacent, so the MVCC data is only fetched if the chunk
+        // changes
+        auto mvcc_data_chunk_id = INVALID_CHUNK_ID;
+        auto mvcc_data = std::shared_ptr<const MvccData>{};
         for (auto row_id : *pos_list_in) {
           if (entirely_visible_chunks[row_id.chunk_id]) {
             temp_pos_list.emplace_back(row_id);
             continue;
           }
 
-          const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+          if (row_id.chunk_id != mvcc_data_chunk_id) {
+            mvcc_data = referenced_table->get_chunk(row_id.chunk_id)->mvcc_data();
+            mvcc_data_chunk_id = row_id.chunk_id;
+          }
 
-          auto mvcc_data = referenced_chunk->mvcc_data();
           if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
             temp_pos_list.emplace_back(row_id);
           }
@@ -261,17 +390,9 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
         pos_list_out = std::make_shared<EntireChunkPosList>(chunk_id, chunk_in->size());
       } else {
         const auto mvcc_data = chunk_in->mvcc_data();
-        RowIDPosList temp_pos_list;
-        temp_pos_list.reserve(expected_number_of_valid_rows);
-        temp_pos_list.guarantee_single_chunk();
         // Generate pos_list_out.
-        auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
-        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-          if (opossum::is_row_visible(our_tid, snapshot_commit_id, chunk_offset, *mvcc_data)) {
-            temp_pos_list.emplace_back(RowID{chunk_id, chunk_offset});
-          }
-        }
-        pos_list_out = std::make_shared<const RowIDPosList>(std::move(temp_pos_list));
+        _determine_visible_rows(*mvcc_data, chunk_in->size(), our_tid, snapshot_commit_id, visible_rows);
+        pos_list_out = create_pos_list_for_visible_rows(visible_rows, chunk_id, chunk_in->size());
       }
 
       // Create actual ReferenceSegment objects.
@@ -10,6 +10,8 @@
 
 namespace opossum {
 
+struct MvccData;
+
 /**
  * Validates visibility of records of a table
  * within the context of a given transaction
@@ -37,6 +39,12 @@ class Validate : public AbstractReadOnlyOperator {
   // _can_use_chunk_shortcut is true. Consult _on_execute() for more details on the conditions.
   bool _is_entire_chunk_visible(const std::shared_ptr<const Chunk>& chunk, const CommitID snapshot_commit_id) const;
 
+  // Determines which of the rows [0, row_count) are visible (see is_row_visible). Bit (i % 64) of visible_rows[i / 64]
+  // is set if row i is visible. The MVCC vectors are compared in blocks of 64 rows, which the compiler vectorizes.
+  static void _determine_visible_rows(const MvccData& mvcc_data, const ChunkOffset row_count,
+                                      const TransactionID our_tid, const CommitID snapshot_commit_id,
+                                      std::vector<uint64_t>& visible_rows);
+
   bool _can_use_chunk_shortcut = true;
 
  protected:
@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -9,12 +10,18 @@
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
 #include "cost_estimation/abstract_cost_estimator.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/cardinality_estimator.hpp"
+#include "storage/index/table_key/table_key_index.hpp"
 #include "utils/assert.hpp"
 
 namespace {
@@ -39,6 +46,10 @@ void IndexScanRule::_apply_to_plan_without_subqueries(const std::shared_ptr<Abst
   DebugAssert(cost_estimator, "IndexScanRule requires cost estimator to be set");
   Assert(lqp_root->type == LQPNodeType::Root, "ExpressionReductionRule needs root to hold onto");
 
+  for (const auto& node : lqp_find_nodes_by_type(lqp_root, LQPNodeType::StoredTable)) {
+    _apply_key_index_scan(std::static_pointer_cast<StoredTableNode>(node));
+  }
+
   visit_lqp(lqp_root, [&](const auto& node) {
     if (node->type == LQPNodeType::Predicate) {
       const auto& child = node->left_input();
@@ -60,6 +71,65 @@ void IndexScanRule::_apply_to_plan_without_subqueries(const std::shared_ptr<Abst
   });
 }
 
+void IndexScanRule::_apply_key_index_scan(const std::shared_ptr<StoredTableNode>& stored_table_node) {
+  const auto key_indexes = Hyrise::get().storage_manager.get_table(stored_table_node->table_name)->key_indexes();
+  if (key_indexes.empty() || stored_table_node->outputs().size() != 1) {
+    return;
+  }
+
+  // Collect the predicates of the form `<column> = <value or placeholder>` on top of the StoredTableNode. We stop at
+  // the first node that is neither a PredicateNode nor a ValidateNode or that has multiple outputs, as predicates above
+  // it do not necessarily apply to all rows that pass through the StoredTableNode.
+  auto predicate_nodes_by_column_id = std::map<ColumnID, std::shared_ptr<PredicateNode>>{};
+  auto node = stored_table_node->outputs().front();
+  while (node->type == LQPNodeType::Predicate || node->type == LQPNodeType::Validate) {
+    const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
+    const auto predicate =
+        predicate_node ? std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate_node->predicate()) : nullptr;
+
+    if (predicate && predicate->predicate_condition == PredicateCondition::Equals) {
+      auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(predicate->left_operand());
+      auto value_expression = predicate->right_operand();
+      if (!column_expression) {
+        column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(predicate->right_operand());
+        value_expression = predicate->left_operand();
+      }
+
+      if (column_expression && column_expression->original_node.lock() == stored_table_node &&
+          (value_expression->type == ExpressionType::Value || value_expression->type == ExpressionType::Placeholder)) {
+        predicate_nodes_by_column_id.try_emplace(column_expression->original_column_id, predicate_node);
+      }
+    }
+
+    if (node->outputs().size() != 1) {
+      break;
+    }
+    node = node->outputs().front();
+  }
+
+  for (const auto& key_index : key_indexes) {
+    const auto& column_ids = key_index->column_ids();
+    const auto covers_key = std::all_of(column_ids.cbegin(), column_ids.cend(), [&](const auto column_id) {
+      return predicate_nodes_by_column_id.contains(column_id);
+    });
+    if (!covers_key) {
+      continue;
+    }
+
+    auto predicates = std::vector<std::shared_ptr<AbstractExpression>>{};
+    for (const auto column_id : column_ids) {
+      const auto& predicate_node = predicate_nodes_by_column_id[column_id];
+      predicates.emplace_back(predicate_node->predicate());
+      lqp_remove_node(predicate_node);
+    }
+
+    const auto key_predicate_node = PredicateNode::make(inflate_logical_expressions(predicates, LogicalOperator::And));
+    key_predicate_node->scan_type = ScanType::IndexScan;
+    lqp_insert_node_above(stored_table_node, key_predicate_node);
+    return;
+  }
+}
+
 bool IndexScanRule::_is_index_scan_applicable(const IndexStatistics& index_statistics,
                                               const std::shared_ptr<PredicateNode>& predicate_node) const {
   if (!_is_single_segment_index(index_statistics)) {
@@ -12,6 +12,7 @@ namespace opossum {
 
 class AbstractLQPNode;
 class PredicateNode;
+class StoredTableNode;
 
 /**
  * This optimizer rule finds PredicateNodes whose inputs are StoredTableNodes. These PredicateNodes are candidates
@@ -23,6 +24,12 @@ class PredicateNode;
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
  * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
  * Currently, only GroupKeyIndexes are supported.
+ *
+ * Tables may also have key indexes (see TableKeyIndex), which cover entire tables. If the PredicateNodes directly
+ * above a StoredTableNode (possibly interleaved with a ValidateNode) compare each column of a key index to a value or
+ * placeholder, these predicates are combined into a single PredicateNode with the ScanType IndexScan, which is placed
+ * directly on top of the StoredTableNode. The LQPTranslator turns it into a KeyIndexScan. As key lookups return at
+ * most a handful of rows, this is done regardless of the cardinality estimations.
  */
 
 class IndexScanRule : public AbstractRule {
@@ -31,6 +38,7 @@ class IndexScanRule : public AbstractRule {
 
  protected:
   void _apply_to_plan_without_subqueries(const std::shared_ptr<AbstractLQPNode>& lqp_root) const override;
+  static void _apply_key_index_scan(const std::shared_ptr<StoredTableNode>& stored_table_node);
   bool _is_index_scan_applicable(const IndexStatistics& index_statistics,
                                  const std::shared_ptr<PredicateNode>& predicate_node) const;
   static bool _is_single_segment_index(const IndexStatistics& index_statistics);
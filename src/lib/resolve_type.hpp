@@ -16,6 +16,7 @@
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
 
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/pos_lists/entire_chunk_pos_list.hpp"
 
 namespace opossum {
@@ -146,6 +147,8 @@ void resolve_pos_list_type(const std::shared_ptr<const AbstractPosList>& untyped
     } else if (const auto entire_chunk_pos_list =
                    std::dynamic_pointer_cast<const EntireChunkPosList>(untyped_pos_list)) {
       functor(entire_chunk_pos_list);
+    } else if (const auto bitmap_pos_list = std::dynamic_pointer_cast<const BitmapPosList>(untyped_pos_list)) {
+      functor(bitmap_pos_list);
     } else {
       Fail("Unrecognized PosList type encountered");
     }
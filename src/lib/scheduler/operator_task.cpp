@@ -6,6 +6,8 @@
 
 #include "operators/abstract_operator.hpp"
 #include "operators/abstract_read_write_operator.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/runtime_filter.hpp"
 
 #include "scheduler/job_task.hpp"
 
@@ -38,6 +40,20 @@ std::shared_ptr<OperatorTask> add_operator_tasks_recursively(const std::shared_p
     }
   }
 
+  // The source of a runtime filter has to be executed before the operators that use the filter (see RuntimeFilter).
+  // Both are part of the subtrees that were just added.
+  if (const auto join_hash = std::dynamic_pointer_cast<JoinHash>(op)) {
+    for (const auto& runtime_filter : join_hash->runtime_filters()) {
+      const auto source = std::const_pointer_cast<AbstractOperator>(runtime_filter->source());
+      for (const auto& [consumer, column_id] : runtime_filter->consumers()) {
+        if (!consumer->executed()) {
+          source->get_or_create_operator_task()->set_as_predecessor_of(
+              std::const_pointer_cast<AbstractOperator>(consumer)->get_or_create_operator_task());
+        }
+      }
+    }
+  }
+
   return task;
 }
 
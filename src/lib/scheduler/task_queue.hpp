@@ -48,6 +48,11 @@ class TaskQueue {
    */
   std::mutex lock;
 
+  /**
+   * Number of workers currently waiting on new_task. Pushes to a worker's deque only notify if this is non-zero.
+   */
+  std::atomic_uint32_t sleeping_workers{0};
+
  private:
   NodeID _node_id;
   std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
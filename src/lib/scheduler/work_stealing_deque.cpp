@@ -0,0 +1,129 @@
+#include "work_stealing_deque.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+WorkStealingDeque::Buffer::Buffer(const size_t init_capacity)
+    : capacity(init_capacity), mask(init_capacity - 1), slots(std::make_unique<std::atomic<Slot>[]>(init_capacity)) {
+  DebugAssert(capacity > 0 && (capacity & mask) == 0, "Capacity of WorkStealingDeque must be a power of two");
+}
+
+WorkStealingDeque::Slot WorkStealingDeque::Buffer::get(const int64_t index) const {
+  return slots[static_cast<size_t>(index) & mask].load(std::memory_order_relaxed);
+}
+
+void WorkStealingDeque::Buffer::put(const int64_t index, const Slot slot) {
+  slots[static_cast<size_t>(index) & mask].store(slot, std::memory_order_relaxed);
+}
+
+WorkStealingDeque::WorkStealingDeque(size_t initial_capacity) {
+  _buffers.emplace_back(std::make_unique<Buffer>(initial_capacity));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  // Free the tasks that were never removed from the deque
+  const auto* buffer = _buffer.load(std::memory_order_relaxed);
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  for (auto index = _top.load(std::memory_order_relaxed); index < bottom; ++index) {
+    delete buffer->get(index);
+  }
+}
+
+void WorkStealingDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > static_cast<int64_t>(buffer->capacity) - 1) {
+    buffer = _grow(buffer, top, bottom);
+  }
+
+  // The release store publishes the slot to thieves that acquire-load _bottom. This is equivalent to the release fence
+  // used in the paper, but is understood by ThreadSanitizer.
+  buffer->put(bottom, new std::shared_ptr<AbstractTask>(task));
+  _bottom.store(bottom + 1, std::memory_order_release);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  const auto* buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // Deque was empty
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto slot = buffer->get(bottom);
+  if (top == bottom) {
+    // This is the last task in the deque, so we compete with potential thieves for it
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      slot = nullptr;
+    }
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  return _take(slot);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) {
+    return nullptr;
+  }
+
+  // The slot must be read before the CAS. If the CAS fails, someone else owns the slot and it must not be touched.
+  const auto* buffer = _buffer.load(std::memory_order_acquire);
+  const auto slot = buffer->get(top);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    return nullptr;
+  }
+
+  return _take(slot);
+}
+
+bool WorkStealingDeque::empty() const {
+  return size() == 0;
+}
+
+size_t WorkStealingDeque::size() const {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_relaxed);
+  return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+WorkStealingDeque::Buffer* WorkStealingDeque::_grow(const Buffer* buffer, const int64_t top, const int64_t bottom) {
+  auto new_buffer = std::make_unique<Buffer>(buffer->capacity * 2);
+  for (auto index = top; index < bottom; ++index) {
+    new_buffer->put(index, buffer->get(index));
+  }
+
+  auto* new_buffer_raw = new_buffer.get();
+  _buffers.emplace_back(std::move(new_buffer));
+  _buffer.store(new_buffer_raw, std::memory_order_release);
+  return new_buffer_raw;
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::_take(const Slot slot) {
+  if (!slot) {
+    return nullptr;
+  }
+
+  auto task = std::move(*slot);
+  delete slot;
+  return task;
+}
+
+}  // namespace opossum
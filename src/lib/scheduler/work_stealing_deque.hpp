@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * Lock-free double-ended task queue as described by Chase and Lev ("Dynamic Circular Work-Stealing Deque", SPAA 2005),
+ * using the memory orderings from Le et al. ("Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013).
+ *
+ * Exactly one thread (the owning Worker) may call push() and pop(). These operate on the bottom end of the deque in
+ * LIFO order, so that the owner keeps working on the most recently created (and thus cache-hot) tasks. Any other
+ * thread may call steal(), which takes the oldest task from the top end. Owner and thieves only synchronize via a
+ * compare-and-swap when they compete for the last remaining task.
+ *
+ * The ring buffer grows when it is full. As thieves might still read from the old buffer, retired buffers are kept
+ * until the deque is destroyed. Since the capacity doubles every time, this at most doubles the memory footprint.
+ */
+class WorkStealingDeque : private Noncopyable {
+ public:
+  explicit WorkStealingDeque(size_t initial_capacity = 1024);
+  ~WorkStealingDeque();
+
+  // Only to be called by the owning thread
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  // Only to be called by the owning thread. Returns nullptr if the deque is empty.
+  std::shared_ptr<AbstractTask> pop();
+
+  // May be called by any thread. Returns nullptr if the deque is empty or if another thread won the race for the task.
+  std::shared_ptr<AbstractTask> steal();
+
+  // As the deque is concurrently modified, the results of these are only a snapshot
+  bool empty() const;
+  size_t size() const;
+
+ private:
+  // The slots do not hold the shared_ptrs themselves, as these cannot be read atomically while another thread might
+  // overwrite them. Instead, each slot points to a heap-allocated shared_ptr. Whoever successfully removes a slot from
+  // the deque takes ownership of that shared_ptr.
+  using Slot = std::shared_ptr<AbstractTask>*;
+
+  struct Buffer {
+    explicit Buffer(const size_t init_capacity);
+
+    Slot get(const int64_t index) const;
+    void put(const int64_t index, const Slot slot);
+
+    const size_t capacity;
+    const size_t mask;
+    std::unique_ptr<std::atomic<Slot>[]> slots;
+  };
+
+  Buffer* _grow(const Buffer* buffer, const int64_t top, const int64_t bottom);
+
+  static std::shared_ptr<AbstractTask> _take(const Slot slot);
+
+  // top and bottom are on separate cache lines as they are written by different threads
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  alignas(64) std::atomic<Buffer*> _buffer;
+
+  // Owns the current and all retired buffers. Only modified by the owning thread.
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
@@ -0,0 +1,167 @@
+#include "work_stealing_scheduler.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "abstract_task.hpp"
+#include "hyrise.hpp"
+#include "task_queue.hpp"
+#include "work_stealing_deque.hpp"
+#include "worker.hpp"
+
+#include "uid_allocator.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+WorkStealingScheduler::WorkStealingScheduler() {
+  _worker_id_allocator = std::make_shared<UidAllocator>();
+}
+
+WorkStealingScheduler::~WorkStealingScheduler() {
+  if (HYRISE_DEBUG && _active) {
+    // We cannot throw an exception because destructors are noexcept by default.
+    std::cerr << "WorkStealingScheduler::finish() wasn't called prior to destroying it" << std::endl;
+    std::exit(EXIT_FAILURE);
+  }
+}
+
+void WorkStealingScheduler::begin() {
+  DebugAssert(!_active, "Scheduler is already active");
+
+  const auto& nodes = Hyrise::get().topology.nodes();
+  _workers.reserve(Hyrise::get().topology.num_cpus());
+  _queues.reserve(nodes.size());
+
+  // Remember which workers belong to which node, so that we can build the NUMA-aware steal order below
+  auto workers_per_node = std::vector<std::vector<std::shared_ptr<Worker>>>(nodes.size());
+
+  for (auto node_id = NodeID{0}; node_id < nodes.size(); node_id++) {
+    auto queue = std::make_shared<TaskQueue>(node_id);
+
+    _queues.emplace_back(queue);
+
+    for (const auto& topology_cpu : nodes[node_id].cpus) {
+      auto worker = std::make_shared<Worker>(queue, WorkerID{_worker_id_allocator->allocate()}, topology_cpu.cpu_id,
+                                             std::make_shared<WorkStealingDeque>());
+      _workers.emplace_back(worker);
+      workers_per_node[node_id].emplace_back(worker);
+    }
+  }
+
+  // Victims on the same node come first, followed by the workers of the other nodes. The remote nodes are visited in a
+  // round-robin fashion starting at the next node, so that not all nodes hammer the workers of node 0.
+  for (auto node_id = NodeID{0}; node_id < nodes.size(); node_id++) {
+    for (const auto& worker : workers_per_node[node_id]) {
+      auto victims = std::vector<std::shared_ptr<WorkStealingDeque>>{};
+      victims.reserve(_workers.size() - 1);
+
+      for (const auto& other_worker : workers_per_node[node_id]) {
+        if (other_worker != worker) {
+          victims.emplace_back(other_worker->deque());
+        }
+      }
+      const auto local_victim_count = victims.size();
+
+      for (auto offset = size_t{1}; offset < nodes.size(); ++offset) {
+        for (const auto& other_worker : workers_per_node[(node_id + offset) % nodes.size()]) {
+          victims.emplace_back(other_worker->deque());
+        }
+      }
+
+      worker->set_steal_victims(victims, local_victim_count);
+    }
+  }
+
+  _active = true;
+
+  for (auto& worker : _workers) {
+    worker->start();
+  }
+}
+
+void WorkStealingScheduler::wait_for_all_tasks() {
+  while (true) {
+    uint64_t num_finished_tasks = 0;
+    for (auto& worker : _workers) {
+      num_finished_tasks += worker->num_finished_tasks();
+    }
+
+    if (num_finished_tasks == _task_counter) {
+      break;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+}
+
+void WorkStealingScheduler::finish() {
+  wait_for_all_tasks();
+
+  // All queues SHOULD be empty by now. The deques might still hold tasks that were executed by another worker (e.g., in
+  // Worker::_wait_for_tasks) before they were popped. These are released when the deques are destroyed.
+  if (HYRISE_DEBUG) {
+    for (auto& queue : _queues) {
+      Assert(queue->empty(), "WorkStealingScheduler bug: Queue wasn't empty even though all tasks finished");
+    }
+  }
+
+  _active = false;
+
+  for (auto& worker : _workers) {
+    worker->join();
+  }
+
+  _workers = {};
+  _queues = {};
+  _task_counter = 0;
+}
+
+bool WorkStealingScheduler::active() const {
+  return _active;
+}
+
+const std::vector<std::shared_ptr<TaskQueue>>& WorkStealingScheduler::queues() const {
+  return _queues;
+}
+
+void WorkStealingScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
+                                     SchedulePriority priority) {
+  DebugAssert(_active, "Can't schedule more tasks after the WorkStealingScheduler was shut down");
+  DebugAssert(task->is_scheduled(), "Don't call WorkStealingScheduler::schedule(), call schedule() on the task");
+
+  const auto task_counter = _task_counter++;  // Atomically take snapshot of counter
+  task->set_id(TaskID{task_counter});
+
+  if (!task->is_ready()) {
+    return;
+  }
+
+  const auto worker = Worker::get_this_thread_worker();
+  if (worker && worker->deque()) {
+    const auto worker_node_id = worker->queue()->node_id();
+    if (preferred_node_id == CURRENT_NODE_ID) {
+      preferred_node_id = worker_node_id;
+    }
+
+    // Fast path: Tasks created within a worker go to that worker's deque, where no other thread competes for them
+    // unless it runs out of work.
+    if (preferred_node_id == worker_node_id && priority == SchedulePriority::Default && task->is_stealable()) {
+      worker->push_to_deque(task);
+      return;
+    }
+  } else if (preferred_node_id == CURRENT_NODE_ID) {
+    preferred_node_id = NodeID{0};
+  }
+
+  DebugAssert(!(static_cast<size_t>(preferred_node_id) >= _queues.size()),
+              "preferred_node_id is not within range of available nodes");
+
+  auto queue = _queues[preferred_node_id];
+  queue->push(task, static_cast<uint32_t>(priority));
+}
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "abstract_scheduler.hpp"
+
+namespace opossum {
+
+/*
+ * WORK STEALING SCHEDULER
+ *
+ * Alternative to the NodeQueueScheduler (see there for the general scheduling concept). In the NodeQueueScheduler,
+ * all workers of a node push to and pull from a single shared TaskQueue. When operators spawn thousands of small
+ * JobTasks, that queue and its condition variable become a point of contention.
+ *
+ * Here, every Worker additionally owns a lock-free WorkStealingDeque. Tasks that are scheduled from within a worker
+ * (i.e., JobTasks spawned by an operator or successors that become ready) are pushed to the bottom of that worker's
+ * deque without touching any shared state. The owner pops tasks from the bottom (LIFO), so that it continues with the
+ * most recently created tasks whose data is likely still cached. Once its deque and its node's queue are empty, a
+ * worker steals the oldest task from the top of another worker's deque. Victims are chosen in a NUMA-aware order:
+ * First, the workers of the same node are tried, starting at a random one. Only then, workers on remote nodes are
+ * tried. The node queues of other nodes are checked last.
+ *
+ * The per-node TaskQueues remain in place for tasks that are scheduled from outside of the workers (e.g., by the
+ * clients of the benchmark runner or the server), for tasks with a preferred node other than the current one, for
+ * high-priority tasks, and for tasks that must not be stolen by other nodes.
+ *
+ * In contrast to the NodeQueueScheduler, tasks are not grouped (see NodeQueueScheduler::_group_tasks), as scheduling a
+ * task into the local deque is cheap.
+ */
+
+class Worker;
+class TaskQueue;
+class UidAllocator;
+
+/**
+ * Schedules Tasks using per-worker work-stealing deques
+ */
+class WorkStealingScheduler : public AbstractScheduler {
+ public:
+  WorkStealingScheduler();
+  ~WorkStealingScheduler() override;
+
+  /**
+   * Create a queue on every node and a processing unit with its own deque for every core.
+   * Start a single worker for each processing unit.
+   */
+  void begin() override;
+
+  void finish() override;
+
+  bool active() const override;
+
+  const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
+
+  /**
+   * @param task
+   * @param preferred_node_id If called from a worker of that node (or with CURRENT_NODE_ID), the task is pushed to the
+   *                          worker's deque. Otherwise, it is added to the node's queue.
+   * @param priority High-priority tasks always go to the node's queue.
+   */
+  void schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id = CURRENT_NODE_ID,
+                SchedulePriority priority = SchedulePriority::Default) override;
+
+  void wait_for_all_tasks() override;
+
+ private:
+  std::atomic<TaskID::base_type> _task_counter{0};
+  std::shared_ptr<UidAllocator> _worker_id_allocator;
+  std::vector<std::shared_ptr<TaskQueue>> _queues;
+  std::vector<std::shared_ptr<Worker>> _workers;
+  std::atomic_bool _active{false};
+};
+
+}  // namespace opossum
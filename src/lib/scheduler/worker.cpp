@@ -16,6 +16,7 @@
 #include "abstract_task.hpp"
 #include "hyrise.hpp"
 #include "task_queue.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace {
 
@@ -35,8 +36,9 @@ std::shared_ptr<Worker> Worker::get_this_thread_worker() {
   return ::this_thread_worker.lock();
 }
 
-Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id)
-    : _queue(queue), _id(id), _cpu_id(cpu_id) {
+Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id,
+               const std::shared_ptr<WorkStealingDeque>& deque)
+    : _queue(queue), _id(id), _cpu_id(cpu_id), _deque(deque) {
   // Generate a random distribution from 0-99 for later use, see below
   _random.resize(100);
   std::iota(_random.begin(), _random.end(), 0);
@@ -55,6 +57,17 @@ CpuID Worker::cpu_id() const {
   return _cpu_id;
 }
 
+std::shared_ptr<WorkStealingDeque> Worker::deque() const {
+  return _deque;
+}
+
+void Worker::set_steal_victims(const std::vector<std::shared_ptr<WorkStealingDeque>>& victims,
+                               size_t local_victim_count) {
+  DebugAssert(local_victim_count <= victims.size(), "More local victims than victims");
+  _steal_victims = victims;
+  _local_victim_count = local_victim_count;
+}
+
 void Worker::operator()() {
   Assert(this_thread_worker.expired(), "Thread already has a worker");
 
@@ -68,13 +81,26 @@ void Worker::operator()() {
 }
 
 void Worker::_work() {
-  // If execute_next has been called, run that task first, otherwise try to retrieve a task from the queue.
+  // If execute_next has been called, run that task first, otherwise try to retrieve a task from the own deque (most
+  // recently pushed first) or from the queue.
   auto task = std::shared_ptr<AbstractTask>{};
   if (_next_task) {
     task = std::move(_next_task);
     _next_task = nullptr;
   } else {
-    task = _queue->pull();
+    if (_deque) {
+      task = _deque->pop();
+    }
+    if (!task) {
+      task = _queue->pull();
+    }
+  }
+
+  if (!task && _deque) {
+    task = _steal_from_deques();
+    if (task) {
+      task->set_node_id(_queue->node_id());
+    }
   }
 
   if (!task) {
@@ -98,7 +124,9 @@ void Worker::_work() {
     if (!work_stealing_successful) {
       {
         std::unique_lock<std::mutex> unique_lock(_queue->lock);
+        ++_queue->sleeping_workers;
         _queue->new_task.wait_for(unique_lock, WORKER_SLEEP_TIME);
+        --_queue->sleeping_workers;
       }
       return;
     }
@@ -133,11 +161,33 @@ void Worker::execute_next(const std::shared_ptr<AbstractTask>& task) {
     }
     Assert(successfully_enqueued, "Task was already enqueued, expected to be solely responsible for execution");
     _next_task = task;
+  } else if (_deque && task->is_stealable()) {
+    push_to_deque(task);
   } else {
     _queue->push(task, static_cast<uint32_t>(SchedulePriority::Default));
   }
 }
 
+void Worker::push_to_deque(const std::shared_ptr<AbstractTask>& task) {
+  DebugAssert(_deque, "Worker has no deque");
+  DebugAssert(&*get_this_thread_worker() == this, "Only the owning worker may push to its deque");
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) {
+    return;
+  }
+
+  task->set_node_id(_queue->node_id());
+  _deque->push(task);
+
+  // Idle workers of this node sleep on the queue's condition variable. Wake one of them up so that it can steal the
+  // task. Busy nodes, where nobody sleeps, skip the notification. A worker that starts sleeping just after the check
+  // misses the task for at most WORKER_SLEEP_TIME.
+  if (_queue->sleeping_workers.load() > 0) {
+    _queue->new_task.notify_one();
+  }
+}
+
 void Worker::start() {
   _thread = std::thread(&Worker::operator(), this);
 }
@@ -216,6 +266,33 @@ void Worker::_wait_for_tasks(const std::vector<std::shared_ptr<AbstractTask>>& t
   }
 }
 
+std::shared_ptr<AbstractTask> Worker::_steal_from_deques() {
+  // Try the workers on the same node first, as their tasks are likely to work on data in the local memory. Within each
+  // group of victims, start at a random victim so that multiple thieves do not all compete for the same deque.
+  const auto steal_from_range = [&](const size_t begin, const size_t end) -> std::shared_ptr<AbstractTask> {
+    const auto victim_count = end - begin;
+    if (victim_count == 0) {
+      return nullptr;
+    }
+
+    _next_random = (_next_random + 1) % _random.size();
+    const auto offset = static_cast<size_t>(_random[_next_random]);
+    for (auto victim_idx = size_t{0}; victim_idx < victim_count; ++victim_idx) {
+      auto task = _steal_victims[begin + (offset + victim_idx) % victim_count]->steal();
+      if (task) {
+        return task;
+      }
+    }
+    return nullptr;
+  };
+
+  auto task = steal_from_range(0, _local_victim_count);
+  if (!task) {
+    task = steal_from_range(_local_victim_count, _steal_victims.size());
+  }
+  return task;
+}
+
 void Worker::_set_affinity() {
 #if HYRISE_NUMA_SUPPORT
   cpu_set_t cpuset;
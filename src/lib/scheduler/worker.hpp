@@ -12,6 +12,7 @@
 namespace opossum {
 
 class TaskQueue;
+class WorkStealingDeque;
 
 /**
  * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
@@ -23,7 +24,12 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
  public:
   static std::shared_ptr<Worker> get_this_thread_worker();
 
-  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id);
+  /**
+   * @param deque If set (see WorkStealingScheduler), the worker first works on the tasks in its own deque before it
+   *              pulls from the node's queue and steals from the deques of other workers.
+   */
+  Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id,
+         const std::shared_ptr<WorkStealingDeque>& deque = nullptr);
 
   /**
    * Unique ID of a worker. Currently not in use, but really helpful for debugging.
@@ -31,6 +37,13 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   WorkerID id() const;
   std::shared_ptr<TaskQueue> queue() const;
   CpuID cpu_id() const;
+  std::shared_ptr<WorkStealingDeque> deque() const;
+
+  /**
+   * Sets the deques of other workers that this worker steals from once it runs out of tasks. The first
+   * local_victim_count deques belong to workers on the same node and are tried first.
+   */
+  void set_steal_victims(const std::vector<std::shared_ptr<WorkStealingDeque>>& victims, size_t local_victim_count);
 
   void start();
   void join();
@@ -38,10 +51,13 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   // Try to execute task immediately after this worker finishes the execution of the current task. The goal is to
   // execute the task while the caches are still fresh instead of having to wait for it to be scheduled again. A task
   // can have multiple successors and all of them could become executable at the same time. In that case, the current
-  // worker can only execute one of them immediately. The others are placed into a high priority queue on the same node
-  // so that they are worked on as soon as possible by either this or another worker.
+  // worker can only execute one of them immediately. The others are placed into the worker's deque (if it has one) or
+  // into the queue of the same node so that they are worked on as soon as possible by either this or another worker.
   void execute_next(const std::shared_ptr<AbstractTask>& task);
 
+  // Pushes the task to the bottom of this worker's deque. Must be called from the worker's own thread.
+  void push_to_deque(const std::shared_ptr<AbstractTask>& task);
+
   uint64_t num_finished_tasks() const;
 
   void operator=(const Worker&) = delete;
@@ -60,10 +76,16 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   void _set_affinity();
 
+  // Tries to steal a task from the deques of other workers, starting with a random worker on the same node
+  std::shared_ptr<AbstractTask> _steal_from_deques();
+
   std::shared_ptr<AbstractTask> _next_task{};
   std::shared_ptr<TaskQueue> _queue;
   WorkerID _id;
   CpuID _cpu_id;
+  std::shared_ptr<WorkStealingDeque> _deque;
+  std::vector<std::shared_ptr<WorkStealingDeque>> _steal_victims;
+  size_t _local_victim_count{0};
   std::thread _thread;
   std::atomic_uint64_t _num_finished_tasks{0};
 
@@ -0,0 +1,553 @@
+#include "copy_handler.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstdlib>
+#include <regex>
+#include <string_view>
+#include <utility>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/endian/conversion.hpp>
+
+#include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "resolve_type.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Signature at the beginning of the binary format, followed by a 32-bit flags field and the length of the header
+// extension area
+constexpr auto BINARY_SIGNATURE = std::string_view{"PGCOPY\n\377\r\n\0", 11};
+constexpr auto BINARY_HEADER_SIZE = BINARY_SIGNATURE.size() + 2 * sizeof(uint32_t);
+
+template <typename T>
+T read_big_endian(const char* data) {
+  auto value = T{};
+  std::copy_n(data, sizeof(T), reinterpret_cast<char*>(&value));
+  return boost::endian::big_to_native(value);
+}
+
+// Parses up to max_digits digits of the given base starting at position. Returns the number of digits consumed and the
+// byte that they represent (used for the \nnn and \xhh escapes of the text format).
+std::pair<size_t, char> parse_escaped_byte(const std::string_view field, const size_t position, const int base,
+                                           const size_t max_digits) {
+  auto byte = 0;
+  auto digit_count = size_t{0};
+  while (digit_count < max_digits && position + digit_count < field.size()) {
+    const auto character = field[position + digit_count];
+    auto digit = base;
+    if (character >= '0' && character <= '9') {
+      digit = character - '0';
+    } else if (character >= 'a' && character <= 'f') {
+      digit = character - 'a' + 10;
+    } else if (character >= 'A' && character <= 'F') {
+      digit = character - 'A' + 10;
+    }
+
+    if (digit >= base) {
+      break;
+    }
+    byte = byte * base + digit;
+    ++digit_count;
+  }
+  return {digit_count, static_cast<char>(byte)};
+}
+
+}  // namespace
+
+namespace opossum {
+
+class BaseCopyColumnBuilder {
+ public:
+  virtual ~BaseCopyColumnBuilder() = default;
+
+  // Appends a value given in text format (as used by the text and CSV formats) or in binary format
+  virtual void append_text(const std::string_view value) = 0;
+  virtual void append_binary(const std::string_view value) = 0;
+  virtual void append_null() = 0;
+
+  // Returns a segment with the values appended so far and resets the builder
+  virtual std::shared_ptr<AbstractSegment> finish() = 0;
+};
+
+template <typename T>
+class CopyColumnBuilder : public BaseCopyColumnBuilder {
+ public:
+  CopyColumnBuilder(const std::string& column_name, const bool nullable, const ChunkOffset capacity)
+      : _column_name(column_name), _nullable(nullable), _capacity(capacity) {
+    _reserve();
+  }
+
+  void append_text(const std::string_view value) final {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      _values.emplace_back(value);
+    } else if constexpr (std::is_integral_v<T>) {
+      auto converted = T{};
+      const auto [end, error_code] = std::from_chars(value.data(), value.data() + value.size(), converted);
+      AssertInput(error_code == std::errc{} && end == value.data() + value.size(),
+                  "Invalid value '" + std::string{value} + "' for column " + _column_name);
+      _values.emplace_back(converted);
+    } else {
+      // std::strtod requires a null-terminated string. Numbers are short enough to not allocate memory.
+      const auto value_string = std::string{value};
+      auto* end = static_cast<char*>(nullptr);
+      const auto converted = std::is_same_v<T, float> ? std::strtof(value_string.c_str(), &end)
+                                                      : std::strtod(value_string.c_str(), &end);
+      AssertInput(!value_string.empty() && end == value_string.c_str() + value_string.size(),
+                  "Invalid value '" + value_string + "' for column " + _column_name);
+      _values.emplace_back(static_cast<T>(converted));
+    }
+
+    if (_nullable) {
+      _null_values.emplace_back(false);
+    }
+  }
+
+  void append_binary(const std::string_view value) final {
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      _values.emplace_back(value);
+    } else {
+      AssertInput(value.size() == sizeof(T), "Invalid length of binary value for column " + _column_name);
+      if constexpr (std::is_same_v<T, float>) {
+        _values.emplace_back(std::bit_cast<float>(read_big_endian<uint32_t>(value.data())));
+      } else if constexpr (std::is_same_v<T, double>) {
+        _values.emplace_back(std::bit_cast<double>(read_big_endian<uint64_t>(value.data())));
+      } else {
+        _values.emplace_back(read_big_endian<T>(value.data()));
+      }
+    }
+
+    if (_nullable) {
+      _null_values.emplace_back(false);
+    }
+  }
+
+  void append_null() final {
+    AssertInput(_nullable, "NULL value for column " + _column_name + ", which is not nullable");
+    _values.emplace_back();
+    _null_values.emplace_back(true);
+  }
+
+  std::shared_ptr<AbstractSegment> finish() final {
+    auto segment = _nullable ? std::make_shared<ValueSegment<T>>(std::move(_values), std::move(_null_values))
+                             : std::make_shared<ValueSegment<T>>(std::move(_values));
+    _values = {};
+    _null_values = {};
+    _reserve();
+    return segment;
+  }
+
+ private:
+  void _reserve() {
+    _values.reserve(_capacity);
+    if (_nullable) {
+      _null_values.reserve(_capacity);
+    }
+  }
+
+  const std::string _column_name;
+  const bool _nullable;
+  const ChunkOffset _capacity;
+  pmr_vector<T> _values;
+  pmr_vector<bool> _null_values;
+};
+
+std::optional<CopyStatement> parse_copy_statement(const std::string& query) {
+  // Groups: (1) table name, (2) query, (3) direction, (4) format in parentheses, (5) format without parentheses
+  static const auto copy_regex = std::regex{
+      R"(^\s*COPY\s+(?:(\w+)|\(([\s\S]+)\))\s+(FROM\s+STDIN|TO\s+STDOUT))"
+      R"((?:\s+(?:WITH\s*)?(?:\(\s*FORMAT\s+(\w+)\s*\)|(\w+)))?\s*;?\s*$)",
+      std::regex::icase};
+
+  auto matches = std::smatch{};
+  if (!std::regex_match(query, matches, copy_regex)) {
+    return std::nullopt;
+  }
+
+  auto copy_statement = CopyStatement{};
+  copy_statement.direction =
+      boost::istarts_with(matches.str(3), "FROM") ? CopyDirection::FromStdin : CopyDirection::ToStdout;
+
+  const auto format = boost::to_lower_copy(matches[4].matched ? matches.str(4) : matches.str(5));
+  if (format.empty() || format == "text") {
+    copy_statement.format = CopyFormat::Text;
+  } else if (format == "csv") {
+    copy_statement.format = CopyFormat::CSV;
+  } else if (format == "binary") {
+    copy_statement.format = CopyFormat::Binary;
+  } else {
+    FailInput("Unknown COPY format " + format);
+  }
+
+  if (copy_statement.direction == CopyDirection::FromStdin) {
+    AssertInput(matches[1].matched, "COPY FROM STDIN requires a table");
+    copy_statement.table_name = matches.str(1);
+  } else {
+    copy_statement.query = matches[1].matched ? "SELECT * FROM " + matches.str(1) : matches.str(2);
+  }
+
+  return copy_statement;
+}
+
+CopyImporter::CopyImporter(const std::string& table_name, const CopyFormat format,
+                           const std::shared_ptr<TransactionContext>& transaction_context)
+    : _table_name(table_name),
+      _table(Hyrise::get().storage_manager.has_table(table_name) ? Hyrise::get().storage_manager.get_table(table_name)
+                                                                 : nullptr),
+      _format(format),
+      _transaction_context(transaction_context) {
+  AssertInput(_table, "Table " + table_name + " does not exist");
+
+  const auto column_count = _table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(_table->column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      _column_builders.emplace_back(std::make_unique<CopyColumnBuilder<ColumnDataType>>(
+          _table->column_name(column_id), _table->column_is_nullable(column_id), _table->target_chunk_size()));
+    });
+  }
+}
+
+CopyImporter::~CopyImporter() = default;
+
+void CopyImporter::consume(const std::string& data) {
+  if (_end_of_data) {
+    // Everything after the end-of-data marker is ignored
+    return;
+  }
+
+  _buffer += data;
+  switch (_format) {
+    case CopyFormat::Text:
+      _parse_text_rows(false);
+      break;
+    case CopyFormat::CSV:
+      _parse_csv_rows(false);
+      break;
+    case CopyFormat::Binary:
+      _parse_binary_rows();
+      break;
+  }
+}
+
+uint64_t CopyImporter::finish() {
+  switch (_format) {
+    case CopyFormat::Text:
+      _parse_text_rows(true);
+      break;
+    case CopyFormat::CSV:
+      _parse_csv_rows(true);
+      AssertInput(_buffer.empty() || _end_of_data, "Unterminated quoted value at the end of the COPY data");
+      break;
+    case CopyFormat::Binary:
+      AssertInput(_end_of_data, "Binary COPY data ended without trailer");
+      break;
+  }
+
+  _insert_batch();
+  return _row_count;
+}
+
+ColumnCount CopyImporter::column_count() const {
+  return _table->column_count();
+}
+
+void CopyImporter::_parse_text_rows(const bool end_of_data) {
+  auto row_begin = size_t{0};
+  while (!_end_of_data && row_begin < _buffer.size()) {
+    auto row_end = _buffer.find('\n', row_begin + _scanned_row_size);
+    if (row_end == std::string::npos) {
+      if (!end_of_data) {
+        _scanned_row_size = _buffer.size() - row_begin;
+        break;
+      }
+      row_end = _buffer.size();
+    }
+    _scanned_row_size = 0;
+
+    auto row = std::string_view{_buffer}.substr(row_begin, row_end - row_begin);
+    row_begin = row_end + 1;
+    if (!row.empty() && row.back() == '\r') {
+      row.remove_suffix(1);
+    }
+
+    if (row == "\\.") {
+      _end_of_data = true;
+      break;
+    }
+    _append_text_row(row);
+  }
+
+  _buffer.erase(0, std::min(row_begin, _buffer.size()));
+}
+
+void CopyImporter::_append_text_row(std::string_view row) {
+  const auto column_count = _column_builders.size();
+  auto column_id = size_t{0};
+  auto field_begin = size_t{0};
+  while (true) {
+    const auto field_end = std::min(row.find('\t', field_begin), row.size());
+    const auto field = row.substr(field_begin, field_end - field_begin);
+    AssertInput(column_id < column_count, "Row '" + std::string{row} + "' has more values than the table has columns");
+    auto& column_builder = *_column_builders[column_id];
+
+    if (field == "\\N") {
+      column_builder.append_null();
+    } else if (field.find('\\') == std::string_view::npos) {
+      column_builder.append_text(field);
+    } else {
+      _unescaped_value.clear();
+      for (auto position = size_t{0}; position < field.size(); ++position) {
+        if (field[position] != '\\' || position + 1 == field.size()) {
+          _unescaped_value += field[position];
+          continue;
+        }
+
+        ++position;
+
+        // \nnn is a byte given by one to three octal digits, \xhh a byte given by one or two hexadecimal digits
+        const auto is_hex = field[position] == 'x';
+        const auto [digit_count, byte] = is_hex ? parse_escaped_byte(field, position + 1, 16, 2)
+                                                : parse_escaped_byte(field, position, 8, 3);
+        if (digit_count > 0) {
+          _unescaped_value += byte;
+          position += digit_count - (is_hex ? 0 : 1);
+          continue;
+        }
+
+        switch (field[position]) {
+          case 'b':
+            _unescaped_value += '\b';
+            break;
+          case 'f':
+            _unescaped_value += '\f';
+            break;
+          case 'n':
+            _unescaped_value += '\n';
+            break;
+          case 'r':
+            _unescaped_value += '\r';
+            break;
+          case 't':
+            _unescaped_value += '\t';
+            break;
+          case 'v':
+            _unescaped_value += '\v';
+            break;
+          default:
+            // Any other character following a backslash is taken literally, including the backslash itself and an x
+            // that is not followed by a hexadecimal digit
+            _unescaped_value += field[position];
+        }
+      }
+      column_builder.append_text(_unescaped_value);
+    }
+
+    ++column_id;
+    if (field_end == row.size()) {
+      break;
+    }
+    field_begin = field_end + 1;
+  }
+
+  AssertInput(column_id == column_count, "Row '" + std::string{row} + "' has fewer values than the table has columns");
+  _finish_row();
+}
+
+void CopyImporter::_parse_csv_rows(const bool end_of_data) {
+  auto row_begin = size_t{0};
+  while (!_end_of_data && row_begin < _buffer.size()) {
+    // Line breaks within quoted values do not end the row. Escaped quotes ("") toggle the state twice.
+    auto row_end = row_begin + _scanned_row_size;
+    auto in_quotes = _scanned_row_in_quotes;
+    while (row_end < _buffer.size() && (in_quotes || _buffer[row_end] != '\n')) {
+      if (_buffer[row_end] == '"') {
+        in_quotes = !in_quotes;
+      }
+      ++row_end;
+    }
+    if (row_end == _buffer.size() && (!end_of_data || in_quotes)) {
+      _scanned_row_size = row_end - row_begin;
+      _scanned_row_in_quotes = in_quotes;
+      break;
+    }
+    _scanned_row_size = 0;
+    _scanned_row_in_quotes = false;
+
+    auto row = std::string_view{_buffer}.substr(row_begin, row_end - row_begin);
+    row_begin = row_end + 1;
+    if (!row.empty() && row.back() == '\r') {
+      row.remove_suffix(1);
+    }
+
+    if (row == "\\.") {
+      _end_of_data = true;
+      break;
+    }
+    _append_csv_row(row);
+  }
+
+  _buffer.erase(0, std::min(row_begin, _buffer.size()));
+}
+
+void CopyImporter::_append_csv_row(std::string_view row) {
+  const auto column_count = _column_builders.size();
+  auto column_id = size_t{0};
+  auto position = size_t{0};
+  while (true) {
+    AssertInput(column_id < column_count, "Row '" + std::string{row} + "' has more values than the table has columns");
+    auto& column_builder = *_column_builders[column_id];
+
+    if (position < row.size() && row[position] == '"') {
+      // Quoted value, which is never NULL
+      _unescaped_value.clear();
+      ++position;
+      while (true) {
+        AssertInput(position < row.size(), "Unterminated quoted value in row '" + std::string{row} + "'");
+        if (row[position] == '"') {
+          if (position + 1 < row.size() && row[position + 1] == '"') {
+            _unescaped_value += '"';
+            position += 2;
+            continue;
+          }
+          ++position;
+          break;
+        }
+        _unescaped_value += row[position];
+        ++position;
+      }
+      AssertInput(position == row.size() || row[position] == ',',
+                  "Unexpected character after quoted value in row '" + std::string{row} + "'");
+      column_builder.append_text(_unescaped_value);
+    } else {
+      const auto value_end = std::min(row.find(',', position), row.size());
+      if (value_end == position) {
+        column_builder.append_null();
+      } else {
+        column_builder.append_text(row.substr(position, value_end - position));
+      }
+      position = value_end;
+    }
+
+    ++column_id;
+    if (position == row.size()) {
+      break;
+    }
+    // Skip the separator
+    ++position;
+  }
+
+  AssertInput(column_id == column_count, "Row '" + std::string{row} + "' has fewer values than the table has columns");
+  _finish_row();
+}
+
+void CopyImporter::_parse_binary_rows() {
+  auto position = size_t{0};
+  const auto available = [&](const size_t bytes) { return position + bytes <= _buffer.size(); };
+
+  if (!_binary_header_read) {
+    if (!available(BINARY_HEADER_SIZE)) {
+      return;
+    }
+    AssertInput(std::string_view{_buffer}.substr(0, BINARY_SIGNATURE.size()) == BINARY_SIGNATURE,
+                "Invalid signature of binary COPY data");
+    const auto extension_length = read_big_endian<uint32_t>(_buffer.data() + BINARY_SIGNATURE.size() + 4);
+    if (!available(BINARY_HEADER_SIZE + extension_length)) {
+      return;
+    }
+    position = BINARY_HEADER_SIZE + extension_length;
+    _binary_header_read = true;
+  }
+
+  const auto column_count = _column_builders.size();
+  while (available(sizeof(int16_t))) {
+    const auto field_count = read_big_endian<int16_t>(_buffer.data() + position);
+    if (field_count == -1) {
+      position += sizeof(int16_t);
+      _end_of_data = true;
+      break;
+    }
+    AssertInput(static_cast<size_t>(field_count) == column_count,
+                "Binary COPY row has " + std::to_string(field_count) + " values, but the table has " +
+                    std::to_string(column_count) + " columns");
+
+    // Only append the values once the row is complete
+    auto row_end = position + sizeof(int16_t);
+    auto row_complete = true;
+    for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+      if (row_end + sizeof(int32_t) > _buffer.size()) {
+        row_complete = false;
+        break;
+      }
+      const auto value_length = read_big_endian<int32_t>(_buffer.data() + row_end);
+      // -1 marks NULL, any other negative length is invalid
+      AssertInput(value_length >= -1, "Invalid value length " + std::to_string(value_length) + " in binary COPY data");
+      row_end += sizeof(int32_t) + std::max(value_length, int32_t{0});
+    }
+    if (!row_complete || row_end > _buffer.size()) {
+      break;
+    }
+
+    position += sizeof(int16_t);
+    for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+      const auto value_length = read_big_endian<int32_t>(_buffer.data() + position);
+      position += sizeof(int32_t);
+      if (value_length == -1) {
+        _column_builders[column_id]->append_null();
+        continue;
+      }
+      _column_builders[column_id]->append_binary(std::string_view{_buffer}.substr(position, value_length));
+      position += value_length;
+    }
+    _finish_row();
+  }
+
+  _buffer.erase(0, position);
+}
+
+void CopyImporter::_finish_row() {
+  ++_batch_row_count;
+  ++_row_count;
+  if (_batch_row_count == _table->target_chunk_size()) {
+    _insert_batch();
+  }
+}
+
+void CopyImporter::_insert_batch() {
+  if (_batch_row_count == 0) {
+    return;
+  }
+
+  auto segments = Segments{};
+  for (const auto& column_builder : _column_builders) {
+    segments.emplace_back(column_builder->finish());
+  }
+
+  // The Insert operator copies the ValueSegments of the batch into the table and takes care of the MVCC data
+  const auto batch_table = std::make_shared<Table>(_table->column_definitions(), TableType::Data,
+                                                   _table->target_chunk_size(), UseMvcc::No);
+  batch_table->append_chunk(segments);
+  _batch_row_count = ChunkOffset{0};
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(batch_table);
+  table_wrapper->execute();
+
+  const auto insert = std::make_shared<Insert>(_table_name, table_wrapper);
+  insert->set_transaction_context(_transaction_context);
+  insert->execute();
+
+  // Like a failed INSERT statement (see OperatorTask::_on_execute), a failed batch aborts the transaction
+  if (insert->execute_failed()) {
+    _transaction_context->rollback(RollbackReason::Conflict);
+    FailInput("COPY into '" + _table_name + "' failed because of a key violation or a conflicting transaction");
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "server_types.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+enum class CopyDirection { FromStdin, ToStdout };
+
+// COPY statements that transfer data over the client connection. Our SQL parser only supports COPY with files, so
+// these statements are recognized by the server itself.
+struct CopyStatement {
+  CopyDirection direction;
+  CopyFormat format;
+
+  // Target table of COPY ... FROM STDIN
+  std::string table_name;
+
+  // Query of COPY ... TO STDOUT. `COPY table TO STDOUT` is handled as `SELECT * FROM table`.
+  std::string query;
+};
+
+// Returns std::nullopt if the query is not a COPY FROM STDIN or COPY TO STDOUT statement. Supported are
+// `COPY table FROM STDIN`, `COPY { table | (query) } TO STDOUT`, each optionally followed by `[WITH] (FORMAT format)`
+// or `[WITH] format` with format being one of text, csv, and binary.
+std::optional<CopyStatement> parse_copy_statement(const std::string& query);
+
+class BaseCopyColumnBuilder;
+
+/**
+ * Imports the data of COPY ... FROM STDIN into a table. The data is sent in CopyData messages whose boundaries do not
+ * have to match row boundaries. Incomplete rows are kept until the next message arrives.
+ *
+ * The values are converted directly into ValueSegments. Whenever the rows of a full chunk are parsed, they are
+ * inserted into the table within the given transaction. Thus, the import is only visible after the transaction is
+ * committed and can be rolled back as a whole. If a batch violates a key or conflicts with another transaction, the
+ * transaction is rolled back and an InvalidInputException is thrown.
+ *
+ * Text format: columns are separated by tabs, rows by newlines, NULL is written as \N, and backslash escapes are used
+ * for special characters. CSV format: columns are separated by commas, values may be quoted with double quotes, and
+ * NULL is an unquoted empty value. Binary format: PostgreSQL's binary COPY format with big-endian int4, int8, float4,
+ * float8, and text values.
+ */
+class CopyImporter {
+ public:
+  CopyImporter(const std::string& table_name, const CopyFormat format,
+               const std::shared_ptr<TransactionContext>& transaction_context);
+  ~CopyImporter();
+
+  // Parses the data of a CopyData message
+  void consume(const std::string& data);
+
+  // Inserts the remaining rows after the CopyDone message. Returns the number of imported rows.
+  uint64_t finish();
+
+  ColumnCount column_count() const;
+
+ private:
+  // Each of these methods appends all complete rows in `_buffer` to the column builders and removes them from
+  // `_buffer`. A row without a line break is only considered complete at the end of the data.
+  void _parse_text_rows(const bool end_of_data);
+  void _parse_csv_rows(const bool end_of_data);
+  void _parse_binary_rows();
+
+  void _append_text_row(std::string_view row);
+  void _append_csv_row(std::string_view row);
+
+  // Counts the row and inserts the batch if the chunk size is reached
+  void _finish_row();
+  void _insert_batch();
+
+  const std::string _table_name;
+  const std::shared_ptr<Table> _table;
+  const CopyFormat _format;
+  const std::shared_ptr<TransactionContext> _transaction_context;
+
+  std::vector<std::unique_ptr<BaseCopyColumnBuilder>> _column_builders;
+  ChunkOffset _batch_row_count{0};
+  uint64_t _row_count{0};
+
+  std::string _buffer;
+  // Part of the incomplete row at the beginning of `_buffer` that has already been searched for the row's end (text and
+  // CSV format). Thus, a row that spans many CopyData messages is not scanned again for each of them.
+  size_t _scanned_row_size{0};
+  bool _scanned_row_in_quotes{false};
+  bool _binary_header_read{false};
+  // Set after the end-of-data marker (`\.` in text and CSV format, the trailer in binary format)
+  bool _end_of_data{false};
+
+  // Reused for values that need to be unescaped
+  std::string _unescaped_value;
+};
+
+}  // namespace opossum
@@ -6,6 +6,9 @@ namespace opossum {
 // avoid magic numbers.
 static constexpr auto LENGTH_FIELD_SIZE = 4u;
 
+// Special protocol version of the startup packet that clients send to request SSL, which we deny
+static constexpr auto SSL_REQUEST_CODE = 80877103u;
+
 // Documentation of the message types can be found here:
 // https://www.postgresql.org/docs/12/protocol-message-formats.html
 enum class PostgresMessageType : unsigned char {
@@ -22,6 +25,12 @@ enum class PostgresMessageType : unsigned char {
   ReadyForQuery = 'Z',
   RowDescription = 'T',
   DataRow = 'D',
+  CopyInResponse = 'G',
+  CopyOutResponse = 'H',
+
+  // Sent by both sides during COPY
+  CopyData = 'd',
+  CopyDone = 'c',
 
   // Selection of error and notice message fields. All possible fields are documented at:
   // https://www.postgresql.org/docs/12/protocol-error-fields.html
@@ -38,6 +47,7 @@ enum class PostgresMessageType : unsigned char {
   ParseCommand = 'P',
   SimpleQueryCommand = 'Q',
   CloseCommand = 'C',
+  CopyFailCommand = 'f',
 
   // SSL willingness
   SslYes = 'S',
@@ -1,16 +1,50 @@
 #include "postgres_protocol_handler.hpp"
 
+#include <bit>
+
+#include <boost/endian/conversion.hpp>
+
+#include "session_stream.hpp"
+
 namespace opossum {
 
+AllTypeVariant decode_binary_parameter(const AllTypeVariant& raw_parameter, const uint32_t object_id) {
+  if (variant_is_null(raw_parameter)) {
+    return raw_parameter;
+  }
+
+  const auto& bytes = boost::get<pmr_string>(raw_parameter);
+  const auto read_big_endian = [&](auto value) {
+    AssertInput(bytes.size() == sizeof(value), "Invalid length of binary parameter");
+    std::copy_n(bytes.data(), sizeof(value), reinterpret_cast<char*>(&value));
+    return boost::endian::big_to_native(value);
+  };
+
+  // See ResultSerializer::send_table_description for the object ids
+  switch (object_id) {
+    case 23:
+      return read_big_endian(int32_t{});
+    case 20:
+      return read_big_endian(int64_t{});
+    case 700:
+      return std::bit_cast<float>(read_big_endian(uint32_t{}));
+    case 701:
+      return std::bit_cast<double>(read_big_endian(uint64_t{}));
+    case 25:
+    case 1043:
+      // text and varchar are sent as their characters in both formats
+      return raw_parameter;
+    default:
+      FailInput("Binary parameters require their data type (int4, int8, float4, float8, text) to be specified");
+  }
+}
+
 template <typename SocketType>
 PostgresProtocolHandler<SocketType>::PostgresProtocolHandler(const std::shared_ptr<SocketType>& socket)
     : _read_buffer(socket), _write_buffer(socket) {}
 
 template <typename SocketType>
 uint32_t PostgresProtocolHandler<SocketType>::read_startup_packet_header() {
-  // Special SSL version number that we catch to deny SSL support
-  constexpr auto SSL_REQUEST_CODE = 80877103u;
-
   const auto body_length = _read_buffer.template get_value<uint32_t>();
   const auto protocol_version = _read_buffer.template get_value<uint32_t>();
 
@@ -89,7 +123,7 @@ void PostgresProtocolHandler<SocketType>::send_row_description_header(const uint
 
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_row_description(const std::string& column_name, const uint32_t object_id,
-                                                               const int16_t type_width) {
+                                                               const int16_t type_width, const FormatCode format_code) {
   _write_buffer.put_string(column_name);
   // This field contains the table ID (OID in postgres). We have to set it in order to fulfill the protocol
   // specification. We do not know what it's good for.
@@ -99,7 +133,7 @@ void PostgresProtocolHandler<SocketType>::send_row_description(const std::string
   _write_buffer.template put_value<int32_t>(object_id);   // Object id of type
   _write_buffer.template put_value<int16_t>(type_width);  // Data type size
   _write_buffer.template put_value<int32_t>(-1);          // No modifier
-  _write_buffer.template put_value<int16_t>(0u);          // Text format
+  _write_buffer.template put_value<int16_t>(static_cast<int16_t>(format_code));
 }
 
 template <typename SocketType>
@@ -132,6 +166,11 @@ void PostgresProtocolHandler<SocketType>::send_data_row(
   }
 }
 
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_data_rows(const std::string& serialized_data_rows) {
+  _write_buffer.put_string(serialized_data_rows, HasNullTerminator::No);
+}
+
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_command_complete(const std::string& command_complete_message) {
   const auto packet_size = LENGTH_FIELD_SIZE + command_complete_message.size() + 1u /* null terminator */;
@@ -141,22 +180,24 @@ void PostgresProtocolHandler<SocketType>::send_command_complete(const std::strin
 }
 
 template <typename SocketType>
-std::pair<std::string, std::string> PostgresProtocolHandler<SocketType>::read_parse_packet() {
+std::tuple<std::string, std::string, std::vector<uint32_t>> PostgresProtocolHandler<SocketType>::read_parse_packet() {
   _read_buffer.template get_value<uint32_t>();  // Ignore packet size
 
   const std::string statement_name = _read_buffer.get_string();
   const std::string query = _read_buffer.get_string();
 
-  // The number of parameter data types specified (can be zero). These data types are ignored currently.
+  // The number of parameter data types specified (can be zero). These data types are only needed to decode parameters
+  // that are sent in binary format.
   const auto data_types_specified = _read_buffer.template get_value<uint16_t>();
 
+  auto parameter_object_ids = std::vector<uint32_t>(data_types_specified);
   for (auto i = 0; i < data_types_specified; i++) {
     // Specifies the object ID of the parameter data type.
     // Placing a zero here is equivalent to leaving the type unspecified.
-    /*auto data_type = */ _read_buffer.template get_value<int32_t>();
+    parameter_object_ids[i] = _read_buffer.template get_value<uint32_t>();
   }
 
-  return {statement_name, query};
+  return {statement_name, query, parameter_object_ids};
 }
 
 template <typename SocketType>
@@ -191,27 +232,49 @@ PreparedStatementDetails PostgresProtocolHandler<SocketType>::read_bind_packet()
   _read_buffer.template get_value<uint32_t>();
   const auto portal = _read_buffer.get_string();
   const auto statement_name = _read_buffer.get_string();
-  const auto num_format_codes = _read_buffer.template get_value<int16_t>();
+  const auto read_format_codes = [&]() {
+    const auto num_format_codes = _read_buffer.template get_value<int16_t>();
+    AssertInput(num_format_codes >= 0, "Invalid number of format codes " + std::to_string(num_format_codes));
+    auto format_codes = std::vector<FormatCode>(num_format_codes);
+    for (auto i = 0; i < num_format_codes; i++) {
+      const auto format_code = _read_buffer.template get_value<int16_t>();
+      AssertInput(format_code == 0 || format_code == 1, "Unknown format code " + std::to_string(format_code));
+      format_codes[i] = static_cast<FormatCode>(format_code);
+    }
+    return format_codes;
+  };
 
-  for (auto i = 0; i < num_format_codes; i++) {
-    Assert(_read_buffer.template get_value<int16_t>() == 0, "Assuming all parameters to be in text format (0)");
-  }
+  const auto format_codes = read_format_codes();
 
   const auto num_parameter_values = _read_buffer.template get_value<int16_t>();
+  AssertInput(num_parameter_values >= 0, "Invalid number of parameters " + std::to_string(num_parameter_values));
+
+  // Zero format codes mean that all parameters are in text format, one format code applies to all parameters
+  AssertInput(format_codes.size() <= 1 || format_codes.size() == static_cast<size_t>(num_parameter_values),
+              "Number of parameter format codes does not match the number of parameters");
+  auto parameter_format_codes = std::vector<FormatCode>(num_parameter_values, FormatCode::Text);
+  for (auto i = 0; i < num_parameter_values; ++i) {
+    if (!format_codes.empty()) {
+      parameter_format_codes[i] = format_codes.size() == 1 ? format_codes.front() : format_codes[i];
+    }
+  }
 
   std::vector<AllTypeVariant> parameter_values;
   for (auto i = 0; i < num_parameter_values; ++i) {
     const auto parameter_value_length = _read_buffer.template get_value<int32_t>();
+    if (parameter_value_length == -1) {
+      // NULL values are represented by a length of -1
+      parameter_values.emplace_back(NULL_VALUE);
+      continue;
+    }
+    AssertInput(parameter_value_length >= 0,
+                "Invalid length of parameter value " + std::to_string(parameter_value_length));
     parameter_values.emplace_back(pmr_string{_read_buffer.get_string(parameter_value_length, HasNullTerminator::No)});
   }
 
-  const auto num_result_column_format_codes = _read_buffer.template get_value<int16_t>();
+  auto result_format_codes = read_format_codes();
 
-  for (auto i = 0; i < num_result_column_format_codes; i++) {
-    Assert(_read_buffer.template get_value<int16_t>() == 0, "Assuming all result columns to be in text format (0)");
-  }
-
-  return {statement_name, portal, parameter_values};
+  return {statement_name, portal, parameter_values, parameter_format_codes, result_format_codes};
 }
 
 template <typename SocketType>
@@ -227,6 +290,54 @@ std::string PostgresProtocolHandler<SocketType>::read_execute_packet() {
   return portal;
 }
 
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_copy_response(const PostgresMessageType message_type,
+                                                             const CopyFormat format, const uint16_t column_count) {
+  // The documentation of the fields in this message can be found at:
+  // https://www.postgresql.org/docs/12/static/protocol-message-formats.html
+  const auto format_code = format == CopyFormat::Binary ? FormatCode::Binary : FormatCode::Text;
+  const auto packet_size = LENGTH_FIELD_SIZE + sizeof(int8_t) + sizeof(uint16_t) + column_count * sizeof(int16_t);
+
+  _write_buffer.template put_value(message_type);
+  _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(packet_size));
+  // Overall format of the data stream followed by the format of each column, which must be the same in text mode
+  _write_buffer.template put_value(static_cast<int8_t>(format_code));
+  _write_buffer.template put_value<uint16_t>(column_count);
+  for (auto column_id = uint16_t{0}; column_id < column_count; ++column_id) {
+    _write_buffer.template put_value<int16_t>(static_cast<int16_t>(format_code));
+  }
+
+  // The client has to know that it may start sending data
+  _write_buffer.flush();
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_copy_data(const std::string& data) {
+  _write_buffer.template put_value(PostgresMessageType::CopyData);
+  _write_buffer.template put_value<uint32_t>(static_cast<uint32_t>(LENGTH_FIELD_SIZE + data.size()));
+  _write_buffer.put_string(data, HasNullTerminator::No);
+}
+
+template <typename SocketType>
+std::string PostgresProtocolHandler<SocketType>::read_copy_data_packet() {
+  const auto packet_size = _read_buffer.template get_value<uint32_t>();
+  AssertInput(packet_size >= LENGTH_FIELD_SIZE, "Invalid CopyData message length " + std::to_string(packet_size));
+  return _read_buffer.get_string(packet_size - LENGTH_FIELD_SIZE, HasNullTerminator::No);
+}
+
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::read_copy_done_packet() {
+  // This packet has no body. Hence, only read and ignore its size.
+  _read_buffer.template get_value<uint32_t>();
+}
+
+template <typename SocketType>
+std::string PostgresProtocolHandler<SocketType>::read_copy_fail_packet() {
+  const auto packet_size = _read_buffer.template get_value<uint32_t>();
+  AssertInput(packet_size >= LENGTH_FIELD_SIZE, "Invalid CopyFail message length " + std::to_string(packet_size));
+  return _read_buffer.get_string(packet_size - LENGTH_FIELD_SIZE);
+}
+
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_error_message(const ErrorMessage& error_message) {
   _write_buffer.template put_value(PostgresMessageType::ErrorResponse);
@@ -272,7 +383,7 @@ void PostgresProtocolHandler<SocketType>::_ssl_deny() {
   _write_buffer.flush();
 }
 
-template class PostgresProtocolHandler<Socket>;
+template class PostgresProtocolHandler<SessionStream>;
 // For testing purposes only. stream_descriptor is used to write data to file
 template class PostgresProtocolHandler<boost::asio::posix::stream_descriptor>;
 
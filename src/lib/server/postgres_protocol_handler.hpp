@@ -1,5 +1,6 @@
 #pragma once
 
+#include <tuple>
 #include <unordered_map>
 
 #include "all_type_variant.hpp"
@@ -15,9 +16,17 @@ using ErrorMessage = std::unordered_map<PostgresMessageType, std::string>;
 struct PreparedStatementDetails {
   std::string statement_name;
   std::string portal;
+  // Parameters in binary format are stored as their raw bytes, as their data type is only known from the Parse message.
+  // Use decode_binary_parameter() to convert them.
   std::vector<AllTypeVariant> parameters;
+  std::vector<FormatCode> parameter_format_codes{};
+  // As sent by the client: empty (all columns in text format), one format for all columns, or one format per column
+  std::vector<FormatCode> result_format_codes{};
 };
 
+// Converts a parameter that was sent in binary format to a value of the type denoted by the PostgreSQL object id
+AllTypeVariant decode_binary_parameter(const AllTypeVariant& raw_parameter, const uint32_t object_id);
+
 // This class extracts information from client messages and serializes the response data according to the PostgreSQL
 // Wire Protocol.
 template <typename SocketType>
@@ -44,13 +53,17 @@ class PostgresProtocolHandler {
 
   // Send query result
   void send_row_description_header(const uint32_t total_column_name_length, const uint16_t column_count);
-  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width);
+  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width,
+                            const FormatCode format_code = FormatCode::Text);
   void send_data_row(const std::vector<std::optional<std::string>>& values_as_strings,
                      const uint32_t string_length_sum);
+  // Send a sequence of DataRow messages that were already serialized, see ResultSerializer
+  void send_data_rows(const std::string& serialized_data_rows);
   void send_command_complete(const std::string& command_complete_message);
 
-  // Messages for parsing prepared statements
-  std::pair<std::string, std::string> read_parse_packet();
+  // Messages for parsing prepared statements. Returns the statement name, the query, and the object ids of the
+  // parameter data types (0 if not specified by the client).
+  std::tuple<std::string, std::string, std::vector<uint32_t>> read_parse_packet();
   void read_sync_packet();
 
   // Send out status message containing PostgresMessageType and length
@@ -61,12 +74,26 @@ class PostgresProtocolHandler {
   PreparedStatementDetails read_bind_packet();
   std::string read_execute_packet();
 
+  // COPY sub-protocol. The CopyInResponse and CopyOutResponse messages announce the format of the data stream.
+  void send_copy_response(const PostgresMessageType message_type, const CopyFormat format,
+                          const uint16_t column_count);
+  void send_copy_data(const std::string& data);
+  std::string read_copy_data_packet();
+  void read_copy_done_packet();
+  // Returns the error message of the client
+  std::string read_copy_fail_packet();
+
   // Send error message to client if there is an error during parsing or execution
   void send_error_message(const ErrorMessage& error_message);
 
   // Additional (optional) message containing execution times of different components (such as translator or optimizer)
   void send_execution_info(const std::string& execution_information);
 
+  // Indicate whether messages have already been received from the socket but not been read yet
+  bool has_buffered_data() const {
+    return _read_buffer.size() > 0;
+  }
+
   // This method is required for testing. Otherwise we cannot make the protocol handler flush its data.
   void force_flush() {
     _write_buffer.flush();
@@ -1,13 +1,245 @@
 #include "result_serializer.hpp"
-#include "lossy_cast.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <limits>
+
+#include <boost/endian/conversion.hpp>
+
+#include "hyrise.hpp"
 #include "query_handler.hpp"
+#include "session_stream.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Resolves the format codes of the Bind message to one format code per column
+std::vector<FormatCode> resolve_format_codes(const std::vector<FormatCode>& format_codes,
+                                             const ColumnCount column_count) {
+  if (format_codes.empty()) {
+    return std::vector<FormatCode>(column_count, FormatCode::Text);
+  }
+  if (format_codes.size() == 1) {
+    return std::vector<FormatCode>(column_count, format_codes.front());
+  }
+  AssertInput(format_codes.size() == column_count, "Number of result format codes does not match the column count");
+  return format_codes;
+}
+
+template <typename T>
+void append_big_endian(std::string& buffer, T value) {
+  boost::endian::native_to_big_inplace(value);
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+// Appends the value to the buffer and returns the number of bytes written
+template <typename T>
+int32_t append_value(std::string& buffer, const T& value, const FormatCode format_code) {
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    // Strings are sent as their characters in both formats
+    buffer.append(value.data(), value.size());
+    return static_cast<int32_t>(value.size());
+  } else {
+    if (format_code == FormatCode::Binary) {
+      // Binary format uses network byte order, floating point values are sent as their IEEE 754 representation
+      if constexpr (std::is_same_v<T, float>) {
+        append_big_endian(buffer, std::bit_cast<uint32_t>(value));
+      } else if constexpr (std::is_same_v<T, double>) {
+        append_big_endian(buffer, std::bit_cast<uint64_t>(value));
+      } else {
+        append_big_endian(buffer, value);
+      }
+      return static_cast<int32_t>(sizeof(T));
+    }
+
+    // Text format. Floating point values use the same precision as boost::lexical_cast, which was used before.
+    auto characters = std::array<char, 32>{};
+    auto result = std::to_chars_result{};
+    if constexpr (std::is_floating_point_v<T>) {
+      result = std::to_chars(characters.data(), characters.data() + characters.size(), value,
+                             std::chars_format::general, std::numeric_limits<T>::max_digits10);
+    } else {
+      result = std::to_chars(characters.data(), characters.data() + characters.size(), value);
+    }
+    DebugAssert(result.ec == std::errc{}, "Could not convert value to string");
+    const auto length = static_cast<int32_t>(result.ptr - characters.data());
+    buffer.append(characters.data(), length);
+    return length;
+  }
+}
+
+// COPY text format: backslash escapes for the backslash itself, the separator, and line breaks
+int32_t append_copy_text_string(std::string& buffer, const pmr_string& value) {
+  const auto size_before = buffer.size();
+  for (const auto character : value) {
+    switch (character) {
+      case '\\':
+        buffer += "\\\\";
+        break;
+      case '\t':
+        buffer += "\\t";
+        break;
+      case '\n':
+        buffer += "\\n";
+        break;
+      case '\r':
+        buffer += "\\r";
+        break;
+      default:
+        buffer += character;
+    }
+  }
+  return static_cast<int32_t>(buffer.size() - size_before);
+}
+
+// CSV format: values containing special characters are quoted. Empty strings are quoted as well to distinguish them
+// from NULL.
+int32_t append_copy_csv_string(std::string& buffer, const pmr_string& value) {
+  if (!value.empty() && value.find_first_of(",\"\n\r") == pmr_string::npos && value != "\\.") {
+    buffer.append(value.data(), value.size());
+    return static_cast<int32_t>(value.size());
+  }
+
+  const auto size_before = buffer.size();
+  buffer += '"';
+  for (const auto character : value) {
+    if (character == '"') {
+      buffer += '"';
+    }
+    buffer += character;
+  }
+  buffer += '"';
+  return static_cast<int32_t>(buffer.size() - size_before);
+}
+
+// The values of a chunk, serialized column by column. The values of a column are stored consecutively, their lengths
+// are stored separately. NULL values have a length of -1, as in the DataRow message.
+struct SerializedColumns {
+  std::vector<std::string> values;
+  std::vector<std::vector<int32_t>> value_lengths;
+  size_t value_length_sum{0};
+};
+
+// append_value_functor(buffer, value, column_id) appends a non-NULL value to the buffer and returns its length
+template <typename AppendValueFunctor>
+SerializedColumns serialize_columns(const Chunk& chunk, const std::vector<DataType>& column_data_types,
+                                    const AppendValueFunctor& append_value_functor) {
+  const auto column_count = chunk.column_count();
+  const auto row_count = chunk.size();
+
+  auto serialized_columns = SerializedColumns{};
+  serialized_columns.values.resize(column_count);
+  serialized_columns.value_lengths.resize(column_count, std::vector<int32_t>(row_count));
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    auto& values = serialized_columns.values[column_id];
+    auto& value_lengths = serialized_columns.value_lengths[column_id];
+
+    resolve_data_type(column_data_types[column_id], [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto chunk_offset = ChunkOffset{0};
+      segment_iterate<ColumnDataType>(*chunk.get_segment(column_id), [&](const auto& position) {
+        if (position.is_null()) {
+          value_lengths[chunk_offset] = -1;
+        } else {
+          value_lengths[chunk_offset] = append_value_functor(values, position.value(), column_id);
+        }
+        ++chunk_offset;
+      });
+    });
+    serialized_columns.value_length_sum += values.size();
+  }
+
+  return serialized_columns;
+}
+
+// Appends length and value of each field of a row, as used by the DataRow message and the binary COPY format
+void append_binary_row(std::string& buffer, const SerializedColumns& serialized_columns, const ChunkOffset chunk_offset,
+                       std::vector<size_t>& value_positions) {
+  const auto column_count = serialized_columns.values.size();
+  for (auto column_id = size_t{0}; column_id < column_count; ++column_id) {
+    const auto value_length = serialized_columns.value_lengths[column_id][chunk_offset];
+    append_big_endian(buffer, value_length);
+    if (value_length > 0) {
+      buffer.append(serialized_columns.values[column_id], value_positions[column_id], value_length);
+      value_positions[column_id] += value_length;
+    }
+  }
+}
+
+// Serializes the chunks of the table and sends them in order. If the scheduler is multi-threaded, batches of chunks
+// are serialized in parallel. While the chunks of one batch are written to the network, the next batch is already
+// being serialized. Serialized chunks are released as soon as they are sent, so that the memory consumption does not
+// depend on the size of the table.
+template <typename SerializeFunctor, typename SendFunctor>
+void serialize_and_send_chunks(const Table& table, const SerializeFunctor& serialize_functor,
+                               const SendFunctor& send_functor) {
+  const auto chunk_count = table.chunk_count();
+  const auto serialize = [&](const ChunkID chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    return chunk ? serialize_functor(*chunk) : std::string{};
+  };
+
+  if (!Hyrise::get().is_multi_threaded() || chunk_count <= 1) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      send_functor(serialize(chunk_id));
+    }
+    return;
+  }
+
+  const auto batch_size = std::max(size_t{1}, size_t{Hyrise::get().topology.num_cpus()});
+  auto serialized_chunks = std::vector<std::string>(chunk_count);
+
+  const auto schedule_batch = [&](const size_t batch_begin) {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    const auto batch_end = std::min(batch_begin + batch_size, size_t{chunk_count});
+    for (auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(batch_begin)}; chunk_id < batch_end; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+        serialized_chunks[chunk_id] = serialize(chunk_id);
+      }));
+    }
+    AbstractScheduler::schedule_tasks(jobs);
+    return jobs;
+  };
+
+  auto jobs = schedule_batch(0);
+  for (auto batch_begin = size_t{0}; batch_begin < chunk_count; batch_begin += batch_size) {
+    AbstractScheduler::wait_for_tasks(jobs);
+
+    const auto batch_end = std::min(batch_begin + batch_size, size_t{chunk_count});
+    jobs = batch_end < chunk_count ? schedule_batch(batch_end) : std::vector<std::shared_ptr<AbstractTask>>{};
+
+    try {
+      for (auto chunk_id = batch_begin; chunk_id < batch_end; ++chunk_id) {
+        send_functor(serialized_chunks[chunk_id]);
+        serialized_chunks[chunk_id] = std::string{};
+      }
+    } catch (...) {
+      // Sending fails if the client disconnected. The jobs of the next batch write into serialized_chunks, so they
+      // have to finish before the stack is unwound.
+      AbstractScheduler::wait_for_tasks(jobs);
+      throw;
+    }
+  }
+}
+
+}  // namespace
 
 namespace opossum {
 
 template <typename SocketType>
 void ResultSerializer::send_table_description(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<FormatCode>& format_codes) {
+  const auto formats = resolve_format_codes(format_codes, table->column_count());
+
   // Calculate sum of length of all column names
   uint32_t column_name_length_sum = 0;
   for (auto& column_name : table->column_names()) {
@@ -48,46 +280,146 @@ void ResultSerializer::send_table_description(
       case DataType::Null:
         Fail("Bad DataType");
     }
-    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width);
+    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width,
+                                                    formats[column_id]);
   }
 }
 
 template <typename SocketType>
 void ResultSerializer::send_query_response(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
-  auto values_as_strings = std::vector<std::optional<std::string>>(table->column_count());
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<FormatCode>& format_codes) {
+  const auto formats = resolve_format_codes(format_codes, table->column_count());
+  const auto column_data_types = table->column_data_types();
 
-  const auto chunk_count = table->chunk_count();
+  serialize_and_send_chunks(
+      *table, [&](const Chunk& chunk) { return serialize_chunk(chunk, column_data_types, formats); },
+      [&](const std::string& serialized_chunk) { postgres_protocol_handler->send_data_rows(serialized_chunk); });
+}
 
-  // Iterate over each chunk in result table
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; chunk_id++) {
-    const auto chunk = table->get_chunk(chunk_id);
-    const auto chunk_size = chunk->size();
+template <typename SocketType>
+void ResultSerializer::send_copy_out_response(
+    const std::shared_ptr<const Table>& table,
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler, const CopyFormat format) {
+  const auto column_data_types = table->column_data_types();
 
-    const auto column_count = table->column_count();
-    auto segments = Segments(column_count);
-    for (auto column_id = ColumnID{0}; column_id < column_count; column_id++) {
-      segments[column_id] = chunk->get_segment(column_id);
+  postgres_protocol_handler->send_copy_response(PostgresMessageType::CopyOutResponse, format,
+                                                static_cast<uint16_t>(table->column_count()));
+  if (format == CopyFormat::Binary) {
+    // Signature, flags field, and length of the header extension area
+    auto header = std::string{"PGCOPY\n\377\r\n\0", 11};
+    append_big_endian(header, uint32_t{0});
+    append_big_endian(header, uint32_t{0});
+    postgres_protocol_handler->send_copy_data(header);
+  }
+
+  serialize_and_send_chunks(
+      *table, [&](const Chunk& chunk) { return serialize_copy_chunk(chunk, column_data_types, format); },
+      [&](const std::string& serialized_chunk) {
+        if (!serialized_chunk.empty()) {
+          postgres_protocol_handler->send_copy_data(serialized_chunk);
+        }
+      });
+
+  if (format == CopyFormat::Binary) {
+    // The trailer is a field count of -1
+    auto trailer = std::string{};
+    append_big_endian(trailer, int16_t{-1});
+    postgres_protocol_handler->send_copy_data(trailer);
+  }
+  postgres_protocol_handler->send_status_message(PostgresMessageType::CopyDone);
+}
+
+std::string ResultSerializer::serialize_chunk(const Chunk& chunk, const std::vector<DataType>& column_data_types,
+                                              const std::vector<FormatCode>& column_format_codes) {
+  const auto append_functor = [&](std::string& buffer, const auto& value, const ColumnID column_id) {
+    return append_value(buffer, value, column_format_codes[column_id]);
+  };
+  const auto serialized_columns = serialize_columns(chunk, column_data_types, append_functor);
+
+  // Assemble the DataRow messages row by row. The documentation of the fields in this message can be found at:
+  // https://www.postgresql.org/docs/12/static/protocol-message-formats.html
+  const auto column_count = chunk.column_count();
+  const auto row_count = chunk.size();
+  const auto row_header_size = sizeof(PostgresMessageType) + LENGTH_FIELD_SIZE + sizeof(uint16_t);
+  auto serialized_rows = std::string{};
+  serialized_rows.reserve(row_count * (row_header_size + column_count * LENGTH_FIELD_SIZE) +
+                          serialized_columns.value_length_sum);
+
+  auto value_positions = std::vector<size_t>(column_count);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    auto packet_size = LENGTH_FIELD_SIZE + sizeof(uint16_t) + column_count * LENGTH_FIELD_SIZE;
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      packet_size += std::max(serialized_columns.value_lengths[column_id][chunk_offset], int32_t{0});
+    }
+
+    serialized_rows += static_cast<char>(PostgresMessageType::DataRow);
+    append_big_endian(serialized_rows, static_cast<uint32_t>(packet_size));
+    append_big_endian(serialized_rows, static_cast<uint16_t>(column_count));
+    append_binary_row(serialized_rows, serialized_columns, chunk_offset, value_positions);
+  }
+
+  return serialized_rows;
+}
+
+std::string ResultSerializer::serialize_copy_chunk(const Chunk& chunk, const std::vector<DataType>& column_data_types,
+                                                   const CopyFormat format) {
+  const auto column_count = chunk.column_count();
+  const auto row_count = chunk.size();
+  auto serialized_rows = std::string{};
+  auto value_positions = std::vector<size_t>(column_count);
+
+  if (format == CopyFormat::Binary) {
+    // Each row consists of the field count followed by length and value of each field, just like a DataRow message
+    const auto serialized_columns =
+        serialize_columns(chunk, column_data_types, [&](std::string& buffer, const auto& value, const ColumnID) {
+          return append_value(buffer, value, FormatCode::Binary);
+        });
+    serialized_rows.reserve(row_count * (sizeof(uint16_t) + column_count * LENGTH_FIELD_SIZE) +
+                            serialized_columns.value_length_sum);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      append_big_endian(serialized_rows, static_cast<uint16_t>(column_count));
+      append_binary_row(serialized_rows, serialized_columns, chunk_offset, value_positions);
     }
+    return serialized_rows;
+  }
 
-    // Iterate over each row in chunk
-    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-      auto string_length_sum = 0;
-      // Iterate over each attribute in row
-      for (auto segment_id = ColumnID{0}; segment_id < column_count; segment_id++) {
-        const auto attribute_value = (*segments[segment_id])[chunk_offset];
-        // The PostgreSQL protocol requires the conversion of values to strings
-        const auto string_value = lossy_variant_cast<pmr_string>(attribute_value);
-        if (string_value.has_value()) {
-          // Sum up string lengths for a row to save an extra loop during serialization
-          string_length_sum += string_value.value().size();
+  // Text and CSV format: one line per row, the values are separated by tabs or commas
+  const auto serialized_columns =
+      serialize_columns(chunk, column_data_types, [&](std::string& buffer, const auto& value, const ColumnID) {
+        using ValueType = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<ValueType, pmr_string>) {
+          return format == CopyFormat::CSV ? append_copy_csv_string(buffer, value)
+                                           : append_copy_text_string(buffer, value);
+        } else {
+          return append_value(buffer, value, FormatCode::Text);
         }
-        values_as_strings[segment_id] = string_value;
+      });
+
+  const auto separator = format == CopyFormat::CSV ? ',' : '\t';
+  // NULL is written as \N in text format and as an unquoted empty value in CSV format
+  const auto null_string = format == CopyFormat::CSV ? std::string_view{} : std::string_view{"\\N"};
+  serialized_rows.reserve(row_count * column_count * (1 + null_string.size()) + serialized_columns.value_length_sum);
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      if (column_id > 0) {
+        serialized_rows += separator;
       }
-      postgres_protocol_handler->send_data_row(values_as_strings, string_length_sum);
+
+      const auto value_length = serialized_columns.value_lengths[column_id][chunk_offset];
+      if (value_length == -1) {
+        serialized_rows += null_string;
+        continue;
+      }
+      serialized_rows.append(serialized_columns.values[column_id], value_positions[column_id], value_length);
+      value_positions[column_id] += value_length;
     }
+    serialized_rows += '\n';
   }
+
+  return serialized_rows;
 }
 
 std::string ResultSerializer::build_command_complete_message(const ExecutionInformation& execution_information,
@@ -122,18 +454,30 @@ std::string ResultSerializer::build_command_complete_message(const OperatorType
   }
 }
 
-template void ResultSerializer::send_table_description<Socket>(const std::shared_ptr<const Table>&,
-                                                               const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+template void ResultSerializer::send_table_description<SessionStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<SessionStream>>&,
+    const std::vector<FormatCode>&);
 
 template void ResultSerializer::send_table_description<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
-    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<FormatCode>&);
 
-template void ResultSerializer::send_query_response<Socket>(const std::shared_ptr<const Table>&,
-                                                            const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+template void ResultSerializer::send_query_response<SessionStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<SessionStream>>&,
+    const std::vector<FormatCode>&);
 
 template void ResultSerializer::send_query_response<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
-    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<FormatCode>&);
+
+template void ResultSerializer::send_copy_out_response<SessionStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<SessionStream>>&,
+    const CopyFormat);
+
+template void ResultSerializer::send_copy_out_response<boost::asio::posix::stream_descriptor>(
+    const std::shared_ptr<const Table>&,
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&, const CopyFormat);
 
 }  // namespace opossum
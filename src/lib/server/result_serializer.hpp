@@ -1,6 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <vector>
+
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
 #include "storage/table.hpp"
@@ -10,19 +13,39 @@ namespace opossum {
 struct ExecutionInformation;
 
 // The ResultSerializer serializes the result data returned by Hyrise according to PostgreSQL Wire Protocol.
+// The format_codes are those requested by the client in the Bind message: empty (all columns in text format), one
+// format for all columns, or one format per column.
 class ResultSerializer {
  public:
   // Serialize information about the result table
   template <typename SocketType>
   static void send_table_description(
       const std::shared_ptr<const Table>& table,
-      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<FormatCode>& format_codes = {});
 
+  // Serialize the rows of the result table chunk by chunk and send them. If the scheduler is multi-threaded, the next
+  // chunks are serialized in parallel while the current one is sent.
   template <typename SocketType>
-  // Cast attributes of the result table and send them row-wise
   static void send_query_response(
       const std::shared_ptr<const Table>& table,
-      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<FormatCode>& format_codes = {});
+
+  // Send the rows of the table for COPY ... TO STDOUT: CopyOutResponse, the data in CopyData messages, and CopyDone.
+  // As for query responses, the chunks are serialized in parallel if the scheduler is multi-threaded.
+  template <typename SocketType>
+  static void send_copy_out_response(
+      const std::shared_ptr<const Table>& table,
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler, const CopyFormat format);
+
+  // Serialize all rows of a chunk as DataRow messages. Each column is converted with a typed loop over its segment.
+  static std::string serialize_chunk(const Chunk& chunk, const std::vector<DataType>& column_data_types,
+                                     const std::vector<FormatCode>& column_format_codes);
+
+  // Serialize all rows of a chunk in the given COPY format. Header and trailer of the binary format are not included.
+  static std::string serialize_copy_chunk(const Chunk& chunk, const std::vector<DataType>& column_data_types,
+                                          const CopyFormat format);
 
   // Build completion message after query execution containing the statement type and the number of rows affected
   static std::string build_command_complete_message(const ExecutionInformation& execution_information,
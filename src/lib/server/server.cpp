@@ -4,6 +4,7 @@
 
 #include <iostream>
 #include <thread>
+#include <vector>
 
 #include "hyrise.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
@@ -12,8 +13,13 @@ namespace opossum {
 
 // Specified port (default: 5432) will be opened after initializing the _acceptor
 Server::Server(const boost::asio::ip::address& address, const uint16_t port,
-               const SendExecutionInfo send_execution_info)
-    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(address, port)), _send_execution_info(send_execution_info) {
+               const SendExecutionInfo send_execution_info, const SessionMode session_mode,
+               const uint32_t io_thread_count)
+    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(address, port)),
+      _send_execution_info(send_execution_info),
+      _session_mode(session_mode),
+      _io_thread_count(io_thread_count) {
+  Assert(_io_thread_count > 0, "Server requires at least one I/O thread");
   std::cout << "Server started at " << server_address() << " and port " << server_port() << std::endl
             << "Run 'psql -h localhost " << server_address() << "' to connect to the server" << std::endl;
 }
@@ -30,14 +36,27 @@ void Server::run() {
 
   _is_initialized = true;
   _accept_new_session();
+
+  // Threaded sessions do not use the io_service after the connection is accepted, so additional threads would idle.
+  auto io_threads = std::vector<std::thread>{};
+  if (_session_mode == SessionMode::Async) {
+    for (auto thread_id = uint32_t{1}; thread_id < _io_thread_count; ++thread_id) {
+      io_threads.emplace_back([&]() { _io_service.run(); });
+    }
+  }
+
   _io_service.run();
+
+  for (auto& io_thread : io_threads) {
+    io_thread.join();
+  }
 }
 
 void Server::_accept_new_session() {
   // Create a new session. This will also open a new data socket in order to communicate with the client
   // For more information on TCP ports + Asio see:
   // https://www.gamedev.net/forums/topic/586557-boostasio-allowing-multiple-connections-to-a-single-server-socket/
-  auto new_session = std::make_shared<Session>(_io_service, _send_execution_info);
+  auto new_session = std::make_shared<Session>(_io_service, _send_execution_info, _session_mode);
   _acceptor.async_accept(*(new_session->socket()),
                          boost::bind(&Server::_start_session, this, new_session, boost::asio::placeholders::error));
 }
@@ -45,6 +64,15 @@ void Server::_accept_new_session() {
 void Server::_start_session(const std::shared_ptr<Session>& new_session, const boost::system::error_code& error) {
   Assert(!error, error.message());
 
+  if (_session_mode == SessionMode::Async) {
+    // The session is kept alive by its pending handlers and jobs. It is destroyed once the client terminates the
+    // connection, which reduces the number of running sessions (see Session::~Session).
+    ++_num_running_sessions;
+    new_session->start_async([&num_running_sessions = _num_running_sessions]() { --num_running_sessions; });
+    _accept_new_session();
+    return;
+  }
+
   std::thread session_thread([session = new_session, &num_running_sessions = this->_num_running_sessions]() mutable {
     const std::string thread_name = "server_p_" + std::to_string(session->socket()->remote_endpoint().port());
 #ifdef __APPLE__
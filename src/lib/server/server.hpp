@@ -10,12 +10,15 @@ namespace opossum {
 
 /* In the following a short description of the classes used for the server implementation.
 
-*  Server - Opens and binds a server socket. Starts a new session per client.
+*  Server - Opens and binds a server socket. Starts a new session per client. Sessions either run on a thread each or
+*           are event-driven, see SessionMode.
 *  Session - Creates a data socket for client server communication. It is responsible for the message flow and holds
 *            session-specific data.
 *  PostgresProtocolHandler - This class operates on the message level. It serializes and de-serializes information from
 *                            messages.
 *  PostgresMessageTypes - Set of different message types supported by Hyrise.
+*  SessionStream - Stream used by the PostgresProtocolHandler. Either blocks on the socket or, for asynchronous
+*                  sessions, holds the messages received and the responses to be sent by the I/O threads.
 *  ReadBuffer - Dedicated ring buffer for reading information from the network socket. Also does network to host byte
 *               conversion for integer types.
 *  WriteBuffer - Dedicated ring buffer for writing information to the network socket. Does host to network byte
@@ -29,7 +32,10 @@ namespace opossum {
 
 class Server {
  public:
-  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info);
+  // In SessionMode::Async, io_thread_count threads (including the one calling run()) receive requests, dispatch them to
+  // the scheduler, and send the responses. A small number of threads is sufficient as they do not execute queries.
+  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info,
+         const SessionMode session_mode = SessionMode::Threaded, const uint32_t io_thread_count = 1);
 
   // Start server to accept new sessions.
   void run();
@@ -55,6 +61,8 @@ class Server {
   boost::asio::io_service _io_service;
   boost::asio::ip::tcp::acceptor _acceptor;
   const SendExecutionInfo _send_execution_info;
+  const SessionMode _session_mode;
+  const uint32_t _io_thread_count;
   std::atomic_bool _is_initialized{false};
 };
 }  // namespace opossum
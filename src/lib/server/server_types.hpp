@@ -10,4 +10,17 @@ enum class HasNullTerminator : bool { Yes = true, No = false };
 
 enum class SendExecutionInfo : bool { Yes = true, No = false };
 
+// Threaded: each session runs on its own thread and blocks on socket reads.
+// Async: requests are received and responses are sent asynchronously on the server's I/O threads. Once a request has
+//        arrived completely, it is handled by a job on the scheduler's workers.
+enum class SessionMode { Threaded, Async };
+
+// Format of parameter and result values. For further documentation see here:
+// https://www.postgresql.org/docs/12/protocol-overview.html#PROTOCOL-FORMAT-CODES
+enum class FormatCode : int16_t { Text = 0, Binary = 1 };
+
+// Data formats of COPY FROM STDIN and COPY TO STDOUT. For further documentation see here:
+// https://www.postgresql.org/docs/12/sql-copy.html#id-1.9.3.55.9
+enum class CopyFormat { Text, CSV, Binary };
+
 }  // namespace opossum
@@ -1,45 +1,187 @@
 #include "session.hpp"
 
+#include <algorithm>
+#include <utility>
+
+#include <boost/endian/conversion.hpp>
+
 #include "client_disconnect_exception.hpp"
+#include "copy_handler.hpp"
 #include "postgres_message_type.hpp"
 #include "query_handler.hpp"
 #include "result_serializer.hpp"
+#include "scheduler/job_task.hpp"
+
+namespace {
+
+// Read a big-endian integer, such as the length field of a message, from data that has been received
+uint32_t read_uint32(const std::string& data, const size_t offset) {
+  auto value = uint32_t{0};
+  std::copy_n(data.data() + offset, sizeof(value), reinterpret_cast<char*>(&value));
+  return boost::endian::big_to_native(value);
+}
+
+}  // namespace
 
 namespace opossum {
 
-Session::Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info)
+Session::Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info,
+                 const SessionMode session_mode)
     : _socket(std::make_shared<Socket>(io_service)),
-      _postgres_protocol_handler(std::make_shared<PostgresProtocolHandler<Socket>>(_socket)),
-      _send_execution_info(send_execution_info) {}
+      _stream(std::make_shared<SessionStream>(_socket, session_mode)),
+      _postgres_protocol_handler(std::make_shared<PostgresProtocolHandler<SessionStream>>(_stream)),
+      _send_execution_info(send_execution_info),
+      _session_mode(session_mode) {}
+
+Session::~Session() {
+  // The client disconnected during COPY ... FROM STDIN
+  if (_copy_transaction_context && _copy_transaction_context->phase() == TransactionPhase::Active) {
+    _copy_transaction_context->rollback(RollbackReason::User);
+  }
+
+  if (_on_termination) {
+    // Close the connection before notifying the server. Afterwards, the server might shut down and destroy the
+    // io_service that the socket belongs to.
+    _postgres_protocol_handler.reset();
+    _stream.reset();
+    _socket.reset();
+    _on_termination();
+  }
+}
 
 std::shared_ptr<Socket> Session::socket() {
   return _socket;
 }
 
 void Session::run() {
+  Assert(_session_mode == SessionMode::Threaded, "Asynchronous sessions have to be started with start_async()");
   // Set TCP_NODELAY in order to disable Nagle's algorithm. It handles congestion control in TCP networks. Therefore,
   // small packets are buffered and sent out later as one large packet. This might introduce a delay of up to 40 ms
   // which we have to avoid. Further reading: https://howdoesinternetwork.com/2015/nagles-algorithm
   _socket->set_option(boost::asio::ip::tcp::no_delay(true));
   _establish_connection();
   while (!_terminate_session) {
-    try {
-      _handle_request();
-    } catch (const ClientDisconnectException&) {
-      return;
-    } catch (const std::exception& e) {
-      std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":" << std::endl
-                << e.what() << std::endl;
-      const auto error_message = ErrorMessage{{PostgresMessageType::HumanReadableError, e.what()}};
-      _postgres_protocol_handler->send_error_message(error_message);
-      _postgres_protocol_handler->send_ready_for_query();
-      // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
-      // Messages that have already been received are processed further. A "sync" message makes the server send another
-      // "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as a new
-      // query arrives it must be set to false again to ensure correct message flow.
-      _sync_send_after_error = true;
+    _handle_request_safely();
+  }
+}
+
+void Session::start_async(const std::function<void()>& on_termination) {
+  Assert(_session_mode == SessionMode::Async, "Threaded sessions have to be started with run()");
+  _on_termination = on_termination;
+  // See run()
+  _socket->set_option(boost::asio::ip::tcp::no_delay(true));
+  _receive_requests();
+}
+
+void Session::_handle_request_safely() {
+  try {
+    _handle_request();
+  } catch (const ClientDisconnectException&) {
+    _terminate_session = true;
+  } catch (const std::exception& e) {
+    std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":" << std::endl
+              << e.what() << std::endl;
+    const auto error_message = ErrorMessage{{PostgresMessageType::HumanReadableError, e.what()}};
+    _postgres_protocol_handler->send_error_message(error_message);
+    _postgres_protocol_handler->send_ready_for_query();
+    // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
+    // Messages that have already been received are processed further. A "sync" message makes the server send another
+    // "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as a new
+    // query arrives it must be set to false again to ensure correct message flow.
+    _sync_send_after_error = true;
+  }
+}
+
+void Session::_receive_requests() {
+  // Before the connection is established, clients may ask for SSL. The request is denied right away, as it has to be
+  // answered before the client continues with the actual startup packet.
+  constexpr auto SSL_REQUEST_SIZE = 2 * LENGTH_FIELD_SIZE;
+  if (!_connection_established && _received_data.size() >= SSL_REQUEST_SIZE &&
+      read_uint32(_received_data, 0) == SSL_REQUEST_SIZE &&
+      read_uint32(_received_data, LENGTH_FIELD_SIZE) == SSL_REQUEST_CODE) {
+    _received_data.erase(0, SSL_REQUEST_SIZE);
+    static constexpr auto SSL_DENY = PostgresMessageType::SslNo;
+    boost::asio::async_write(*_socket, boost::asio::buffer(&SSL_DENY, sizeof(SSL_DENY)),
+                             [session = shared_from_this()](const boost::system::error_code& error, size_t) {
+                               if (!error) {
+                                 session->_receive_requests();
+                               }
+                             });
+    return;
+  }
+
+  const auto complete_messages_size = _complete_messages_size();
+  if (complete_messages_size > 0) {
+    _stream->append_received_data(_received_data.data(), complete_messages_size);
+    _received_data.erase(0, complete_messages_size);
+
+    // The job keeps the session alive while it is running. If no further handler is registered, the session is
+    // destroyed once the job is done.
+    const auto job = std::make_shared<JobTask>([session = shared_from_this()]() mutable {
+      // Release the session as soon as the requests are handled, not only when the task is destroyed
+      const auto handled_session = std::move(session);
+      handled_session->_handle_received_requests();
+    });
+    job->schedule();
+    return;
+  }
+
+  // The handler keeps the session alive while it is waiting. Errors only occur if the client closed the connection or
+  // the io_service is stopped. Then, the session is destroyed.
+  _socket->async_read_some(
+      boost::asio::buffer(_receive_buffer),
+      [session = shared_from_this()](const boost::system::error_code& error, const size_t bytes_read) {
+        if (error) {
+          return;
+        }
+        session->_received_data.append(session->_receive_buffer.data(), bytes_read);
+        session->_receive_requests();
+      });
+}
+
+size_t Session::_complete_messages_size() const {
+  auto complete_size = size_t{0};
+  // The startup packet has no message type, all following messages do
+  auto type_size = _connection_established ? sizeof(PostgresMessageType) : size_t{0};
+  while (_received_data.size() >= complete_size + type_size + LENGTH_FIELD_SIZE) {
+    const auto message_length = read_uint32(_received_data, complete_size + type_size);
+    // A length that does not even cover the length field is invalid. The message is handed over nevertheless, so
+    // that the protocol handler reports the error.
+    const auto message_size = type_size + std::max(message_length, uint32_t{LENGTH_FIELD_SIZE});
+    if (_received_data.size() < complete_size + message_size) {
+      break;
     }
+    complete_size += message_size;
+    type_size = sizeof(PostgresMessageType);
   }
+  return complete_size;
+}
+
+void Session::_handle_received_requests() {
+  // All received messages are complete, so handling them never waits for the client. Responses are sent in batches by
+  // the stream, which only waits if the client does not keep up with reading them (see SessionStream).
+  try {
+    if (!_connection_established) {
+      _establish_connection();
+      _connection_established = true;
+    }
+  } catch (const ClientDisconnectException&) {
+    // The startup packet was malformed
+    return;
+  }
+
+  // Clients might send further requests without waiting for our response (e.g., Parse, Bind, Execute, and Sync)
+  while (!_terminate_session && (_postgres_protocol_handler->has_buffered_data() || _stream->has_received_data())) {
+    _handle_request_safely();
+  }
+
+  // The session is only read from again once the responses are sent. This prevents a client that does not read its
+  // results from making the server buffer an unbounded number of them.
+  _stream->flush_async([session = shared_from_this()](const boost::system::error_code& error) {
+    if (!error && !session->_terminate_session) {
+      session->_receive_requests();
+    }
+  });
 }
 
 void Session::_establish_connection() {
@@ -58,6 +200,11 @@ void Session::_establish_connection() {
 void Session::_handle_request() {
   const auto header = _postgres_protocol_handler->read_packet_type();
 
+  if (_copy_transaction_context) {
+    _handle_copy_message(header);
+    return;
+  }
+
   switch (header) {
     case PostgresMessageType::TerminateCommand: {
       _terminate_session = true;
@@ -104,8 +251,21 @@ void Session::_handle_request() {
 void Session::_handle_simple_query() {
   const auto& query = _postgres_protocol_handler->read_query_packet();
 
-  // A simple query command invalidates unnamed portals
+  // A simple query command invalidates unnamed portals and statements
   _portals.erase("");
+  _portal_result_format_codes.erase("");
+  _parameter_object_ids.erase("");
+
+  if (const auto copy_statement = parse_copy_statement(query)) {
+    if (copy_statement->direction == CopyDirection::FromStdin) {
+      // ReadyForQuery is sent once the client has finished the COPY
+      _handle_copy_from_stdin(*copy_statement);
+    } else {
+      _handle_copy_to_stdout(*copy_statement);
+      _postgres_protocol_handler->send_ready_for_query();
+    }
+    return;
+  }
 
   ExecutionInformation execution_information;
 
@@ -133,9 +293,115 @@ void Session::_handle_simple_query() {
   _postgres_protocol_handler->send_ready_for_query();
 }
 
+void Session::_handle_copy_from_stdin(const CopyStatement& copy_statement) {
+  // Within an explicit transaction, the rows are inserted as part of it. Otherwise, the COPY is a separate
+  // transaction.
+  const auto transaction_context = _transaction_context
+                                       ? _transaction_context
+                                       : Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  _copy_importer =
+      std::make_unique<CopyImporter>(copy_statement.table_name, copy_statement.format, transaction_context);
+  _copy_transaction_context = transaction_context;
+
+  _postgres_protocol_handler->send_copy_response(PostgresMessageType::CopyInResponse, copy_statement.format,
+                                                 static_cast<uint16_t>(_copy_importer->column_count()));
+}
+
+void Session::_handle_copy_message(const PostgresMessageType message_type) {
+  // The client sends CopyData messages until it finishes with either CopyDone or CopyFail
+  switch (message_type) {
+    case PostgresMessageType::CopyData: {
+      const auto data = _postgres_protocol_handler->read_copy_data_packet();
+      if (!_copy_exception) {
+        try {
+          _copy_importer->consume(data);
+        } catch (const std::exception&) {
+          _copy_exception = std::current_exception();
+        }
+      }
+      return;
+    }
+    case PostgresMessageType::CopyDone: {
+      _postgres_protocol_handler->read_copy_done_packet();
+      break;
+    }
+    case PostgresMessageType::CopyFailCommand: {
+      const auto client_error_message = _postgres_protocol_handler->read_copy_fail_packet();
+      if (!_copy_exception) {
+        _copy_exception = std::make_exception_ptr(
+            InvalidInputException("Invalid input error: COPY from stdin failed: " + client_error_message));
+      }
+      break;
+    }
+    case PostgresMessageType::SyncCommand:
+    case PostgresMessageType::FlushCommand: {
+      // Sync and Flush are ignored during COPY. Both messages have no body.
+      _postgres_protocol_handler->read_sync_packet();
+      return;
+    }
+    default: {
+      // Skip the message, whose body starts with its length like that of CopyData
+      _postgres_protocol_handler->read_copy_data_packet();
+      if (!_copy_exception) {
+        _copy_exception = std::make_exception_ptr(
+            InvalidInputException("Invalid input error: Unexpected message during COPY from stdin"));
+      }
+      return;
+    }
+  }
+
+  auto row_count = uint64_t{0};
+  if (!_copy_exception) {
+    try {
+      row_count = _copy_importer->finish();
+    } catch (const std::exception&) {
+      _copy_exception = std::current_exception();
+    }
+  }
+
+  const auto transaction_context = std::move(_copy_transaction_context);
+  const auto copy_exception = std::exchange(_copy_exception, nullptr);
+  _copy_importer.reset();
+
+  if (copy_exception) {
+    // An error aborts the surrounding transaction, just like a failed statement. A conflicting batch has already
+    // rolled it back.
+    if (transaction_context->phase() == TransactionPhase::Active) {
+      transaction_context->rollback(RollbackReason::User);
+    }
+    _transaction_context.reset();
+    std::rethrow_exception(copy_exception);
+  }
+
+  if (!_transaction_context) {
+    transaction_context->commit();
+  }
+  _postgres_protocol_handler->send_command_complete("COPY " + std::to_string(row_count));
+  _postgres_protocol_handler->send_ready_for_query();
+}
+
+void Session::_handle_copy_to_stdout(const CopyStatement& copy_statement) {
+  ExecutionInformation execution_information;
+
+  std::tie(execution_information, _transaction_context) =
+      QueryHandler::execute_pipeline(copy_statement.query, _send_execution_info, _transaction_context);
+
+  if (!execution_information.error_message.empty()) {
+    _postgres_protocol_handler->send_error_message(execution_information.error_message);
+    return;
+  }
+  AssertInput(execution_information.result_table, "The query of COPY TO STDOUT does not return a result");
+
+  ResultSerializer::send_copy_out_response(execution_information.result_table, _postgres_protocol_handler,
+                                           copy_statement.format);
+  _postgres_protocol_handler->send_command_complete(
+      "COPY " + std::to_string(execution_information.result_table->row_count()));
+}
+
 void Session::_handle_parse_command() {
-  const auto [statement_name, query] = _postgres_protocol_handler->read_parse_packet();
+  const auto [statement_name, query, parameter_object_ids] = _postgres_protocol_handler->read_parse_packet();
   QueryHandler::setup_prepared_plan(statement_name, query);
+  _parameter_object_ids[statement_name] = parameter_object_ids;
 
   _postgres_protocol_handler->send_status_message(PostgresMessageType::ParseComplete);
 
@@ -143,7 +409,7 @@ void Session::_handle_parse_command() {
 }
 
 void Session::_handle_bind_command() {
-  const auto parameters = _postgres_protocol_handler->read_bind_packet();
+  auto parameters = _postgres_protocol_handler->read_bind_packet();
 
   // Named portals must be explicitly closed before they can be redefined by another Bind message,
   // but this is not required for the unnamed portal.
@@ -158,6 +424,19 @@ void Session::_handle_bind_command() {
   // we first store a nullptr in the portals map to signalize an error. However, if binding succeeds in the next step
   // this nullptr gets replaced by the correct pqp. Before executing the prepared statement we make a check for errors.
   _portals.emplace(parameters.portal, nullptr);
+  _portal_result_format_codes[parameters.portal] = parameters.result_format_codes;
+
+  // Binary parameters can only be decoded once their data types are known
+  const auto parameter_count = parameters.parameters.size();
+  for (auto parameter_id = size_t{0}; parameter_id < parameter_count; ++parameter_id) {
+    if (parameters.parameter_format_codes[parameter_id] == FormatCode::Binary) {
+      const auto object_ids_it = _parameter_object_ids.find(parameters.statement_name);
+      const auto object_id = object_ids_it != _parameter_object_ids.end() && parameter_id < object_ids_it->second.size()
+                                 ? object_ids_it->second[parameter_id]
+                                 : uint32_t{0};
+      parameters.parameters[parameter_id] = decode_binary_parameter(parameters.parameters[parameter_id], object_id);
+    }
+  }
 
   const auto pqp = QueryHandler::bind_prepared_plan(parameters);
 
@@ -186,13 +465,16 @@ void Session::_handle_execute() {
   // nothing to execute.
   if (!portal_it->second) {
     _portals.erase(portal_it);
+    _portal_result_format_codes.erase(portal_name);
     return;
   }
 
   const auto physical_plan = portal_it->second;
+  const auto result_format_codes = _portal_result_format_codes[portal_name];
 
   if (portal_name.empty()) {
     _portals.erase(portal_it);
+    _portal_result_format_codes.erase(portal_name);
   }
 
   if (!_transaction_context) {
@@ -205,8 +487,8 @@ void Session::_handle_execute() {
   uint64_t row_count = 0;
   // If there is no result table, e.g. after an INSERT command, we cannot send row data
   if (result_table) {
-    ResultSerializer::send_table_description(result_table, _postgres_protocol_handler);
-    ResultSerializer::send_query_response(result_table, _postgres_protocol_handler);
+    ResultSerializer::send_table_description(result_table, _postgres_protocol_handler, result_format_codes);
+    ResultSerializer::send_query_response(result_table, _postgres_protocol_handler, result_format_codes);
     row_count = result_table->row_count();
   } else {
     _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
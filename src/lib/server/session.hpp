@@ -1,9 +1,16 @@
 #pragma once
 
+#include <array>
+#include <exception>
+#include <functional>
+#include <memory>
+
 #include "concurrency/transaction_context.hpp"
+#include "copy_handler.hpp"
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "session_stream.hpp"
 
 namespace opossum {
 
@@ -12,25 +19,62 @@ namespace opossum {
 // portals used for CURSOR operations are currently not supported by Hyrise. For further documentation see here:
 // https://www.postgresql.org/docs/12/protocol-overview.html#PROTOCOL-QUERY-CONCEPTS
 // Example usage can be found here: https://stackoverflow.com/questions/52479293/postgresql-refcursor-and-portal-name
-class Session {
+//
+// Sessions are either run on a dedicated thread (see run()) or event-driven (see start_async()). In the latter case,
+// the session reads requests and writes responses asynchronously on the I/O threads of the server. Only requests that
+// have been received completely are handled by a job on the scheduler, so that neither idle nor slow clients occupy a
+// thread.
+class Session : public std::enable_shared_from_this<Session> {
  public:
-  explicit Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info);
+  Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info,
+          const SessionMode session_mode = SessionMode::Threaded);
+
+  ~Session();
 
-  // Start new session.
+  // Start new session and handle requests on the calling thread until the session is terminated (SessionMode::Threaded
+  // only).
   void run();
 
+  // Start new session and return immediately. on_termination is called when the session is destroyed, which happens
+  // once the client has terminated the session and no more handlers reference it. The session has to be owned by a
+  // shared_ptr (SessionMode::Async only).
+  void start_async(const std::function<void()>& on_termination);
+
   std::shared_ptr<Socket> socket();
 
  private:
   // Establish new connection by exchanging parameters.
   void _establish_connection();
 
+  // Handle a single request and send an error message to the client if it fails.
+  void _handle_request_safely();
+
+  // Receive data asynchronously until at least one message is complete and schedule a job that handles the complete
+  // messages. Runs on the I/O threads.
+  void _receive_requests();
+
+  // Return the number of bytes at the beginning of _received_data that form complete messages.
+  size_t _complete_messages_size() const;
+
+  // Handle all received requests and send the responses asynchronously. Runs on the scheduler's workers.
+  void _handle_received_requests();
+
   // Determine message and call the appropriate method.
   void _handle_request();
 
   // Execute plain SQL statement.
   void _handle_simple_query();
 
+  // Start receiving the data of COPY ... FROM STDIN. The following CopyData messages are handled as separate requests
+  // by _handle_copy_message(), so that a long upload does not occupy a worker in SessionMode::Async.
+  void _handle_copy_from_stdin(const CopyStatement& copy_statement);
+
+  // Insert the data of a CopyData message into the table or finish the COPY.
+  void _handle_copy_message(const PostgresMessageType message_type);
+
+  // Execute the query of COPY ... TO STDOUT and send the result as COPY data.
+  void _handle_copy_to_stdout(const CopyStatement& copy_statement);
+
   // Parse prepared statement.
   void _handle_parse_command();
 
@@ -46,12 +90,31 @@ class Session {
   // Commit current transaction.
   void _sync();
 
-  const std::shared_ptr<Socket> _socket;
-  const std::shared_ptr<PostgresProtocolHandler<Socket>> _postgres_protocol_handler;
+  // Not const so that the socket can be closed before on_termination is called, see ~Session()
+  std::shared_ptr<Socket> _socket;
+  std::shared_ptr<SessionStream> _stream;
+  std::shared_ptr<PostgresProtocolHandler<SessionStream>> _postgres_protocol_handler;
   const SendExecutionInfo _send_execution_info;
+  const SessionMode _session_mode;
+  std::function<void()> _on_termination;
+  bool _connection_established = false;
   bool _terminate_session = false;
   bool _sync_send_after_error = false;
   std::shared_ptr<TransactionContext> _transaction_context;
   std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+  // Result format codes requested when binding the portal
+  std::unordered_map<std::string, std::vector<FormatCode>> _portal_result_format_codes;
+  // Object ids of the parameter data types specified when parsing the statement. Needed for binary parameters.
+  std::unordered_map<std::string, std::vector<uint32_t>> _parameter_object_ids;
+
+  // State of a running COPY ... FROM STDIN. After an error, the remaining data is skipped until the client finishes the
+  // COPY and the error is reported.
+  std::unique_ptr<CopyImporter> _copy_importer;
+  std::shared_ptr<TransactionContext> _copy_transaction_context;
+  std::exception_ptr _copy_exception;
+
+  // SessionMode::Async only: data received from the socket that does not form a complete message yet
+  std::array<char, SERVER_BUFFER_SIZE> _receive_buffer;
+  std::string _received_data;
 };
 }  // namespace opossum
@@ -0,0 +1,76 @@
+#include "session_stream.hpp"
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void SessionStream::flush_async(const std::function<void(const boost::system::error_code&)>& on_sent) {
+  DebugAssert(_session_mode == SessionMode::Async, "Only asynchronous sessions send their output asynchronously");
+
+  const auto error = _queue_pending_output(false);
+
+  auto lock = std::unique_lock<std::mutex>{_output_mutex};
+  if (!error && !_queued_output_batches.empty()) {
+    _on_output_sent = on_sent;
+    return;
+  }
+  lock.unlock();
+
+  on_sent(error);
+}
+
+boost::system::error_code SessionStream::_queue_pending_output(const bool wait_for_queue) {
+  auto lock = std::unique_lock<std::mutex>{_output_mutex};
+  if (wait_for_queue) {
+    _batch_written.wait(lock, [&]() {
+      return _write_error || _queued_output_batches.size() < MAX_QUEUED_OUTPUT_BATCHES;
+    });
+  }
+
+  if (_write_error || _pending_output.empty()) {
+    return _write_error;
+  }
+
+  _queued_output_batches.emplace_back(std::exchange(_pending_output, std::string{}));
+  if (_queued_output_batches.size() == 1) {
+    _write_next_batch();
+  }
+  return {};
+}
+
+void SessionStream::_write_next_batch() {
+  // The session keeps the stream alive while batches are queued: Either the job that produces them is still running or
+  // _on_output_sent references the session.
+  const auto& batch = _queued_output_batches.front();
+  boost::asio::async_write(*_socket, boost::asio::buffer(batch),
+                           [this](const boost::system::error_code& error, size_t) { _on_batch_written(error); });
+}
+
+void SessionStream::_on_batch_written(const boost::system::error_code& error) {
+  auto on_sent = std::function<void(const boost::system::error_code&)>{};
+  auto write_error = boost::system::error_code{};
+  {
+    const auto lock = std::lock_guard<std::mutex>{_output_mutex};
+    _queued_output_batches.pop_front();
+    if (error) {
+      // The client disconnected. The job that is still producing output is notified by the next write.
+      _write_error = error;
+      _queued_output_batches.clear();
+    }
+
+    if (!_queued_output_batches.empty()) {
+      _write_next_batch();
+    } else {
+      on_sent = std::exchange(_on_output_sent, nullptr);
+    }
+    write_error = _write_error;
+  }
+  _batch_written.notify_all();
+
+  // Release on_sent (and thus the session it might reference) after calling it
+  if (on_sent) {
+    on_sent(write_error);
+  }
+}
+
+}  // namespace opossum
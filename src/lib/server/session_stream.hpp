@@ -0,0 +1,115 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <boost/asio.hpp>
+
+#include "server_types.hpp"
+
+namespace opossum {
+
+// The stream that a session's PostgresProtocolHandler reads from and writes to. It satisfies asio's SyncReadStream and
+// SyncWriteStream requirements, so that the ReadBuffer and WriteBuffer can use it like a socket.
+//
+// In SessionMode::Threaded, reads and writes are forwarded to the socket and block the session's thread.
+// In SessionMode::Async, the stream never reads from the socket. The I/O threads receive complete messages and append
+// them to the stream before a job handles them. Responses are collected in batches, which are sent asynchronously by
+// the I/O threads as soon as they are full. Thus, the scheduler's workers do not wait for the network unless the client
+// reads its results slower than they are produced. In that case, the job waits until one of the batches is sent, so
+// that no more than MAX_QUEUED_OUTPUT_BATCHES are held in memory per session (e.g., for a large result set).
+class SessionStream {
+ public:
+  // Size from which on the collected output is sent (SessionMode::Async only)
+  static constexpr auto OUTPUT_BATCH_SIZE = size_t{1} << 20;
+  static constexpr auto MAX_QUEUED_OUTPUT_BATCHES = size_t{2};
+
+  SessionStream(const std::shared_ptr<Socket>& socket, const SessionMode session_mode)
+      : _socket(socket), _session_mode(session_mode) {}
+
+  template <typename MutableBufferSequence>
+  size_t read_some(const MutableBufferSequence& buffers, boost::system::error_code& error) {
+    if (_session_mode == SessionMode::Threaded) {
+      return _socket->read_some(buffers, error);
+    }
+
+    const auto bytes_read = boost::asio::buffer_copy(
+        buffers, boost::asio::buffer(_received_data.data() + _read_position, _received_data.size() - _read_position));
+    _read_position += bytes_read;
+    if (_read_position == _received_data.size()) {
+      _received_data.clear();
+      _read_position = 0;
+    }
+
+    // Only complete messages are received. Reading beyond them means that the client sent a malformed message.
+    if (bytes_read == 0) {
+      error = boost::asio::error::eof;
+    }
+    return bytes_read;
+  }
+
+  template <typename ConstBufferSequence>
+  size_t write_some(const ConstBufferSequence& buffers, boost::system::error_code& error) {
+    if (_session_mode == SessionMode::Threaded) {
+      return _socket->write_some(buffers, error);
+    }
+
+    const auto bytes_to_write = boost::asio::buffer_size(buffers);
+    const auto previous_size = _pending_output.size();
+    _pending_output.resize(previous_size + bytes_to_write);
+    boost::asio::buffer_copy(boost::asio::buffer(_pending_output.data() + previous_size, bytes_to_write), buffers);
+
+    if (_pending_output.size() >= OUTPUT_BATCH_SIZE) {
+      error = _queue_pending_output(true);
+      if (error) {
+        return 0;
+      }
+    }
+    return bytes_to_write;
+  }
+
+  // Append messages that the I/O threads have received completely (SessionMode::Async only)
+  void append_received_data(const char* data, const size_t size) {
+    _received_data.append(data, size);
+  }
+
+  bool has_received_data() const {
+    return _read_position < _received_data.size();
+  }
+
+  // Send the remaining output and call on_sent once all output has been sent or sending failed. on_sent might be called
+  // right away on the calling thread (SessionMode::Async only).
+  void flush_async(const std::function<void(const boost::system::error_code&)>& on_sent);
+
+ private:
+  // Hand the pending output to the I/O threads. If wait_for_queue is set, wait until less than
+  // MAX_QUEUED_OUTPUT_BATCHES are queued first. Returns the error of a previous write, if any.
+  boost::system::error_code _queue_pending_output(const bool wait_for_queue);
+
+  // Write the first queued batch. Requires _output_mutex to be locked.
+  void _write_next_batch();
+
+  void _on_batch_written(const boost::system::error_code& error);
+
+  const std::shared_ptr<Socket> _socket;
+  const SessionMode _session_mode;
+
+  std::string _received_data;
+  size_t _read_position{0};
+  std::string _pending_output;
+
+  // Batches that are queued or being written by the I/O threads. Only the first one is written at a time, as asio
+  // requires for async_write.
+  std::mutex _output_mutex;
+  std::condition_variable _batch_written;
+  std::deque<std::string> _queued_output_batches;
+  boost::system::error_code _write_error;
+  std::function<void(const boost::system::error_code&)> _on_output_sent;
+};
+
+}  // namespace opossum
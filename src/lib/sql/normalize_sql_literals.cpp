@@ -0,0 +1,233 @@
+#include "normalize_sql_literals.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "constant_mappings.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Literals directly following one of these tokens are compared against or assigned to another expression
+const auto value_preceding_tokens = std::unordered_set<std::string>{"=", "<>", "!=", "<", "<=", ">", ">=", "LIKE"};
+
+enum class ParenthesisType { Other, ValueList, ValuesTuple };
+
+bool is_identifier_character(const char character) {
+  return std::isalnum(static_cast<unsigned char>(character)) || character == '_' || character == '$';
+}
+
+bool is_digit(const char character) {
+  return std::isdigit(static_cast<unsigned char>(character));
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string NormalizedSQL::plan_cache_key() const {
+  if (values.empty()) {
+    return sql;
+  }
+
+  auto key = sql + "\n-- ";
+  for (auto value_id = size_t{0}; value_id < values.size(); ++value_id) {
+    if (value_id > 0) {
+      key += ", ";
+    }
+    key += data_type_to_string.left.at(data_type_from_all_type_variant(values[value_id]));
+  }
+  return key;
+}
+
+std::optional<NormalizedSQL> normalize_sql_literals(const std::string& sql) {
+  auto normalized_sql = NormalizedSQL{};
+  normalized_sql.sql.reserve(sql.size());
+
+  // The last token that was not whitespace or a comment. Keywords are upper-cased.
+  auto previous_token = std::string{};
+  auto between_pending = false;
+  auto parenthesis_stack = std::vector<ParenthesisType>{};
+  auto previous_closed_parenthesis = ParenthesisType::Other;
+
+  const auto size = sql.size();
+  auto position = size_t{0};
+  while (position < size) {
+    const auto character = sql[position];
+
+    // Whitespace and comments are copied, but do not count as tokens
+    if (std::isspace(static_cast<unsigned char>(character))) {
+      normalized_sql.sql += character;
+      ++position;
+      continue;
+    }
+    if (sql.compare(position, 2, "--") == 0) {
+      const auto end = std::min(sql.find('\n', position), size);
+      normalized_sql.sql.append(sql, position, end - position);
+      position = end;
+      continue;
+    }
+    if (sql.compare(position, 2, "/*") == 0) {
+      const auto end = sql.find("*/", position + 2);
+      if (end == std::string::npos) {
+        return std::nullopt;
+      }
+      normalized_sql.sql.append(sql, position, end + 2 - position);
+      position = end + 2;
+      continue;
+    }
+
+    auto token = std::string{};
+    auto literal_value = std::optional<AllTypeVariant>{};
+    auto token_appended = false;
+
+    if (character == '\'') {
+      // String literal. Literals with escaped quotes or special characters are not replaced, as we would have to
+      // replicate the unescaping of the SQL parser.
+      auto end = position + 1;
+      auto replaceable = true;
+      while (true) {
+        end = sql.find('\'', end);
+        if (end == std::string::npos) {
+          return std::nullopt;
+        }
+        if (end + 1 < size && sql[end + 1] == '\'') {
+          replaceable = false;
+          end += 2;
+          continue;
+        }
+        break;
+      }
+      token = sql.substr(position, end + 1 - position);
+      const auto content = sql.substr(position + 1, end - position - 1);
+      if (replaceable && content.find_first_of("\\\n") == std::string::npos) {
+        literal_value = pmr_string{content};
+      }
+      position = end + 1;
+    } else if (character == '"') {
+      // Quoted identifier
+      const auto end = sql.find('"', position + 1);
+      if (end == std::string::npos) {
+        return std::nullopt;
+      }
+      token = sql.substr(position, end + 1 - position);
+      position = end + 1;
+    } else if (is_digit(character) || (character == '.' && position + 1 < size && is_digit(sql[position + 1]))) {
+      // Numeric literal, either an integer (`42`) or a float (`4.2`, `4.`, `.2`)
+      auto end = position;
+      while (end < size && is_digit(sql[end])) {
+        ++end;
+      }
+      const auto is_float = end < size && sql[end] == '.';
+      if (is_float) {
+        ++end;
+        while (end < size && is_digit(sql[end])) {
+          ++end;
+        }
+      }
+      token = sql.substr(position, end - position);
+      position = end;
+
+      // Anything that directly follows the number (e.g., an exponent) is left to the parser.
+      if (position == size || (!is_identifier_character(sql[position]) && sql[position] != '.')) {
+        if (is_float) {
+          literal_value = std::strtod(token.c_str(), nullptr);
+        } else {
+          auto value = int64_t{};
+          const auto [last, error_code] = std::from_chars(token.data(), token.data() + token.size(), value);
+          if (error_code == std::errc{}) {
+            // Mirror SQLTranslator, which uses the smallest fitting integer type
+            if (value >= std::numeric_limits<int32_t>::min() && value <= std::numeric_limits<int32_t>::max()) {
+              literal_value = static_cast<int32_t>(value);
+            } else {
+              literal_value = value;
+            }
+          }
+        }
+      }
+    } else if (is_identifier_character(character)) {
+      // Keyword or identifier
+      auto end = position;
+      while (end < size && is_identifier_character(sql[end])) {
+        ++end;
+      }
+      token = sql.substr(position, end - position);
+      // Append the identifier in its original case before upper-casing the token for the keyword comparisons below
+      normalized_sql.sql += token;
+      token_appended = true;
+      std::transform(token.begin(), token.end(), token.begin(), [](const auto c) { return std::toupper(c); });
+      position = end;
+    } else if (character == '?') {
+      // The statement is already parameterized (or invalid outside of PREPARE)
+      return std::nullopt;
+    } else {
+      // Operators and punctuation
+      token = std::string{character};
+      if (position + 1 < size && (character == '<' || character == '>' || character == '!') &&
+          (sql[position + 1] == '=' || sql[position + 1] == '>')) {
+        token += sql[position + 1];
+      }
+      position += token.size();
+    }
+
+    if (literal_value) {
+      const auto in_value_list =
+          !parenthesis_stack.empty() && parenthesis_stack.back() != ParenthesisType::Other &&
+          (previous_token == "(" || previous_token == ",");
+      if (value_preceding_tokens.contains(previous_token) || previous_token == "BETWEEN" || in_value_list) {
+        normalized_sql.sql += '?';
+        normalized_sql.values.emplace_back(std::move(*literal_value));
+      } else {
+        normalized_sql.sql += token;
+      }
+    } else if (!token_appended) {
+      normalized_sql.sql += token;
+    }
+
+    // Update the context for the next literal
+    if (token == "(") {
+      if (previous_token == "IN") {
+        parenthesis_stack.emplace_back(ParenthesisType::ValueList);
+      } else if (previous_token == "VALUES" ||
+                 (previous_token == "," && previous_closed_parenthesis == ParenthesisType::ValuesTuple)) {
+        parenthesis_stack.emplace_back(ParenthesisType::ValuesTuple);
+      } else {
+        parenthesis_stack.emplace_back(ParenthesisType::Other);
+      }
+    } else if (token == ")") {
+      if (parenthesis_stack.empty()) {
+        return std::nullopt;
+      }
+      previous_closed_parenthesis = parenthesis_stack.back();
+      parenthesis_stack.pop_back();
+    } else if (token == "SELECT" && !parenthesis_stack.empty()) {
+      // `IN (SELECT ...)` is a subquery, not a list of values
+      parenthesis_stack.back() = ParenthesisType::Other;
+    }
+
+    if (token != "," && token != ")") {
+      previous_closed_parenthesis = ParenthesisType::Other;
+    }
+
+    if (token == "BETWEEN") {
+      between_pending = true;
+    } else if (token == "AND" && between_pending) {
+      // The upper bound of BETWEEN is treated just like its lower bound
+      between_pending = false;
+      token = "BETWEEN";
+    }
+
+    previous_token = std::move(token);
+  }
+
+  return normalized_sql;
+}
+
+}  // namespace opossum
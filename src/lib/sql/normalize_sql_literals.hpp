@@ -0,0 +1,34 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+struct NormalizedSQL {
+  // Key of the SQLParameterizedPlanCache: `sql`, followed by the data types of the values. A plan is translated and
+  // optimized for the types of its values, so `a = 1` and `a = 1.5` do not share it.
+  // Example: "SELECT * FROM t WHERE a = ? AND b = ?\n-- int, string"
+  std::string plan_cache_key() const;
+
+  // The SQL string with the value literals replaced by `?`
+  std::string sql;
+
+  // The values of the replaced literals, in the order of the placeholders in `sql`
+  std::vector<AllTypeVariant> values;
+};
+
+/**
+ * Replaces the literals of a single SQL statement that are used as values by value placeholders, so that statements
+ * that only differ in these values are normalized to the same string. Only literals that directly follow a comparison
+ * operator, LIKE, BETWEEN (and its AND), or that are elements of an IN list or a VALUES tuple are replaced. Literals
+ * with a structural meaning (e.g., in `LIMIT 10`, `ORDER BY 1`, `DATE '2000-01-01'`, or `SUBSTR(a, 1, 2)`) are kept.
+ *
+ * Returns std::nullopt if the statement already contains placeholders or cannot be tokenized.
+ */
+std::optional<NormalizedSQL> normalize_sql_literals(const std::string& sql);
+
+}  // namespace opossum
@@ -4,7 +4,11 @@
 namespace opossum {
 
 SQLPipelineBuilder::SQLPipelineBuilder(const std::string& sql)
-    : _sql(sql), _pqp_cache(Hyrise::get().default_pqp_cache), _lqp_cache(Hyrise::get().default_lqp_cache) {}
+    : _sql(sql),
+      _pqp_cache(Hyrise::get().default_pqp_cache),
+      _lqp_cache(Hyrise::get().default_lqp_cache),
+      _parameterized_plan_cache(Hyrise::get().default_parameterized_plan_cache),
+      _memory_budget_limit(Hyrise::get().default_memory_budget) {}
 
 SQLPipelineBuilder& SQLPipelineBuilder::with_mvcc(const UseMvcc use_mvcc) {
   _use_mvcc = use_mvcc;
@@ -34,13 +38,30 @@ SQLPipelineBuilder& SQLPipelineBuilder::with_lqp_cache(const std::shared_ptr<SQL
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::with_parameterized_plan_cache(
+    const std::shared_ptr<SQLParameterizedPlanCache>& parameterized_plan_cache) {
+  _parameterized_plan_cache = parameterized_plan_cache;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_memory_budget(const size_t limit) {
+  _memory_budget_limit = limit;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_pipelined_execution() {
+  _pipelined_execution = true;
+  return *this;
+}
+
 SQLPipelineBuilder& SQLPipelineBuilder::disable_mvcc() {
   return with_mvcc(UseMvcc::No);
 }
 
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache);
+  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, optimizer, _pqp_cache, _lqp_cache,
+                              _parameterized_plan_cache, _memory_budget_limit, _pipelined_execution);
   return pipeline;
 }
 
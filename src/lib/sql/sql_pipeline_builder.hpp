@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "types.hpp"
@@ -28,6 +29,8 @@ class Optimizer;
  * Defaults:
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer()) is used.
+ *  - The memory usage of the operators is not limited.
+ *  - Each operator materializes its complete output before its consumers start (no pipelined execution).
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -42,6 +45,21 @@ class SQLPipelineBuilder final {
   SQLPipelineBuilder& with_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
   SQLPipelineBuilder& with_pqp_cache(const std::shared_ptr<SQLPhysicalPlanCache>& pqp_cache);
   SQLPipelineBuilder& with_lqp_cache(const std::shared_ptr<SQLLogicalPlanCache>& lqp_cache);
+  SQLPipelineBuilder& with_parameterized_plan_cache(
+      const std::shared_ptr<SQLParameterizedPlanCache>& parameterized_plan_cache);
+
+  /**
+   * Limits the memory that the operators of each statement may use for their intermediate data structures to
+   * @param limit bytes (see MemoryBudget). Operators that support it, such as JoinHash, spill to disk instead.
+   */
+  SQLPipelineBuilder& with_memory_budget(const size_t limit);
+
+  /**
+   * Executes chains of TableScans, Validates, and Projections that end in an aggregation chunk by chunk (see
+   * ChunkPipeline) instead of materializing the output of each operator. The resulting plans are not cached in the
+   * PQP cache.
+   */
+  SQLPipelineBuilder& with_pipelined_execution();
 
   /**
    * Short for with_mvcc(UseMvcc::No)
@@ -58,6 +76,9 @@ class SQLPipelineBuilder final {
   std::shared_ptr<Optimizer> _optimizer;
   std::shared_ptr<SQLPhysicalPlanCache> _pqp_cache;
   std::shared_ptr<SQLLogicalPlanCache> _lqp_cache;
+  std::shared_ptr<SQLParameterizedPlanCache> _parameterized_plan_cache;
+  std::optional<size_t> _memory_budget_limit;
+  bool _pipelined_execution{false};
 };
 
 }  // namespace opossum
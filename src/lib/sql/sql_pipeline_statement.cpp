@@ -9,9 +9,11 @@
 
 #include "SQLParser.h"
 #include "create_sql_parser_error_message.hpp"
+#include "expression/expression_functional.hpp"
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "operators/export.hpp"
 #include "operators/import.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
@@ -20,22 +22,31 @@
 #include "operators/maintenance/drop_table.hpp"
 #include "operators/maintenance/drop_view.hpp"
 #include "optimizer/optimizer.hpp"
+#include "optimizer/strategy/chunk_pruning_rule.hpp"
 #include "scheduler/job_task.hpp"
+#include "sql/normalize_sql_literals.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
+#include "storage/prepared_plan.hpp"
 #include "utils/assert.hpp"
+#include "utils/memory_budget.hpp"
 
 namespace opossum {
 
-SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
-                                           const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
-                                           const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                                           const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache)
+SQLPipelineStatement::SQLPipelineStatement(
+    const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql, const UseMvcc use_mvcc,
+    const std::shared_ptr<Optimizer>& optimizer, const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
+    const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+    const std::shared_ptr<SQLParameterizedPlanCache>& init_parameterized_plan_cache,
+    const std::optional<size_t>& memory_budget_limit, const bool pipelined_execution)
     : pqp_cache(init_pqp_cache),
       lqp_cache(init_lqp_cache),
+      parameterized_plan_cache(init_parameterized_plan_cache),
       _sql_string(sql),
       _use_mvcc(use_mvcc),
+      _memory_budget_limit(memory_budget_limit),
+      _pipelined_execution(pipelined_execution),
       _optimizer(optimizer),
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()) {
@@ -129,6 +140,14 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
     }
   }
 
+  // Reuse the plan of a statement that only differs in its literals
+  if (parameterized_plan_cache) {
+    _optimized_logical_plan = _get_optimized_logical_plan_from_parameterized_plan_cache();
+    if (_optimized_logical_plan) {
+      return _optimized_logical_plan;
+    }
+  }
+
   auto unoptimized_lqp = get_unoptimized_logical_plan();
 
   const auto started = std::chrono::steady_clock::now();
@@ -154,6 +173,117 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
   return _optimized_logical_plan;
 }
 
+std::shared_ptr<AbstractLQPNode> SQLPipelineStatement::_get_optimized_logical_plan_from_parameterized_plan_cache() {
+  // Only DML statements are parameterized. Other statements either have no literals worth replacing or embed the SQL
+  // string (e.g., CREATE VIEW).
+  const auto statement_type = get_parsed_sql_statement()->getStatement(0)->type();
+  if (statement_type != hsql::kStmtSelect && statement_type != hsql::kStmtInsert &&
+      statement_type != hsql::kStmtUpdate && statement_type != hsql::kStmtDelete) {
+    return nullptr;
+  }
+
+  const auto normalized_sql = normalize_sql_literals(_sql_string);
+  if (!normalized_sql) {
+    return nullptr;
+  }
+
+  const auto plan_cache_key = normalized_sql->plan_cache_key();
+  auto prepared_plan = std::shared_ptr<PreparedPlan>{};
+  if (const auto cached_plan = parameterized_plan_cache->try_get(plan_cache_key)) {
+    // A nullptr entry marks statements that cannot be parameterized
+    if (!*cached_plan) {
+      return nullptr;
+    }
+
+    // MVCC-enabled and MVCC-disabled LQPs will evict each other
+    if (lqp_is_validated((*cached_plan)->lqp) == (_use_mvcc == UseMvcc::Yes)) {
+      prepared_plan = *cached_plan;
+      _metrics->parameterized_plan_cache_hit = true;
+    }
+  }
+
+  if (!prepared_plan) {
+    prepared_plan = _create_parameterized_plan(*normalized_sql, plan_cache_key);
+    if (!prepared_plan) {
+      return nullptr;
+    }
+  }
+
+  auto parameters = std::vector<std::shared_ptr<AbstractExpression>>{};
+  parameters.reserve(normalized_sql->values.size());
+  for (const auto& value : normalized_sql->values) {
+    parameters.emplace_back(expression_functional::value_(value));
+  }
+
+  // Instantiating creates a deep copy, so concurrent statements do not share the LQP nodes.
+  auto lqp = prepared_plan->instantiate(parameters);
+
+  // The ChunkPruningRule could not use the placeholders when the parameterized plan was optimized. Now that the values
+  // are known, we repeat the pruning. Other optimizations that depend on the values (e.g., rewriting LIKE predicates)
+  // are not repeated, which only affects the performance of the plan.
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp)) {
+    for (const auto& node : lqp_find_nodes_by_type(subplan_root, LQPNodeType::StoredTable)) {
+      auto& stored_table_node = static_cast<StoredTableNode&>(*node);
+      stored_table_node.set_pruned_chunk_ids({});
+      stored_table_node.table_statistics = nullptr;
+    }
+  }
+
+  auto chunk_pruning_optimizer = Optimizer{};
+  chunk_pruning_optimizer.add_rule(std::make_unique<ChunkPruningRule>());
+  return chunk_pruning_optimizer.optimize(std::move(lqp));
+}
+
+std::shared_ptr<PreparedPlan> SQLPipelineStatement::_create_parameterized_plan(const NormalizedSQL& normalized_sql,
+                                                                               const std::string& plan_cache_key) {
+  auto parsed_sql = hsql::SQLParserResult{};
+  hsql::SQLParser::parse(normalized_sql.sql, &parsed_sql);
+  if (!parsed_sql.isValid() || parsed_sql.size() != 1) {
+    parameterized_plan_cache->set(plan_cache_key, nullptr);
+    return nullptr;
+  }
+
+  try {
+    const auto started = std::chrono::steady_clock::now();
+
+    auto translation_result = SQLTranslator{_use_mvcc}.translate_parser_result(parsed_sql);
+    DebugAssert(translation_result.lqp_nodes.size() == 1, "Expected exactly one LQP root for a single statement.");
+    const auto& translation_info = translation_result.translation_info;
+
+    // If the translator did not create a placeholder for each replaced literal, we cannot bind the values correctly.
+    if (!translation_info.cacheable ||
+        translation_info.parameter_ids_of_value_placeholders.size() != normalized_sql.values.size()) {
+      parameterized_plan_cache->set(plan_cache_key, nullptr);
+      return nullptr;
+    }
+
+    const auto translated = std::chrono::steady_clock::now();
+    _metrics->sql_translation_duration = translated - started;
+
+    // The optimizer requires to be the only owner of the LQP
+    auto unoptimized_lqp = std::move(translation_result.lqp_nodes.front());
+    translation_result.lqp_nodes.clear();
+
+    auto optimizer_rule_durations = std::make_shared<std::vector<OptimizerRuleMetrics>>();
+    auto optimized_lqp = _optimizer->optimize(std::move(unoptimized_lqp), optimizer_rule_durations);
+
+    _metrics->optimization_duration = std::chrono::steady_clock::now() - translated;
+    _metrics->optimizer_rule_durations = *optimizer_rule_durations;
+
+    auto prepared_plan =
+        std::make_shared<PreparedPlan>(optimized_lqp, translation_info.parameter_ids_of_value_placeholders);
+    parameterized_plan_cache->set(plan_cache_key, prepared_plan);
+    return prepared_plan;
+  } catch (const InvalidInputException&) {
+    // Either the original statement is invalid, too, or a placeholder is used where its data type is needed (see
+    // PlaceholderExpression::data_type). In the first case, translating the original statement reports the error and
+    // the normalized statement is not marked, as it might become valid later (e.g., when a missing table is created).
+    (void)get_unoptimized_logical_plan();
+    parameterized_plan_cache->set(plan_cache_key, nullptr);
+    return nullptr;
+  }
+}
+
 const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan() {
   if (_physical_plan) {
     return _physical_plan;
@@ -169,7 +299,7 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
   auto done = started;  // dummy value needed for initialization
 
   // Try to retrieve the PQP from cache
-  if (pqp_cache) {
+  if (pqp_cache && !_pipelined_execution) {
     if (const auto cached_physical_plan = pqp_cache->try_get(_sql_string)) {
       if ((*cached_physical_plan)->transaction_context_is_set()) {
         Assert(_use_mvcc == UseMvcc::Yes, "Trying to use MVCC cached query without a transaction context.");
@@ -188,7 +318,7 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
 
     // Reset time to exclude previous pipeline steps
     started = std::chrono::steady_clock::now();
-    _physical_plan = LQPTranslator{}.translate_node(lqp);
+    _physical_plan = LQPTranslator{_pipelined_execution}.translate_node(lqp);
   }
 
   done = std::chrono::steady_clock::now();
@@ -198,10 +328,15 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
   }
 
   // Cache newly created plan for the according sql statement (only if not already cached)
-  if (pqp_cache && !_metrics->query_plan_cache_hit && _translation_info.cacheable) {
+  if (pqp_cache && !_pipelined_execution && !_metrics->query_plan_cache_hit && _translation_info.cacheable) {
     pqp_cache->set(_sql_string, _physical_plan);
   }
 
+  // The budget is not copied along with cached plans (see AbstractOperator::set_memory_budget_recursively)
+  if (_memory_budget_limit) {
+    _physical_plan->set_memory_budget_recursively(std::make_shared<MemoryBudget>(*_memory_budget_limit));
+  }
+
   _metrics->lqp_translation_duration = done - started;
 
   return _physical_plan;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "SQLParserResult.h"
@@ -11,6 +12,7 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/operator_task.hpp"
+#include "sql/normalize_sql_literals.hpp"
 #include "sql/sql_translator.hpp"
 #include "sql_plan_cache.hpp"
 #include "storage/table.hpp"
@@ -26,6 +28,7 @@ struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds plan_execution_duration{};
 
   bool query_plan_cache_hit = false;
+  bool parameterized_plan_cache_hit = false;
 };
 
 enum class SQLPipelineStatus {
@@ -50,6 +53,14 @@ enum class SQLPipelineStatus {
  *  If a physical plan for an SQL statement is in the SQLPhysicalPlanCache, it will be used instead of translating the
  *  optimized LQP (get_optimized_logical_plans()) into a PQP. Thus, in this case, the optimized LQP and PQP could be
  *  different.
+ *
+ * NOTE:
+ *  If a SQLParameterizedPlanCache is given, value literals of SELECT, INSERT, UPDATE, and DELETE statements are
+ *  replaced by placeholders (see normalize_sql_literals) before looking up the optimized LQP. Statements that only
+ *  differ in these literals share the same plan, which is instantiated with the literals of the current statement,
+ *  similar to EXECUTE for PREPAREd statements. As the cached plan is optimized without knowing the literals, no
+ *  optimization can rely on their values. Chunk pruning, the most important optimization that does, is repeated on the
+ *  instantiated plan.
  */
 class SQLPipelineStatement : public Noncopyable {
  public:
@@ -57,7 +68,10 @@ class SQLPipelineStatement : public Noncopyable {
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<Optimizer>& optimizer,
                        const std::shared_ptr<SQLPhysicalPlanCache>& init_pqp_cache,
-                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache);
+                       const std::shared_ptr<SQLLogicalPlanCache>& init_lqp_cache,
+                       const std::shared_ptr<SQLParameterizedPlanCache>& init_parameterized_plan_cache = nullptr,
+                       const std::optional<size_t>& memory_budget_limit = std::nullopt,
+                       const bool pipelined_execution = false);
 
   // Set the transaction context if this SQLPipelineStatement should not auto-commit.
   void set_transaction_context(const std::shared_ptr<TransactionContext>& transaction_context);
@@ -102,10 +116,20 @@ class SQLPipelineStatement : public Noncopyable {
 
   const std::shared_ptr<SQLPhysicalPlanCache> pqp_cache;
   const std::shared_ptr<SQLLogicalPlanCache> lqp_cache;
+  const std::shared_ptr<SQLParameterizedPlanCache> parameterized_plan_cache;
 
  private:
   bool _is_transaction_statement();
 
+  // Instantiates the optimized LQP from the parameterized_plan_cache. If the normalized statement is not cached yet,
+  // its parameterized plan is created and cached. Returns nullptr if the statement cannot be parameterized.
+  std::shared_ptr<AbstractLQPNode> _get_optimized_logical_plan_from_parameterized_plan_cache();
+
+  // Translates and optimizes the normalized SQL string and caches the result under plan_cache_key. Returns nullptr if
+  // this fails or if the placeholders do not match the replaced literals.
+  std::shared_ptr<PreparedPlan> _create_parameterized_plan(const NormalizedSQL& normalized_sql,
+                                                           const std::string& plan_cache_key);
+
   // Returns the tasks that execute transaction statements
   std::vector<std::shared_ptr<AbstractTask>> _get_transaction_tasks();
 
@@ -117,6 +141,13 @@ class SQLPipelineStatement : public Noncopyable {
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
 
+  // If set, each execution of the statement gets its own MemoryBudget of this many bytes
+  const std::optional<size_t> _memory_budget_limit;
+
+  // If set, the LQPTranslator fuses operator chains into ChunkPipelines. These plans are not stored in or retrieved
+  // from the PQP cache, as the cache is shared with statements that do not use pipelined execution.
+  const bool _pipelined_execution;
+
   const std::shared_ptr<Optimizer> _optimizer;
 
   // Execution results
@@ -3,14 +3,21 @@
 #include <memory>
 #include <string>
 
-#include "cache/gdfs_cache.hpp"
+#include "cache/sharded_gdfs_cache.hpp"
 
 namespace opossum {
 
 class AbstractOperator;
 class AbstractLQPNode;
+class PreparedPlan;
 
-using SQLPhysicalPlanCache = GDFSCache<std::string, std::shared_ptr<AbstractOperator>>;
-using SQLLogicalPlanCache = GDFSCache<std::string, std::shared_ptr<AbstractLQPNode>>;
+// The plan caches are shared by all sessions of the server, so they are sharded to keep the contention low
+using SQLPhysicalPlanCache = ShardedGDFSCache<std::string, std::shared_ptr<AbstractOperator>>;
+using SQLLogicalPlanCache = ShardedGDFSCache<std::string, std::shared_ptr<AbstractLQPNode>>;
+
+// Keyed on the SQL string with its value literals replaced by placeholders (see normalize_sql_literals). Holds the
+// optimized LQP with placeholders, which is instantiated with the actual values on a cache hit. A nullptr entry marks a
+// statement that cannot be cached in parameterized form.
+using SQLParameterizedPlanCache = ShardedGDFSCache<std::string, std::shared_ptr<PreparedPlan>>;
 
 }  // namespace opossum
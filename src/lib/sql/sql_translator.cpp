@@ -513,7 +513,7 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_delete(const hsql::De
     return ChangeMetaTableNode::make(table_name, MetaTableChangeType::Delete, data_to_delete_node,
                                      DummyTableNode::make());
   }
-  return DeleteNode::make(data_to_delete_node);
+  return DeleteNode::make(table_name, data_to_delete_node);
 }
 
 std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_update(const hsql::UpdateStatement& update) {
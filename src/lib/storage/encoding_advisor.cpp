@@ -0,0 +1,351 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <queue>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/base_segment_encoder.hpp"
+#include "storage/base_value_segment.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Copies the sampled rows of @param segment into a ValueSegment. The rows are read without being counted as accesses
+// of the workload.
+template <typename ColumnDataType>
+std::shared_ptr<ValueSegment<ColumnDataType>> sample_segment(const std::shared_ptr<const AbstractSegment>& segment,
+                                                             const ChunkOffset sample_size) {
+  const auto segment_size = segment->size();
+
+  auto sample_offsets = std::vector<ChunkOffset>{};
+  if (segment_size <= sample_size) {
+    sample_offsets.resize(segment_size);
+    std::iota(sample_offsets.begin(), sample_offsets.end(), ChunkOffset{0});
+  } else {
+    // Take equally spaced runs of consecutive rows, so that the sample keeps the runs of equal values
+    const auto run_count = EncodingAdvisor::SAMPLE_RUN_COUNT;
+    const auto run_length = std::max(size_t{sample_size} / run_count, size_t{1});
+    sample_offsets.reserve(run_count * run_length);
+    for (auto run_idx = size_t{0}; run_idx < run_count; ++run_idx) {
+      const auto run_begin = size_t{segment_size} * run_idx / run_count;
+      const auto run_end = std::min(run_begin + run_length, size_t{segment_size});
+      for (auto chunk_offset = run_begin; chunk_offset < run_end; ++chunk_offset) {
+        sample_offsets.emplace_back(static_cast<ChunkOffset::base_type>(chunk_offset));
+      }
+    }
+  }
+
+  const auto sample_row_count = sample_offsets.size();
+  auto values = pmr_vector<ColumnDataType>(sample_row_count);
+  auto null_values = pmr_vector<bool>(sample_row_count);
+  auto contains_null = false;
+  {
+    const auto accessor = create_segment_accessor<ColumnDataType>(segment);
+    for (auto sample_idx = size_t{0}; sample_idx < sample_row_count; ++sample_idx) {
+      const auto typed_value = accessor->access(sample_offsets[sample_idx]);
+      if (typed_value) {
+        values[sample_idx] = *typed_value;
+      } else {
+        null_values[sample_idx] = true;
+        contains_null = true;
+      }
+    }
+  }
+  // The accessor has counted its accesses as random accesses of the segment when it was destroyed
+  segment->access_counter[SegmentAccessCounter::AccessType::Random] -= sample_row_count;
+
+  const auto value_segment = std::dynamic_pointer_cast<const BaseValueSegment>(segment);
+  if (contains_null || (value_segment && value_segment->is_nullable())) {
+    return std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values));
+  }
+  return std::make_shared<ValueSegment<ColumnDataType>>(std::move(values));
+}
+
+// Returns all encoding specs that can be used for a segment of @param data_type
+std::vector<SegmentEncodingSpec> candidate_encoding_specs(const DataType data_type) {
+  auto encoding_specs = std::vector<SegmentEncodingSpec>{};
+  for (const auto encoding_type : encoding_type_enum_values) {
+    if (!encoding_supports_data_type(encoding_type, data_type)) {
+      continue;
+    }
+
+    if (encoding_type == EncodingType::Unencoded || !create_encoder(encoding_type)->uses_vector_compression()) {
+      encoding_specs.emplace_back(encoding_type);
+      continue;
+    }
+
+    for (const auto vector_compression_type :
+         {VectorCompressionType::FixedWidthInteger, VectorCompressionType::BitPacking}) {
+      encoding_specs.emplace_back(encoding_type, vector_compression_type);
+    }
+  }
+  return encoding_specs;
+}
+
+}  // namespace
+
+namespace opossum {
+
+EncodingAdvisor::EncodingAdvisor(const ChunkOffset sample_size) : _sample_size(sample_size) {
+  Assert(_sample_size >= SAMPLE_RUN_COUNT, "Sample is too small");
+}
+
+double EncodingAdvisor::access_cost_per_value(const SegmentEncodingSpec& encoding_spec,
+                                              const SegmentAccessCounter::AccessType access_type) {
+  using AccessType = SegmentAccessCounter::AccessType;
+
+  // The costs are rough relative costs. Sequential accesses profit from decoding values block-wise (LZ4) or run-wise
+  // (RunLength), while single values have to be located first.
+  auto sequential_cost = 1.0;
+  auto monotonic_cost = 1.0;
+  auto random_cost = 1.0;
+  switch (encoding_spec.encoding_type) {
+    case EncodingType::Unencoded:
+      break;
+    case EncodingType::Dictionary:
+      std::tie(sequential_cost, monotonic_cost, random_cost) = std::make_tuple(1.2, 1.5, 2.0);
+      break;
+    case EncodingType::FixedStringDictionary:
+      std::tie(sequential_cost, monotonic_cost, random_cost) = std::make_tuple(1.5, 2.0, 3.0);
+      break;
+    case EncodingType::FrameOfReference:
+      std::tie(sequential_cost, monotonic_cost, random_cost) = std::make_tuple(1.3, 1.5, 2.0);
+      break;
+    case EncodingType::RunLength:
+      std::tie(sequential_cost, monotonic_cost, random_cost) = std::make_tuple(1.2, 4.0, 10.0);
+      break;
+    case EncodingType::LZ4:
+      std::tie(sequential_cost, monotonic_cost, random_cost) = std::make_tuple(4.0, 20.0, 50.0);
+      break;
+  }
+
+  // Bit-packed vectors have to be unpacked, which is more expensive for single values than for sequences
+  if (encoding_spec.vector_compression_type == VectorCompressionType::BitPacking) {
+    sequential_cost *= 1.2;
+    monotonic_cost *= 1.5;
+    random_cost *= 1.5;
+  }
+
+  switch (access_type) {
+    case AccessType::Sequential:
+      return sequential_cost;
+    case AccessType::Monotonic:
+      return monotonic_cost;
+    case AccessType::Point:
+    case AccessType::Random:
+      return random_cost;
+    case AccessType::Dictionary:
+    case AccessType::Count:
+      return 0.0;
+  }
+  Fail("Invalid enum value");
+}
+
+std::vector<EncodingAdvisor::SegmentEncodingCandidate> EncodingAdvisor::segment_candidates(
+    const std::shared_ptr<const AbstractSegment>& segment, const DataType data_type) const {
+  auto candidates = std::vector<SegmentEncodingCandidate>{};
+
+  auto access_counts = std::vector<std::pair<SegmentAccessCounter::AccessType, uint64_t>>{};
+  for (const auto& [access_type, access_type_name] : SegmentAccessCounter::access_type_string_mapping) {
+    access_counts.emplace_back(access_type, segment->access_counter[access_type].load());
+  }
+
+  resolve_data_type(data_type, [&](const auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto sample = sample_segment<ColumnDataType>(segment, _sample_size);
+    const auto sample_row_count = sample->size();
+    const auto segment_size = segment->size();
+
+    for (const auto& encoding_spec : candidate_encoding_specs(data_type)) {
+      auto estimated_size = size_t{0};
+      if (sample_row_count > 0) {
+        const auto encoded_sample = ChunkEncoder::encode_segment(sample, data_type, encoding_spec);
+        estimated_size =
+            encoded_sample->memory_usage(MemoryUsageCalculationMode::Full) * segment_size / sample_row_count;
+      }
+
+      const auto bytes_per_value =
+          segment_size > 0 ? static_cast<double>(estimated_size) / static_cast<double>(segment_size) : 0.0;
+      auto access_cost = 0.0;
+      for (const auto& [access_type, access_count] : access_counts) {
+        auto cost_per_value = access_cost_per_value(encoding_spec, access_type);
+        if (access_type == SegmentAccessCounter::AccessType::Sequential ||
+            access_type == SegmentAccessCounter::AccessType::Monotonic) {
+          cost_per_value += SCAN_COST_PER_BYTE * bytes_per_value;
+        }
+        access_cost += static_cast<double>(access_count) * cost_per_value;
+      }
+
+      candidates.emplace_back(SegmentEncodingCandidate{encoding_spec, estimated_size, access_cost});
+    }
+  });
+
+  return candidates;
+}
+
+std::vector<EncodingAdvisor::SegmentEncodingRecommendation> EncodingAdvisor::recommend(
+    const std::optional<size_t> memory_budget, const std::vector<std::string>& table_names) const {
+  auto& storage_manager = Hyrise::get().storage_manager;
+
+  // 1. Collect the segments of all immutable chunks. Mutable chunks are still being inserted into.
+  struct SegmentInfo {
+    std::string table_name;
+    ChunkID chunk_id;
+    ColumnID column_id;
+    DataType data_type;
+    std::shared_ptr<const AbstractSegment> segment;
+  };
+  auto segments = std::vector<SegmentInfo>{};
+
+  for (const auto& table_name : table_names.empty() ? storage_manager.table_names() : table_names) {
+    const auto table = storage_manager.get_table(table_name);
+    const auto chunk_count = table->chunk_count();
+    const auto column_count = table->column_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      if (!chunk || chunk->is_mutable()) {
+        continue;
+      }
+
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        segments.emplace_back(SegmentInfo{table_name, chunk_id, column_id, table->column_data_type(column_id),
+                                          chunk->get_segment(column_id)});
+      }
+    }
+  }
+
+  // 2. Estimate the size and access cost of each encoding per segment
+  const auto segment_count = segments.size();
+  auto candidates_per_segment = std::vector<std::vector<SegmentEncodingCandidate>>(segment_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(segment_count);
+  for (auto segment_idx = size_t{0}; segment_idx < segment_count; ++segment_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, segment_idx]() {
+      const auto& segment_info = segments[segment_idx];
+      auto candidates = segment_candidates(segment_info.segment, segment_info.data_type);
+
+      // Only keep the candidates for which no other candidate is both smaller and cheaper to access. Sorted by their
+      // access cost, the remaining candidates become smaller with each step.
+      std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+        return std::tie(lhs.access_cost, lhs.estimated_size) < std::tie(rhs.access_cost, rhs.estimated_size);
+      });
+      auto& pareto_candidates = candidates_per_segment[segment_idx];
+      for (const auto& candidate : candidates) {
+        if (pareto_candidates.empty() || candidate.estimated_size < pareto_candidates.back().estimated_size) {
+          pareto_candidates.emplace_back(candidate);
+        }
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  // 3. Start with the cheapest encoding of each segment. While the budget is exceeded, switch the segment to its next
+  //    smaller encoding for which the access cost increases the least per saved byte.
+  auto chosen_candidate_indices = std::vector<size_t>(segment_count, 0);
+  auto total_size = size_t{0};
+  for (const auto& candidates : candidates_per_segment) {
+    total_size += candidates.front().estimated_size;
+  }
+
+  if (memory_budget && total_size > *memory_budget) {
+    const auto cost_per_saved_byte = [&](const size_t segment_idx) {
+      const auto& candidates = candidates_per_segment[segment_idx];
+      const auto& current = candidates[chosen_candidate_indices[segment_idx]];
+      const auto& next = candidates[chosen_candidate_indices[segment_idx] + 1];
+      return (next.access_cost - current.access_cost) /
+             static_cast<double>(current.estimated_size - next.estimated_size);
+    };
+
+    using Switch = std::pair<double, size_t>;
+    auto switches = std::priority_queue<Switch, std::vector<Switch>, std::greater<Switch>>{};
+    for (auto segment_idx = size_t{0}; segment_idx < segment_count; ++segment_idx) {
+      if (candidates_per_segment[segment_idx].size() > 1) {
+        switches.emplace(cost_per_saved_byte(segment_idx), segment_idx);
+      }
+    }
+
+    while (total_size > *memory_budget && !switches.empty()) {
+      const auto segment_idx = switches.top().second;
+      switches.pop();
+
+      const auto& candidates = candidates_per_segment[segment_idx];
+      auto& candidate_idx = chosen_candidate_indices[segment_idx];
+      total_size -= candidates[candidate_idx].estimated_size - candidates[candidate_idx + 1].estimated_size;
+      ++candidate_idx;
+
+      if (candidate_idx + 1 < candidates.size()) {
+        switches.emplace(cost_per_saved_byte(segment_idx), segment_idx);
+      }
+    }
+  }
+
+  auto recommendations = std::vector<SegmentEncodingRecommendation>{};
+  recommendations.reserve(segment_count);
+  for (auto segment_idx = size_t{0}; segment_idx < segment_count; ++segment_idx) {
+    const auto& segment_info = segments[segment_idx];
+    const auto& candidate = candidates_per_segment[segment_idx][chosen_candidate_indices[segment_idx]];
+    recommendations.emplace_back(SegmentEncodingRecommendation{
+        segment_info.table_name, segment_info.chunk_id, segment_info.column_id,
+        get_segment_encoding_spec(segment_info.segment), candidate.encoding_spec, candidate.estimated_size,
+        candidate.access_cost});
+  }
+
+  return recommendations;
+}
+
+size_t EncodingAdvisor::apply(const std::vector<SegmentEncodingRecommendation>& recommendations) {
+  auto& storage_manager = Hyrise::get().storage_manager;
+
+  auto reencoded_segment_count = size_t{0};
+  for (const auto& recommendation : recommendations) {
+    if (!storage_manager.has_table(recommendation.table_name)) {
+      continue;
+    }
+
+    const auto table = storage_manager.get_table(recommendation.table_name);
+    const auto chunk = table->get_chunk(recommendation.chunk_id);
+    if (!chunk || chunk->is_mutable()) {
+      continue;
+    }
+
+    const auto segment = chunk->get_segment(recommendation.column_id);
+    if (get_segment_encoding_spec(segment) == recommendation.recommended_encoding_spec) {
+      continue;
+    }
+
+    // Copy the access counter before encoding, as reading the segment for the encoding increases its counters
+    const auto access_counter = segment->access_counter;
+    const auto encoded_segment = ChunkEncoder::encode_segment(
+        segment, table->column_data_type(recommendation.column_id), recommendation.recommended_encoding_spec);
+    if (encoded_segment == segment) {
+      continue;
+    }
+    encoded_segment->access_counter = access_counter;
+
+    chunk->replace_segment(recommendation.column_id, encoded_segment);
+    ++reencoded_segment_count;
+  }
+
+  return reencoded_segment_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "storage/encoding_type.hpp"
+#include "storage/segment_access_counter.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+/**
+ * @brief Chooses the encoding of each segment of the stored tables
+ *
+ * For every segment of an immutable chunk, the advisor encodes a sample of the segment with each SegmentEncodingSpec
+ * that supports the segment's data type and scales the size of the encoded sample to the size of the segment. The
+ * sample consists of several runs of consecutive rows, so that run lengths and value locality are preserved. All
+ * candidates, including the segment's current encoding, are estimated this way, so that their sizes are comparable.
+ * The estimate is exact for segments that are not larger than the sample.
+ *
+ * The estimated sizes are weighed against the access costs of each encoding. The access cost of a segment is the sum
+ * of its SegmentAccessCounter values (i.e., the number of values accessed by point, sequential, monotonic, and random
+ * accesses), each multiplied with the relative cost per value of the respective access type for the encoding (see
+ * access_cost_per_value). Sequential and monotonic accesses stream through the segment, so they additionally cost
+ * SCAN_COST_PER_BYTE for each byte of the estimated size per value. Thus, smaller encodings can be cheaper to scan
+ * than unencoded segments. Accesses to the dictionary of a DictionarySegment are a consequence of its encoding, not
+ * of the workload, and are not counted.
+ *
+ * Without a memory budget, each segment gets the encoding with the lowest access cost, ties are broken by size. As
+ * segments that have not been accessed have no access cost, they are encoded with the smallest encoding. With a
+ * memory budget, the advisor greedily switches segments to smaller encodings until the estimated size of all segments
+ * fits into the budget, always picking the switch that increases the access cost the least per byte saved.
+ *
+ * The recommendations can be applied while the tables are in use. As for the ChunkCompressionTask, the segments are
+ * replaced atomically and the order of the rows does not change. The access counters are carried over to the new
+ * segments, so that later recommendations still take the past accesses into account.
+ */
+class EncodingAdvisor {
+ public:
+  // Number of rows that are encoded to estimate the size of a segment
+  static constexpr auto DEFAULT_SAMPLE_SIZE = ChunkOffset{4'096};
+  // Number of runs of consecutive rows the sample is made of
+  static constexpr auto SAMPLE_RUN_COUNT = size_t{8};
+  // Cost of reading one byte of a segment in a sequential or monotonic access, relative to access_cost_per_value.
+  // Reading four bytes costs as much as reading an unencoded value, ignoring the bytes.
+  static constexpr auto SCAN_COST_PER_BYTE = 0.25;
+
+  struct SegmentEncodingCandidate {
+    SegmentEncodingSpec encoding_spec;
+    size_t estimated_size{};
+    double access_cost{};
+  };
+
+  struct SegmentEncodingRecommendation {
+    std::string table_name;
+    ChunkID chunk_id{};
+    ColumnID column_id{};
+    SegmentEncodingSpec current_encoding_spec;
+    SegmentEncodingSpec recommended_encoding_spec;
+    size_t estimated_size{};
+    double access_cost{};
+  };
+
+  explicit EncodingAdvisor(const ChunkOffset sample_size = DEFAULT_SAMPLE_SIZE);
+
+  // Relative cost of accessing a single value of a segment with the given encoding, without the cost of reading its
+  // bytes (see SCAN_COST_PER_BYTE). Reading a value of an unencoded segment sequentially has a cost of 1.
+  static double access_cost_per_value(const SegmentEncodingSpec& encoding_spec,
+                                      const SegmentAccessCounter::AccessType access_type);
+
+  // Returns a candidate for each SegmentEncodingSpec that supports @param data_type, with the estimated size of
+  // @param segment in that encoding and the access cost based on the segment's access counter
+  std::vector<SegmentEncodingCandidate> segment_candidates(const std::shared_ptr<const AbstractSegment>& segment,
+                                                           const DataType data_type) const;
+
+  // Recommends an encoding for every segment of the immutable chunks of @param table_names (or of all stored tables,
+  // if none are given), so that the estimated size of all these segments does not exceed @param memory_budget (in
+  // bytes). If the budget is too small, the smallest encoding is recommended for every segment.
+  std::vector<SegmentEncodingRecommendation> recommend(const std::optional<size_t> memory_budget,
+                                                       const std::vector<std::string>& table_names = {}) const;
+
+  // Re-encodes the segments whose recommended encoding differs from their current encoding. Segments whose chunk has
+  // been removed in the meantime are skipped. Returns the number of re-encoded segments.
+  static size_t apply(const std::vector<SegmentEncodingRecommendation>& recommendations);
+
+ protected:
+  const ChunkOffset _sample_size;
+};
+
+}  // namespace opossum
@@ -0,0 +1,242 @@
+#include "table_key_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <boost/container_hash/hash.hpp>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TableKeyIndex::TableKeyIndex(const Table& table, const TableKeyConstraint& table_key_constraint)
+    : _table(table),
+      _column_ids([&]() {
+        auto column_ids =
+            std::vector<ColumnID>(table_key_constraint.columns().cbegin(), table_key_constraint.columns().cend());
+        std::sort(column_ids.begin(), column_ids.end());
+        return column_ids;
+      }()),
+      _key_type(table_key_constraint.key_type()) {
+  Assert(_table.type() == TableType::Data, "TableKeyIndex can only be created for data tables");
+  Assert(!_column_ids.empty(), "TableKeyIndex requires at least one column");
+}
+
+void TableKeyIndex::add_rows(const std::vector<ChunkOffset>& begin_chunk_sizes,
+                             const std::vector<ChunkOffset>& end_chunk_sizes) {
+  // Materialize the keys of each chunk column by column instead of accessing single values through the segments
+  const auto chunk_count = static_cast<ChunkID::base_type>(end_chunk_sizes.size());
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = _table.get_chunk(chunk_id);
+    const auto begin_offset = chunk_id < begin_chunk_sizes.size() ? begin_chunk_sizes[chunk_id] : ChunkOffset{0};
+    const auto end_offset = end_chunk_sizes[chunk_id];
+    if (!chunk || begin_offset >= end_offset) {
+      continue;
+    }
+
+    const auto row_count = static_cast<size_t>(end_offset - begin_offset);
+    auto keys = std::vector<Key>(row_count, Key(_column_ids.size()));
+    auto key_contains_null = std::vector<bool>(row_count);
+
+    for (auto key_column_index = size_t{0}; key_column_index < _column_ids.size(); ++key_column_index) {
+      const auto& segment = *chunk->get_segment(_column_ids[key_column_index]);
+      resolve_data_type(_table.column_data_type(_column_ids[key_column_index]), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        // Rows beyond end_offset might have been appended, but not written yet
+        segment_with_iterators<ColumnDataType>(segment, [&](auto iter, [[maybe_unused]] const auto segment_end) {
+          const auto end = iter + end_offset;
+          for (iter += begin_offset; iter != end; ++iter) {
+            const auto row_index = iter->chunk_offset() - begin_offset;
+            if (iter->is_null()) {
+              key_contains_null[row_index] = true;
+            } else {
+              keys[row_index][key_column_index] = iter->value();
+            }
+          }
+        });
+      });
+    }
+
+    for (auto chunk_offset = begin_offset; chunk_offset < end_offset; ++chunk_offset) {
+      const auto row_index = chunk_offset - begin_offset;
+      if (key_contains_null[row_index]) {
+        continue;
+      }
+
+      // Rows that were deleted or rolled back do not count towards uniqueness, but they may still be visible to
+      // running transactions
+      const auto is_deleted = [&](const RowID& row_id) {
+        const auto row_mvcc_data = _table.get_chunk(row_id.chunk_id)->mvcc_data();
+        return row_mvcc_data && row_mvcc_data->get_end_cid(row_id.chunk_offset) != MvccData::MAX_COMMIT_ID;
+      };
+
+      const auto row_id = RowID{chunk_id, chunk_offset};
+      auto& partition = _partition(keys[row_index]);
+      auto& row_ids = partition.entries[std::move(keys[row_index])];
+      if (!is_deleted(row_id)) {
+        Assert(std::all_of(row_ids.cbegin(), row_ids.cend(), is_deleted),
+               "Cannot create TableKeyIndex: table contains duplicate keys");
+      }
+      row_ids.emplace_back(row_id);
+    }
+  }
+}
+
+const std::vector<ColumnID>& TableKeyIndex::column_ids() const {
+  return _column_ids;
+}
+
+KeyConstraintType TableKeyIndex::key_type() const {
+  return _key_type;
+}
+
+std::vector<RowID> TableKeyIndex::lookup(const Key& key) const {
+  DebugAssert(key.size() == _column_ids.size(), "Key does not match the indexed columns");
+
+  const auto& partition = _partition(key);
+  const auto lock = std::lock_guard<std::mutex>{partition.mutex};
+
+  const auto iter = partition.entries.find(key);
+  if (iter == partition.entries.cend()) {
+    return {};
+  }
+  return iter->second;
+}
+
+std::optional<TableKeyIndex::Key> TableKeyIndex::key_of_row(const Chunk& chunk, const ChunkOffset chunk_offset) const {
+  auto key = Key{};
+  key.reserve(_column_ids.size());
+  for (const auto column_id : _column_ids) {
+    auto value = (*chunk.get_segment(column_id))[chunk_offset];
+    if (variant_is_null(value)) {
+      return std::nullopt;
+    }
+    key.emplace_back(std::move(value));
+  }
+  return key;
+}
+
+bool TableKeyIndex::try_insert(const Key& key, const RowID row_id, const TransactionID transaction_id) {
+  DebugAssert(key.size() == _column_ids.size(), "Key does not match the indexed columns");
+
+  auto& partition = _partition(key);
+  const auto lock = std::lock_guard<std::mutex>{partition.mutex};
+
+  auto& row_ids = partition.entries[key];
+
+  // Remove the entries of rows that no transaction can see anymore while we are looking at them anyway
+  auto has_conflict = false;
+  row_ids.erase(std::remove_if(row_ids.begin(), row_ids.end(),
+                               [&](const RowID& indexed_row_id) {
+                                 const auto row_state = _row_state(indexed_row_id, transaction_id);
+                                 has_conflict |= row_state == RowState::Conflicting;
+                                 return row_state == RowState::Dead;
+                               }),
+                row_ids.end());
+
+  if (has_conflict) {
+    if (row_ids.empty()) {
+      partition.entries.erase(key);
+    }
+    return false;
+  }
+
+  row_ids.emplace_back(row_id);
+  return true;
+}
+
+void TableKeyIndex::erase(const Key& key, const RowID row_id) {
+  auto& partition = _partition(key);
+  const auto lock = std::lock_guard<std::mutex>{partition.mutex};
+
+  const auto iter = partition.entries.find(key);
+  if (iter == partition.entries.end()) {
+    return;
+  }
+
+  auto& row_ids = iter->second;
+  row_ids.erase(std::remove(row_ids.begin(), row_ids.end(), row_id), row_ids.end());
+  if (row_ids.empty()) {
+    partition.entries.erase(iter);
+  }
+}
+
+size_t TableKeyIndex::memory_usage() const {
+  auto bytes = sizeof(*this) + _column_ids.capacity() * sizeof(ColumnID);
+  for (const auto& partition : _partitions) {
+    const auto lock = std::lock_guard<std::mutex>{partition.mutex};
+    bytes += partition.entries.bucket_count() * sizeof(void*);
+    for (const auto& [key, row_ids] : partition.entries) {
+      // Estimate the size of a hash map node. Strings are only accounted for with their inline size.
+      bytes += sizeof(void*) + sizeof(Key) + key.capacity() * sizeof(AllTypeVariant) + sizeof(std::vector<RowID>) +
+               row_ids.capacity() * sizeof(RowID);
+    }
+  }
+  return bytes;
+}
+
+size_t TableKeyIndex::KeyHash::operator()(const Key& key) const {
+  auto hash = size_t{0};
+  for (const auto& value : key) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+  }
+  return hash;
+}
+
+TableKeyIndex::Partition& TableKeyIndex::_partition(const Key& key) {
+  return _partitions[KeyHash{}(key) % PARTITION_COUNT];
+}
+
+const TableKeyIndex::Partition& TableKeyIndex::_partition(const Key& key) const {
+  return _partitions[KeyHash{}(key) % PARTITION_COUNT];
+}
+
+TableKeyIndex::RowState TableKeyIndex::_row_state(const RowID row_id, const TransactionID transaction_id) const {
+  const auto chunk = _table.get_chunk(row_id.chunk_id);
+  if (!chunk) {
+    // The chunk was physically deleted, which requires all of its rows to be invalidated
+    return RowState::Dead;
+  }
+
+  const auto mvcc_data = chunk->mvcc_data();
+  if (!mvcc_data) {
+    return RowState::Conflicting;
+  }
+
+  // Read the TID first. Commits and rollbacks reset it last, so the CIDs read afterwards reflect their outcome.
+  const auto row_transaction_id = mvcc_data->get_tid(row_id.chunk_offset);
+  const auto begin_cid = mvcc_data->get_begin_cid(row_id.chunk_offset);
+  const auto end_cid = mvcc_data->get_end_cid(row_id.chunk_offset);
+
+  if (end_cid != MvccData::MAX_COMMIT_ID) {
+    // The row was deleted by a committed transaction or its insert was rolled back (end_cid == 0). Once the commit is
+    // complete and all transactions that might still see the row are finished, the entry can be removed.
+    const auto& transaction_manager = Hyrise::get().transaction_manager;
+    const auto lowest_snapshot_commit_id = transaction_manager.get_lowest_active_snapshot_commit_id();
+    if (end_cid <= transaction_manager.last_commit_id() &&
+        (!lowest_snapshot_commit_id || end_cid <= *lowest_snapshot_commit_id)) {
+      return RowState::Dead;
+    }
+    return RowState::NotConflicting;
+  }
+
+  if (begin_cid != MvccData::MAX_COMMIT_ID) {
+    // The row is committed. Unless the inserting transaction is about to delete it, it still exists at commit time.
+    return row_transaction_id == transaction_id ? RowState::NotConflicting : RowState::Conflicting;
+  }
+
+  // The row is being inserted, either by another transaction or by this one. If this transaction deleted a row that
+  // it inserted itself, Delete has reset the TID.
+  return row_transaction_id == INVALID_TRANSACTION_ID ? RowState::NotConflicting : RowState::Conflicting;
+}
+
+}  // namespace opossum
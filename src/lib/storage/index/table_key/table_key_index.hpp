@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "storage/table_key_constraint.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+/**
+ * The TableKeyIndex is a hash index on the columns of a TableKeyConstraint. Different from the indexes in
+ * storage/index/, which are built for a single immutable chunk, it covers all chunks of a table, including the mutable
+ * chunk that Insert appends to. It serves two purposes: point lookups by key (see KeyIndexScan) and the enforcement of
+ * the key constraint during Insert and Update.
+ *
+ * The index is not versioned. Instead, it maps each key to the RowIDs of all versions of that key that might still be
+ * visible to a transaction, and the MVCC data of the table decides which of them exist for a given snapshot:
+ *
+ *  - Insert adds its rows via try_insert() before it is committed. A new row conflicts with an existing entry unless
+ *    that entry's row was deleted by a committed transaction, has been deleted by the inserting transaction itself
+ *    (e.g., in an Update that keeps the key), or was rolled back.
+ *  - When an Insert is rolled back, its entries are erased.
+ *  - Delete does not touch the index. Entries of deleted rows remain until no active transaction can see the rows
+ *    anymore. They are then removed lazily by try_insert().
+ *
+ * Consequently, lookup() returns candidates. The rows have to be validated like the output of any other scan.
+ *
+ * Keys that contain NULL are not indexed, as NULL is never equal to another value. For PRIMARY KEYs, the table
+ * ensures that the columns are not nullable.
+ *
+ * The entries are split into partitions by the hash of the key, each of which is protected by its own mutex.
+ */
+class TableKeyIndex : private Noncopyable {
+ public:
+  // The key values in the order of column_ids(). Values must have the data type of the respective column.
+  using Key = std::vector<AllTypeVariant>;
+
+  // Creates an empty index. Use Table::create_key_index to create an index for the rows of a table.
+  TableKeyIndex(const Table& table, const TableKeyConstraint& table_key_constraint);
+
+  // Adds the rows of each chunk from @param begin_chunk_sizes (0 for chunks not listed) to @param end_chunk_sizes.
+  // Fails if two rows that have not been deleted share a key.
+  void add_rows(const std::vector<ChunkOffset>& begin_chunk_sizes, const std::vector<ChunkOffset>& end_chunk_sizes);
+
+  // The indexed columns, sorted by ColumnID
+  const std::vector<ColumnID>& column_ids() const;
+  KeyConstraintType key_type() const;
+
+  // Returns the RowIDs of all indexed rows with the given key, regardless of whether they are visible.
+  std::vector<RowID> lookup(const Key& key) const;
+
+  // Reads the key of a row from the table. Returns std::nullopt if the key contains NULL.
+  std::optional<Key> key_of_row(const Chunk& chunk, const ChunkOffset chunk_offset) const;
+
+  // Adds the row (which has to be inserted, but not committed by the transaction) to the index. Returns false and
+  // leaves the index unchanged if another row with the same key conflicts with it (see above).
+  bool try_insert(const Key& key, const RowID row_id, const TransactionID transaction_id);
+
+  // Removes the row from the index, if present.
+  void erase(const Key& key, const RowID row_id);
+
+  size_t memory_usage() const;
+
+ protected:
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  static constexpr auto PARTITION_COUNT = size_t{64};
+
+  struct Partition {
+    mutable std::mutex mutex;
+    std::unordered_map<Key, std::vector<RowID>, KeyHash> entries;
+  };
+
+  Partition& _partition(const Key& key);
+  const Partition& _partition(const Key& key) const;
+
+  enum class RowState { Conflicting, NotConflicting, Dead };
+  RowState _row_state(const RowID row_id, const TransactionID transaction_id) const;
+
+  const Table& _table;
+  const std::vector<ColumnID> _column_ids;
+  const KeyConstraintType _key_type;
+
+  std::array<Partition, PARTITION_COUNT> _partitions;
+};
+
+}  // namespace opossum
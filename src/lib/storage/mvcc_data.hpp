@@ -13,6 +13,7 @@ namespace opossum {
  */
 struct MvccData {
   friend class Chunk;
+  friend class Validate;
   friend std::ostream& operator<<(std::ostream& stream, const MvccData& mvcc_data);
 
  public:
@@ -0,0 +1,184 @@
+#include "bitmap_pos_list.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace {
+
+// Returns the position of the set bit of the word with the given rank, i.e., with rank set bits below it. Skips whole
+// bytes first, so that at most eight bytes and seven bits are looked at.
+size_t select_in_word(uint64_t word, size_t rank) {
+  auto offset = size_t{0};
+  while (true) {
+    const auto byte_bit_count = static_cast<size_t>(__builtin_popcountll(word & 0xFFu));
+    if (rank < byte_bit_count) {
+      break;
+    }
+    rank -= byte_bit_count;
+    word >>= 8u;
+    offset += 8;
+  }
+
+  for (; rank > 0; --rank) {
+    word &= word - 1;
+  }
+  return offset + static_cast<size_t>(__builtin_ctzll(word));
+}
+
+}  // namespace
+
+namespace opossum {
+
+BitmapPosList::BitmapPosList(const ChunkID chunk_id, Bitmap bitmap) : _chunk_id(chunk_id), _bitmap(std::move(bitmap)) {
+  DebugAssert(_chunk_id != INVALID_CHUNK_ID, "Cannot create BitmapPosList for INVALID_CHUNK_ID");
+
+  _ranks.resize(_bitmap.size());
+  for (auto word_index = size_t{0}; word_index < _bitmap.size(); ++word_index) {
+    _ranks[word_index] = static_cast<ChunkOffset::base_type>(_size);
+    _size += static_cast<size_t>(__builtin_popcountll(_bitmap[word_index]));
+  }
+
+  // Sample the word of the first position of each block. As the positions are ascending, one pass over the words
+  // suffices.
+  const auto block_count = (_size + SELECT_SAMPLE_RATE - 1) / SELECT_SAMPLE_RATE;
+  _select_samples.resize(block_count);
+  auto word_index = size_t{0};
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto first_position = block_index * SELECT_SAMPLE_RATE;
+    while (word_index + 1 < _ranks.size() && _ranks[word_index + 1] <= first_position) {
+      ++word_index;
+    }
+    _select_samples[block_index] = static_cast<uint32_t>(word_index);
+  }
+
+  // Blocks whose positions spread across too many words store them explicitly. These blocks cover at least
+  // MAX_SCANNED_WORDS words, so the explicit offsets never need more memory than the bitmap itself.
+  const auto last_word_index = _select_samples.empty() ? size_t{0} : _word_of_last_position();
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    const auto first_word_index = size_t{_select_samples[block_index]};
+    const auto end_word_index =
+        block_index + 1 < block_count ? size_t{_select_samples[block_index + 1]} : last_word_index;
+    if (end_word_index - first_word_index <= MAX_SCANNED_WORDS) {
+      continue;
+    }
+
+    const auto first_position = block_index * SELECT_SAMPLE_RATE;
+    const auto end_position = std::min(first_position + SELECT_SAMPLE_RATE, _size);
+    _select_samples[block_index] = SPARSE_BLOCK_FLAG | static_cast<uint32_t>(_sparse_block_offsets.size());
+
+    auto rank = size_t{_ranks[first_word_index]};
+    for (auto sparse_word_index = first_word_index; rank < end_position; ++sparse_word_index) {
+      for (auto bits = _bitmap[sparse_word_index]; bits && rank < end_position; bits &= bits - 1, ++rank) {
+        if (rank >= first_position) {
+          _sparse_block_offsets.emplace_back(static_cast<ChunkOffset::base_type>(
+              sparse_word_index * BITS_PER_WORD + static_cast<size_t>(__builtin_ctzll(bits))));
+        }
+      }
+    }
+  }
+}
+
+size_t BitmapPosList::word_count(const size_t chunk_size) {
+  return (chunk_size + BITS_PER_WORD - 1) / BITS_PER_WORD;
+}
+
+bool BitmapPosList::is_more_compact(const size_t position_count, const size_t chunk_size) {
+  // Each word of the bitmap comes with its rank
+  const auto bytes_per_word = sizeof(Bitmap::value_type) + sizeof(ChunkOffset::base_type);
+  const auto select_sample_count = (position_count + SELECT_SAMPLE_RATE - 1) / SELECT_SAMPLE_RATE;
+  const auto bitmap_memory_usage = word_count(chunk_size) * bytes_per_word + select_sample_count * sizeof(uint32_t);
+  return bitmap_memory_usage < position_count * sizeof(RowID);
+}
+
+std::shared_ptr<BitmapPosList> BitmapPosList::try_create(const RowIDPosList& pos_list, const ChunkOffset chunk_size) {
+  if (pos_list.empty() || !pos_list.references_single_chunk() || !is_more_compact(pos_list.size(), chunk_size)) {
+    return nullptr;
+  }
+
+  auto bitmap = Bitmap(word_count(chunk_size));
+  auto previous_offset = std::optional<ChunkOffset>{};
+  for (const auto& row_id : pos_list) {
+    if ((previous_offset && row_id.chunk_offset <= *previous_offset) || row_id.chunk_offset >= chunk_size) {
+      return nullptr;
+    }
+    const auto offset = static_cast<size_t>(row_id.chunk_offset);
+    bitmap[offset / BITS_PER_WORD] |= uint64_t{1} << (offset % BITS_PER_WORD);
+    previous_offset = row_id.chunk_offset;
+  }
+
+  return std::make_shared<BitmapPosList>(pos_list.common_chunk_id(), std::move(bitmap));
+}
+
+bool BitmapPosList::references_single_chunk() const {
+  return true;
+}
+
+ChunkID BitmapPosList::common_chunk_id() const {
+  return _chunk_id;
+}
+
+RowID BitmapPosList::operator[](const size_t index) const {
+  DebugAssert(index < _size, "Index out of bounds of BitmapPosList");
+  return *Iterator{this, index};
+}
+
+const BitmapPosList::Bitmap& BitmapPosList::bitmap() const {
+  return _bitmap;
+}
+
+bool BitmapPosList::empty() const {
+  return _size == 0;
+}
+
+size_t BitmapPosList::size() const {
+  return _size;
+}
+
+size_t BitmapPosList::memory_usage(const MemoryUsageCalculationMode /*mode*/) const {
+  return sizeof *this + _bitmap.capacity() * sizeof(Bitmap::value_type) +
+         _ranks.capacity() * sizeof(ChunkOffset::base_type) + _select_samples.capacity() * sizeof(uint32_t) +
+         _sparse_block_offsets.capacity() * sizeof(ChunkOffset::base_type);
+}
+
+BitmapPosList::Iterator BitmapPosList::begin() const {
+  return Iterator{this, 0};
+}
+
+BitmapPosList::Iterator BitmapPosList::end() const {
+  return Iterator{this, _size};
+}
+
+BitmapPosList::Iterator BitmapPosList::cbegin() const {
+  return begin();
+}
+
+BitmapPosList::Iterator BitmapPosList::cend() const {
+  return end();
+}
+
+size_t BitmapPosList::_select(const size_t index) const {
+  const auto sample = _select_samples[index / SELECT_SAMPLE_RATE];
+  if (sample & SPARSE_BLOCK_FLAG) {
+    return _sparse_block_offsets[(sample & ~SPARSE_BLOCK_FLAG) + index % SELECT_SAMPLE_RATE];
+  }
+
+  // The last word whose preceding words hold at most index positions, at most MAX_SCANNED_WORDS after the sample.
+  // Words without positions share their rank with the next word, so they are skipped.
+  auto word_index = size_t{sample};
+  while (word_index + 1 < _ranks.size() && _ranks[word_index + 1] <= index) {
+    ++word_index;
+  }
+  return word_index * BITS_PER_WORD + select_in_word(_bitmap[word_index], index - _ranks[word_index]);
+}
+
+size_t BitmapPosList::_word_of_last_position() const {
+  auto word_index = _bitmap.size() - 1;
+  while (!_bitmap[word_index]) {
+    --word_index;
+  }
+  return word_index;
+}
+
+}  // namespace opossum
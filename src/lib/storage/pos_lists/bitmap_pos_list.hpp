@@ -0,0 +1,161 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_pos_list.hpp"
+#include "row_id_pos_list.hpp"
+
+namespace opossum {
+
+// The BitmapPosList references rows of a single chunk by storing one bit per row of that chunk. Its positions are
+// always ordered by their ChunkOffset and contain neither duplicates nor NULLs. For predicates that are not very
+// selective, it needs far less memory than a RowIDPosList, which stores eight bytes per position. More importantly,
+// combining the results of two predicates on the same chunk becomes a bitwise operation on the bitmaps instead of a
+// merge of two sorted lists (see Validate and UnionPositions).
+//
+// Random access via operator[] is a select operation (finding the n-th set bit) in constant time: For every
+// SELECT_SAMPLE_RATE-th position, the word holding it is sampled. From there, the word of any position of that block
+// is at most MAX_SCANNED_WORDS words ahead and is found via the number of set bits before each word. Blocks that spread
+// across more words store their positions explicitly. The iterators walk the set bits sequentially and only select
+// for larger jumps.
+
+class BitmapPosList final : public AbstractPosList {
+ public:
+  using Bitmap = std::vector<uint64_t>;
+  static constexpr auto BITS_PER_WORD = size_t{64};
+  static constexpr auto SELECT_SAMPLE_RATE = size_t{64};
+  static constexpr auto MAX_SCANNED_WORDS = size_t{32};
+
+  class Iterator : public boost::iterator_facade<Iterator, RowID, boost::random_access_traversal_tag, RowID> {
+   public:
+    Iterator(const BitmapPosList* pos_list, const size_t index) : _pos_list(pos_list) {
+      _seek(index);
+    }
+
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
+
+    void increment() {
+      ++_index;
+      _remaining_bits &= _remaining_bits - 1;
+      const auto word_count = _pos_list->_bitmap.size();
+      while (!_remaining_bits && ++_word_index < word_count) {
+        _remaining_bits = _pos_list->_bitmap[_word_index];
+      }
+    }
+
+    void decrement() {
+      _seek(_index - 1);
+    }
+
+    void advance(const std::ptrdiff_t n) {
+      // Skipping a few positions is cheaper by walking the bits than by searching for the new position
+      if (n >= 0 && n < static_cast<std::ptrdiff_t>(BITS_PER_WORD)) {
+        for (auto step = std::ptrdiff_t{0}; step < n; ++step) {
+          increment();
+        }
+      } else {
+        _seek(_index + n);
+      }
+    }
+
+    bool equal(const Iterator& other) const {
+      DebugAssert(_pos_list == other._pos_list, "Iterator compared to iterator on different BitmapPosList instance");
+      return _index == other._index;
+    }
+
+    std::ptrdiff_t distance_to(const Iterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._index) - static_cast<std::ptrdiff_t>(_index);
+    }
+
+    RowID dereference() const {
+      DebugAssert(_index < _pos_list->size(), "past-the-end BitmapPosList::Iterator dereferenced");
+      const auto offset_in_word = static_cast<size_t>(__builtin_ctzll(_remaining_bits));
+      return RowID{_pos_list->_chunk_id, static_cast<ChunkOffset>(_word_index * BITS_PER_WORD + offset_in_word)};
+    }
+
+    void _seek(const size_t index) {
+      _index = index;
+      if (index >= _pos_list->size()) {
+        _word_index = _pos_list->_bitmap.size();
+        _remaining_bits = 0;
+        return;
+      }
+      const auto offset = _pos_list->_select(index);
+      _word_index = offset / BITS_PER_WORD;
+      // Clear the bits before the index-th position
+      _remaining_bits = _pos_list->_bitmap[_word_index] & (~uint64_t{0} << (offset % BITS_PER_WORD));
+    }
+
+    const BitmapPosList* _pos_list;
+    size_t _index{};
+    size_t _word_index{};
+
+    // Bits of the current word from the current position onwards. The current position is the lowest set bit.
+    uint64_t _remaining_bits{};
+  };
+
+  // Bit i of the bitmap represents ChunkOffset i of the chunk chunk_id. Thus, the bitmap should have
+  // word_count(chunk size) words.
+  BitmapPosList(const ChunkID chunk_id, Bitmap bitmap);
+
+  // Returns the number of words of a bitmap for a chunk with chunk_size rows.
+  static size_t word_count(const size_t chunk_size);
+
+  // Returns whether a BitmapPosList for a chunk with chunk_size rows needs less memory than a RowIDPosList with
+  // position_count positions. Only then, we create BitmapPosLists.
+  static bool is_more_compact(const size_t position_count, const size_t chunk_size);
+
+  // Creates a BitmapPosList with the positions of pos_list if it references a single chunk with chunk_size rows, if its
+  // positions are strictly ascending (i.e., if a bitmap retains their order), and if the bitmap is more compact.
+  // Returns nullptr otherwise.
+  static std::shared_ptr<BitmapPosList> try_create(const RowIDPosList& pos_list, const ChunkOffset chunk_size);
+
+  bool references_single_chunk() const final;
+  ChunkID common_chunk_id() const final;
+
+  RowID operator[](const size_t index) const final;
+
+  // Returns whether the row at chunk_offset is part of the list.
+  bool contains(const ChunkOffset chunk_offset) const {
+    const auto offset = static_cast<size_t>(chunk_offset);
+    const auto word_index = offset / BITS_PER_WORD;
+    return word_index < _bitmap.size() && ((_bitmap[word_index] >> (offset % BITS_PER_WORD)) & 1u);
+  }
+
+  const Bitmap& bitmap() const;
+
+  bool empty() const final;
+  size_t size() const final;
+  size_t memory_usage(const MemoryUsageCalculationMode /*mode*/) const final;
+
+  Iterator begin() const;
+  Iterator end() const;
+  Iterator cbegin() const;
+  Iterator cend() const;
+
+ private:
+  // Returns the chunk offset of the index-th position.
+  size_t _select(const size_t index) const;
+
+  // Returns the index of the last word with a set bit. Requires a non-empty list.
+  size_t _word_of_last_position() const;
+
+  const ChunkID _chunk_id;
+  const Bitmap _bitmap;
+
+  // For each word, the number of set bits in the words before it
+  std::vector<ChunkOffset::base_type> _ranks;
+
+  size_t _size{0};
+
+  // For each block of SELECT_SAMPLE_RATE positions, the index of the word that holds its first position. For blocks
+  // that span more than MAX_SCANNED_WORDS words, SPARSE_BLOCK_FLAG is set instead and the remaining bits give the index
+  // of the block's first position in _sparse_block_offsets.
+  static constexpr auto SPARSE_BLOCK_FLAG = uint32_t{1} << 31;
+  std::vector<uint32_t> _select_samples;
+  std::vector<ChunkOffset::base_type> _sparse_block_offsets;
+};
+
+}  // namespace opossum
@@ -1,39 +1,59 @@
 #include "split_pos_list_by_chunk_id.hpp"
 
+#include <numeric>
+
+#include "resolve_type.hpp"
+
 namespace opossum {
 
 PosListsByChunkID split_pos_list_by_chunk_id(const std::shared_ptr<const AbstractPosList>& input_pos_list,
                                              const size_t number_of_chunks) {
-  DebugAssert(!input_pos_list->references_single_chunk() || input_pos_list->empty(),
-              "No need to split a reference segment that references a single chunk");
+  auto pos_lists_by_chunk_id = PosListsByChunkID{number_of_chunks};
 
-  // The input_pos_list references multiple chunks and we actually need to split it. Because we are supposed to return
-  // shared_ptr<const RowIDPosList>, we first create regular PosLists, add the values to them, and then convert these.
+  if (input_pos_list->references_single_chunk()) {
+    // Single-chunk PosLists (e.g., a BitmapPosList) are not split but used as they are. Their positions do not move.
+    if (!input_pos_list->empty()) {
+      const auto chunk_id = input_pos_list->common_chunk_id();
+      DebugAssert(chunk_id < number_of_chunks, "Inconsistent number_of_chunks passed");
+      auto& mapping = pos_lists_by_chunk_id[chunk_id];
+      mapping.row_ids = input_pos_list;
+      mapping.original_positions.resize(input_pos_list->size());
+      std::iota(mapping.original_positions.begin(), mapping.original_positions.end(), ChunkOffset{0});
+    }
+    return pos_lists_by_chunk_id;
+  }
+
+  // The input_pos_list references multiple chunks and we actually need to split it. We first fill regular
+  // RowIDPosLists and then store these as shared_ptr<const AbstractPosList>.
 
   // Create RowIDPosLists and set them as `references_single_chunk`
-  auto pos_lists_by_chunk_id = PosListsByChunkID{number_of_chunks};
+  auto row_id_pos_lists = std::vector<std::shared_ptr<RowIDPosList>>(number_of_chunks);
 
   for (auto chunk_id = ChunkID{0}; chunk_id < number_of_chunks; ++chunk_id) {
-    DebugAssert(chunk_id < number_of_chunks, "Inconsistent number_of_chunks passed");
-    auto& mapping = pos_lists_by_chunk_id[chunk_id];
-    mapping.row_ids = std::make_shared<RowIDPosList>();
-    mapping.row_ids->guarantee_single_chunk();
-    mapping.row_ids->reserve(input_pos_list->size() / number_of_chunks);
-    mapping.original_positions.reserve(input_pos_list->size() / number_of_chunks);
+    auto& row_ids = row_id_pos_lists[chunk_id];
+    row_ids = std::make_shared<RowIDPosList>();
+    row_ids->guarantee_single_chunk();
+    row_ids->reserve(input_pos_list->size() / number_of_chunks);
+    pos_lists_by_chunk_id[chunk_id].original_positions.reserve(input_pos_list->size() / number_of_chunks);
   }
 
   // Iterate over the input_pos_list and split the entries by chunk_id
-  auto original_position = ChunkOffset{0};
-  for (const auto row_id : *input_pos_list) {
-    if (row_id.is_null()) {
-      original_position++;
-      continue;
+  resolve_pos_list_type(input_pos_list, [&](const auto& resolved_pos_list) {
+    auto original_position = ChunkOffset{0};
+    for (const auto row_id : *resolved_pos_list) {
+      if (row_id.is_null()) {
+        original_position++;
+        continue;
+      }
+
+      DebugAssert(row_id.chunk_id < number_of_chunks, "Inconsistent number_of_chunks passed");
+      row_id_pos_lists[row_id.chunk_id]->emplace_back(row_id);
+      pos_lists_by_chunk_id[row_id.chunk_id].original_positions.emplace_back(original_position++);
     }
+  });
 
-    auto& mapping = pos_lists_by_chunk_id[row_id.chunk_id];
-
-    mapping.row_ids->emplace_back(row_id);
-    mapping.original_positions.emplace_back(original_position++);
+  for (auto chunk_id = ChunkID{0}; chunk_id < number_of_chunks; ++chunk_id) {
+    pos_lists_by_chunk_id[chunk_id].row_ids = std::move(row_id_pos_lists[chunk_id]);
   }
 
   return pos_lists_by_chunk_id;
@@ -13,7 +13,7 @@ namespace opossum {
 // of which references only a single chunk. For each entry in that SubPosList, we need to keep its position in the
 // original PosList so that we can reassemble that PosList if needed.
 struct SubPosList {
-  std::shared_ptr<RowIDPosList> row_ids;
+  std::shared_ptr<const AbstractPosList> row_ids;
   std::vector<ChunkOffset> original_positions;
 };
 
@@ -24,6 +24,8 @@ using PosListsByChunkID = std::vector<SubPosList>;
 // For example, splitting [(1,3), (0,2), (1,2)] gives us two PosLists [(0,2)] and [(1,3), (1,2)] as well as the
 // original positions [1] and [0, 2]. These original positions are needed to reassemble the result.
 // The returned PosListsByChunkID has a guaranteed size of `number_of_chunks`, but the entries might be empty.
+// A PosList that already references a single chunk (e.g., a BitmapPosList) is not copied but becomes the SubPosList of
+// that chunk. The row_ids of all other entries are nullptr in that case.
 
 PosListsByChunkID split_pos_list_by_chunk_id(const std::shared_ptr<const AbstractPosList>& input_pos_list,
                                              const size_t number_of_chunks);
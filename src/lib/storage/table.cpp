@@ -12,6 +12,7 @@
 #include "resolve_type.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/table_key/table_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -29,7 +30,9 @@ Table::Table(const TableColumnDefinitions& column_definitions, const TableType t
       _type(type),
       _use_mvcc(use_mvcc),
       _target_chunk_size(type == TableType::Data ? target_chunk_size.value_or(Chunk::DEFAULT_SIZE) : Chunk::MAX_SIZE),
-      _append_mutex(std::make_unique<std::mutex>()) {
+      _append_mutex(std::make_unique<std::mutex>()),
+      _key_index_mutex(std::make_unique<std::shared_mutex>()),
+      _key_indexes(std::make_shared<const std::vector<std::shared_ptr<TableKeyIndex>>>()) {
   DebugAssert(target_chunk_size <= Chunk::MAX_SIZE, "Chunk size exceeds maximum");
   DebugAssert(type == TableType::Data || !target_chunk_size, "Must not set target_chunk_size for reference tables");
   DebugAssert(!target_chunk_size || *target_chunk_size > 0, "Table must have a chunk size greater than 0.");
@@ -227,6 +230,18 @@ std::shared_ptr<Chunk> Table::last_chunk() const {
   }
 }
 
+std::optional<ChunkID> Table::last_mutable_chunk_id() const {
+  auto chunk_id = chunk_count();
+  while (chunk_id > 0) {
+    --chunk_id;
+    const auto chunk = get_chunk(chunk_id);
+    if (chunk && chunk->is_mutable()) {
+      return chunk_id;
+    }
+  }
+  return std::nullopt;
+}
+
 void Table::remove_chunk(ChunkID chunk_id) {
   DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
   DebugAssert(([this, chunk_id]() {  // NOLINT
@@ -273,6 +288,15 @@ void Table::append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvc
   std::atomic_store(&*new_chunk_iter, std::make_shared<Chunk>(segments, mvcc_data, alloc));
 }
 
+void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
+  Assert(_type == TableType::Data, "Only chunks of data tables can be appended directly.");
+  Assert(chunk->has_mvcc_data() == (_use_mvcc == UseMvcc::Yes), "Supply MvccData to data Tables if MVCC is enabled.");
+  AssertInput(chunk->column_count() == column_count(), "Input does not have the same number of columns.");
+
+  auto new_chunk_iter = _chunks.push_back(nullptr);
+  std::atomic_store(&*new_chunk_iter, chunk);
+}
+
 std::vector<AllTypeVariant> Table::get_row(size_t row_idx) const {
   PerformanceWarning("get_row() used");
   const auto chunk_count = _chunks.size();
@@ -335,6 +359,10 @@ std::unique_lock<std::mutex> Table::acquire_append_mutex() {
   return std::unique_lock<std::mutex>(*_append_mutex);
 }
 
+std::shared_lock<std::shared_mutex> Table::acquire_shared_key_index_mutex() const {
+  return std::shared_lock<std::shared_mutex>(*_key_index_mutex);
+}
+
 std::shared_ptr<TableStatistics> Table::table_statistics() const {
   return _table_statistics;
 }
@@ -382,6 +410,61 @@ void Table::add_soft_key_constraint(const TableKeyConstraint& table_key_constrai
   }
 }
 
+void Table::create_key_index(const TableKeyConstraint& table_key_constraint) {
+  const auto assert_no_key_index_for_columns = [&]() {
+    const auto existing_key_indexes = key_indexes();
+    Assert(std::none_of(existing_key_indexes.cbegin(), existing_key_indexes.cend(),
+                        [&](const auto& key_index) {
+                          return std::unordered_set<ColumnID>(key_index->column_ids().cbegin(),
+                                                              key_index->column_ids().cend()) ==
+                                 table_key_constraint.columns();
+                        }),
+           "Another key index for the same column set has already been created.");
+  };
+
+  const auto chunk_sizes = [&]() {
+    const auto chunk_count = _chunks.size();
+    auto sizes = std::vector<ChunkOffset>(chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = get_chunk(chunk_id);
+      sizes[chunk_id] = chunk ? chunk->size() : ChunkOffset{0};
+    }
+    return sizes;
+  };
+
+  // Once no operator is between appending rows and indexing them, all rows up to the current chunk sizes are complete
+  auto indexed_chunk_sizes = std::vector<ChunkOffset>{};
+  {
+    const auto key_index_lock = std::unique_lock<std::shared_mutex>{*_key_index_mutex};
+    assert_no_key_index_for_columns();
+    indexed_chunk_sizes = chunk_sizes();
+  }
+
+  // Build the index without blocking Inserts. This fails if the table violates the key.
+  auto key_index = std::make_shared<TableKeyIndex>(*this, table_key_constraint);
+  key_index->add_rows({}, indexed_chunk_sizes);
+
+  // Add the rows that were appended in the meantime and publish the index. Operators that acquire the mutex afterwards
+  // add their rows themselves.
+  const auto key_index_lock = std::unique_lock<std::shared_mutex>{*_key_index_mutex};
+  assert_no_key_index_for_columns();
+  key_index->add_rows(indexed_chunk_sizes, chunk_sizes());
+
+  if (std::find(_table_key_constraints.cbegin(), _table_key_constraints.cend(), table_key_constraint) ==
+      _table_key_constraints.cend()) {
+    add_soft_key_constraint(table_key_constraint);
+  }
+
+  auto new_key_indexes = key_indexes();
+  new_key_indexes.emplace_back(std::move(key_index));
+  std::atomic_store(&_key_indexes,
+                    std::make_shared<const std::vector<std::shared_ptr<TableKeyIndex>>>(std::move(new_key_indexes)));
+}
+
+std::vector<std::shared_ptr<TableKeyIndex>> Table::key_indexes() const {
+  return *std::atomic_load(&_key_indexes);
+}
+
 const std::vector<ColumnID>& Table::value_clustered_by() const {
   return _value_clustered_by;
 }
@@ -444,6 +527,10 @@ size_t Table::memory_usage(const MemoryUsageCalculationMode mode) const {
     bytes += column_definition.name.size();
   }
 
+  for (const auto& key_index : key_indexes()) {
+    bytes += key_index->memory_usage();
+  }
+
   // TODO(anybody) Statistics and Indexes missing from Memory Usage Estimation
   // TODO(anybody) TableLayout missing
 
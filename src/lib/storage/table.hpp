@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -20,6 +21,7 @@
 
 namespace opossum {
 
+class TableKeyIndex;
 class TableStatistics;
 
 /**
@@ -96,6 +98,13 @@ class Table : private Noncopyable {
 
   std::shared_ptr<Chunk> last_chunk() const;
 
+  /**
+   * Returns the ID of the last mutable chunk, which is the chunk that Insert appends to, or std::nullopt if there is
+   * none. Usually, this is the last chunk. ReplaceChunk, however, appends immutable chunks after it, so that Insert
+   * keeps filling the partially filled chunk. Chunks before it do not receive new rows anymore.
+   */
+  std::optional<ChunkID> last_mutable_chunk_id() const;
+
   /**
    * Removes the chunk with the given id.
    * Makes sure that the the chunk was fully invalidated by the logical delete before deleting it physically.
@@ -114,6 +123,12 @@ class Table : private Noncopyable {
   void append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvcc_data = nullptr,
                     const std::optional<PolymorphicAllocator<Chunk>>& alloc = std::nullopt);
 
+  /**
+   * Appends an existing Chunk to this table. This allows to finalize a Chunk and to set its sort order and pruning
+   * statistics before it becomes visible to other operators (see ReplaceChunk).
+   */
+  void append_chunk(const std::shared_ptr<Chunk>& chunk);
+
   // Create and append a Chunk consisting of ValueSegments.
   void append_mutable_chunk();
   /** @} */
@@ -173,6 +188,13 @@ class Table : private Noncopyable {
 
   std::unique_lock<std::mutex> acquire_append_mutex();
 
+  /**
+   * Held by operators that add rows (Insert, ReplaceChunk) from appending the rows until they are added to the key
+   * indexes. create_key_index acquires the mutex exclusively, so that it sees the values of all appended rows and
+   * neither misses rows nor indexes them twice.
+   */
+  std::shared_lock<std::shared_mutex> acquire_shared_key_index_mutex() const;
+
   /**
    * Tables, typically those stored in the StorageManager, can be associated with statistics to perform Cardinality
    * estimation during optimization.
@@ -207,6 +229,14 @@ class Table : private Noncopyable {
   void add_soft_key_constraint(const TableKeyConstraint& table_key_constraint);
   const TableKeyConstraints& soft_key_constraints() const;
 
+  /**
+   * Creates a TableKeyIndex for the given key constraint, which is added to the soft key constraints if it is not
+   * known yet. Different from soft key constraints, the key is enforced from then on: Insert fails if a new row
+   * conflicts with an existing one. Rows can be inserted while the index is created.
+   */
+  void create_key_index(const TableKeyConstraint& table_key_constraint);
+  std::vector<std::shared_ptr<TableKeyIndex>> key_indexes() const;
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
@@ -248,6 +278,11 @@ class Table : private Noncopyable {
   std::shared_ptr<TableStatistics> _table_statistics;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexStatistics> _indexes;
+  std::unique_ptr<std::shared_mutex> _key_index_mutex;
+
+  // Replaced atomically when an index is published. Thus, key_indexes() does not acquire the _key_index_mutex, which
+  // Insert and ReplaceChunk already hold while they add their rows to the indexes.
+  std::shared_ptr<const std::vector<std::shared_ptr<TableKeyIndex>>> _key_indexes;
 
   // For tables with _type==Reference, the row count will not vary. As such, there is no need to iterate over all
   // chunks more than once.
@@ -0,0 +1,141 @@
+#include "memory_budget.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include <boost/algorithm/string.hpp>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MemoryBudget::MemoryBudget(const size_t limit) : _limit(limit) {}
+
+size_t MemoryBudget::default_limit(const size_t concurrent_statement_count) {
+  // Unlike the free memory, MemAvailable includes the page cache that the kernel can reclaim. It is only reported on
+  // Linux, otherwise we fall back to the physical memory.
+  auto available_memory = 0.0;
+#ifdef __linux__
+  auto meminfo_file = std::ifstream{"/proc/meminfo"};
+  auto meminfo_line = std::string{};
+  while (std::getline(meminfo_file, meminfo_line)) {
+    if (meminfo_line.starts_with("MemAvailable:")) {
+      // The line looks like "MemAvailable:   12345678 kB"
+      auto line_stream = std::istringstream{meminfo_line.substr(std::strlen("MemAvailable:"))};
+      auto available_kilobytes = size_t{0};
+      if (line_stream >> available_kilobytes) {
+        available_memory = static_cast<double>(available_kilobytes) * 1024.0;
+      }
+      break;
+    }
+  }
+#endif
+
+  if (available_memory == 0.0) {
+    const auto page_count = sysconf(_SC_PHYS_PAGES);
+    const auto page_size = sysconf(_SC_PAGESIZE);
+    Assert(page_count > 0 && page_size > 0, "Could not determine the available memory");
+    available_memory = static_cast<double>(page_count) * static_cast<double>(page_size);
+  }
+
+  return static_cast<size_t>(available_memory * DEFAULT_LIMIT_SHARE /
+                             static_cast<double>(std::max(concurrent_statement_count, size_t{1})));
+}
+
+std::optional<size_t> MemoryBudget::parse_limit(const std::string& value, const size_t concurrent_statement_count) {
+  const auto trimmed_value = boost::trim_copy(value);
+  if (trimmed_value.empty()) {
+    return std::nullopt;
+  }
+
+  if (boost::iequals(trimmed_value, "auto")) {
+    return default_limit(concurrent_statement_count);
+  }
+
+  auto limit = size_t{0};
+  const auto [end, error_code] =
+      std::from_chars(trimmed_value.data(), trimmed_value.data() + trimmed_value.size(), limit);
+  AssertInput(error_code == std::errc{} && end == trimmed_value.data() + trimmed_value.size(),
+              "Expected the memory budget in bytes or 'auto', got '" + value + "'");
+  return limit;
+}
+
+bool MemoryBudget::try_reserve(const size_t bytes) {
+  auto reserved_bytes = _reserved_bytes.load();
+  do {
+    if (bytes > _limit - reserved_bytes) {
+      return false;
+    }
+  } while (!_reserved_bytes.compare_exchange_weak(reserved_bytes, reserved_bytes + bytes));
+
+  auto peak_reserved_bytes = _peak_reserved_bytes.load();
+  while (peak_reserved_bytes < reserved_bytes + bytes &&
+         !_peak_reserved_bytes.compare_exchange_weak(peak_reserved_bytes, reserved_bytes + bytes)) {}
+
+  return true;
+}
+
+void MemoryBudget::release(const size_t bytes) {
+  [[maybe_unused]] const auto previously_reserved_bytes = _reserved_bytes.fetch_sub(bytes);
+  DebugAssert(previously_reserved_bytes >= bytes, "Released more bytes than were reserved");
+}
+
+size_t MemoryBudget::limit() const {
+  return _limit;
+}
+
+size_t MemoryBudget::reserved_bytes() const {
+  return _reserved_bytes.load();
+}
+
+size_t MemoryBudget::peak_reserved_bytes() const {
+  return _peak_reserved_bytes.load();
+}
+
+MemoryReservation::MemoryReservation(const std::shared_ptr<MemoryBudget>& budget) : _budget(budget) {}
+
+MemoryReservation::MemoryReservation(MemoryReservation&& other) noexcept
+    : _budget(std::move(other._budget)), _bytes(std::exchange(other._bytes, 0)) {}
+
+MemoryReservation& MemoryReservation::operator=(MemoryReservation&& other) noexcept {
+  if (this != &other) {
+    shrink(_bytes);
+    _budget = std::move(other._budget);
+    _bytes = std::exchange(other._bytes, 0);
+  }
+  return *this;
+}
+
+MemoryReservation::~MemoryReservation() {
+  shrink(_bytes);
+}
+
+bool MemoryReservation::try_grow(const size_t bytes) {
+  if (_budget && !_budget->try_reserve(bytes)) {
+    return false;
+  }
+
+  _bytes += bytes;
+  return true;
+}
+
+void MemoryReservation::shrink(const size_t bytes) {
+  DebugAssert(bytes <= _bytes, "Cannot shrink reservation below zero");
+  if (_budget) {
+    _budget->release(bytes);
+  }
+  _bytes -= bytes;
+}
+
+size_t MemoryReservation::bytes() const {
+  return _bytes;
+}
+
+}  // namespace opossum
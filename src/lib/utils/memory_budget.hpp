@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Limits the amount of memory that the operators of a query use for their intermediate data structures (e.g., the
+ * materialized columns and hash tables of JoinHash). Operators do not allocate from the budget, but reserve the number
+ * of bytes they estimate to need before they allocate them. If a reservation is denied, the operator has to fall back
+ * to an algorithm that needs less memory, e.g., by spilling data to disk (see SpillFile), or exceed the budget.
+ *
+ * A budget is shared by all operators of a query (see AbstractOperator::set_memory_budget_recursively), which reserve
+ * memory concurrently. Operators without a budget are not limited.
+ */
+class MemoryBudget : private Noncopyable {
+ public:
+  explicit MemoryBudget(const size_t limit);
+
+  // Share of the available memory that all concurrently executed statements get by default
+  static constexpr auto DEFAULT_LIMIT_SHARE = 0.5;
+
+  // Returns the default limit of each statement if @param concurrent_statement_count statements are executed at once
+  static size_t default_limit(const size_t concurrent_statement_count);
+
+  // Parses a limit given in bytes, "auto" for the default_limit, or an empty string for no limit, e.g., from a CLI
+  static std::optional<size_t> parse_limit(const std::string& value, const size_t concurrent_statement_count);
+
+  // Reserves @param bytes if they fit into the budget. @return false (and reserves nothing) otherwise.
+  bool try_reserve(const size_t bytes);
+
+  // Returns @param bytes that have been reserved before
+  void release(const size_t bytes);
+
+  size_t limit() const;
+  size_t reserved_bytes() const;
+  size_t peak_reserved_bytes() const;
+
+ protected:
+  const size_t _limit;
+  std::atomic<size_t> _reserved_bytes{0};
+  std::atomic<size_t> _peak_reserved_bytes{0};
+};
+
+/**
+ * Bytes reserved from a MemoryBudget by an operator. The reservation grows while the operator allocates its data
+ * structures and is returned to the budget when it is destroyed. A reservation without a budget never fails.
+ */
+class MemoryReservation : private Noncopyable {
+ public:
+  explicit MemoryReservation(const std::shared_ptr<MemoryBudget>& budget);
+  MemoryReservation(MemoryReservation&& other) noexcept;
+  MemoryReservation& operator=(MemoryReservation&& other) noexcept;
+  ~MemoryReservation();
+
+  // Adds @param bytes to the reservation. @return false if the budget does not have enough memory left.
+  bool try_grow(const size_t bytes);
+
+  // Returns @param bytes of the reservation to the budget
+  void shrink(const size_t bytes);
+
+  size_t bytes() const;
+
+ protected:
+  std::shared_ptr<MemoryBudget> _budget;
+  size_t _bytes{0};
+};
+
+}  // namespace opossum
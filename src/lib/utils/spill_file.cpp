@@ -0,0 +1,45 @@
+#include "spill_file.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+namespace opossum {
+
+SpillFile::SpillFile() : _file(std::tmpfile()) {
+  Assert(_file, "Could not create temporary file: " + std::string{std::strerror(errno)});
+}
+
+SpillFile::~SpillFile() {
+  std::fclose(_file);
+}
+
+void SpillFile::finish_writing() {
+  Assert(std::fflush(_file) == 0, "Could not flush temporary file: " + std::string{std::strerror(errno)});
+  std::rewind(_file);
+  _is_reading = true;
+}
+
+size_t SpillFile::size() const {
+  return _size;
+}
+
+void SpillFile::_write(const void* data, const size_t bytes) {
+  if (bytes == 0) {
+    return;
+  }
+
+  Assert(std::fwrite(data, 1, bytes, _file) == bytes,
+         "Could not write to temporary file: " + std::string{std::strerror(errno)});
+  _size += bytes;
+}
+
+void SpillFile::_read(void* data, const size_t bytes) {
+  if (bytes == 0) {
+    return;
+  }
+
+  Assert(std::fread(data, 1, bytes, _file) == bytes, "Could not read from temporary file");
+}
+
+}  // namespace opossum
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * Temporary file to which operators write intermediate data that does not fit into their MemoryBudget. The data is
+ * written sequentially and read back sequentially after finish_writing() has been called. Values are stored in their
+ * binary representation, strings are prefixed with their length.
+ *
+ * The file is created with std::tmpfile, i.e., in the temporary directory of the system (e.g., $TMPDIR), and deleted
+ * when the SpillFile is destroyed or the process terminates.
+ */
+class SpillFile : private Noncopyable {
+ public:
+  SpillFile();
+  ~SpillFile();
+
+  template <typename T>
+  void write(const T& value) {
+    DebugAssert(!_is_reading, "Cannot write to a SpillFile that is being read");
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      const auto size = value.size();
+      _write(&size, sizeof(size));
+      _write(value.data(), size);
+    } else {
+      static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types and strings can be spilled");
+      _write(&value, sizeof(T));
+    }
+  }
+
+  template <typename T>
+  void read(T& value) {
+    DebugAssert(_is_reading, "Cannot read from a SpillFile before finish_writing() has been called");
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      auto size = size_t{0};
+      _read(&size, sizeof(size));
+      value.resize(size);
+      _read(value.data(), size);
+    } else {
+      static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable types and strings can be spilled");
+      _read(&value, sizeof(T));
+    }
+  }
+
+  // Flushes the written data and rewinds the file so that it can be read from the beginning
+  void finish_writing();
+
+  // Number of bytes written to the file
+  size_t size() const;
+
+ protected:
+  void _write(const void* data, const size_t bytes);
+  void _read(void* data, const size_t bytes);
+
+  std::FILE* _file;
+  size_t _size{0};
+  bool _is_reading{false};
+};
+
+}  // namespace opossum
@@ -0,0 +1,342 @@
+#include "chunk_maintenance_plugin.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+#include <boost/algorithm/string.hpp>
+
+#include "operators/get_table.hpp"
+#include "operators/replace_chunk.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ChunkMaintenancePlugin::ClusteringKeysSetting::ClusteringKeysSetting()
+    : AbstractSetting("ChunkMaintenancePlugin.ClusteringKeys") {}
+
+const std::string& ChunkMaintenancePlugin::ClusteringKeysSetting::description() const {
+  static const auto description =
+      std::string{"Comma-separated list of table_name.column_name pairs by which completed chunks are sorted"};
+  return description;
+}
+
+const std::string& ChunkMaintenancePlugin::ClusteringKeysSetting::get() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _value;
+}
+
+void ChunkMaintenancePlugin::ClusteringKeysSetting::set(const std::string& value) {
+  auto clustering_keys = std::vector<std::string>{};
+  boost::split(clustering_keys, value, boost::is_any_of(","), boost::token_compress_on);
+  for (const auto& clustering_key : clustering_keys) {
+    const auto trimmed_clustering_key = boost::trim_copy(clustering_key);
+    AssertInput(trimmed_clustering_key.empty() || trimmed_clustering_key.find('.') != std::string::npos,
+                "Expected clustering key in the form table_name.column_name, got '" + trimmed_clustering_key + "'");
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _value = value;
+}
+
+std::map<std::string, std::string> ChunkMaintenancePlugin::ClusteringKeysSetting::clustering_keys() const {
+  auto value = std::string{};
+  {
+    const auto lock = std::lock_guard<std::mutex>{_mutex};
+    value = _value;
+  }
+
+  auto clustering_keys = std::vector<std::string>{};
+  boost::split(clustering_keys, value, boost::is_any_of(","), boost::token_compress_on);
+
+  auto column_name_by_table_name = std::map<std::string, std::string>{};
+  for (const auto& clustering_key : clustering_keys) {
+    const auto trimmed_clustering_key = boost::trim_copy(clustering_key);
+    const auto separator_position = trimmed_clustering_key.find('.');
+    if (separator_position == std::string::npos) {
+      continue;
+    }
+    column_name_by_table_name[trimmed_clustering_key.substr(0, separator_position)] =
+        trimmed_clustering_key.substr(separator_position + 1);
+  }
+  return column_name_by_table_name;
+}
+
+ChunkMaintenancePlugin::ChunkMaintenancePlugin()
+    : _clustering_keys_setting(std::make_shared<ClusteringKeysSetting>()) {}
+
+std::string ChunkMaintenancePlugin::description() const {
+  return "Chunk maintenance plugin";
+}
+
+void ChunkMaintenancePlugin::start() {
+  _clustering_keys_setting->register_at_settings_manager();
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY, [&](size_t) { _maintenance_loop(); });
+}
+
+void ChunkMaintenancePlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread.reset();
+  _clustering_keys_setting->unregister_at_settings_manager();
+  _replaced_chunks = {};
+}
+
+/**
+ * This function encodes (and, if a clustering key is set, sorts) all completed chunks of every table.
+ */
+void ChunkMaintenancePlugin::_maintenance_loop() {
+  _physical_delete_replaced_chunks();
+
+  const auto clustering_keys = _clustering_keys_setting->clustering_keys();
+  const auto tables = Hyrise::get().storage_manager.tables();
+
+  for (const auto& [table_name, table] : tables) {
+    if (table->type() != TableType::Data || table->uses_mvcc() != UseMvcc::Yes) {
+      continue;
+    }
+
+    auto clustering_column_id = std::optional<ColumnID>{};
+    const auto clustering_key_iter = clustering_keys.find(table_name);
+    if (clustering_key_iter != clustering_keys.end()) {
+      const auto& column_names = table->column_names();
+      const auto column_name_iter = std::find(column_names.cbegin(), column_names.cend(), clustering_key_iter->second);
+      if (column_name_iter != column_names.cend()) {
+        clustering_column_id = ColumnID{static_cast<ColumnID::base_type>(column_name_iter - column_names.cbegin())};
+      }
+    }
+
+    auto chunk_encoding_spec = std::optional<ChunkEncodingSpec>{};
+    auto encoded_chunk_count = size_t{0};
+    auto sorted_chunk_count = size_t{0};
+
+    // The last mutable chunk is skipped as it is (or will be) used for insertions. Later chunks are immutable.
+    const auto last_mutable_chunk_id = table->last_mutable_chunk_id();
+    for (auto chunk_id = ChunkID{0}; last_mutable_chunk_id && chunk_id < *last_mutable_chunk_id; ++chunk_id) {
+      if (!_chunk_is_completed(*table, chunk_id)) {
+        continue;
+      }
+
+      if (!chunk_encoding_spec) {
+        chunk_encoding_spec = _chunk_encoding_spec(*table);
+      }
+
+      if (!clustering_column_id) {
+        _encode_chunk(*table, table->get_chunk(chunk_id), *chunk_encoding_spec);
+        ++encoded_chunk_count;
+        continue;
+      }
+
+      auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+      if (_try_replace_with_sorted_chunk(table_name, chunk_id, *clustering_column_id, *chunk_encoding_spec,
+                                         transaction_context)) {
+        _replaced_chunks.emplace(table, chunk_id);
+        ++sorted_chunk_count;
+      }
+    }
+
+    if (encoded_chunk_count > 0 || sorted_chunk_count > 0) {
+      std::ostringstream message;
+      message << "Encoded " << encoded_chunk_count << " and sorted " << sorted_chunk_count << " chunk(s) of "
+              << table_name;
+      Hyrise::get().log_manager.add_message("ChunkMaintenancePlugin", message.str(), LogLevel::Info);
+    }
+  }
+}
+
+/**
+ * This function removes the replaced chunks that are no longer visible to any active transaction.
+ */
+void ChunkMaintenancePlugin::_physical_delete_replaced_chunks() {
+  while (!_replaced_chunks.empty()) {
+    const auto& [table, chunk_id] = _replaced_chunks.front();
+    const auto chunk = table->get_chunk(chunk_id);
+    DebugAssert(chunk && chunk->get_cleanup_commit_id(), "Replaced chunk should have been deleted logically");
+
+    // Chunks are queued in the order of their cleanup commit IDs, so later chunks cannot be removed either
+    const auto lowest_snapshot_commit_id = Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id();
+    if (lowest_snapshot_commit_id && *chunk->get_cleanup_commit_id() > *lowest_snapshot_commit_id) {
+      return;
+    }
+
+    table->remove_chunk(chunk_id);
+    _replaced_chunks.pop();
+  }
+}
+
+bool ChunkMaintenancePlugin::_chunk_is_completed(const Table& table, const ChunkID chunk_id) {
+  const auto chunk = table.get_chunk(chunk_id);
+  if (!chunk || !chunk->is_mutable() || chunk->get_cleanup_commit_id() || chunk->size() == 0) {
+    return false;
+  }
+
+  // Insert only appends to the last mutable chunk of a table, so no rows are added to the chunk anymore. Rows that
+  // were inserted by transactions that have not committed or rolled back yet still have a begin CID of MAX_COMMIT_ID.
+  const auto& mvcc_data = chunk->mvcc_data();
+  const auto chunk_size = chunk->size();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    if (mvcc_data->get_begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+ChunkEncodingSpec ChunkMaintenancePlugin::_chunk_encoding_spec(const Table& table) {
+  const auto column_count = table.column_count();
+  const auto chunk_count = table.chunk_count();
+
+  // Use the encoding of the first chunk that has been encoded (e.g., when the table was loaded)
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    if (!chunk || chunk->is_mutable()) {
+      continue;
+    }
+
+    auto chunk_encoding_spec = ChunkEncodingSpec{};
+    auto chunk_is_encoded = false;
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      chunk_encoding_spec.emplace_back(get_segment_encoding_spec(chunk->get_segment(column_id)));
+      chunk_is_encoded |= chunk_encoding_spec.back().encoding_type != EncodingType::Unencoded;
+    }
+
+    if (chunk_is_encoded) {
+      return chunk_encoding_spec;
+    }
+  }
+
+  return ChunkEncodingSpec{column_count, SegmentEncodingSpec{}};
+}
+
+void ChunkMaintenancePlugin::_encode_chunk(const Table& table, const std::shared_ptr<Chunk>& chunk,
+                                           const ChunkEncodingSpec& chunk_encoding_spec) {
+  if (chunk->is_mutable()) {
+    chunk->finalize();
+  }
+
+  // Also generates the pruning statistics of the chunk
+  ChunkEncoder::encode_chunk(chunk, table.column_data_types(), chunk_encoding_spec);
+}
+
+bool ChunkMaintenancePlugin::_try_replace_with_sorted_chunk(
+    const std::string& table_name, const ChunkID chunk_id, const ColumnID clustering_column_id,
+    const ChunkEncodingSpec& chunk_encoding_spec, const std::shared_ptr<TransactionContext>& transaction_context) {
+  const auto& table = Hyrise::get().storage_manager.get_table(table_name);
+  const auto& chunk = table->get_chunk(chunk_id);
+
+  Assert(chunk != nullptr, "Chunk does not exist. It cannot be replaced.");
+  Assert(chunk_id < table->last_mutable_chunk_id().value_or(INVALID_CHUNK_ID),
+         "The last/current mutable chunk should not be replaced.");
+
+  // Create temporary referencing table that contains the given chunk only
+  //   Include all ChunksIDs of current table except chunk_id for pruning in GetTable
+  std::vector<ChunkID> excluded_chunk_ids(table->chunk_count() - 1);
+  std::iota(excluded_chunk_ids.begin(), excluded_chunk_ids.begin() + chunk_id, 0);
+  std::iota(excluded_chunk_ids.begin() + chunk_id, excluded_chunk_ids.end(), chunk_id + 1);
+
+  auto get_table = std::make_shared<GetTable>(table_name, excluded_chunk_ids, std::vector<ColumnID>());
+  get_table->set_transaction_context(transaction_context);
+  get_table->execute();
+
+  auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+
+  if (validate->get_output()->row_count() == 0) {
+    // No rows are visible anymore. Encoding the chunk in place is cheaper, and the MvccDeletePlugin removes it.
+    transaction_context->commit();
+    _encode_chunk(*table, chunk, chunk_encoding_spec);
+    return false;
+  }
+
+  // The sorted rows still reference the old rows, which tells ReplaceChunk where each row was moved to
+  const auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition{clustering_column_id}};
+  auto sort = std::make_shared<Sort>(validate, sort_definitions, table->target_chunk_size(),
+                                     Sort::ForceMaterialization::No);
+  sort->execute();
+
+  // The materialized table is not visible to other operators yet, so it can be encoded in place
+  const auto sorted_table = _materialize(*sort->get_output());
+  const auto column_data_types = sorted_table->column_data_types();
+  const auto sorted_chunk_count = sorted_table->chunk_count();
+  for (auto sorted_chunk_id = ChunkID{0}; sorted_chunk_id < sorted_chunk_count; ++sorted_chunk_id) {
+    ChunkEncoder::encode_chunk(sorted_table->get_chunk(sorted_chunk_id), column_data_types, chunk_encoding_spec);
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(sorted_table);
+  table_wrapper->execute();
+
+  auto replace_chunk = std::make_shared<ReplaceChunk>(table_name, sort, table_wrapper);
+  replace_chunk->set_transaction_context(transaction_context);
+  replace_chunk->execute();
+
+  if (replace_chunk->execute_failed()) {
+    // Transaction conflict. Usually, the OperatorTask would call rollback, but as we executed ReplaceChunk directly,
+    // that is our job.
+    transaction_context->rollback(RollbackReason::Conflict);
+    return false;
+  }
+
+  transaction_context->commit();
+  // Mark chunk as logically deleted
+  chunk->set_cleanup_commit_id(transaction_context->commit_id());
+  return true;
+}
+
+std::shared_ptr<Table> ChunkMaintenancePlugin::_materialize(const Table& table) {
+  const auto column_count = table.column_count();
+  auto materialized_table = std::make_shared<Table>(table.column_definitions(), TableType::Data,
+                                                    table.target_chunk_size());
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+
+    auto segments = Segments{};
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+        using ColumnDataType = typename decltype(data_type_t)::type;
+
+        auto values = pmr_vector<ColumnDataType>{};
+        auto null_values = pmr_vector<bool>{};
+        values.reserve(chunk_size);
+        null_values.reserve(chunk_size);
+        segment_iterate<ColumnDataType>(*chunk->get_segment(column_id), [&](const auto& position) {
+          values.emplace_back(position.value());
+          null_values.emplace_back(position.is_null());
+        });
+
+        if (table.column_is_nullable(column_id)) {
+          segments.emplace_back(
+              std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+        } else {
+          segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+        }
+      });
+    }
+
+    materialized_table->append_chunk(segments);
+    const auto materialized_chunk = materialized_table->last_chunk();
+    materialized_chunk->finalize();
+    if (!chunk->individually_sorted_by().empty()) {
+      materialized_chunk->set_individually_sorted_by(chunk->individually_sorted_by());
+    }
+  }
+
+  return materialized_table;
+}
+
+EXPORT_PLUGIN(ChunkMaintenancePlugin)
+
+}  // namespace opossum
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <string>
+#include <utility>
+
+#include "gtest/gtest_prod.h"
+#include "hyrise.hpp"
+#include "storage/chunk.hpp"
+#include "storage/encoding_type.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/settings/abstract_setting.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+/*
+ * Insert appends rows to mutable chunks of unencoded ValueSegments, which are never encoded, sorted, or equipped with
+ * pruning statistics on their own. This plugin maintains such chunks in the background once they are completed, i.e.,
+ * once they are no longer the last mutable chunk of their table and all transactions that inserted into them have
+ * committed or rolled back.
+ *
+ * Completed chunks are encoded with the encoding of the table's already encoded chunks (e.g., those created by the
+ * benchmark table generators) or, if there are none, with the default encoding. Encoding generates the pruning
+ * statistics. As encoding does not change the order of the rows, the segments are replaced in place (see
+ * ChunkCompressionTask).
+ *
+ * If a clustering key is configured for the table, the rows are also sorted by it. Sorting changes the RowIDs of the
+ * rows, so the chunk cannot be modified in place. Instead, a transaction sorts and encodes the visible rows of the
+ * chunk and swaps them in using ReplaceChunk. The old chunk is removed physically once no active transaction can see
+ * its rows anymore (see MvccDeletePlugin). If the swap conflicts with another transaction that modifies the chunk, it
+ * is retried in a later iteration. The sorted chunks are appended after the chunk that Insert currently appends to,
+ * which keeps receiving rows until it is full (see Table::last_mutable_chunk_id).
+ *
+ * The clustering keys are configured by the setting "ChunkMaintenancePlugin.ClusteringKeys" as a comma-separated
+ * list of table_name.column_name pairs, e.g., "orders.o_orderdate,lineitem.l_shipdate".
+ */
+class ChunkMaintenancePlugin : public AbstractPlugin {
+  friend class ChunkMaintenancePluginTest;
+
+ public:
+  ChunkMaintenancePlugin();
+
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  // IDLE_DELAY: sleep after each iteration of the maintenance loop
+  constexpr static std::chrono::milliseconds IDLE_DELAY = std::chrono::milliseconds(1000);
+
+ private:
+  class ClusteringKeysSetting : public AbstractSetting {
+   public:
+    ClusteringKeysSetting();
+
+    const std::string& description() const final;
+
+    const std::string& get() final;
+
+    void set(const std::string& value) final;
+
+    // Returns the clustering column name per table name
+    std::map<std::string, std::string> clustering_keys() const;
+
+   private:
+    mutable std::mutex _mutex;
+    std::string _value;
+  };
+
+  using TableAndChunkID = std::pair<const std::shared_ptr<Table>, ChunkID>;
+
+  void _maintenance_loop();
+  void _physical_delete_replaced_chunks();
+
+  static bool _chunk_is_completed(const Table& table, const ChunkID chunk_id);
+  static ChunkEncodingSpec _chunk_encoding_spec(const Table& table);
+
+  // Copies the (referenced) rows of @param table into ValueSegments, keeping their order, chunks, and sort order
+  static std::shared_ptr<Table> _materialize(const Table& table);
+
+  static void _encode_chunk(const Table& table, const std::shared_ptr<Chunk>& chunk,
+                            const ChunkEncodingSpec& chunk_encoding_spec);
+  static bool _try_replace_with_sorted_chunk(const std::string& table_name, const ChunkID chunk_id,
+                                             const ColumnID clustering_column_id,
+                                             const ChunkEncodingSpec& chunk_encoding_spec,
+                                             const std::shared_ptr<TransactionContext>& transaction_context);
+
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+  std::shared_ptr<ClusteringKeysSetting> _clustering_keys_setting;
+
+  // Chunks that were replaced by sorted chunks and wait for their physical removal
+  std::queue<TableAndChunkID> _replaced_chunks;
+};
+
+}  // namespace opossum
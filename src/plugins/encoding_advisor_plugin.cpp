@@ -0,0 +1,88 @@
+#include "encoding_advisor_plugin.hpp"
+
+#include <charconv>
+#include <sstream>
+
+#include <boost/algorithm/string.hpp>
+
+#include "hyrise.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+EncodingAdvisorPlugin::MemoryBudgetSetting::MemoryBudgetSetting()
+    : AbstractSetting("EncodingAdvisorPlugin.MemoryBudget") {}
+
+const std::string& EncodingAdvisorPlugin::MemoryBudgetSetting::description() const {
+  static const auto description =
+      std::string{"Memory budget (in bytes) for the segments of immutable chunks, empty for no budget"};
+  return description;
+}
+
+const std::string& EncodingAdvisorPlugin::MemoryBudgetSetting::get() {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _value;
+}
+
+void EncodingAdvisorPlugin::MemoryBudgetSetting::set(const std::string& value) {
+  const auto trimmed_value = boost::trim_copy(value);
+  auto memory_budget = std::optional<size_t>{};
+  if (!trimmed_value.empty()) {
+    auto parsed_memory_budget = size_t{0};
+    const auto [end, error_code] =
+        std::from_chars(trimmed_value.data(), trimmed_value.data() + trimmed_value.size(), parsed_memory_budget);
+    AssertInput(error_code == std::errc{} && end == trimmed_value.data() + trimmed_value.size(),
+                "Expected the memory budget in bytes, got '" + value + "'");
+    memory_budget = parsed_memory_budget;
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  _value = value;
+  _memory_budget = memory_budget;
+}
+
+std::optional<size_t> EncodingAdvisorPlugin::MemoryBudgetSetting::memory_budget() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+  return _memory_budget;
+}
+
+EncodingAdvisorPlugin::EncodingAdvisorPlugin() : _memory_budget_setting(std::make_shared<MemoryBudgetSetting>()) {}
+
+std::string EncodingAdvisorPlugin::description() const {
+  return "Encoding advisor plugin";
+}
+
+void EncodingAdvisorPlugin::start() {
+  _memory_budget_setting->register_at_settings_manager();
+  _loop_thread = std::make_unique<PausableLoopThread>(IDLE_DELAY, [&](size_t) { _advisor_loop(); });
+}
+
+void EncodingAdvisorPlugin::stop() {
+  // Call destructor of PausableLoopThread to terminate its thread
+  _loop_thread.reset();
+  _memory_budget_setting->unregister_at_settings_manager();
+}
+
+/**
+ * This function re-encodes the segments whose recommended encoding differs from their current one.
+ */
+void EncodingAdvisorPlugin::_advisor_loop() {
+  const auto recommendations = _advisor.recommend(_memory_budget_setting->memory_budget());
+  const auto reencoded_segment_count = EncodingAdvisor::apply(recommendations);
+
+  if (reencoded_segment_count > 0) {
+    auto estimated_size = size_t{0};
+    for (const auto& recommendation : recommendations) {
+      estimated_size += recommendation.estimated_size;
+    }
+
+    std::ostringstream message;
+    message << "Re-encoded " << reencoded_segment_count << " of " << recommendations.size()
+            << " segment(s), estimated size is " << estimated_size << " bytes";
+    Hyrise::get().log_manager.add_message("EncodingAdvisorPlugin", message.str(), LogLevel::Info);
+  }
+}
+
+EXPORT_PLUGIN(EncodingAdvisorPlugin)
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include "gtest/gtest_prod.h"
+#include "storage/encoding_advisor.hpp"
+#include "utils/abstract_plugin.hpp"
+#include "utils/pausable_loop_thread.hpp"
+#include "utils/settings/abstract_setting.hpp"
+
+namespace opossum {
+
+/*
+ * Periodically re-encodes the segments of the immutable chunks of all stored tables with the encodings that the
+ * EncodingAdvisor recommends for the accesses observed so far (see SegmentAccessCounter). The segments are replaced in
+ * place, so the plugin can run while the tables are in use, e.g., during a benchmark.
+ *
+ * The estimated size of all these segments is kept within the memory budget (in bytes) configured by the setting
+ * "EncodingAdvisorPlugin.MemoryBudget". If it is empty, each segment gets the encoding that is the cheapest to access.
+ */
+class EncodingAdvisorPlugin : public AbstractPlugin {
+  friend class EncodingAdvisorPluginTest;
+
+ public:
+  EncodingAdvisorPlugin();
+
+  std::string description() const final;
+
+  void start() final;
+
+  void stop() final;
+
+  // IDLE_DELAY: sleep after each iteration of the advisor loop. Estimating the sizes encodes samples of all segments,
+  // so the advisor does not run as often as the ChunkMaintenancePlugin.
+  constexpr static std::chrono::milliseconds IDLE_DELAY = std::chrono::milliseconds(60'000);
+
+ private:
+  class MemoryBudgetSetting : public AbstractSetting {
+   public:
+    MemoryBudgetSetting();
+
+    const std::string& description() const final;
+
+    const std::string& get() final;
+
+    void set(const std::string& value) final;
+
+    std::optional<size_t> memory_budget() const;
+
+   private:
+    mutable std::mutex _mutex;
+    std::string _value;
+    std::optional<size_t> _memory_budget;
+  };
+
+  void _advisor_loop();
+
+  const EncodingAdvisor _advisor;
+  std::unique_ptr<PausableLoopThread> _loop_thread;
+  std::shared_ptr<MemoryBudgetSetting> _memory_budget_setting;
+};
+
+}  // namespace opossum
@@ -44,9 +44,14 @@ void MvccDeletePlugin::_logical_delete_loop() {
     size_t saved_memory = 0;
     size_t num_chunks = 0;
 
-    // Check all chunks, except for the last one, which is currently used for insertions
-    const auto max_chunk_id = static_cast<ChunkID>(table->chunk_count() - 1);
-    for (auto chunk_id = ChunkID{0}; chunk_id < max_chunk_id; chunk_id++) {
+    // Check all chunks, except for the last mutable one, which is currently used for insertions
+    const auto last_mutable_chunk_id = table->last_mutable_chunk_id();
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; chunk_id++) {
+      if (chunk_id == last_mutable_chunk_id) {
+        continue;
+      }
+
       const auto& chunk = table->get_chunk(chunk_id);
       if (chunk && !chunk->get_cleanup_commit_id()) {
         const auto chunk_memory = chunk->memory_usage(MemoryUsageCalculationMode::Sampled);
@@ -136,7 +141,7 @@ bool MvccDeletePlugin::_try_logical_delete(const std::string& table_name, const
   const auto& chunk = table->get_chunk(chunk_id);
 
   Assert(chunk != nullptr, "Chunk does not exist. Logical Delete can not be applied.");
-  Assert(chunk_id < (table->chunk_count() - 1),
+  Assert(chunk_id != table->last_mutable_chunk_id(),
          "MVCC Logical Delete should not be applied on the last/current mutable chunk.");
 
   // Create temporary referencing table that contains the given chunk only
@@ -0,0 +1,90 @@
+#include "base_test.hpp"
+
+#include "ch/ch_benchmark_item_runner.hpp"
+#include "ch/ch_queries.hpp"
+#include "ch/ch_table_generator.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+
+namespace opossum {
+
+class CHTest : public BaseTest {
+ public:
+  static void SetUpTestCase() {
+    auto benchmark_config = std::make_shared<BenchmarkConfig>(BenchmarkConfig::get_default_config());
+    auto table_generator = CHTableGenerator{NUM_WAREHOUSES, benchmark_config};
+
+    tables = table_generator.generate();
+  }
+
+  void SetUp() override {
+    // The queries do not modify the tables, so that the tests can share them
+    for (const auto& [table_name, table_info] : tables) {
+      Hyrise::get().storage_manager.add_table(table_name, table_info.table);
+    }
+  }
+
+  std::shared_ptr<const Table> execute(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    const auto [pipeline_status, table] = pipeline.get_result_table();
+    EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+    return table;
+  }
+
+  static std::unordered_map<std::string, BenchmarkTableInfo> tables;
+  static constexpr auto NUM_WAREHOUSES = 1;
+};
+
+std::unordered_map<std::string, BenchmarkTableInfo> CHTest::tables;
+
+TEST_F(CHTest, InitialTables) {
+  EXPECT_EQ(tables.size(), 12u);
+  EXPECT_EQ(tables.at("SUPPLIER").table->row_count(), CHTableGenerator::NUM_SUPPLIERS);
+  EXPECT_EQ(tables.at("NATION").table->row_count(), CHTableGenerator::NUM_NATIONS);
+  EXPECT_EQ(tables.at("REGION").table->row_count(), CHTableGenerator::NUM_REGIONS);
+
+  // Every stock item has a supplier and every customer belongs to a nation
+  const auto stock_without_supplier =
+      execute("SELECT COUNT(*) FROM STOCK WHERE (S_W_ID * S_I_ID) % 10000 NOT IN (SELECT SU_SUPPKEY FROM SUPPLIER)");
+  EXPECT_EQ(*stock_without_supplier->get_value<int64_t>(ColumnID{0}, 0), 0);
+  const auto customers_without_nation = execute(
+      "SELECT COUNT(*) FROM CUSTOMER WHERE SUBSTR(C_STATE, 1, 1) NOT IN (SELECT N_STATE_INITIAL FROM NATION)");
+  EXPECT_EQ(*customers_without_nation->get_value<int64_t>(ColumnID{0}, 0), 0);
+
+  // The nation key is the ASCII code of N_STATE_INITIAL
+  const auto nation_table = execute("SELECT N_NATIONKEY, N_STATE_INITIAL FROM NATION");
+  for (auto row_id = size_t{0}; row_id < nation_table->row_count(); ++row_id) {
+    const auto nation_key = *nation_table->get_value<int32_t>(ColumnID{0}, row_id);
+    const auto state_initial = *nation_table->get_value<pmr_string>(ColumnID{1}, row_id);
+    ASSERT_EQ(state_initial.size(), 1u);
+    EXPECT_EQ(nation_key, static_cast<int32_t>(state_initial.front()));
+  }
+
+  // The nations and regions used by the queries exist
+  EXPECT_EQ(execute("SELECT * FROM NATION WHERE N_NAME IN ('GERMANY', 'CAMBODIA')")->row_count(), 2u);
+  EXPECT_EQ(execute("SELECT * FROM REGION WHERE R_NAME = 'EUROPE'")->row_count(), 1u);
+}
+
+TEST_F(CHTest, QueriesArePlanned) {
+  // Executing all queries on a full warehouse takes too long for debug builds. Creating the physical plans is enough to
+  // find translation errors, e.g., for join predicates that Hyrise does not support.
+  for (const auto& [query_id, sql] : ch_queries) {
+    SCOPED_TRACE("CH " + std::to_string(query_id));
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    EXPECT_EQ(pipeline.get_physical_plans().size(), 1u);
+  }
+}
+
+TEST_F(CHTest, ItemRunner) {
+  const auto config = std::make_shared<BenchmarkConfig>(BenchmarkConfig::get_default_config());
+  auto item_runner = CHBenchmarkItemRunner{config, {BenchmarkItemID{5}}};
+  EXPECT_EQ(item_runner.items(), std::vector<BenchmarkItemID>{BenchmarkItemID{5}});
+  EXPECT_EQ(item_runner.item_name(BenchmarkItemID{5}), "CH 06");
+
+  const auto [success, metrics, verification_failed] = item_runner.execute_item(BenchmarkItemID{5});
+  EXPECT_TRUE(success);
+  EXPECT_FALSE(verification_failed);
+
+  EXPECT_EQ(CHBenchmarkItemRunner{config}.items().size(), 22u);
+}
+
+}  // namespace opossum
@@ -1,5 +1,10 @@
+#include <thread>
+#include <vector>
+
 #include "base_test.hpp"
 
+#include "cache/sharded_gdfs_cache.hpp"
+
 namespace opossum {
 
 // Test for the cache implementation in lib/cache.
@@ -191,4 +196,113 @@ TEST_F(CacheTest, Snapshot) {
   }
 }
 
+class ShardedCacheTest : public BaseTest {};
+
+TEST_F(ShardedCacheTest, GDFSEvictionWithinShard) {
+  // With a single shard, the eviction decisions are the same as for GDFSCache, even though hits are applied lazily
+  ShardedGDFSCache<int, int> cache(2, 1);
+  ASSERT_EQ(cache.shard_count(), 1u);
+
+  cache.set(1, 2);                 // Miss, insert, L=0, Fr=1
+  ASSERT_EQ(cache.try_get(1), 2);  // Hit, L=0, Fr=2
+  cache.set(2, 4);                 // Miss, insert, L=0, Fr=1
+  cache.set(3, 6);                 // Miss, evict 2, L=1, Fr=1
+
+  ASSERT_TRUE(cache.has(1));
+  ASSERT_FALSE(cache.has(2));
+  ASSERT_TRUE(cache.has(3));
+
+  ASSERT_EQ(cache.try_get(3), 6);  // Hit, L=1, Fr=2
+  ASSERT_EQ(cache.try_get(3), 6);  // Hit, L=1, Fr=3
+  cache.set(2, 5);                 // Miss, evict 1, L=2
+
+  ASSERT_FALSE(cache.has(1));
+  ASSERT_TRUE(cache.has(2));
+  ASSERT_TRUE(cache.has(3));
+
+  const auto snapshot = cache.snapshot();
+  EXPECT_EQ(snapshot.at(3).frequency, 3);
+  EXPECT_EQ(snapshot.at(2).frequency, 1);
+}
+
+TEST_F(ShardedCacheTest, Capacity) {
+  // The shard count is limited by the capacity
+  EXPECT_EQ((ShardedGDFSCache<int, int>{3, 16}.shard_count()), 3u);
+  EXPECT_EQ((ShardedGDFSCache<int, int>{0, 16}.shard_count()), 1u);
+
+  ShardedGDFSCache<int, int> cache(64, 4);
+  EXPECT_EQ(cache.shard_count(), 4u);
+  for (auto key = 0; key < 1000; ++key) {
+    cache.set(key, key);
+  }
+  EXPECT_EQ(cache.size(), 64u);
+
+  cache.resize(10);
+  EXPECT_EQ(cache.capacity(), 10u);
+  EXPECT_EQ(cache.size(), 10u);
+
+  // Resizing below the shard count moves the entries to fewer shards, so that every shard in use can hold an entry
+  cache.resize(2);
+  EXPECT_EQ(cache.shard_count(), 2u);
+  EXPECT_EQ(cache.size(), 2u);
+  for (const auto& [key, entry] : cache.snapshot()) {
+    EXPECT_EQ(entry.value, key);
+    EXPECT_EQ(cache.try_get(key), key);
+  }
+  for (auto key = 0; key < 1000; ++key) {
+    cache.set(key, key);
+    EXPECT_TRUE(cache.has(key));
+  }
+  EXPECT_EQ(cache.size(), 2u);
+
+  // Growing the cache uses all shards again and keeps the entries
+  cache.resize(10);
+  EXPECT_EQ(cache.shard_count(), 4u);
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_TRUE(cache.has(999));
+  for (auto key = 0; key < 1000; ++key) {
+    cache.set(key, key);
+  }
+  EXPECT_EQ(cache.size(), 10u);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0u);
+  EXPECT_FALSE(cache.try_get(999));
+
+  ShardedGDFSCache<int, int> empty_cache(0);
+  empty_cache.set(1, 2);
+  EXPECT_FALSE(empty_cache.has(1));
+}
+
+TEST_F(ShardedCacheTest, ConcurrentAccess) {
+  constexpr auto THREAD_COUNT = 8;
+  constexpr auto KEY_COUNT = 200;
+
+  ShardedGDFSCache<int, int> cache(100, 8);
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto iteration = 0; iteration < 10'000; ++iteration) {
+        const auto key = (iteration * 7 + thread_id) % KEY_COUNT;
+        const auto value = cache.try_get(key);
+        if (value) {
+          ASSERT_EQ(*value, key * 2);
+        } else {
+          cache.set(key, key * 2);
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(cache.size(), 100u);
+  for (const auto& [key, entry] : cache.snapshot()) {
+    EXPECT_EQ(entry.value, key * 2);
+  }
+}
+
 }  // namespace opossum
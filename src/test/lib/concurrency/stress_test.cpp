@@ -5,6 +5,7 @@
 
 #include "hyrise.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
+#include "storage/index/table_key/table_key_index.hpp"
 
 namespace opossum {
 
@@ -150,6 +151,64 @@ TEST_F(StressTest, TestTransactionInsertsSmallChunks) {
   }
 }
 
+TEST_F(StressTest, TestCreateKeyIndexWhileInserting) {
+  // Rows that are inserted while the key index is created must be indexed exactly once: either when the index is
+  // built or by the Insert itself.
+  TableColumnDefinitions column_definitions;
+  column_definitions.emplace_back("a", DataType::Int, false);
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10}, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("table_d", table);
+
+  const auto iterations_per_thread = 100;
+
+  // Each job inserts distinct keys, so all Inserts have to succeed
+  std::atomic_int job_id{0};
+  const auto run = [&]() {
+    const auto my_job_id = job_id++;
+    for (auto iteration = 0; iteration < iterations_per_thread; ++iteration) {
+      const auto key = my_job_id * iterations_per_thread + iteration;
+      auto pipeline =
+          SQLPipelineBuilder{std::string{"INSERT INTO table_d (a) VALUES ("} + std::to_string(key) + ")"}
+              .create_pipeline();
+      const auto [status, _] = pipeline.get_result_table();
+      EXPECT_EQ(status, SQLPipelineStatus::Success);
+    }
+  };
+
+  const auto num_threads = 20u;
+  std::vector<std::future<void>> thread_futures;
+  thread_futures.reserve(num_threads);
+
+  for (auto thread_num = 0u; thread_num < num_threads; ++thread_num) {
+    thread_futures.emplace_back(std::async(std::launch::async, run));
+  }
+
+  while (table->row_count() == 0) {
+    std::this_thread::yield();
+  }
+  table->create_key_index({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+
+  for (auto& thread_future : thread_futures) {
+    if (thread_future.wait_for(std::chrono::seconds(600)) == std::future_status::timeout) {
+      ASSERT_TRUE(false) << "At least one thread got stuck and did not commit.";
+    }
+    thread_future.get();
+  }
+
+  const auto& key_index = *table->key_indexes().front();
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      const auto key = key_index.key_of_row(*chunk, chunk_offset);
+      ASSERT_TRUE(key);
+      EXPECT_EQ(key_index.lookup(*key), std::vector<RowID>{RowID(chunk_id, chunk_offset)});
+    }
+  }
+  EXPECT_EQ(table->row_count(), num_threads * iterations_per_thread);
+}
+
 TEST_F(StressTest, TestTransactionInsertsPackedNullValues) {
   // As ValueSegments store their null flags in a vector<bool>, which is not safe to be modified concurrently,
   // conflicts may (and have) occurred when that vector was written without any type of protection.
@@ -111,7 +111,7 @@ TEST_F(TransactionContextTest, CommitShouldIncreaseCommitIDIfReadWrite) {
 
   const auto get_table_op = std::make_shared<GetTable>(table_name);
   const auto validate_op = std::make_shared<Validate>(get_table_op);
-  const auto delete_op = std::make_shared<Delete>(validate_op);
+  const auto delete_op = std::make_shared<Delete>(table_name, validate_op);
   delete_op->set_transaction_context_recursively(context);
   get_table_op->execute();
   validate_op->execute();
@@ -0,0 +1,206 @@
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/write_ahead_log.hpp"
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
+#include "operators/replace_chunk.hpp"
+#include "operators/sort.hpp"
+#include "operators/validate.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+
+namespace opossum {
+
+class WriteAheadLogTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::remove(_log_path.c_str());
+    _load_tables();
+  }
+
+  void TearDown() override {
+    Hyrise::get().write_ahead_log = nullptr;
+    std::remove(_log_path.c_str());
+  }
+
+  void _load_tables() {
+    Hyrise::get().storage_manager.add_table("table_a",
+                                            load_table("resources/test_data/tbl/int_float.tbl", ChunkOffset{2}));
+  }
+
+  // Creates the log, replays it, and enables logging. Returns the number of replayed transactions.
+  uint64_t _enable_log() {
+    const auto write_ahead_log = std::make_shared<WriteAheadLog>(_log_path);
+    const auto replayed_commit_count = write_ahead_log->recover();
+    Hyrise::get().write_ahead_log = write_ahead_log;
+    return replayed_commit_count;
+  }
+
+  // Simulates a restart: the log is closed, the in-memory state is lost, and the tables are loaded from disk again
+  void _restart() {
+    Hyrise::get().write_ahead_log = nullptr;
+    Hyrise::reset();
+    _load_tables();
+  }
+
+  std::shared_ptr<const Table> _execute(const std::string& sql) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    const auto [status, table] = pipeline.get_result_table();
+    EXPECT_EQ(status, SQLPipelineStatus::Success);
+    return table;
+  }
+
+  const std::string _log_path = test_data_path + "write_ahead_log_test.log";
+};
+
+TEST_F(WriteAheadLogTest, RecoverModifications) {
+  EXPECT_EQ(_enable_log(), 0u);
+
+  _execute("INSERT INTO table_a VALUES (1, 1.5), (2, 2.5), (3, 3.5);");
+  _execute("DELETE FROM table_a WHERE a = 123 OR a = 2;");
+  _execute("UPDATE table_a SET b = 4.5 WHERE a = 3 OR a = 12345;");
+  // Read-only transactions are not logged
+  const auto expected_table = _execute("SELECT * FROM table_a;");
+
+  const auto statistics = Hyrise::get().write_ahead_log->statistics();
+  EXPECT_EQ(statistics.commit_count, 3u);
+  EXPECT_GE(statistics.flush_count, 1u);
+  EXPECT_LE(statistics.flush_count, 3u);
+  EXPECT_GT(statistics.written_bytes, 0u);
+
+  _restart();
+  EXPECT_EQ(_execute("SELECT * FROM table_a;")->row_count(), 3u);
+
+  EXPECT_EQ(_enable_log(), 3u);
+  EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_a;"), expected_table);
+}
+
+TEST_F(WriteAheadLogTest, RecoverMovedRows) {
+  EXPECT_EQ(_enable_log(), 0u);
+
+  // The rolled back insert occupies the first rows after the loaded data. During recovery, the following insert is
+  // written to these rows instead.
+  _execute("BEGIN; INSERT INTO table_a VALUES (10, 1.0), (11, 1.0), (12, 1.0); ROLLBACK;");
+  _execute("INSERT INTO table_a VALUES (20, 2.0), (21, 2.0), (22, 2.0);");
+  _execute("DELETE FROM table_a WHERE a = 21;");
+
+  _restart();
+  EXPECT_EQ(_enable_log(), 2u);
+  EXPECT_EQ(_execute("SELECT * FROM table_a;")->row_count(), 5u);
+  EXPECT_EQ(_execute("SELECT * FROM table_a WHERE a = 20 OR a = 22;")->row_count(), 2u);
+
+  // Modifications after the recovery refer to the rows' positions after the recovery
+  _execute("INSERT INTO table_a VALUES (30, 3.0);");
+  _execute("DELETE FROM table_a WHERE a = 22 OR a = 30 OR a = 123;");
+  const auto expected_table = _execute("SELECT * FROM table_a;");
+
+  _restart();
+  EXPECT_EQ(_enable_log(), 4u);
+  EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_a;"), expected_table);
+
+  // Recovering again yields the same result
+  _restart();
+  EXPECT_EQ(_enable_log(), 4u);
+  EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_a;"), expected_table);
+}
+
+TEST_F(WriteAheadLogTest, RecoverReplacedChunk) {
+  EXPECT_EQ(_enable_log(), 0u);
+
+  // The loaded chunks are immutable, so the rows 21 and 20 end up in chunk 2 and the row 22 in chunk 3
+  _execute("INSERT INTO table_a VALUES (21, 1.0), (20, 2.0), (22, 3.0);");
+
+  // Replace chunk 2 with a sorted copy, which is appended as chunk 4
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto get_table = std::make_shared<GetTable>(
+      "table_a", std::vector<ChunkID>{ChunkID{0}, ChunkID{1}, ChunkID{3}}, std::vector<ColumnID>{});
+  get_table->set_transaction_context(context);
+  get_table->execute();
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(context);
+  validate->execute();
+  const auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}};
+  const auto sorted_rows =
+      std::make_shared<Sort>(validate, sort_definitions, ChunkOffset{2}, Sort::ForceMaterialization::No);
+  sorted_rows->execute();
+  const auto sorted_values =
+      std::make_shared<Sort>(validate, sort_definitions, ChunkOffset{2}, Sort::ForceMaterialization::Yes);
+  sorted_values->execute();
+  const auto replace_chunk = std::make_shared<ReplaceChunk>("table_a", sorted_rows, sorted_values);
+  replace_chunk->set_transaction_context(context);
+  replace_chunk->execute();
+  ASSERT_FALSE(replace_chunk->execute_failed());
+  context->commit();
+
+  // The row 20 is deleted from its new position, and the row 23 is added to the still mutable chunk 3
+  _execute("DELETE FROM table_a WHERE a = 20;");
+  _execute("INSERT INTO table_a VALUES (23, 4.0);");
+  const auto expected_table = _execute("SELECT * FROM table_a;");
+  EXPECT_EQ(expected_table->row_count(), 6u);
+
+  // Recovery neither duplicates the replaced rows nor loses the deletion
+  _restart();
+  EXPECT_EQ(_enable_log(), 4u);
+  EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_a;"), expected_table);
+}
+
+TEST_F(WriteAheadLogTest, DiscardIncompleteRecord) {
+  EXPECT_EQ(_enable_log(), 0u);
+  _execute("INSERT INTO table_a VALUES (1, 1.5);");
+  _restart();
+
+  // Simulate a crash while writing a record
+  {
+    auto log_file = std::ofstream{_log_path, std::ios::binary | std::ios::app};
+    log_file << std::string{"\x40\0\0\0\1\2\3\4\0incomplete", 19};
+  }
+
+  EXPECT_EQ(_enable_log(), 1u);
+  _execute("INSERT INTO table_a VALUES (2, 2.5);");
+  const auto expected_table = _execute("SELECT * FROM table_a;");
+  EXPECT_EQ(expected_table->row_count(), 5u);
+
+  // The incomplete record has been removed, so the following records can be recovered
+  _restart();
+  EXPECT_EQ(_enable_log(), 2u);
+  EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_a;"), expected_table);
+}
+
+TEST_F(WriteAheadLogTest, GroupCommit) {
+  EXPECT_EQ(_enable_log(), 0u);
+
+  constexpr auto THREAD_COUNT = uint64_t{8};
+  constexpr auto INSERTS_PER_THREAD = uint64_t{20};
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = uint64_t{0}; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto insert_id = uint64_t{0}; insert_id < INSERTS_PER_THREAD; ++insert_id) {
+        const auto value = std::to_string(thread_id * INSERTS_PER_THREAD + insert_id);
+        _execute("INSERT INTO table_a VALUES (" + value + ", " + value + ".5);");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Each commit is durable once it is reported as committed, but concurrent commits may share a sync
+  const auto statistics = Hyrise::get().write_ahead_log->statistics();
+  EXPECT_EQ(statistics.commit_count, THREAD_COUNT * INSERTS_PER_THREAD);
+  EXPECT_LE(statistics.flush_count, THREAD_COUNT * INSERTS_PER_THREAD);
+  const auto expected_table = _execute("SELECT * FROM table_a;");
+
+  _restart();
+  EXPECT_EQ(_enable_log(), THREAD_COUNT * INSERTS_PER_THREAD);
+  EXPECT_TABLE_EQ_UNORDERED(_execute("SELECT * FROM table_a;"), expected_table);
+}
+
+}  // namespace opossum
@@ -0,0 +1,235 @@
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "cost_estimation/join_cost_model.hpp"
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "utils/load_table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class JoinCostModelTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Three chunks, each of which is sorted by column a
+    const auto sorted_table = load_table("resources/test_data/tbl/int_sorted.tbl", ChunkOffset{2});
+    const auto sorted_chunk_count = sorted_table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < sorted_chunk_count; ++chunk_id) {
+      sorted_table->get_chunk(chunk_id)->set_individually_sorted_by(SortColumnDefinition{ColumnID{0}});
+    }
+    Hyrise::get().storage_manager.add_table("sorted_table", sorted_table);
+
+    // Two chunks with an index on column a, but not on b
+    const auto indexed_table = load_table("resources/test_data/tbl/int_int.tbl", ChunkOffset{2});
+    ChunkEncoder::encode_all_chunks(indexed_table);
+    indexed_table->create_index<GroupKeyIndex>({ColumnID{0}});
+    Hyrise::get().storage_manager.add_table("indexed_table", indexed_table);
+
+    sorted_table_node = StoredTableNode::make("sorted_table");
+    indexed_table_node = StoredTableNode::make("indexed_table");
+  }
+
+  static JoinCostModel::InputProperties properties(const Cardinality row_count,
+                                                   const std::optional<size_t> sorted_run_count = std::nullopt,
+                                                   const std::optional<size_t> indexed_chunk_count = std::nullopt) {
+    auto input_properties = JoinCostModel::InputProperties{};
+    input_properties.row_count = row_count;
+    input_properties.sorted_run_count = sorted_run_count;
+    input_properties.indexed_chunk_count = indexed_chunk_count;
+    input_properties.table_type = indexed_chunk_count ? TableType::Data : TableType::References;
+    return input_properties;
+  }
+
+  static std::vector<OperatorType> join_types(const std::vector<JoinCostModel::JoinCostEstimate>& estimates) {
+    auto types = std::vector<OperatorType>{};
+    for (const auto& estimate : estimates) {
+      types.emplace_back(estimate.join_type);
+    }
+    return types;
+  }
+
+  static Cost cost_of(const std::vector<JoinCostModel::JoinCostEstimate>& estimates, const OperatorType join_type) {
+    for (const auto& estimate : estimates) {
+      if (estimate.join_type == join_type) {
+        return estimate.cost;
+      }
+    }
+    Fail("No estimate for join type");
+  }
+
+  const JoinConfiguration inner_equi_join{JoinMode::Inner, PredicateCondition::Equals, DataType::Int, DataType::Int,
+                                          false, TableType::References, TableType::References};
+
+  std::shared_ptr<StoredTableNode> sorted_table_node, indexed_table_node;
+};
+
+TEST_F(JoinCostModelTest, HashJoinForUnsortedInputs) {
+  for (const auto row_count : {1.0f, 4.0f, 1'000.0f, 10'000'000.0f}) {
+    const auto estimates =
+        JoinCostModel::estimate_join_costs(inner_equi_join, properties(row_count), properties(row_count), row_count);
+    EXPECT_EQ(join_types(estimates), std::vector<OperatorType>({OperatorType::JoinHash, OperatorType::JoinSortMerge}));
+  }
+
+  // The smaller input becomes the build side of inner joins, regardless of the order of the inputs
+  const auto small_build_side =
+      JoinCostModel::estimate_join_costs(inner_equi_join, properties(1'000), properties(1'000'000), 1'000);
+  const auto small_probe_side =
+      JoinCostModel::estimate_join_costs(inner_equi_join, properties(1'000'000), properties(1'000), 1'000);
+  EXPECT_EQ(cost_of(small_build_side, OperatorType::JoinHash), cost_of(small_probe_side, OperatorType::JoinHash));
+}
+
+TEST_F(JoinCostModelTest, SortMergeJoinForPresortedInputs) {
+  // Small inputs are joined faster by hashing, even if they are sorted
+  const auto small_estimates =
+      JoinCostModel::estimate_join_costs(inner_equi_join, properties(100, 1), properties(100, 1), 100);
+  EXPECT_EQ(small_estimates.front().join_type, OperatorType::JoinHash);
+
+  const auto large_estimates = JoinCostModel::estimate_join_costs(
+      inner_equi_join, properties(10'000'000, 10), properties(10'000'000, 10), 10'000'000);
+  EXPECT_EQ(large_estimates.front().join_type, OperatorType::JoinSortMerge);
+
+  // Non-equi joins are not supported by JoinHash
+  auto less_than_join = inner_equi_join;
+  less_than_join.predicate_condition = PredicateCondition::LessThan;
+  EXPECT_EQ(join_types(JoinCostModel::estimate_join_costs(less_than_join, properties(10), properties(10), 50)),
+            std::vector<OperatorType>{OperatorType::JoinSortMerge});
+}
+
+TEST_F(JoinCostModelTest, FixedBuildSideOfOuterJoins) {
+  // The right input is the build side of left outer joins. If it is large and sorted, JoinSortMerge is cheaper.
+  auto left_join = inner_equi_join;
+  left_join.join_mode = JoinMode::Left;
+
+  const auto inner_estimates =
+      JoinCostModel::estimate_join_costs(inner_equi_join, properties(1'000), properties(10'000'000, 50), 1'000);
+  const auto left_estimates =
+      JoinCostModel::estimate_join_costs(left_join, properties(1'000), properties(10'000'000, 50), 1'000);
+  EXPECT_GT(cost_of(left_estimates, OperatorType::JoinHash), cost_of(inner_estimates, OperatorType::JoinHash));
+  EXPECT_EQ(inner_estimates.front().join_type, OperatorType::JoinHash);
+  EXPECT_EQ(left_estimates.front().join_type, OperatorType::JoinSortMerge);
+}
+
+TEST_F(JoinCostModelTest, IndexJoinForSmallProbeSide) {
+  auto configuration = inner_equi_join;
+  configuration.right_table_type = TableType::Data;
+
+  const auto small_probe_side =
+      JoinCostModel::estimate_join_costs(configuration, properties(10), properties(10'000'000, std::nullopt, 50), 10);
+  EXPECT_EQ(small_probe_side.front().join_type, OperatorType::JoinIndex);
+  EXPECT_EQ(small_probe_side.front().index_side, IndexSide::Right);
+
+  // Every probe tuple is looked up in the index of every chunk
+  const auto large_probe_side = JoinCostModel::estimate_join_costs(
+      configuration, properties(100'000), properties(10'000'000, std::nullopt, 50), 100'000);
+  EXPECT_EQ(large_probe_side.front().join_type, OperatorType::JoinHash);
+  EXPECT_GT(cost_of(large_probe_side, OperatorType::JoinIndex), cost_of(large_probe_side, OperatorType::JoinHash));
+
+  // Index joins require matching data types
+  configuration.left_data_type = DataType::Long;
+  const auto different_types =
+      JoinCostModel::estimate_join_costs(configuration, properties(10), properties(10'000'000, std::nullopt, 50), 10);
+  EXPECT_EQ(join_types(different_types), std::vector<OperatorType>({OperatorType::JoinHash}));
+}
+
+TEST_F(JoinCostModelTest, IndexJoinOnReferenceInput) {
+  // A validated index side requires filtering the index matches by the positions of the Validate output
+  auto data_configuration = inner_equi_join;
+  data_configuration.right_table_type = TableType::Data;
+  const auto data_index_input = properties(1'000'000, std::nullopt, 10);
+
+  auto reference_index_input = data_index_input;
+  reference_index_input.table_type = TableType::References;
+
+  const auto data_estimates =
+      JoinCostModel::estimate_join_costs(data_configuration, properties(10), data_index_input, 10);
+  const auto reference_estimates =
+      JoinCostModel::estimate_join_costs(inner_equi_join, properties(10), reference_index_input, 10);
+  const auto filter_cost = (1'000'000 + 10) * std::log2(100'000.0f) * JoinCostModel::INDEX_REFERENCE_FILTER_COST;
+  EXPECT_FLOAT_EQ(cost_of(reference_estimates, OperatorType::JoinIndex),
+                  cost_of(data_estimates, OperatorType::JoinIndex) + filter_cost);
+}
+
+TEST_F(JoinCostModelTest, NestedLoopJoinOnlyAsFallback) {
+  // Even though a nested loop join would be cheap for tiny inputs, it is not chosen. Underestimated inputs would make
+  // the quadratic algorithm explode.
+  EXPECT_EQ(JoinCostModel::estimate_join_costs(inner_equi_join, properties(2), properties(2), 2).front().join_type,
+            OperatorType::JoinHash);
+
+  // Neither JoinHash nor JoinSortMerge support non-equi joins of different data types
+  auto configuration = inner_equi_join;
+  configuration.predicate_condition = PredicateCondition::LessThan;
+  configuration.right_data_type = DataType::Float;
+  const auto estimates = JoinCostModel::estimate_join_costs(configuration, properties(10), properties(20), 100);
+  ASSERT_EQ(join_types(estimates), std::vector<OperatorType>{OperatorType::JoinNestedLoop});
+  EXPECT_FLOAT_EQ(estimates.front().cost,
+                  10 * 20 * JoinCostModel::NESTED_LOOP_PAIR_COST + 100 * JoinCostModel::OUTPUT_COST);
+}
+
+TEST_F(JoinCostModelTest, SortedInputProperties) {
+  const auto join_cost_model = JoinCostModel{std::make_shared<CardinalityEstimator>()};
+  const auto a = sorted_table_node->get_column("a");
+
+  const auto stored_table_properties = join_cost_model.input_properties(sorted_table_node, ColumnID{0});
+  EXPECT_EQ(stored_table_properties.sorted_run_count, 3u);
+  EXPECT_FALSE(stored_table_properties.indexed_chunk_count);
+  EXPECT_EQ(stored_table_properties.table_type, TableType::Data);
+
+  // Predicates and Validate keep the order within the chunks
+  const auto predicate_node = PredicateNode::make(greater_than_(a, 1), ValidateNode::make(sorted_table_node));
+  const auto predicate_properties = join_cost_model.input_properties(predicate_node, ColumnID{0});
+  EXPECT_EQ(predicate_properties.sorted_run_count, 3u);
+  EXPECT_EQ(predicate_properties.table_type, TableType::References);
+
+  // Pruned chunks do not count
+  sorted_table_node->set_pruned_chunk_ids({ChunkID{1}});
+  EXPECT_EQ(join_cost_model.input_properties(sorted_table_node, ColumnID{0}).sorted_run_count, 2u);
+
+  const auto sort_node = SortNode::make(expression_vector(indexed_table_node->get_column("a")),
+                                        std::vector<SortMode>{SortMode::Ascending}, indexed_table_node);
+  EXPECT_EQ(join_cost_model.input_properties(sort_node, ColumnID{0}).sorted_run_count, 1u);
+
+  const auto descending_sort_node =
+      SortNode::make(expression_vector(a), std::vector<SortMode>{SortMode::Descending}, sorted_table_node);
+  EXPECT_FALSE(join_cost_model.input_properties(descending_sort_node, ColumnID{0}).sorted_run_count);
+
+  EXPECT_FALSE(join_cost_model.input_properties(indexed_table_node, ColumnID{0}).sorted_run_count);
+}
+
+TEST_F(JoinCostModelTest, IndexedInputProperties) {
+  const auto join_cost_model = JoinCostModel{std::make_shared<CardinalityEstimator>()};
+
+  const auto stored_table_properties = join_cost_model.input_properties(indexed_table_node, ColumnID{0});
+  EXPECT_EQ(stored_table_properties.indexed_chunk_count, 2u);
+  EXPECT_FLOAT_EQ(stored_table_properties.row_count, 3.0f);
+
+  EXPECT_EQ(join_cost_model.input_properties(ValidateNode::make(indexed_table_node), ColumnID{0}).indexed_chunk_count,
+            2u);
+  EXPECT_FALSE(join_cost_model.input_properties(indexed_table_node, ColumnID{1}).indexed_chunk_count);
+
+  // The output of a TableScan does not carry the indexes
+  const auto predicate_node = PredicateNode::make(greater_than_(indexed_table_node->get_column("a"), 1),
+                                                  indexed_table_node);
+  EXPECT_FALSE(join_cost_model.input_properties(predicate_node, ColumnID{0}).indexed_chunk_count);
+}
+
+TEST_F(JoinCostModelTest, EstimatesToString) {
+  const auto estimates = std::vector<JoinCostModel::JoinCostEstimate>{
+      {OperatorType::JoinIndex, 12.4f, IndexSide::Right}, {OperatorType::JoinHash, 1500.0f, std::nullopt}};
+  EXPECT_EQ(JoinCostModel::estimates_to_string(estimates),
+            "Estimated cost: JoinIndex (index right) 12, JoinHash 1500");
+}
+
+}  // namespace opossum
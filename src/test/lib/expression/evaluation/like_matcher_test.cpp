@@ -53,6 +53,58 @@ TEST_F(LikeMatcherTest, NotMatching) {
   EXPECT_FALSE(match("hello", "Hello"));
   EXPECT_FALSE(match("Hello", "Hello_"));
   EXPECT_FALSE(match("Hello", "He_o"));
+  EXPECT_FALSE(match("Hello World", "%o%Wor"));
+  EXPECT_FALSE(match("Hello World", "%o%o%o%"));
+  EXPECT_FALSE(match("Hello", "%ll%ll%"));
+}
+
+TEST_F(LikeMatcherTest, GeneralPatternMatching) {
+  EXPECT_TRUE(match("", "%%"));
+  EXPECT_TRUE(match("Hello", "H_llo"));
+  EXPECT_TRUE(match("Hello", "_____"));
+  EXPECT_TRUE(match("Hello", "%l_o"));
+  EXPECT_TRUE(match("Hello", "H%l%o"));
+  EXPECT_TRUE(match("Hello", "H%_%o"));
+  EXPECT_TRUE(match("Hello", "He%lo"));
+  EXPECT_TRUE(match("Hello World", "%o_W%"));
+  EXPECT_TRUE(match("Hello World", "H%o%o%d"));
+
+  EXPECT_FALSE(match("", "_%"));
+  EXPECT_FALSE(match("Hello", "______"));
+  EXPECT_FALSE(match("Hello", "Hel%llo"));
+  EXPECT_FALSE(match("Hello", "H%e%e%"));
+  EXPECT_FALSE(match("Hello World", "%o_W"));
+  EXPECT_FALSE(match("Hello World", "_ello%Word"));
+}
+
+TEST_F(LikeMatcherTest, GeneralPatternMatchingLongStrings) {
+  // Occurrences of the segments are searched for in blocks of 16 or 32 characters. Make sure that matches in later
+  // blocks, at block boundaries, and in the remaining characters are found.
+  const auto string = std::string(100, 'a');
+  for (auto position = size_t{1}; position < 97; ++position) {
+    auto string_with_segment = string;
+    string_with_segment.replace(position, 3, "bcd");
+    EXPECT_TRUE(match(string_with_segment, "a%b_d%a")) << position;
+    EXPECT_TRUE(match(string_with_segment, "%b_d%")) << position;
+    EXPECT_TRUE(match(string_with_segment, "%_b%d%a")) << position;
+    EXPECT_FALSE(match(string_with_segment, "%b_c%")) << position;
+    EXPECT_FALSE(match(string_with_segment, "%d%b%")) << position;
+  }
+}
+
+TEST_F(LikeMatcherTest, PatternVariant) {
+  const auto is_general_pattern = [](const pmr_string& pattern) {
+    return std::holds_alternative<LikeMatcher::GeneralPattern>(LikeMatcher::pattern_string_to_pattern_variant(pattern));
+  };
+
+  EXPECT_FALSE(is_general_pattern("Hello%"));
+  EXPECT_FALSE(is_general_pattern("%Hello"));
+  EXPECT_FALSE(is_general_pattern("%Hello%"));
+  EXPECT_FALSE(is_general_pattern("%Hello%World%"));
+  EXPECT_TRUE(is_general_pattern("Hello"));
+  EXPECT_TRUE(is_general_pattern("H_llo%"));
+  EXPECT_TRUE(is_general_pattern("%Hello%World"));
+  EXPECT_TRUE(is_general_pattern("Hello%World%"));
 }
 
 TEST_F(LikeMatcherTest, LowerUpperBound) {
@@ -220,4 +220,28 @@ TEST_F(ExpressionEvaluatorToPosListTest, ExistsUncorrelated) {
                               {ChunkOffset{0}, ChunkOffset{1}, ChunkOffset{2}, ChunkOffset{3}}));
 }
 
+TEST_F(ExpressionEvaluatorToPosListTest, VectorizedEvaluation) {
+  // The Chunk is evaluated in three vectors, the last of which is only partially filled
+  const auto row_count = static_cast<ChunkOffset>(ExpressionEvaluator::VECTOR_SIZE * 2 + 17);
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}}, TableType::Data, row_count);
+  for (auto row_idx = int32_t{0}; row_idx < static_cast<int32_t>(row_count); ++row_idx) {
+    table->append({row_idx, row_idx % 7 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row_idx % 100}});
+  }
+
+  const auto a = PQPColumnExpression::from_table(*table, "a");
+  const auto b = PQPColumnExpression::from_table(*table, "b");
+
+  auto vectorized_evaluator =
+      ExpressionEvaluator{table, ChunkID{0}, nullptr, ExpressionEvaluator::EvaluationMode::Vectorized};
+  const auto predicates =
+      expression_vector(less_than_(b, 10), greater_than_equals_(add_(a, b), 1500), or_(less_than_(b, 50), is_null_(b)),
+                        and_(between_inclusive_(a, 1000, 1100), greater_than_(b, 5)), is_not_null_(b),
+                        like_(cast_(a, DataType::String), "%23"));
+  for (const auto& predicate : predicates) {
+    const auto expected_pos_list = ExpressionEvaluator{table, ChunkID{0}}.evaluate_expression_to_pos_list(*predicate);
+    EXPECT_EQ(vectorized_evaluator.evaluate_expression_to_pos_list(*predicate), expected_pos_list);
+  }
+}
+
 }  // namespace opossum
@@ -21,6 +21,7 @@
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "utils/load_table.hpp"
 
@@ -829,4 +830,61 @@ TEST_F(ExpressionEvaluatorToValuesTest, CastNullableStrings) {
                                        {12, std::nullopt, 1234, std::nullopt}));
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, VectorizedEvaluation) {
+  // The Chunks have more rows than ExpressionEvaluator::VECTOR_SIZE, so that they are evaluated in multiple vectors,
+  // the last of which is only partially filled. The second Chunk is dictionary-encoded and the third Chunk is
+  // LZ4-encoded, so that the per-Chunk materializations of encoded segments are sliced and replaced on set_chunk().
+  const auto chunk_size = static_cast<ChunkOffset>(ExpressionEvaluator::VECTOR_SIZE * 2 + 17);
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Double, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, chunk_size);
+  for (auto row_idx = int32_t{0}; row_idx < 3 * static_cast<int32_t>(chunk_size); ++row_idx) {
+    table->append({row_idx, row_idx % 7 == 0 ? AllTypeVariant{NullValue{}} : AllTypeVariant{row_idx * 0.5}});
+  }
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_chunks(table, {ChunkID{1}}, SegmentEncodingSpec{EncodingType::Dictionary});
+  ChunkEncoder::encode_chunks(table, {ChunkID{2}}, SegmentEncodingSpec{EncodingType::LZ4});
+
+  const auto column_a = PQPColumnExpression::from_table(*table, "a");
+  const auto column_b = PQPColumnExpression::from_table(*table, "b");
+  const auto a_plus_b = add_(column_a, column_b);
+  const auto expressions = expression_vector(a_plus_b, mul_(a_plus_b, 2), div_(column_a, mod_(column_a, 5)),
+                                             unary_minus_(column_b), case_(greater_than_(column_a, 100), column_b, 0.0),
+                                             cast_(column_a, DataType::String), less_than_(column_b, 10), 42);
+
+  const auto to_table = [&](const std::vector<std::shared_ptr<BaseValueSegment>>& value_segments) {
+    auto result_column_definitions = TableColumnDefinitions{};
+    auto segments = Segments{};
+    for (auto expression_idx = size_t{0}; expression_idx < expressions.size(); ++expression_idx) {
+      result_column_definitions.emplace_back(expressions[expression_idx]->as_column_name(),
+                                             expressions[expression_idx]->data_type(),
+                                             value_segments[expression_idx]->is_nullable());
+      segments.emplace_back(value_segments[expression_idx]);
+    }
+    const auto result_table = std::make_shared<Table>(result_column_definitions, TableType::Data);
+    result_table->append_chunk(segments);
+    return result_table;
+  };
+
+  // The same evaluator is used for all Chunks
+  auto vectorized_evaluator =
+      ExpressionEvaluator{table, ChunkID{0}, nullptr, ExpressionEvaluator::EvaluationMode::Vectorized};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    if (chunk_id > 0) {
+      vectorized_evaluator.set_chunk(chunk_id);
+    }
+
+    auto expected_segments = std::vector<std::shared_ptr<BaseValueSegment>>{};
+    for (const auto& expression : expressions) {
+      expected_segments.emplace_back(ExpressionEvaluator{table, chunk_id}.evaluate_expression_to_segment(*expression));
+    }
+
+    EXPECT_TABLE_EQ_ORDERED(to_table(vectorized_evaluator.evaluate_expressions_to_segments(expressions)),
+                            to_table(expected_segments));
+
+    // After the vectorized evaluation, results for the entire Chunk are returned
+    const auto a_plus_b_result = vectorized_evaluator.evaluate_expression_to_result<double>(*a_plus_b);
+    EXPECT_EQ(a_plus_b_result->size(), static_cast<size_t>(chunk_size));
+  }
+}
+
 }  // namespace opossum
@@ -6,6 +6,7 @@
 
 #include "hyrise.hpp"
 #include "import_export/binary/binary_parser.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
 
@@ -424,4 +425,50 @@ TEST_F(BinaryParserTest, SortColumnDefinitions) {
   EXPECT_TRUE(table->get_chunk(ChunkID{2})->individually_sorted_by().empty());
 }
 
+TEST_F(BinaryParserTest, FileWithoutChunkOffsetIndex) {
+  // Files written before the chunk offset index was introduced are read sequentially. This file equals
+  // SortColumnDefinitions.bin without the index.
+  const auto expected_table = BinaryParser::parse(_reference_filepath + "SortColumnDefinitions.bin");
+  auto table = BinaryParser::parse(_reference_filepath +
+                                   ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin");
+
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+  for (auto chunk_id = ChunkID{0}; chunk_id < expected_table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(table->get_chunk(chunk_id)->individually_sorted_by(),
+              expected_table->get_chunk(chunk_id)->individually_sorted_by());
+  }
+}
+
+TEST_F(BinaryParserTest, ParallelChunkImport) {
+  const auto filenames = std::vector<std::string>{"AllTypesMixColumn/Dictionary.bin",
+                                                  "AllTypesMixColumn/LZ4.bin",
+                                                  "AllTypesMixColumn/RunLength.bin",
+                                                  "AllTypesMixColumn/Unencoded.bin",
+                                                  "AllTypesNullValues/Unencoded.bin",
+                                                  "FixedStringDictionaryMultipleChunks.bin",
+                                                  "FileWithoutChunkOffsetIndex.bin",
+                                                  "LZ4MultipleBlocks.bin",
+                                                  "MultipleChunksFrameOfReferenceSegment.bin",
+                                                  "SortColumnDefinitions.bin",
+                                                  "TwoColumnsNoValues.bin"};
+
+  // The ImmediateExecutionScheduler decodes one chunk after the other
+  auto expected_tables = std::vector<std::shared_ptr<Table>>{};
+  for (const auto& filename : filenames) {
+    expected_tables.emplace_back(BinaryParser::parse(_reference_filepath + filename));
+  }
+
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  for (auto file_idx = size_t{0}; file_idx < filenames.size(); ++file_idx) {
+    SCOPED_TRACE(filenames[file_idx]);
+    const auto table = BinaryParser::parse(_reference_filepath + filenames[file_idx]);
+
+    EXPECT_EQ(table->chunk_count(), expected_tables[file_idx]->chunk_count());
+    EXPECT_TABLE_EQ_ORDERED(table, expected_tables[file_idx]);
+  }
+
+  EXPECT_THROW(BinaryParser::parse("not_existing_file"), std::exception);
+  Hyrise::get().scheduler()->finish();
+}
+
 }  // namespace opossum
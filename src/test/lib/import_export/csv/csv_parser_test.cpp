@@ -5,11 +5,19 @@
 #include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/run_length_segment.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
 
-class CsvParserTest : public BaseTest {};
+class CsvParserTest : public BaseTest {
+ protected:
+  static std::shared_ptr<Table> parse_with_read_window_size(const std::string& filename, const ChunkOffset chunk_size,
+                                                            const size_t read_window_size) {
+    return CsvParser::_parse(filename, chunk_size, std::nullopt, std::nullopt, read_window_size);
+  }
+};
 
 TEST_F(CsvParserTest, SingleFloatColumn) {
   auto table = CsvParser::parse("resources/test_data/csv/float.csv");
@@ -306,4 +314,48 @@ TEST_F(CsvParserTest, FinalizedChunks) {
   EXPECT_FALSE(table->get_chunk(ChunkID{2})->is_mutable());
 }
 
+TEST_F(CsvParserTest, RowsSpanningReadWindows) {
+  const auto filenames = std::vector<std::string>{
+      "resources/test_data/csv/float_int_large.csv", "resources/test_data/csv/string_escaped.csv",
+      "resources/test_data/csv/string_quotes.csv", "resources/test_data/csv/float_int_trailing_newline.csv"};
+
+  for (const auto& filename : filenames) {
+    // Small chunks, so that the end of a window usually falls into a chunk that is not full yet
+    const auto expected_table = CsvParser::parse(filename, ChunkOffset{3});
+    for (const auto read_window_size : {size_t{1}, size_t{2}, size_t{7}, size_t{100}}) {
+      SCOPED_TRACE(filename + " with windows of " + std::to_string(read_window_size) + " bytes");
+      const auto table = parse_with_read_window_size(filename, ChunkOffset{3}, read_window_size);
+      EXPECT_EQ(table->chunk_count(), expected_table->chunk_count());
+      EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+    }
+  }
+}
+
+TEST_F(CsvParserTest, EncodeWhileParsing) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto encoding_spec =
+      ChunkEncodingSpec{SegmentEncodingSpec{EncodingType::Dictionary}, SegmentEncodingSpec{EncodingType::RunLength}};
+  const auto table =
+      CsvParser::parse("resources/test_data/csv/float_int_large.csv", ChunkOffset{20}, std::nullopt, encoding_spec);
+
+  const auto expected_table = CsvParser::parse("resources/test_data/csv/float_int_large.csv", ChunkOffset{20});
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  ASSERT_EQ(table->chunk_count(), 5u);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<float>>(chunk->get_segment(ColumnID{0})));
+    EXPECT_TRUE(std::dynamic_pointer_cast<RunLengthSegment<int32_t>>(chunk->get_segment(ColumnID{1})));
+  }
+
+  EXPECT_THROW(CsvParser::parse("resources/test_data/csv/float_int_large.csv", ChunkOffset{20}, std::nullopt,
+                                ChunkEncodingSpec{SegmentEncodingSpec{EncodingType::Dictionary}}),
+               std::exception);
+
+  Hyrise::get().scheduler()->finish();
+}
+
 }  // namespace opossum
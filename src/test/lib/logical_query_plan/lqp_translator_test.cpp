@@ -34,26 +34,32 @@
 #include "logical_query_plan/validate_node.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/change_meta_table.hpp"
+#include "operators/chunk_pipeline.hpp"
 #include "operators/export.hpp"
 #include "operators/get_table.hpp"
 #include "operators/import.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
+#include "operators/key_index_scan.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
 #include "operators/maintenance/create_table.hpp"
 #include "operators/maintenance/drop_table.hpp"
 #include "operators/product.hpp"
 #include "operators/projection.hpp"
+#include "operators/runtime_filter.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_key/table_key_index.hpp"
 #include "storage/prepared_plan.hpp"
 #include "storage/table.hpp"
 #include "utils/load_table.hpp"
@@ -364,6 +370,49 @@ TEST_F(LQPTranslatorTest, LimitLiteral) {
   EXPECT_EQ(get_table->table_name(), "table_int_float");
 }
 
+TEST_F(LQPTranslatorTest, LimitAboveSortIsTopK) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float ORDER BY b DESC, a LIMIT 10
+   */
+  const auto sort_modes = std::vector<SortMode>{SortMode::Descending, SortMode::Ascending};
+
+  // clang-format off
+  const auto lqp =
+  LimitNode::make(value_(10),
+    SortNode::make(expression_vector(int_float_b, int_float_a), sort_modes,
+      int_float_node));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP
+   */
+  const auto top_k = std::dynamic_pointer_cast<TopK>(pqp);
+  ASSERT_TRUE(top_k);
+  EXPECT_EQ(top_k->k(), size_t{10});
+  ASSERT_EQ(top_k->sort_definitions().size(), 2u);
+  EXPECT_EQ(top_k->sort_definitions().at(0), SortColumnDefinition(ColumnID{1}, SortMode::Descending));
+  EXPECT_EQ(top_k->sort_definitions().at(1), SortColumnDefinition(ColumnID{0}, SortMode::Ascending));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(top_k->left_input()));
+
+  // Row counts that are not constant or too large keep using Sort and Limit
+  const auto too_large_k = static_cast<int64_t>(TopK::MAX_K + 1);
+  for (const auto& num_rows_expression : expression_vector(placeholder_(ParameterID{0}), value_(too_large_k))) {
+    // clang-format off
+    const auto limit_lqp =
+    LimitNode::make(num_rows_expression,
+      SortNode::make(expression_vector(int_float_a), std::vector<SortMode>{SortMode::Ascending},
+        int_float_node));
+    // clang-format on
+    const auto limit = std::dynamic_pointer_cast<Limit>(LQPTranslator{}.translate_node(limit_lqp));
+    ASSERT_TRUE(limit);
+    EXPECT_TRUE(std::dynamic_pointer_cast<const Sort>(limit->left_input()));
+  }
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeUnaryScan) {
   /**
    * Build LQP and translate to PQP
@@ -569,6 +618,31 @@ TEST_F(LQPTranslatorTest, PredicateNodeBinaryIndexScan) {
   EXPECT_EQ(*table_scan_op->predicate(), *between_inclusive_(b, 42, 1337));
 }
 
+TEST_F(LQPTranslatorTest, PredicateNodeKeyIndexScan) {
+  const auto table = Hyrise::get().storage_manager.get_table("int_float_chunked");
+  table->create_key_index({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+
+  const auto stored_table_node = StoredTableNode::make("int_float_chunked");
+  const auto predicate_node = PredicateNode::make(equals_(123, stored_table_node->get_column("a")), stored_table_node);
+  predicate_node->scan_type = ScanType::IndexScan;
+  const auto op = LQPTranslator{}.translate_node(predicate_node);
+
+  const auto key_index_scan_op = std::dynamic_pointer_cast<const KeyIndexScan>(op);
+  ASSERT_TRUE(key_index_scan_op);
+  EXPECT_EQ(key_index_scan_op->column_ids(), std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(key_index_scan_op->values(), std::vector<AllTypeVariant>{123});
+  EXPECT_EQ(key_index_scan_op->lqp_node, predicate_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(op->left_input()));
+
+  // Predicates that do not cover the key are executed by a TableScan
+  const auto range_predicate_node =
+      PredicateNode::make(and_(equals_(stored_table_node->get_column("a"), 123),
+                               less_than_(stored_table_node->get_column("b"), 500.0f)),
+                          stored_table_node);
+  range_predicate_node->scan_type = ScanType::IndexScan;
+  EXPECT_TRUE(std::dynamic_pointer_cast<const TableScan>(LQPTranslator{}.translate_node(range_predicate_node)));
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeIndexScanFailsWhenNotApplicable) {
   if (!HYRISE_DEBUG) {
     GTEST_SKIP();
@@ -665,6 +739,85 @@ TEST_F(LQPTranslatorTest, JoinNodeToJoinNestedLoop) {
   EXPECT_EQ(join_op->mode(), JoinMode::Inner);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeToJoinIndex) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto indexed_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}},
+                                                     TableType::Data, ChunkOffset{500});
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    indexed_table->append({value});
+  }
+  indexed_table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(indexed_table);
+  indexed_table->create_index<GroupKeyIndex>({ColumnID{0}});
+  Hyrise::get().storage_manager.add_table("indexed_table", indexed_table);
+
+  const auto indexed_table_node = StoredTableNode::make("indexed_table");
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(int_float_a, indexed_table_node->get_column("a")),
+                                        int_float_node, indexed_table_node);
+  const auto op = LQPTranslator{}.translate_node(join_node);
+
+  /**
+   * Check PQP - probing the indexes with the few tuples of the left input is cheaper than hashing all rows of the
+   * right input. The estimates are part of the description.
+   */
+  const auto join_op = std::dynamic_pointer_cast<JoinIndex>(op);
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->primary_predicate().column_ids, ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_NE(join_op->description(DescriptionMode::MultiLine).find("Estimated cost: JoinIndex (index right)"),
+            std::string::npos);
+  EXPECT_EQ(join_op->description(DescriptionMode::SingleLine).find("Estimated cost"), std::string::npos);
+}
+
+TEST_F(LQPTranslatorTest, JoinHashPublishesRuntimeFilter) {
+  const auto probe_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}},
+                                                   TableType::Data, ChunkOffset{500});
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    probe_table->append({value});
+  }
+  Hyrise::get().storage_manager.add_table("probe_table", probe_table);
+
+  const auto probe_table_node = StoredTableNode::make("probe_table");
+  const auto probe_a = probe_table_node->get_column("a");
+
+  // clang-format off
+  const auto lqp =
+  JoinNode::make(JoinMode::Semi, equals_(probe_a, int_float_a),
+    PredicateNode::make(greater_than_(probe_a, 5),
+      probe_table_node),
+    int_float_node);
+  // clang-format on
+  const auto op = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP - the few rows of the right input are summarized in a filter for the scan and the GetTable on the left
+   */
+  const auto join_op = std::dynamic_pointer_cast<JoinHash>(op);
+  ASSERT_TRUE(join_op);
+  ASSERT_EQ(join_op->runtime_filters().size(), 1u);
+
+  const auto& runtime_filter = join_op->runtime_filters().front();
+  EXPECT_EQ(runtime_filter->source(), join_op->right_input());
+  EXPECT_EQ(runtime_filter->source_column_id(), ColumnID{0});
+
+  const auto table_scan = std::dynamic_pointer_cast<const TableScan>(join_op->left_input());
+  ASSERT_TRUE(table_scan);
+  const auto get_table = table_scan->left_input();
+  EXPECT_EQ(runtime_filter->probe_chain(),
+            std::vector<std::shared_ptr<const AbstractOperator>>({get_table, table_scan}));
+  EXPECT_EQ(runtime_filter->consumers().size(), 2u);
+  EXPECT_EQ(table_scan->runtime_filters().size(), 1u);
+
+  // All rows of the left input are part of the result of a left outer join. Only the right input could be filtered,
+  // which does not pay off for a large source.
+  const auto left_join_lqp = JoinNode::make(JoinMode::Left, equals_(probe_a, int_float_a), probe_table_node,
+                                            int_float_node);
+  const auto left_join_op = std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(left_join_lqp));
+  ASSERT_TRUE(left_join_op);
+  EXPECT_TRUE(left_join_op->runtime_filters().empty());
+}
+
 TEST_F(LQPTranslatorTest, AggregateNodeSimple) {
   /**
    * Build LQP and translate to PQP
@@ -693,6 +846,44 @@ TEST_F(LQPTranslatorTest, AggregateNodeSimple) {
   EXPECT_EQ(*count, *count_(pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*")));
 }
 
+TEST_F(LQPTranslatorTest, AggregateNodePipelined) {
+  // clang-format off
+  const auto lqp =
+  AggregateNode::make(expression_vector(int_float_a), expression_vector(sum_(add_(int_float_b, int_float_a)), count_star_(int_float_node)),  // NOLINT
+    ProjectionNode::make(expression_vector(int_float_b, int_float_a, add_(int_float_b, int_float_a)),
+      PredicateNode::make(greater_than_(int_float_a, 5),
+        int_float_node)));
+  // clang-format on
+  const auto op = LQPTranslator{true}.translate_node(lqp);
+
+  const auto chunk_pipeline = std::dynamic_pointer_cast<ChunkPipeline>(op);
+  ASSERT_TRUE(chunk_pipeline);
+  EXPECT_EQ(chunk_pipeline->groupby_column_ids, std::vector<ColumnID>{ColumnID{1}});
+  ASSERT_EQ(chunk_pipeline->aggregates.size(), 2u);
+  EXPECT_EQ(*chunk_pipeline->aggregates[0], *sum_(pqp_column_(ColumnID{2}, DataType::Float, false, "b + a")));
+
+  ASSERT_EQ(chunk_pipeline->stages.size(), 2u);
+  const auto a = PQPColumnExpression::from_table(*table_int_float, "a");
+  EXPECT_EQ(chunk_pipeline->stages[0].type, OperatorType::TableScan);
+  EXPECT_EQ(*chunk_pipeline->stages[0].expressions.at(0), *greater_than_(a, 5));
+  EXPECT_EQ(chunk_pipeline->stages[1].type, OperatorType::Projection);
+  EXPECT_EQ(chunk_pipeline->stages[1].expressions.size(), 3u);
+
+  ASSERT_TRUE(std::dynamic_pointer_cast<const GetTable>(chunk_pipeline->left_input()));
+
+  // COUNT(DISTINCT) cannot be merged from per-chunk results, so that the regular operators are used
+  // clang-format off
+  const auto lqp_count_distinct =
+  AggregateNode::make(expression_vector(), expression_vector(count_distinct_(int_float_a)),
+    PredicateNode::make(greater_than_(int_float_a, 5),
+      int_float_node));
+  // clang-format on
+  const auto aggregate_op =
+      std::dynamic_pointer_cast<AggregateHash>(LQPTranslator{true}.translate_node(lqp_count_distinct));
+  ASSERT_TRUE(aggregate_op);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const TableScan>(aggregate_op->left_input()));
+}
+
 TEST_F(LQPTranslatorTest, JoinAndPredicates) {
   /**
    * Build LQP and translate to PQP
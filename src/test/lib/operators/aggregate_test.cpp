@@ -18,6 +18,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/table.hpp"
@@ -735,6 +736,39 @@ TYPED_TEST(OperatorsAggregateTest, TwoAggregateEmptyTableGrouped) {
                          "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_3agg/max_count_count_empty.tbl");
 }
 
+/**
+ * Tests for multi-threaded execution. For AggregateHash, these use the parallel aggregation, where chunks are
+ * aggregated by multiple jobs and the partial results are merged afterwards.
+ */
+
+TYPED_TEST(OperatorsAggregateTest, MultiThreaded) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  test_output<TypeParam>(this->_table_wrapper_1_1_string, {{ColumnID{1}, AggregateFunction::Sum}}, {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/sum.tbl");
+  test_output<TypeParam>(this->_table_wrapper_1_1_string_null, {{ColumnID{1}, AggregateFunction::Count}}, {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_string_1gb_1agg/count_str_null.tbl", false);
+  test_output<TypeParam>(this->_table_wrapper_2_2,
+                         {{ColumnID{2}, AggregateFunction::StandardDeviationSample},
+                          {ColumnID{3}, AggregateFunction::Avg}},
+                         {ColumnID{0}, ColumnID{1}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_int_2gb_2agg/stddev_samp_avg.tbl");
+  test_output<TypeParam>(this->_table_wrapper_2_2,
+                         {{ColumnID{2}, AggregateFunction::Min}, {ColumnID{3}, AggregateFunction::Max}},
+                         {ColumnID{0}, ColumnID{1}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_int_2gb_2agg/min_max.tbl");
+  test_output<TypeParam>(this->_table_wrapper_3_0_null, {{INVALID_COLUMN_ID, AggregateFunction::Count}},
+                         {ColumnID{0}, ColumnID{2}, ColumnID{3}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_int_3gb_0agg/count_star.tbl", false);
+  test_output<TypeParam>(this->_table_wrapper_1_1, {}, {ColumnID{0}, ColumnID{1}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_int_2gb_0agg/result.tbl");
+  test_output<TypeParam>(this->_table_wrapper_1_1, {{ColumnID{1}, AggregateFunction::StandardDeviationSample}}, {},
+                         "resources/test_data/tbl/aggregateoperator/0gb_1agg/stddev_samp.tbl");
+  test_output<TypeParam>(this->_table_wrapper_1_1, {{ColumnID{1}, AggregateFunction::CountDistinct}}, {ColumnID{0}},
+                         "resources/test_data/tbl/aggregateoperator/groupby_int_1gb_1agg/count_distinct.tbl");
+}
+
 /**
  * Tests for ReferenceSegments
  */
@@ -0,0 +1,151 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "hyrise.hpp"
+#include "operators/aggregate_hash.hpp"
+#include "operators/chunk_pipeline.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsChunkPipelineTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(
+        load_table("resources/test_data/tbl/tpch/sf-0.001/lineitem.tbl", ChunkOffset{100}));
+    _table_wrapper->never_clear_output();
+    _table_wrapper->execute();
+
+    const auto& table = *_table_wrapper->get_output();
+    _orderkey = PQPColumnExpression::from_table(table, "l_orderkey");
+    _quantity = PQPColumnExpression::from_table(table, "l_quantity");
+    _extendedprice = PQPColumnExpression::from_table(table, "l_extendedprice");
+    _discount = PQPColumnExpression::from_table(table, "l_discount");
+    _returnflag = PQPColumnExpression::from_table(table, "l_returnflag");
+    _linestatus = PQPColumnExpression::from_table(table, "l_linestatus");
+    _shipdate = PQPColumnExpression::from_table(table, "l_shipdate");
+  }
+
+  // Executes the pipeline and the same chain of operators one after the other and compares their results
+  void test_against_operators(const std::vector<ChunkPipeline::Stage>& stages,
+                              const std::vector<std::shared_ptr<AggregateExpression>>& aggregates,
+                              const std::vector<ColumnID>& groupby_column_ids,
+                              const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto current_operator = std::shared_ptr<AbstractOperator>{_table_wrapper};
+    for (const auto& stage : stages) {
+      switch (stage.type) {
+        case OperatorType::TableScan:
+          current_operator = std::make_shared<TableScan>(current_operator, stage.expressions.front());
+          break;
+        case OperatorType::Validate:
+          current_operator = std::make_shared<Validate>(current_operator);
+          current_operator->set_transaction_context(transaction_context);
+          break;
+        default:
+          current_operator = std::make_shared<Projection>(current_operator, stage.expressions);
+      }
+      current_operator->execute();
+    }
+    const auto aggregate = std::make_shared<AggregateHash>(current_operator, aggregates, groupby_column_ids);
+    aggregate->execute();
+
+    const auto pipeline = std::make_shared<ChunkPipeline>(_table_wrapper, stages, aggregates, groupby_column_ids);
+    if (transaction_context) {
+      pipeline->set_transaction_context(transaction_context);
+    }
+    pipeline->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(pipeline->get_output(), aggregate->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<PQPColumnExpression> _orderkey, _quantity, _extendedprice, _discount, _returnflag, _linestatus,
+      _shipdate;
+};
+
+TEST_F(OperatorsChunkPipelineTest, OperatorName) {
+  const auto pipeline = std::make_shared<ChunkPipeline>(
+      _table_wrapper, std::vector<ChunkPipeline::Stage>{{OperatorType::Validate, {}}},
+      std::vector<std::shared_ptr<AggregateExpression>>{sum_(_quantity)}, std::vector<ColumnID>{});
+  EXPECT_EQ(pipeline->name(), "ChunkPipeline");
+}
+
+TEST_F(OperatorsChunkPipelineTest, Description) {
+  const auto stages = std::vector<ChunkPipeline::Stage>{{OperatorType::TableScan, {greater_than_(_quantity, 10)}},
+                                                        {OperatorType::Projection, {_returnflag, _quantity}}};
+  const auto pipeline = std::make_shared<ChunkPipeline>(_table_wrapper, stages,
+                                                        std::vector<std::shared_ptr<AggregateExpression>>{sum_(
+                                                            pqp_column_(ColumnID{1}, DataType::Float, false, "q"))},
+                                                        std::vector<ColumnID>{ColumnID{0}});
+
+  EXPECT_EQ(pipeline->description(DescriptionMode::SingleLine),
+            "ChunkPipeline -> TableScan l_quantity > 10 -> Projection l_returnflag, l_quantity -> Aggregate GroupBy "
+            "{Column #0} SUM(q)");
+}
+
+TEST_F(OperatorsChunkPipelineTest, SupportedAggregates) {
+  const auto groupby_column_ids = std::vector<ColumnID>{ColumnID{0}};
+
+  EXPECT_TRUE(ChunkPipeline::supports_aggregates({sum_(_quantity), avg_(_quantity), min_(_quantity), max_(_quantity),
+                                                  count_(_quantity)},
+                                                 {}));
+  EXPECT_TRUE(ChunkPipeline::supports_aggregates({any_(_quantity)}, groupby_column_ids));
+  EXPECT_FALSE(ChunkPipeline::supports_aggregates({any_(_quantity)}, {}));
+  EXPECT_FALSE(ChunkPipeline::supports_aggregates({sum_(_quantity), count_distinct_(_quantity)}, groupby_column_ids));
+  EXPECT_FALSE(ChunkPipeline::supports_aggregates({standard_deviation_sample_(_quantity)}, groupby_column_ids));
+}
+
+TEST_F(OperatorsChunkPipelineTest, ScanAndAggregateWithoutGroupBy) {
+  // TPC-H Q6
+  const auto stages = std::vector<ChunkPipeline::Stage>{
+      {OperatorType::TableScan, {greater_than_equals_(_shipdate, "1994-01-01")}},
+      {OperatorType::TableScan, {less_than_(_shipdate, "1995-01-01")}},
+      {OperatorType::TableScan, {between_inclusive_(_discount, 0.05, 0.07)}},
+      {OperatorType::TableScan, {less_than_(_quantity, 24)}},
+      {OperatorType::Projection, {mul_(_extendedprice, _discount), _quantity}}};
+
+  const auto revenue = pqp_column_(ColumnID{0}, DataType::Float, false, "revenue");
+  const auto quantity = pqp_column_(ColumnID{1}, DataType::Float, false, "l_quantity");
+  test_against_operators(stages, {sum_(revenue), avg_(quantity), min_(quantity), max_(quantity), count_(quantity)},
+                         {});
+}
+
+TEST_F(OperatorsChunkPipelineTest, ValidateScanAndAggregateWithGroupBy) {
+  // Similar to TPC-H Q1
+  const auto stages =
+      std::vector<ChunkPipeline::Stage>{{OperatorType::Validate, {}},
+                                        {OperatorType::TableScan, {less_than_equals_(_shipdate, "1998-09-02")}}};
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  test_against_operators(stages,
+                         {sum_(_quantity), sum_(mul_(_extendedprice, sub_(1, _discount))), avg_(_quantity),
+                          avg_(_discount), count_(pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*"))},
+                         {_returnflag->column_id, _linestatus->column_id}, transaction_context);
+}
+
+TEST_F(OperatorsChunkPipelineTest, AnyWithGroupBy) {
+  const auto stages = std::vector<ChunkPipeline::Stage>{{OperatorType::TableScan, {less_than_(_orderkey, 100)}}};
+  test_against_operators(stages, {any_(_orderkey), max_(_quantity)}, {_orderkey->column_id});
+}
+
+TEST_F(OperatorsChunkPipelineTest, EmptyResult) {
+  const auto stages = std::vector<ChunkPipeline::Stage>{{OperatorType::TableScan, {less_than_(_quantity, 0)}}};
+  const auto count_star = count_(pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*"));
+
+  // Without GROUP BY, a single row with COUNT(*) = 0 and NULL for the other aggregates is expected
+  test_against_operators(stages, {count_star, sum_(_quantity), avg_(_quantity)}, {});
+  test_against_operators(stages, {count_star, sum_(_quantity), avg_(_quantity)}, {_returnflag->column_id});
+}
+
+}  // namespace opossum
@@ -88,7 +88,7 @@ TEST_F(OperatorsGetTableTest, PassThroughInvalidRowCount) {
 
   const auto rows_to_delete = table_scan->get_output()->row_count();
 
-  auto delete_op = std::make_shared<Delete>(table_scan);
+  auto delete_op = std::make_shared<Delete>("int_int_float", table_scan);
   delete_op->set_transaction_context(transaction_context);
   delete_op->execute();
 
@@ -198,7 +198,7 @@ TEST_F(OperatorsGetTableTest, ExcludePhysicallyDeletedChunks) {
   vt->execute();
 
   // Delete all rows from table so calling original_table->remove_chunk() below is legal
-  auto delete_all = std::make_shared<opossum::Delete>(vt);
+  auto delete_all = std::make_shared<opossum::Delete>("int_int_float", vt);
   delete_all->set_transaction_context(context);
   delete_all->execute();
   EXPECT_FALSE(delete_all->execute_failed());
@@ -240,7 +240,7 @@ TEST_F(OperatorsGetTableTest, PrunedChunksCombined) {
   vt->execute();
 
   // Delete all rows from table so calling original_table->remove_chunk() below is legal
-  auto delete_all = std::make_shared<opossum::Delete>(vt);
+  auto delete_all = std::make_shared<opossum::Delete>("int_int_float", vt);
   delete_all->set_transaction_context(context);
   delete_all->execute();
   EXPECT_FALSE(delete_all->execute_failed());
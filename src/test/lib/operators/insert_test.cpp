@@ -13,6 +13,7 @@
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/index/table_key/table_key_index.hpp"
 #include "storage/table.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -320,4 +321,55 @@ TEST_F(OperatorsInsertTest, InsertIntoEmptyTable) {
   EXPECT_TABLE_EQ_ORDERED(target_table, table_int_float);
 }
 
+TEST_F(OperatorsInsertTest, KeyIndex) {
+  const auto table = load_table("resources/test_data/tbl/int_int.tbl", ChunkOffset{2});
+  Hyrise::get().storage_manager.add_table("key_table", table);
+  table->create_key_index({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+  const auto& key_index = *table->key_indexes().front();
+
+  const auto insert_rows = [&](const std::vector<std::vector<AllTypeVariant>>& rows,
+                               const std::shared_ptr<TransactionContext>& context) {
+    const auto values = std::make_shared<Table>(table->column_definitions(), TableType::Data);
+    for (const auto& row : rows) {
+      values->append(row);
+    }
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto insert = std::make_shared<Insert>("key_table", table_wrapper);
+    insert->set_transaction_context(context);
+    insert->execute();
+    return !insert->execute_failed();
+  };
+
+  // Inserting an existing key fails. The rollback removes all new rows from the index.
+  auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_FALSE(insert_rows({{1, 1}, {123, 4}}, context));
+  context->rollback(RollbackReason::Conflict);
+  EXPECT_EQ(key_index.lookup({123}), std::vector<RowID>{RowID(ChunkID{0}, ChunkOffset{1})});
+  EXPECT_TRUE(key_index.lookup({1}).empty());
+
+  // Keys inserted by an uncommitted transaction cannot be inserted by other transactions
+  auto context_1 = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  auto context_2 = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_TRUE(insert_rows({{1, 1}, {2, 2}}, context_1));
+  EXPECT_FALSE(insert_rows({{2, 3}}, context_2));
+  context_2->rollback(RollbackReason::Conflict);
+  context_1->commit();
+
+  EXPECT_EQ(key_index.lookup({1}).size(), 1u);
+  EXPECT_EQ(key_index.lookup({2}).size(), 1u);
+
+  // Duplicates within the inserted rows are detected as well
+  context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_FALSE(insert_rows({{3, 1}, {3, 2}}, context));
+  context->rollback(RollbackReason::Conflict);
+  EXPECT_TRUE(key_index.lookup({3}).empty());
+
+  context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_TRUE(insert_rows({{3, 1}}, context));
+  context->commit();
+  EXPECT_EQ(table->row_count(), 11u);
+}
+
 }  // namespace opossum
@@ -3,6 +3,7 @@
 #include "operators/join_hash.hpp"
 #include "operators/table_wrapper.hpp"
 #include "types.hpp"
+#include "utils/memory_budget.hpp"
 
 namespace opossum {
 
@@ -117,4 +118,117 @@ TEST_F(OperatorsJoinHashTest, RadixBitCalculation) {
             0ul);
 }
 
+TEST_F(OperatorsJoinHashTest, SpillingIfMemoryBudgetIsExceeded) {
+  const auto orders =
+      std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/tpch/sf-0.001/orders.tbl", ChunkOffset{100}));
+  const auto lineitems = std::make_shared<TableWrapper>(
+      load_table("resources/test_data/tbl/tpch/sf-0.001/lineitem.tbl", ChunkOffset{100}));
+  for (const auto& table_wrapper : {orders, lineitems}) {
+    table_wrapper->never_clear_output();
+    table_wrapper->execute();
+  }
+
+  // o_orderkey = l_orderkey, optionally AND o_custkey < l_partkey
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto secondary_predicate = OperatorJoinPredicate{{ColumnID{1}, ColumnID{1}}, PredicateCondition::LessThan};
+
+  // With 2'000 bytes, the first partitioning pass does not create enough partitions and some partitions are
+  // partitioned again.
+  for (const auto limit : {size_t{20'000}, size_t{2'000}}) {
+    for (const auto join_mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Right, JoinMode::Semi,
+                                 JoinMode::AntiNullAsFalse, JoinMode::AntiNullAsTrue}) {
+      for (const auto with_secondary_predicate : {false, true}) {
+        if (join_mode == JoinMode::AntiNullAsTrue && with_secondary_predicate) {
+          continue;
+        }
+
+        SCOPED_TRACE(std::string{"Join mode: "} + join_mode_to_string.left.at(join_mode) +
+                     (with_secondary_predicate ? " with secondary predicate" : "") + ", limit: " +
+                     std::to_string(limit));
+
+        const auto secondary_predicates = with_secondary_predicate
+                                              ? std::vector<OperatorJoinPredicate>{secondary_predicate}
+                                              : std::vector<OperatorJoinPredicate>{};
+        const auto join =
+            std::make_shared<JoinHash>(orders, lineitems, join_mode, primary_predicate, secondary_predicates);
+        join->execute();
+
+        const auto memory_budget = std::make_shared<MemoryBudget>(limit);
+        const auto spilling_join =
+            std::make_shared<JoinHash>(orders, lineitems, join_mode, primary_predicate, secondary_predicates);
+        spilling_join->set_memory_budget(memory_budget);
+        spilling_join->execute();
+
+        EXPECT_TABLE_EQ_UNORDERED(spilling_join->get_output(), join->get_output());
+
+        const auto& performance_data = dynamic_cast<const JoinHash::PerformanceData&>(*spilling_join->performance_data);
+        EXPECT_GE(performance_data.spilled_partition_count, 2u);
+        EXPECT_GT(performance_data.spilled_bytes, 0u);
+        EXPECT_EQ(memory_budget->reserved_bytes(), 0u);
+        EXPECT_GT(memory_budget->peak_reserved_bytes(), 0u);
+        EXPECT_LE(memory_budget->peak_reserved_bytes(), limit);
+      }
+    }
+  }
+}
+
+TEST_F(OperatorsJoinHashTest, SpillingKeepsPartitionsInMemory) {
+  const auto orders =
+      std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/tpch/sf-0.001/orders.tbl", ChunkOffset{100}));
+  const auto lineitems = std::make_shared<TableWrapper>(
+      load_table("resources/test_data/tbl/tpch/sf-0.001/lineitem.tbl", ChunkOffset{100}));
+  for (const auto& table_wrapper : {orders, lineitems}) {
+    table_wrapper->never_clear_output();
+    table_wrapper->execute();
+  }
+
+  const auto primary_predicate = OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto join = std::make_shared<JoinHash>(orders, lineitems, JoinMode::Inner, primary_predicate);
+  join->execute();
+
+  // Without any budget, all partitions are written to disk. With a budget that holds a part of the build side, only
+  // the remaining partitions are.
+  auto spilled_bytes = std::vector<size_t>{};
+  for (const auto limit : {size_t{0}, size_t{30'000}}) {
+    const auto spilling_join = std::make_shared<JoinHash>(orders, lineitems, JoinMode::Inner, primary_predicate);
+    spilling_join->set_memory_budget(std::make_shared<MemoryBudget>(limit));
+    spilling_join->execute();
+    EXPECT_TABLE_EQ_UNORDERED(spilling_join->get_output(), join->get_output());
+    spilled_bytes.emplace_back(
+        dynamic_cast<const JoinHash::PerformanceData&>(*spilling_join->performance_data).spilled_bytes);
+  }
+
+  EXPECT_GT(spilled_bytes[1], 0u);
+  EXPECT_LT(spilled_bytes[1], spilled_bytes[0]);
+}
+
+TEST_F(OperatorsJoinHashTest, SpillingWithNullsAndStrings) {
+  const auto table_with_nulls = std::make_shared<TableWrapper>(
+      load_table("resources/test_data/tbl/int_int4_with_null.tbl", ChunkOffset{2}));
+  const auto strings = std::make_shared<TableWrapper>(
+      load_table("resources/test_data/tbl/int_string_like.tbl", ChunkOffset{2}));
+  for (const auto& table_wrapper : {table_with_nulls, strings}) {
+    table_wrapper->never_clear_output();
+    table_wrapper->execute();
+  }
+
+  for (const auto join_mode : {JoinMode::Inner, JoinMode::Left, JoinMode::Semi, JoinMode::AntiNullAsFalse,
+                               JoinMode::AntiNullAsTrue}) {
+    SCOPED_TRACE(std::string{"Join mode: "} + join_mode_to_string.left.at(join_mode));
+    for (const auto& [input, column_id] :
+         {std::pair{table_with_nulls, ColumnID{0}}, std::pair{strings, ColumnID{1}}}) {
+      const auto primary_predicate = OperatorJoinPredicate{{column_id, column_id}, PredicateCondition::Equals};
+      const auto join = std::make_shared<JoinHash>(input, input, join_mode, primary_predicate);
+      join->execute();
+
+      const auto spilling_join = std::make_shared<JoinHash>(input, input, join_mode, primary_predicate);
+      spilling_join->set_memory_budget(std::make_shared<MemoryBudget>(0));
+      spilling_join->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(spilling_join->get_output(), join->get_output());
+      EXPECT_GT(dynamic_cast<const JoinHash::PerformanceData&>(*spilling_join->performance_data).spilled_bytes, 0u);
+    }
+  }
+}
+
 }  // namespace opossum
@@ -265,6 +265,17 @@ TEST_F(OperatorsJoinIndexTest, MultiJoinOnReferenceLeftIndexLeft) {
                    IndexSide::Left, false);
 }
 
+TEST_F(OperatorsJoinIndexTest, InnerJoinOnReferenceIndexSideLeft) {
+  // The scan removes all rows of the second chunk, so that the chunk ids of the scan output differ from those of the
+  // indexed table. The join columns of both inputs differ.
+  auto scan = create_table_scan(_table_wrapper_g, ColumnID{1}, PredicateCondition::GreaterThanEquals, 10);
+  scan->execute();
+  ASSERT_EQ(scan->get_output()->chunk_count(), ChunkID{2});
+
+  test_join_output(scan, _table_wrapper_f, {{ColumnID{1}, ColumnID{0}}, PredicateCondition::Equals}, JoinMode::Inner,
+                   1, true, IndexSide::Left);
+}
+
 TEST_F(OperatorsJoinIndexTest, RightJoinPruneInputIsRefIndexInputIsDataIndexSideIsRight) {
   // scan that returns all rows
   auto scan_a = create_table_scan(_table_wrapper_a, ColumnID{0}, PredicateCondition::GreaterThanEquals, 0);
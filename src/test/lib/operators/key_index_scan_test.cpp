@@ -0,0 +1,101 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
+#include "operators/key_index_scan.hpp"
+#include "operators/validate.hpp"
+#include "storage/index/table_key/table_key_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsKeyIndexScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // a|b|c: (9, 10, 11), (10, 10, 10) | (11, 10, 11), (9, 10, 9)
+    table = load_table("resources/test_data/tbl/int_int_int.tbl", ChunkOffset{2});
+    Hyrise::get().storage_manager.add_table("key_table", table);
+    table->create_key_index({{ColumnID{0}, ColumnID{2}}, KeyConstraintType::PRIMARY_KEY});
+  }
+
+  std::shared_ptr<const Table> scan(const std::shared_ptr<GetTable>& get_table, const std::vector<ColumnID>& column_ids,
+                                    const std::vector<AllTypeVariant>& values) {
+    get_table->execute();
+    const auto key_index_scan = std::make_shared<KeyIndexScan>(get_table, column_ids, values);
+    key_index_scan->execute();
+    return key_index_scan->get_output();
+  }
+
+  std::shared_ptr<Table> table;
+};
+
+TEST_F(OperatorsKeyIndexScanTest, Lookup) {
+  const auto get_table = std::make_shared<GetTable>("key_table");
+
+  const auto result = scan(get_table, {ColumnID{0}, ColumnID{2}}, {9, 9});
+  ASSERT_EQ(result->row_count(), 1u);
+  EXPECT_EQ(result->type(), TableType::References);
+  EXPECT_EQ(result->get_row(0), std::vector<AllTypeVariant>({9, 10, 9}));
+
+  // The output references the stored table
+  const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(
+      result->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->referenced_table(), table);
+  EXPECT_EQ(segment->pos_list()->operator[](0), RowID(ChunkID{1}, ChunkOffset{1}));
+
+  EXPECT_EQ(scan(get_table, {ColumnID{0}, ColumnID{2}}, {9, 10})->row_count(), 0u);
+}
+
+TEST_F(OperatorsKeyIndexScanTest, ValuesAreCastToColumnTypes) {
+  const auto get_table = std::make_shared<GetTable>("key_table");
+
+  // The values can be given in any order of the columns
+  EXPECT_EQ(scan(get_table, {ColumnID{2}, ColumnID{0}}, {int64_t{11}, 11.0})->get_row(0),
+            std::vector<AllTypeVariant>({11, 10, 11}));
+
+  // Values that cannot be represented in the column type and NULLs do not match anything
+  EXPECT_EQ(scan(get_table, {ColumnID{0}, ColumnID{2}}, {9.5, 9})->row_count(), 0u);
+  EXPECT_EQ(scan(get_table, {ColumnID{0}, ColumnID{2}}, {NullValue{}, 9})->row_count(), 0u);
+}
+
+TEST_F(OperatorsKeyIndexScanTest, PrunedChunksAndColumns) {
+  const auto get_table = std::make_shared<GetTable>("key_table", std::vector<ChunkID>{ChunkID{0}},
+                                                    std::vector<ColumnID>{ColumnID{1}});
+
+  const auto result = scan(get_table, {ColumnID{0}, ColumnID{2}}, {11, 11});
+  EXPECT_EQ(result->column_count(), 2u);
+  EXPECT_EQ(result->get_row(0), std::vector<AllTypeVariant>({11, 11}));
+
+  EXPECT_EQ(scan(get_table, {ColumnID{0}, ColumnID{2}}, {9, 11})->row_count(), 0u);
+}
+
+TEST_F(OperatorsKeyIndexScanTest, OutputIsValidated) {
+  // The index still contains the deleted version of a row
+  table->get_chunk(ChunkID{0})->mvcc_data()->set_end_cid(ChunkOffset{0}, CommitID{0});
+
+  const auto get_table = std::make_shared<GetTable>("key_table");
+  get_table->execute();
+  const auto key_index_scan =
+      std::make_shared<KeyIndexScan>(get_table, std::vector<ColumnID>{ColumnID{0}, ColumnID{2}},
+                                     std::vector<AllTypeVariant>{9, 11});
+  key_index_scan->execute();
+  EXPECT_EQ(key_index_scan->get_output()->row_count(), 1u);
+
+  const auto validate = std::make_shared<Validate>(key_index_scan);
+  validate->set_transaction_context(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No));
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 0u);
+}
+
+TEST_F(OperatorsKeyIndexScanTest, MissingIndex) {
+  const auto get_table = std::make_shared<GetTable>("key_table");
+  EXPECT_THROW(scan(get_table, {ColumnID{0}}, {9}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -343,7 +343,7 @@ TEST_F(OperatorPerformanceDataTest, OperatorPerformanceDataHasOutputMarkerSet) {
   table_scan_1->execute();
   table_scan_2->execute();
 
-  auto delete_op = std::make_shared<Delete>(table_scan_1);
+  auto delete_op = std::make_shared<Delete>(table_name, table_scan_1);
   delete_op->set_transaction_context(transaction_context);
 
   delete_op->execute();
@@ -68,7 +68,7 @@ TEST_F(OperatorsProjectionTest, PassThroughInvalidRowCount) {
 
   const auto rows_to_delete = table_scan->get_output()->row_count();
 
-  auto delete_op = std::make_shared<Delete>(table_scan);
+  auto delete_op = std::make_shared<Delete>("int_float", table_scan);
   delete_op->set_transaction_context(transaction_context);
   delete_op->execute();
 
@@ -0,0 +1,176 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/replace_chunk.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class OperatorsReplaceChunkTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{4}, UseMvcc::Yes);
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+
+    // Chunk 0 holds the rows with a = 6, 3, 5, 1, chunk 1 those with a = 4, 2
+    const auto values = std::make_shared<Table>(column_definitions, TableType::Data);
+    for (const auto a : {6, 3, 5, 1, 4, 2}) {
+      values->append({a, a == 5 ? NULL_VALUE : AllTypeVariant{a * 10}});
+    }
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto insert = std::make_shared<Insert>(_table_name, table_wrapper);
+    insert->set_transaction_context(context);
+    insert->execute();
+    context->commit();
+  }
+
+  // Returns the rows of the table that are visible to the transaction
+  std::shared_ptr<const Table> _visible_rows(const std::shared_ptr<TransactionContext>& context) {
+    const auto get_table = std::make_shared<GetTable>(_table_name);
+    get_table->set_transaction_context(context);
+    get_table->execute();
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  // Creates a ReplaceChunk that replaces chunk 0 by its visible rows, sorted by column a
+  std::shared_ptr<ReplaceChunk> _replace_first_chunk_with_sorted_rows(
+      const std::shared_ptr<TransactionContext>& context) {
+    const auto get_table = std::make_shared<GetTable>(_table_name, std::vector<ChunkID>{ChunkID{1}},
+                                                      std::vector<ColumnID>{});
+    get_table->set_transaction_context(context);
+    get_table->execute();
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    // As the values of a are unique, both sorts yield the same order. The first one references the old rows.
+    const auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}};
+    const auto sorted_rows =
+        std::make_shared<Sort>(validate, sort_definitions, ChunkOffset{4}, Sort::ForceMaterialization::No);
+    sorted_rows->execute();
+    const auto sorted_values =
+        std::make_shared<Sort>(validate, sort_definitions, ChunkOffset{4}, Sort::ForceMaterialization::Yes);
+    sorted_values->execute();
+
+    const auto replace_chunk = std::make_shared<ReplaceChunk>(_table_name, sorted_rows, sorted_values);
+    replace_chunk->set_transaction_context(context);
+    return replace_chunk;
+  }
+
+  const std::string _table_name{"replace_chunk_table"};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsReplaceChunkTest, OperatorName) {
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_EQ(_replace_first_chunk_with_sorted_rows(context)->name(), "ReplaceChunk");
+}
+
+TEST_F(OperatorsReplaceChunkTest, ReplaceWithSortedRows) {
+  const auto old_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto rows_before = _visible_rows(old_context);
+
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto replace_chunk = _replace_first_chunk_with_sorted_rows(context);
+  replace_chunk->execute();
+  ASSERT_FALSE(replace_chunk->execute_failed());
+  EXPECT_EQ(replace_chunk->appended_chunk_ids(), std::vector<ChunkID>{ChunkID{2}});
+
+  // Before the commit, other transactions only see the old rows
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(old_context), rows_before);
+  context->commit();
+
+  EXPECT_EQ(_table->chunk_count(), 3);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->invalid_row_count(), 4u);
+
+  const auto new_chunk = _table->get_chunk(ChunkID{2});
+  EXPECT_FALSE(new_chunk->is_mutable());
+  EXPECT_EQ(new_chunk->individually_sorted_by(),
+            std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}});
+  EXPECT_EQ((*new_chunk->get_segment(ColumnID{0}))[ChunkOffset{0}], AllTypeVariant{1});
+  EXPECT_EQ((*new_chunk->get_segment(ColumnID{0}))[ChunkOffset{3}], AllTypeVariant{6});
+  EXPECT_TRUE(variant_is_null((*new_chunk->get_segment(ColumnID{1}))[ChunkOffset{2}]));
+
+  // Transactions see either the old or the new rows
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(old_context), rows_before);
+  const auto new_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(new_context), rows_before);
+  EXPECT_EQ(_visible_rows(new_context)->row_count(), 6u);
+}
+
+TEST_F(OperatorsReplaceChunkTest, InsertKeepsFillingMutableChunk) {
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto replace_chunk = _replace_first_chunk_with_sorted_rows(context);
+  replace_chunk->execute();
+  ASSERT_FALSE(replace_chunk->execute_failed());
+  context->commit();
+  EXPECT_EQ(_table->last_mutable_chunk_id(), ChunkID{1});
+
+  // Chunk 1 holds two rows. The first two new rows are added to it, only the third one starts a new chunk.
+  const auto values = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  for (const auto a : {7, 8, 9}) {
+    values->append({a, a * 10});
+  }
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+  const auto insert_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto insert = std::make_shared<Insert>(_table_name, table_wrapper);
+  insert->set_transaction_context(insert_context);
+  insert->execute();
+  insert_context->commit();
+
+  EXPECT_EQ(_table->chunk_count(), 4);
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->size(), 4);
+  EXPECT_EQ(_table->get_chunk(ChunkID{3})->size(), 1);
+  EXPECT_EQ(_table->last_mutable_chunk_id(), ChunkID{3});
+  EXPECT_EQ(_visible_rows(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No))->row_count(), 9u);
+}
+
+TEST_F(OperatorsReplaceChunkTest, ConflictWithConcurrentDelete) {
+  const auto rows_before = _visible_rows(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No));
+
+  // Another transaction deletes a row of chunk 0, but has not committed yet
+  const auto delete_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto get_table = std::make_shared<GetTable>(_table_name, std::vector<ChunkID>{ChunkID{1}},
+                                                    std::vector<ColumnID>{});
+  get_table->set_transaction_context(delete_context);
+  get_table->execute();
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(delete_context);
+  validate->execute();
+  const auto delete_op = std::make_shared<Delete>(_table_name, validate);
+  delete_op->set_transaction_context(delete_context);
+  delete_op->execute();
+  ASSERT_FALSE(delete_op->execute_failed());
+
+  const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto replace_chunk = _replace_first_chunk_with_sorted_rows(context);
+  replace_chunk->execute();
+  EXPECT_TRUE(replace_chunk->execute_failed());
+  context->rollback(RollbackReason::Conflict);
+  delete_context->rollback(RollbackReason::User);
+
+  // Nothing has been appended
+  EXPECT_EQ(_table->chunk_count(), 2);
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No)),
+                            rows_before);
+}
+
+}  // namespace opossum
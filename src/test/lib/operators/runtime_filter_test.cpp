@@ -0,0 +1,300 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/runtime_filter.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/operator_task.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class RuntimeFilterTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // The probe table has ten chunks with ten rows each. Column a contains the values from 0 to 99, b is pruned.
+    const auto probe_table = std::make_shared<Table>(
+        TableColumnDefinitions{{"b", DataType::Int, false}, {"a", DataType::Int, false}}, TableType::Data,
+        ChunkOffset{10}, UseMvcc::Yes);
+    for (auto value = int32_t{0}; value < 100; ++value) {
+      probe_table->append({-value, value});
+    }
+    probe_table->last_chunk()->finalize();
+    ChunkEncoder::encode_all_chunks(probe_table);
+    generate_chunk_pruning_statistics(probe_table);
+    Hyrise::get().storage_manager.add_table("probe_table", probe_table);
+
+    const auto source_table =
+        std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+    source_table->append({3});
+    source_table->append({NullValue{}});
+    source_table->append({15});
+    source_table->append({17});
+    source = std::make_shared<TableWrapper>(source_table);
+
+    get_table = std::make_shared<GetTable>("probe_table", std::vector<ChunkID>{}, std::vector<ColumnID>{ColumnID{0}});
+  }
+
+  // Semi-joins the output of @param probe_input with the source, which makes the join the only consumer of the probe
+  // input and the source
+  std::shared_ptr<JoinHash> make_join(const std::shared_ptr<AbstractOperator>& probe_input) {
+    return std::make_shared<JoinHash>(probe_input, source, JoinMode::Semi,
+                                      OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
+  }
+
+  std::shared_ptr<RuntimeFilter> make_runtime_filter(
+      const std::vector<std::shared_ptr<const AbstractOperator>>& probe_chain) {
+    return std::make_shared<RuntimeFilter>(source, ColumnID{0}, probe_chain);
+  }
+
+  std::shared_ptr<TableScan> make_scan(const std::shared_ptr<AbstractOperator>& input, const int32_t upper_bound) {
+    return std::make_shared<TableScan>(input, less_than_(pqp_column_(ColumnID{0}, DataType::Int, false, "a"),
+                                                         upper_bound));
+  }
+
+  std::shared_ptr<TableWrapper> source;
+  std::shared_ptr<GetTable> get_table;
+};
+
+TEST_F(RuntimeFilterTest, BuildFromSource) {
+  const auto join = make_join(get_table);
+  const auto runtime_filter = make_runtime_filter({get_table});
+  get_table->add_runtime_filter(runtime_filter, ColumnID{0});
+  join->add_runtime_filter(runtime_filter);
+
+  // The source has not been executed yet
+  EXPECT_FALSE(runtime_filter->can_filter(*get_table));
+
+  source->execute();
+  ASSERT_TRUE(runtime_filter->can_filter(*get_table));
+  EXPECT_EQ(runtime_filter->data_type(), DataType::Int);
+
+  // The filter does not have false negatives. Values outside of the range of the source are never contained. For
+  // these few values, the Bloom filter does not have false positives either.
+  for (auto value = int32_t{-10}; value < 110; ++value) {
+    EXPECT_EQ(runtime_filter->may_contain(value), value == 3 || value == 15 || value == 17);
+  }
+
+  // Only the first two chunks overlap with the range of the source, from 3 to 17
+  const auto probe_table = Hyrise::get().storage_manager.get_table("probe_table");
+  EXPECT_TRUE(runtime_filter->chunk_may_match(*probe_table->get_chunk(ChunkID{0}), ColumnID{1}));
+  EXPECT_TRUE(runtime_filter->chunk_may_match(*probe_table->get_chunk(ChunkID{1}), ColumnID{1}));
+  EXPECT_FALSE(runtime_filter->chunk_may_match(*probe_table->get_chunk(ChunkID{2}), ColumnID{1}));
+  EXPECT_FALSE(runtime_filter->chunk_may_match(*probe_table->get_chunk(ChunkID{9}), ColumnID{1}));
+
+  // None of them lies entirely within that range
+  EXPECT_FALSE(runtime_filter->chunk_within_range(*probe_table->get_chunk(ChunkID{0}), ColumnID{1}));
+  EXPECT_FALSE(runtime_filter->chunk_within_range(*probe_table->get_chunk(ChunkID{1}), ColumnID{1}));
+
+  // Operators that are not part of the probe chain cannot use the filter
+  EXPECT_FALSE(runtime_filter->can_filter(*source));
+}
+
+TEST_F(RuntimeFilterTest, EmptySource) {
+  const auto source_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+  source_table->append({NullValue{}});
+  source = std::make_shared<TableWrapper>(source_table);
+  source->execute();
+
+  const auto join = make_join(get_table);
+  const auto runtime_filter = make_runtime_filter({get_table});
+  ASSERT_TRUE(runtime_filter->can_filter(*get_table));
+
+  // NULLs never find a join partner
+  EXPECT_FALSE(runtime_filter->may_contain(0));
+  EXPECT_FALSE(runtime_filter->chunk_may_match(
+      *Hyrise::get().storage_manager.get_table("probe_table")->get_chunk(ChunkID{0}), ColumnID{1}));
+}
+
+TEST_F(RuntimeFilterTest, ChunkWithinRange) {
+  const auto source_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  source_table->append({0});
+  source_table->append({12});
+  source_table->append({25});
+  source = std::make_shared<TableWrapper>(source_table);
+  source->execute();
+
+  // Without pruned columns, GetTable forwards the stored chunks along with their pruning statistics
+  const auto unpruned_get_table = std::make_shared<GetTable>("probe_table");
+  const auto table_scan = std::make_shared<TableScan>(
+      unpruned_get_table, less_than_(pqp_column_(ColumnID{1}, DataType::Int, false, "a"), 20));
+  const auto join_predicate = OperatorJoinPredicate{{ColumnID{1}, ColumnID{0}}, PredicateCondition::Equals};
+  const auto join = std::make_shared<JoinHash>(table_scan, source, JoinMode::Semi, join_predicate);
+  const auto runtime_filter = make_runtime_filter({table_scan});
+  table_scan->add_runtime_filter(runtime_filter, ColumnID{1});
+  join->add_runtime_filter(runtime_filter);
+  ASSERT_TRUE(runtime_filter->can_filter(*table_scan));
+
+  // The first two chunks hold the values from 0 to 19, which are all between 0 and 25
+  const auto probe_table = Hyrise::get().storage_manager.get_table("probe_table");
+  EXPECT_TRUE(runtime_filter->chunk_within_range(*probe_table->get_chunk(ChunkID{0}), ColumnID{1}));
+  EXPECT_TRUE(runtime_filter->chunk_within_range(*probe_table->get_chunk(ChunkID{1}), ColumnID{1}));
+  EXPECT_FALSE(runtime_filter->chunk_within_range(*probe_table->get_chunk(ChunkID{2}), ColumnID{1}));
+
+  // For these chunks, the scan only probes the Bloom filter, which yields the same rows as may_contain
+  unpruned_get_table->execute();
+  table_scan->execute();
+  const auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"b", DataType::Int, false}, {"a", DataType::Int, false}}, TableType::Data);
+  for (auto value = int32_t{0}; value < 20; ++value) {
+    if (runtime_filter->may_contain(value)) {
+      expected_table->append({-value, value});
+    }
+  }
+  EXPECT_TABLE_EQ_UNORDERED(table_scan->get_output(), expected_table);
+}
+
+TEST_F(RuntimeFilterTest, SharedOperatorsAreNotFiltered) {
+  const auto table_scan = make_scan(get_table, 50);
+  const auto join = make_join(table_scan);
+  const auto runtime_filter = make_runtime_filter({get_table, table_scan});
+  source->execute();
+  EXPECT_TRUE(runtime_filter->can_filter(*get_table));
+  EXPECT_TRUE(runtime_filter->can_filter(*table_scan));
+
+  // Another consumer of the GetTable needs all of its rows. The scan above it may still be filtered.
+  const auto other_table_scan = make_scan(get_table, 20);
+  EXPECT_FALSE(runtime_filter->can_filter(*get_table));
+  EXPECT_TRUE(runtime_filter->can_filter(*table_scan));
+
+  // If the scan is shared, neither of them may be filtered
+  const auto other_join = make_join(table_scan);
+  EXPECT_FALSE(runtime_filter->can_filter(*table_scan));
+}
+
+TEST_F(RuntimeFilterTest, GetTableSkipsChunks) {
+  const auto join = make_join(get_table);
+  const auto runtime_filter = make_runtime_filter({get_table});
+  get_table->add_runtime_filter(runtime_filter, ColumnID{0});
+  join->add_runtime_filter(runtime_filter);
+
+  source->execute();
+  get_table->execute();
+  ASSERT_EQ(get_table->get_output()->chunk_count(), 2u);
+  EXPECT_EQ(get_table->get_output()->get_value<int32_t>(ColumnID{0}, 10), 10);
+}
+
+TEST_F(RuntimeFilterTest, TableScanDropsRows) {
+  const auto table_scan = make_scan(get_table, 16);
+  const auto join = make_join(table_scan);
+  const auto runtime_filter = make_runtime_filter({table_scan});
+  table_scan->add_runtime_filter(runtime_filter, ColumnID{0});
+  join->add_runtime_filter(runtime_filter);
+
+  source->execute();
+  get_table->execute();
+  table_scan->execute();
+
+  const auto expected_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}},
+                                                      TableType::Data);
+  expected_table->append({3});
+  expected_table->append({15});
+  EXPECT_TABLE_EQ_UNORDERED(table_scan->get_output(), expected_table);
+
+  const auto& performance_data = dynamic_cast<const TableScan::PerformanceData&>(*table_scan->performance_data);
+  EXPECT_EQ(performance_data.num_rows_dropped_by_runtime_filters.load(), 14u);
+}
+
+TEST_F(RuntimeFilterTest, TableScanOnReferences) {
+  const auto lower_table_scan = make_scan(get_table, 50);
+  const auto table_scan = make_scan(lower_table_scan, 40);
+  const auto join = make_join(table_scan);
+  const auto runtime_filter = make_runtime_filter({table_scan});
+  table_scan->add_runtime_filter(runtime_filter, ColumnID{0});
+  join->add_runtime_filter(runtime_filter);
+
+  source->execute();
+  get_table->execute();
+  lower_table_scan->execute();
+  table_scan->execute();
+  EXPECT_EQ(table_scan->get_output()->row_count(), 3u);
+
+  // Only the 40 rows that match the predicate are probed
+  const auto& performance_data = dynamic_cast<const TableScan::PerformanceData&>(*table_scan->performance_data);
+  EXPECT_EQ(performance_data.num_rows_dropped_by_runtime_filters.load(), 37u);
+}
+
+TEST_F(RuntimeFilterTest, NoFilteringBeforeSourceIsExecuted) {
+  const auto table_scan = make_scan(get_table, 16);
+  const auto join = make_join(table_scan);
+  const auto runtime_filter = make_runtime_filter({table_scan});
+  table_scan->add_runtime_filter(runtime_filter, ColumnID{0});
+  join->add_runtime_filter(runtime_filter);
+
+  get_table->execute();
+  table_scan->execute();
+  EXPECT_EQ(table_scan->get_output()->row_count(), 16u);
+}
+
+TEST_F(RuntimeFilterTest, TasksExecuteSourceFirst) {
+  const auto table_scan = make_scan(get_table, 50);
+  const auto join = make_join(table_scan);
+  const auto runtime_filter = make_runtime_filter({get_table, table_scan});
+  get_table->add_runtime_filter(runtime_filter, ColumnID{0});
+  table_scan->add_runtime_filter(runtime_filter, ColumnID{0});
+  join->add_runtime_filter(runtime_filter);
+
+  const auto& [tasks, root_operator_task] = OperatorTask::make_tasks_from_operator(join);
+  const auto source_task = source->get_or_create_operator_task();
+  const auto& get_table_predecessors = get_table->get_or_create_operator_task()->predecessors();
+  ASSERT_EQ(get_table_predecessors.size(), 1u);
+  EXPECT_EQ(get_table_predecessors.front().lock(), source_task);
+  EXPECT_EQ(table_scan->get_or_create_operator_task()->predecessors().size(), 2u);
+
+  for (const auto& task : tasks) {
+    task->schedule();
+  }
+
+  EXPECT_EQ(get_table->get_output()->chunk_count(), 2u);
+  EXPECT_EQ(table_scan->get_output()->row_count(), 3u);
+  EXPECT_EQ(join->get_output()->row_count(), 3u);
+}
+
+TEST_F(RuntimeFilterTest, DeepCopy) {
+  const auto table_scan = make_scan(get_table, 50);
+  const auto join = make_join(table_scan);
+  const auto runtime_filter = make_runtime_filter({table_scan});
+  table_scan->add_runtime_filter(runtime_filter, ColumnID{0});
+  join->add_runtime_filter(runtime_filter);
+
+  const auto copied_join = std::dynamic_pointer_cast<JoinHash>(join->deep_copy());
+  ASSERT_EQ(copied_join->runtime_filters().size(), 1u);
+  const auto& copied_runtime_filter = copied_join->runtime_filters().front();
+  EXPECT_NE(copied_runtime_filter, runtime_filter);
+  EXPECT_EQ(copied_runtime_filter->source(), copied_join->right_input());
+  EXPECT_EQ(copied_runtime_filter->source_column_id(), ColumnID{0});
+
+  const auto& consumers = copied_runtime_filter->consumers();
+  ASSERT_EQ(consumers.size(), 1u);
+  EXPECT_EQ(consumers.front().first, copied_join->left_input());
+  EXPECT_EQ(consumers.front().second, ColumnID{0});
+  EXPECT_EQ(std::dynamic_pointer_cast<const TableScan>(consumers.front().first)->runtime_filters().size(), 1u);
+
+  // The original scan is not affected
+  EXPECT_EQ(table_scan->runtime_filters().size(), 1u);
+}
+
+TEST_F(RuntimeFilterTest, InvalidJoinModes) {
+  const auto runtime_filter = make_runtime_filter({get_table});
+
+  // Rows of the left input without a join partner are part of the result of left outer and anti joins
+  for (const auto join_mode : {JoinMode::Left, JoinMode::AntiNullAsFalse, JoinMode::AntiNullAsTrue}) {
+    const auto join = std::make_shared<JoinHash>(
+        get_table, source, join_mode, OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
+    EXPECT_THROW(join->add_runtime_filter(runtime_filter), std::logic_error);
+  }
+}
+
+}  // namespace opossum
@@ -1,8 +1,14 @@
+#include <algorithm>
+#include <numeric>
+#include <optional>
+#include <random>
+
 #include "base_test.hpp"
 
 #include "operators/join_hash.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 
 namespace opossum {
 
@@ -234,4 +240,112 @@ TEST_F(SortTest, InputReferencesDifferentColumns) {
   EXPECT_EQ(sort.get_output()->type(), TableType::Data);
 }
 
+TEST_F(SortTest, MultiThreadedLargeInput) {
+  // The input is large enough to be sorted in multiple buckets (of about 10k rows each) by multiple jobs. The string
+  // column has long common prefixes, so that rows with equal normalized keys have to be compared by their values.
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, true},
+                                                         {"b", DataType::String, false},
+                                                         {"c", DataType::Double, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1'000});
+
+  struct Row {
+    std::optional<int32_t> a;
+    pmr_string b;
+    double c;
+  };
+
+  constexpr auto ROW_COUNT = size_t{40'000};
+  auto random_engine = std::mt19937{};
+  auto rows = std::vector<Row>(ROW_COUNT);
+  for (auto row_idx = size_t{0}; row_idx < ROW_COUNT; ++row_idx) {
+    auto& row = rows[row_idx];
+    if (row_idx % 13 != 0) {
+      row.a = static_cast<int32_t>(random_engine() % 20) - 10;
+    }
+    row.b = pmr_string{"common_prefix_"} + pmr_string(std::to_string(random_engine() % 50));
+    row.c = static_cast<double>(random_engine() % 1'000) / 4.0 - 100.0;
+
+    table->append({row.a ? AllTypeVariant{*row.a} : AllTypeVariant{NullValue{}}, row.b, row.c});
+  }
+  table->last_chunk()->finalize();
+
+  // ORDER BY a, b DESC, c
+  auto expected_order = std::vector<size_t>(ROW_COUNT);
+  std::iota(expected_order.begin(), expected_order.end(), size_t{0});
+  std::stable_sort(expected_order.begin(), expected_order.end(), [&](const auto lhs_idx, const auto rhs_idx) {
+    const auto& lhs = rows[lhs_idx];
+    const auto& rhs = rows[rhs_idx];
+    if (lhs.a != rhs.a) {
+      // std::nullopt is less than all values, i.e., NULLs come first
+      return lhs.a < rhs.a;
+    }
+    if (lhs.b != rhs.b) {
+      return lhs.b > rhs.b;
+    }
+    return lhs.c < rhs.c;
+  });
+
+  const auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (const auto row_idx : expected_order) {
+    const auto& row = rows[row_idx];
+    expected_table->append({row.a ? AllTypeVariant{*row.a} : AllTypeVariant{NullValue{}}, row.b, row.c});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, SortMode::Ascending},
+                                        SortColumnDefinition{ColumnID{1}, SortMode::Descending},
+                                        SortColumnDefinition{ColumnID{2}, SortMode::Ascending}};
+  for (const auto force_materialization : {Sort::ForceMaterialization::No, Sort::ForceMaterialization::Yes}) {
+    auto sort = Sort{table_wrapper, sort_definitions, Chunk::DEFAULT_SIZE, force_materialization};
+    sort.execute();
+    EXPECT_TABLE_EQ_ORDERED(sort.get_output(), expected_table);
+  }
+}
+
+TEST_F(SortTest, SkewedSampleLargeInput) {
+  // The sample sort picks its sample at evenly spaced positions. The values at these positions are larger than all
+  // other values, so that most rows fall into the first bucket, which is then sample sorted recursively.
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  constexpr auto ROW_COUNT = size_t{64'000};
+  const auto bucket_count = size_t{7};
+  const auto sample_count = bucket_count * 64;
+
+  auto values = std::vector<int32_t>(ROW_COUNT);
+  for (auto row_idx = size_t{0}; row_idx < ROW_COUNT; ++row_idx) {
+    values[row_idx] = -static_cast<int32_t>(row_idx);
+  }
+  for (auto sample_idx = size_t{0}; sample_idx < sample_count; ++sample_idx) {
+    const auto row_idx = sample_idx * ROW_COUNT / sample_count;
+    values[row_idx] = static_cast<int32_t>(row_idx);
+  }
+
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10'000});
+  for (const auto value : values) {
+    table->append({value});
+  }
+  table->last_chunk()->finalize();
+
+  std::sort(values.begin(), values.end());
+  const auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  for (const auto value : values) {
+    expected_table->append({value});
+  }
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = Sort{table_wrapper, {SortColumnDefinition{ColumnID{0}, SortMode::Ascending}}};
+  sort.execute();
+  EXPECT_TABLE_EQ_ORDERED(sort.get_output(), expected_table);
+}
+
 }  // namespace opossum
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <tuple>
+
+#include "base_test.hpp"
+
+#include "constant_mappings.hpp"
+#include "operators/table_scan/attribute_vector_scan_kernels.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+
+namespace opossum {
+
+// The parameters are the vector compression type and the maximum value id. The latter determines the width of the
+// FixedWidthIntegerVector (uint8_t, uint16_t, uint32_t) and the number of bits of the BitPackingVector.
+using AttributeVectorKernelsTestParam = std::tuple<VectorCompressionType, uint32_t>;
+
+class TableScanAttributeVectorKernelsTest : public BaseTestWithParam<AttributeVectorKernelsTestParam> {
+ public:
+  void SetUp() override {
+    max_value_id = std::get<1>(GetParam());
+
+    // 1'000 rows are 15 full blocks of 64 rows and a partial block. Every seventh row holds the maximum value id.
+    auto generator = std::mt19937{42};
+    auto distribution = std::uniform_int_distribution<uint32_t>{0, max_value_id};
+    value_ids = pmr_vector<uint32_t>(1'000);
+    for (auto row = size_t{0}; row < value_ids.size(); ++row) {
+      value_ids[row] = row % 7 == 0 ? max_value_id : distribution(generator);
+    }
+
+    attribute_vector = compress_vector(value_ids, std::get<0>(GetParam()), {}, {max_value_id});
+  }
+
+  std::vector<RowID> expected_matches(const uint32_t lower_value_id, const uint32_t upper_value_id) const {
+    auto matches = std::vector<RowID>{};
+    for (auto row = ChunkOffset::base_type{0}; row < value_ids.size(); ++row) {
+      if (value_ids[row] >= lower_value_id && value_ids[row] <= upper_value_id) {
+        matches.emplace_back(RowID{ChunkID{3}, ChunkOffset{row}});
+      }
+    }
+    return matches;
+  }
+
+  std::vector<RowID> scan(const uint32_t lower_value_id, const uint32_t upper_value_id) const {
+    auto match_masks = ValueIDMatchMasks{};
+    scan_attribute_vector_for_value_id_range(*attribute_vector, ValueID{lower_value_id}, ValueID{upper_value_id},
+                                             match_masks);
+    EXPECT_EQ(match_masks.size(), 16u);
+
+    auto matches = RowIDPosList{};
+    append_match_masks_to_matches(match_masks, ChunkID{3}, matches);
+    return std::vector<RowID>(matches.begin(), matches.end());
+  }
+
+  uint32_t max_value_id{};
+  pmr_vector<uint32_t> value_ids;
+  std::unique_ptr<const BaseCompressedVector> attribute_vector;
+};
+
+auto kernels_test_formatter = [](const ::testing::TestParamInfo<AttributeVectorKernelsTestParam> info) {
+  auto string = vector_compression_type_to_string.left.at(std::get<0>(info.param));
+  string.erase(std::remove_if(string.begin(), string.end(), [](char c) { return !std::isalnum(c); }), string.end());
+  return string + "Max" + std::to_string(std::get<1>(info.param));
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    VectorCompressionTypes, TableScanAttributeVectorKernelsTest,
+    ::testing::Combine(::testing::Values(VectorCompressionType::FixedWidthInteger, VectorCompressionType::BitPacking),
+                       ::testing::Values(1u, 200u, 40'000u, 100'000u, 30'000'000u, 4'000'000'000u)),
+    kernels_test_formatter);
+
+TEST_P(TableScanAttributeVectorKernelsTest, ValueIDRanges) {
+  const auto quarter = max_value_id / 4;
+
+  for (const auto& [lower_value_id, upper_value_id] :
+       std::vector<std::pair<uint32_t, uint32_t>>{{0, 0},
+                                                  {0, max_value_id},
+                                                  {max_value_id, max_value_id},
+                                                  {quarter, 3 * quarter},
+                                                  {value_ids[5], value_ids[5]},
+                                                  {1, max_value_id - 1}}) {
+    if (lower_value_id > upper_value_id) {
+      continue;
+    }
+    EXPECT_EQ(scan(lower_value_id, upper_value_id), expected_matches(lower_value_id, upper_value_id))
+        << "[" << lower_value_id << ", " << upper_value_id << "]";
+  }
+}
+
+TEST_P(TableScanAttributeVectorKernelsTest, RangesBeyondVector) {
+  // Value ids above the maximum value id cannot be stored in the vector, but they must not wrap around
+  if (max_value_id < std::numeric_limits<uint32_t>::max() - 1) {
+    EXPECT_TRUE(scan(max_value_id + 1, max_value_id + 1).empty());
+    EXPECT_EQ(scan(max_value_id, std::numeric_limits<uint32_t>::max()),
+              expected_matches(max_value_id, max_value_id));
+  }
+}
+
+TEST_P(TableScanAttributeVectorKernelsTest, CombineRanges) {
+  if (max_value_id < 2) {
+    return;
+  }
+
+  // Ranges are ORed into the existing masks, e.g., for NotEquals
+  auto match_masks = ValueIDMatchMasks{};
+  scan_attribute_vector_for_value_id_range(*attribute_vector, ValueID{0}, ValueID{0}, match_masks);
+  scan_attribute_vector_for_value_id_range(*attribute_vector, ValueID{2}, ValueID{max_value_id}, match_masks);
+
+  auto matches = RowIDPosList{};
+  matches.emplace_back(RowID{ChunkID{0}, ChunkOffset{0}});
+  append_match_masks_to_matches(match_masks, ChunkID{3}, matches);
+
+  auto expected = std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{0}}};
+  for (auto row = ChunkOffset::base_type{0}; row < value_ids.size(); ++row) {
+    if (value_ids[row] != 1) {
+      expected.emplace_back(RowID{ChunkID{3}, ChunkOffset{row}});
+    }
+  }
+  EXPECT_EQ(std::vector<RowID>(matches.begin(), matches.end()), expected);
+}
+
+}  // namespace opossum
@@ -24,6 +24,7 @@
 #include "operators/table_wrapper.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -1296,4 +1297,45 @@ TEST_P(OperatorsTableScanTest, SortedFlagMultipleChunksReferenced) {
   ASSERT_TRUE(chunk_sorted_by.empty());
 }
 
+TEST_P(OperatorsTableScanTest, BitmapPosListForManyMatches) {
+  // If many rows of a chunk match, the scan stores the matches as a bitmap. Scanning that result keeps the bitmap as
+  // long as enough rows match.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{1'000});
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    table->append({value});
+  }
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto get_pos_list = [](const std::shared_ptr<const Table>& result) {
+    EXPECT_EQ(result->chunk_count(), 1u);
+    const auto segment = result->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+    return std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+  };
+
+  const auto scan_a = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThanEquals, 200);
+  scan_a->execute();
+  const auto pos_list_a = std::dynamic_pointer_cast<const BitmapPosList>(get_pos_list(scan_a->get_output()));
+  ASSERT_TRUE(pos_list_a);
+  EXPECT_EQ(pos_list_a->size(), 800u);
+  EXPECT_EQ((*pos_list_a)[0], RowID(ChunkID{0}, ChunkOffset{200}));
+
+  const auto scan_b = create_table_scan(scan_a, ColumnID{0}, PredicateCondition::LessThan, 700);
+  scan_b->execute();
+  const auto pos_list_b = std::dynamic_pointer_cast<const BitmapPosList>(get_pos_list(scan_b->get_output()));
+  ASSERT_TRUE(pos_list_b);
+  EXPECT_EQ(pos_list_b->size(), 500u);
+  EXPECT_EQ((*pos_list_b)[499], RowID(ChunkID{0}, ChunkOffset{699}));
+
+  // Few matches are still stored as a RowIDPosList
+  const auto scan_c = create_table_scan(scan_b, ColumnID{0}, PredicateCondition::Equals, 400);
+  scan_c->execute();
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RowIDPosList>(get_pos_list(scan_c->get_output())));
+  EXPECT_EQ(scan_c->get_output()->get_value<int32_t>(ColumnID{0}, 0), 400);
+}
+
 }  // namespace opossum
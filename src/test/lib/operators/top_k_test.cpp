@@ -0,0 +1,135 @@
+#include <random>
+
+#include "base_test.hpp"
+
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+
+namespace opossum {
+
+class TopKTest : public BaseTest {
+ public:
+  static void SetUpTestCase() {
+    input_table = load_table("resources/test_data/tbl/sort/input.tbl", ChunkOffset{20});
+    input_table_wrapper = std::make_shared<TableWrapper>(input_table);
+    input_table_wrapper->never_clear_output();
+    input_table_wrapper->execute();
+  }
+
+  // Returns the result of ORDER BY ... LIMIT k as computed by Sort and Limit
+  static std::shared_ptr<const Table> sort_and_limit(const std::shared_ptr<AbstractOperator>& input,
+                                                     const std::vector<SortColumnDefinition>& sort_definitions,
+                                                     const size_t k) {
+    const auto sort = std::make_shared<Sort>(input, sort_definitions);
+    sort->execute();
+    const auto limit = std::make_shared<Limit>(sort, to_expression(static_cast<int64_t>(k)));
+    limit->execute();
+    return limit->get_output();
+  }
+
+  static inline std::shared_ptr<Table> input_table;
+  static inline std::shared_ptr<AbstractOperator> input_table_wrapper;
+};
+
+TEST_F(TopKTest, OperatorName) {
+  const auto top_k = std::make_shared<TopK>(input_table_wrapper,
+                                            std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}}, 3);
+  EXPECT_EQ(top_k->name(), "TopK");
+  EXPECT_EQ(top_k->k(), size_t{3});
+}
+
+TEST_F(TopKTest, MatchesSortAndLimit) {
+  const auto sort_definitions_list = std::vector<std::vector<SortColumnDefinition>>{
+      {SortColumnDefinition{ColumnID{0}, SortMode::Ascending}},
+      {SortColumnDefinition{ColumnID{0}, SortMode::Descending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::Ascending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::Descending}},
+      {SortColumnDefinition{ColumnID{2}, SortMode::Ascending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::Descending}, SortColumnDefinition{ColumnID{2}}},
+      {SortColumnDefinition{ColumnID{2}, SortMode::Descending}, SortColumnDefinition{ColumnID{0}}},
+  };
+
+  for (const auto& sort_definitions : sort_definitions_list) {
+    for (const auto k : {size_t{1}, size_t{5}, size_t{17}, size_t{1'000}}) {
+      SCOPED_TRACE(std::string{"k: "} + std::to_string(k));
+      const auto top_k = std::make_shared<TopK>(input_table_wrapper, sort_definitions, k);
+      top_k->execute();
+      EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), sort_and_limit(input_table_wrapper, sort_definitions, k));
+    }
+  }
+}
+
+TEST_F(TopKTest, EmptyResult) {
+  const auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}};
+
+  const auto top_k = std::make_shared<TopK>(input_table_wrapper, sort_definitions, 0);
+  top_k->execute();
+  EXPECT_EQ(top_k->get_output()->row_count(), 0u);
+  EXPECT_EQ(top_k->get_output()->column_definitions(), input_table->column_definitions());
+
+  const auto empty_input = std::make_shared<TableScan>(input_table_wrapper, equals_(1, 2));
+  empty_input->execute();
+  const auto top_k_empty_input = std::make_shared<TopK>(empty_input, sort_definitions, 5);
+  top_k_empty_input->execute();
+  EXPECT_EQ(top_k_empty_input->get_output()->row_count(), 0u);
+}
+
+TEST_F(TopKTest, SortedChunksWithPruningStatistics) {
+  // The chunks are sorted and have pruning statistics, so that most of them can be skipped or are only partially
+  // scanned. The result has to be the same nevertheless.
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, false}};
+  const auto unsorted_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100});
+  auto random_engine = std::mt19937{};
+  for (auto row_idx = size_t{0}; row_idx < 5'000; ++row_idx) {
+    unsorted_table->append({static_cast<int32_t>(random_engine() % 1'000),
+                            pmr_string{"value_"} + pmr_string(std::to_string(random_engine() % 100))});
+  }
+  unsorted_table->last_chunk()->finalize();
+
+  // Sort the table in chunks of 100 rows, which sets their sorted_by information
+  const auto unsorted_table_wrapper = std::make_shared<TableWrapper>(unsorted_table);
+  unsorted_table_wrapper->execute();
+  const auto sort = std::make_shared<Sort>(unsorted_table_wrapper,
+                                           std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}},
+                                           ChunkOffset{100}, Sort::ForceMaterialization::Yes);
+  sort->execute();
+  const auto table = std::const_pointer_cast<Table>(sort->get_output());
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+  generate_chunk_pruning_statistics(table);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  // The statistics of the referenced chunks are used for reference inputs
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(a, 10));
+  table_scan->execute();
+
+  const auto sort_definitions_list = std::vector<std::vector<SortColumnDefinition>>{
+      {SortColumnDefinition{ColumnID{0}, SortMode::Ascending}, SortColumnDefinition{ColumnID{1}, SortMode::Descending}},
+      {SortColumnDefinition{ColumnID{0}, SortMode::Descending}, SortColumnDefinition{ColumnID{1}, SortMode::Ascending}},
+      {SortColumnDefinition{ColumnID{1}, SortMode::Descending}},
+  };
+
+  for (const auto& input : std::vector<std::shared_ptr<AbstractOperator>>{table_wrapper, table_scan}) {
+    for (const auto& sort_definitions : sort_definitions_list) {
+      for (const auto k : {size_t{1}, size_t{10}, size_t{250}}) {
+        SCOPED_TRACE(std::string{"k: "} + std::to_string(k));
+        const auto top_k = std::make_shared<TopK>(input, sort_definitions, k);
+        top_k->execute();
+        EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), sort_and_limit(input, sort_definitions, k));
+      }
+    }
+  }
+}
+
+}  // namespace opossum
@@ -11,6 +11,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_positions.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 
 namespace opossum {
@@ -341,4 +342,47 @@ TEST_F(UnionPositionsTest, SameColumnsDifferentTables) {
   EXPECT_THROW(union_positions_op->execute(), std::logic_error);
 }
 
+TEST_F(UnionPositionsTest, BitmapUnion) {
+  /**
+   * If all PosLists reference single chunks, the positions of each referenced chunk are ORed as bitmaps. The inputs
+   * contain BitmapPosLists, an EntireChunkPosList, and a RowIDPosList.
+   */
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{500});
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    table->append({value});
+  }
+  table->last_chunk()->finalize();
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  const auto a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto table_scan_a_op = std::make_shared<TableScan>(table_wrapper, less_than_(a, 400));
+  table_scan_a_op->never_clear_output();
+  const auto table_scan_b_op = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(a, 300));
+  table_scan_b_op->never_clear_output();
+  const auto table_scan_c_op = std::make_shared<TableScan>(table_wrapper, equals_(a, 950));
+  table_scan_c_op->never_clear_output();
+  execute_all({table_wrapper, table_scan_a_op, table_scan_b_op, table_scan_c_op});
+
+  const auto union_ab_op = std::make_shared<UnionPositions>(table_scan_a_op, table_scan_b_op);
+  union_ab_op->execute();
+  EXPECT_TABLE_EQ_UNORDERED(union_ab_op->get_output(), table);
+
+  const auto union_ac_op = std::make_shared<UnionPositions>(table_scan_a_op, table_scan_c_op);
+  union_ac_op->execute();
+  const auto result = union_ac_op->get_output();
+  ASSERT_EQ(result->chunk_count(), 2u);
+  EXPECT_EQ(result->row_count(), 401u);
+
+  const auto pos_list = [&](const ChunkID chunk_id) {
+    const auto segment = result->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    return std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+  };
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(pos_list(ChunkID{0})));
+  EXPECT_EQ(pos_list(ChunkID{0})->size(), 400u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const RowIDPosList>(pos_list(ChunkID{1})));
+  EXPECT_EQ((*pos_list(ChunkID{1}))[0], RowID(ChunkID{1}, ChunkOffset{450}));
+}
+
 }  // namespace opossum
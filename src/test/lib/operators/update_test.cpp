@@ -13,6 +13,7 @@
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/table_key/table_key_index.hpp"
 #include "storage/table.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -84,4 +85,33 @@ TEST_F(OperatorsUpdateTest, UpdateNone) {
   helper(greater_than_(column_a, 100'000), expression_vector(1, 1.5f), "resources/test_data/tbl/int_float2.tbl");
 }
 
+TEST_F(OperatorsUpdateTest, KeyIndex) {
+  const auto table = Hyrise::get().storage_manager.get_table(table_to_update_name);
+  table->create_key_index({{ColumnID{0}, ColumnID{1}}, KeyConstraintType::UNIQUE});
+
+  // Rows whose key is not changed by the Update do not conflict with their old versions
+  helper(greater_than_(column_a, 0), expression_vector(column_a, column_b), "resources/test_data/tbl/int_float2.tbl");
+
+  // Setting b to the same value for both rows with a = 12345 violates the key
+  const auto get_table = std::make_shared<GetTable>(table_to_update_name);
+  const auto where_scan = std::make_shared<TableScan>(get_table, greater_than_(column_a, 1000));
+  where_scan->never_clear_output();
+  const auto updated_values_projection =
+      std::make_shared<Projection>(where_scan, expression_vector(column_a, value_(7.5f)));
+  get_table->execute();
+  where_scan->execute();
+  updated_values_projection->execute();
+
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto update = std::make_shared<Update>(table_to_update_name, where_scan, updated_values_projection);
+  update->set_transaction_context(transaction_context);
+  update->execute();
+  EXPECT_TRUE(update->execute_failed());
+  transaction_context->rollback(RollbackReason::Conflict);
+
+  const auto key_index = table->key_indexes().front();
+  EXPECT_TRUE(key_index->lookup({12345, 7.5f}).empty());
+  EXPECT_EQ(key_index->lookup({12345, 457.7f}).size(), 2u);
+}
+
 }  // namespace opossum
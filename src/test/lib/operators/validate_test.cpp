@@ -15,6 +15,7 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
 
@@ -57,6 +58,12 @@ class OperatorsValidateTest : public BaseTest {
                                               const CommitID snapshot_commit_id) {
     return validate->_is_entire_chunk_visible(chunk, snapshot_commit_id);
   }
+
+  static void forward_determine_visible_rows(const MvccData& mvcc_data, const ChunkOffset row_count,
+                                             const TransactionID our_tid, const CommitID snapshot_commit_id,
+                                             std::vector<uint64_t>& visible_rows) {
+    Validate::_determine_visible_rows(mvcc_data, row_count, our_tid, snapshot_commit_id, visible_rows);
+  }
 };
 
 void OperatorsValidateTest::set_all_records_visible(Table& table) {
@@ -127,7 +134,7 @@ TEST_F(OperatorsValidateTest, ValidateAfterDelete) {
   auto table_scan = create_table_scan(_gt, ColumnID{0}, PredicateCondition::Equals, "13");
   table_scan->execute();
 
-  auto delete_op = std::make_shared<Delete>(table_scan);
+  auto delete_op = std::make_shared<Delete>(_table2_name, table_scan);
   delete_op->set_transaction_context(t2_context);
   delete_op->execute();
 
@@ -287,4 +294,89 @@ TEST_F(OperatorsValidateTest, ForwardSortedByFlag) {
   }
 }
 
+TEST_F(OperatorsValidateTest, DetermineVisibleRowsMatchesIsRowVisible) {
+  // Covers all combinations of own/foreign/no transaction id, begin_cid before/after the snapshot, and end_cid
+  // before/after the snapshot. The number of rows is not a multiple of the block size.
+  constexpr auto ROW_COUNT = ChunkOffset{150};
+  const auto our_tid = TransactionID{7};
+  const auto snapshot_commit_id = CommitID{10};
+
+  auto mvcc_data = MvccData{ROW_COUNT + 10, CommitID{0}};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < ROW_COUNT; ++chunk_offset) {
+    const auto combination = chunk_offset % 12;
+    const auto tids = std::array<TransactionID, 3>{our_tid, TransactionID{8}, TransactionID{0}};
+    mvcc_data.set_tid(chunk_offset, tids[combination % 3]);
+    mvcc_data.set_begin_cid(chunk_offset, combination / 3 % 2 ? CommitID{5} : MvccData::MAX_COMMIT_ID);
+    mvcc_data.set_end_cid(chunk_offset, combination / 6 ? CommitID{9} : MvccData::MAX_COMMIT_ID);
+  }
+
+  auto visible_rows = std::vector<uint64_t>{};
+  forward_determine_visible_rows(mvcc_data, ROW_COUNT, our_tid, snapshot_commit_id, visible_rows);
+  ASSERT_EQ(visible_rows.size(), 3u);
+
+  auto visible_row_count = size_t{0};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < ROW_COUNT; ++chunk_offset) {
+    const auto expected = Validate::is_row_visible(our_tid, snapshot_commit_id, mvcc_data.get_tid(chunk_offset),
+                                                   mvcc_data.get_begin_cid(chunk_offset),
+                                                   mvcc_data.get_end_cid(chunk_offset));
+    const auto visible = static_cast<bool>((visible_rows[chunk_offset / 64] >> (chunk_offset % 64)) & 1u);
+    EXPECT_EQ(visible, expected) << "Row " << chunk_offset;
+    visible_row_count += visible;
+  }
+  EXPECT_GT(visible_row_count, 0u);
+
+  // Rows after the last one are not set
+  EXPECT_EQ(visible_rows.back() >> (ROW_COUNT % 64), 0u);
+}
+
+TEST_F(OperatorsValidateTest, BitmapPosLists) {
+  // If many rows are visible, Validate emits a BitmapPosList. When validating a BitmapPosList, the referenced rows are
+  // ANDed with the visible rows.
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data,
+                                             ChunkOffset{1'000}, UseMvcc::Yes);
+  for (auto value = int32_t{0}; value < 1'000; ++value) {
+    table->append({value});
+  }
+  table->last_chunk()->finalize();
+  set_all_records_visible(*table);
+  for (auto chunk_offset = ChunkOffset::base_type{0}; chunk_offset < 1'000; chunk_offset += 10) {
+    invalidate_record(*table, RowID{ChunkID{0}, ChunkOffset{chunk_offset}}, CommitID{2});
+  }
+
+  auto context = std::make_shared<TransactionContext>(TransactionID{1}, CommitID{3}, AutoCommit::No);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->never_clear_output();
+  table_wrapper->execute();
+
+  const auto get_pos_list = [](const std::shared_ptr<const Table>& result) {
+    EXPECT_EQ(result->chunk_count(), 1u);
+    const auto segment = result->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+    return std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+  };
+
+  const auto validate_table = std::make_shared<Validate>(table_wrapper);
+  validate_table->set_transaction_context(context);
+  validate_table->execute();
+  const auto validated_table_pos_list =
+      std::dynamic_pointer_cast<const BitmapPosList>(get_pos_list(validate_table->get_output()));
+  ASSERT_TRUE(validated_table_pos_list);
+  EXPECT_EQ(validated_table_pos_list->size(), 900u);
+
+  const auto a = PQPColumnExpression::from_table(*table, "a");
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(a, 100));
+  table_scan->execute();
+  ASSERT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(get_pos_list(table_scan->get_output())));
+
+  const auto validate_scan = std::make_shared<Validate>(table_scan);
+  validate_scan->set_transaction_context(context);
+  validate_scan->execute();
+  const auto validated_scan_pos_list =
+      std::dynamic_pointer_cast<const BitmapPosList>(get_pos_list(validate_scan->get_output()));
+  ASSERT_TRUE(validated_scan_pos_list);
+  EXPECT_EQ(validated_scan_pos_list->size(), 810u);
+  EXPECT_EQ((*validated_scan_pos_list)[0], RowID(ChunkID{0}, ChunkOffset{101}));
+  EXPECT_FALSE(validated_scan_pos_list->contains(ChunkOffset{110}));
+}
+
 }  // namespace opossum
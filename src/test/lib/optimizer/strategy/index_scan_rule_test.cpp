@@ -14,6 +14,7 @@
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
 #include "optimizer/strategy/index_scan_rule.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/table_statistics.hpp"
@@ -22,6 +23,7 @@
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
+#include "storage/index/table_key/table_key_index.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -177,4 +179,50 @@ TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
 }
 
+TEST_F(IndexScanRuleTest, KeyIndexScan) {
+  table->create_key_index({{ColumnID{0}, ColumnID{2}}, KeyConstraintType::PRIMARY_KEY});
+
+  // The rule does not depend on the cardinality estimations for key indexes
+  generate_mock_statistics(10);
+
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(equals_(c, 11),
+    ValidateNode::make(
+      PredicateNode::make(greater_than_(b, 5),
+        PredicateNode::make(equals_(a, 9),
+          stored_table_node))));
+
+  const auto expected_lqp =
+  ValidateNode::make(
+    PredicateNode::make(greater_than_(b, 5),
+      PredicateNode::make(and_(equals_(a, 9), equals_(c, 11)),
+        stored_table_node)));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+
+  const auto key_predicate_node = std::static_pointer_cast<PredicateNode>(actual_lqp->left_input()->left_input());
+  EXPECT_EQ(key_predicate_node->scan_type, ScanType::IndexScan);
+}
+
+TEST_F(IndexScanRuleTest, NoKeyIndexScanWithoutFullKey) {
+  table->create_key_index({{ColumnID{0}, ColumnID{2}}, KeyConstraintType::PRIMARY_KEY});
+  generate_mock_statistics(10);
+
+  // The predicate on c is not an equality predicate
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(less_than_(c, 11),
+    PredicateNode::make(equals_(a, 9),
+      stored_table_node));
+  // clang-format on
+
+  const auto expected_lqp = input_lqp->deep_copy();
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  EXPECT_EQ(std::static_pointer_cast<PredicateNode>(actual_lqp->left_input())->scan_type, ScanType::TableScan);
+}
+
 }  // namespace opossum
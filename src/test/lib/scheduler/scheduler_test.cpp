@@ -13,6 +13,7 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/work_stealing_scheduler.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -290,4 +291,83 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   Hyrise::get().scheduler()->finish();
 }
 
+TEST_F(SchedulerTest, WorkStealingBasicTest) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<WorkStealingScheduler>());
+
+  std::atomic_uint32_t counter{0};
+
+  increment_counter_in_subtasks(counter);
+
+  Hyrise::get().scheduler()->finish();
+
+  ASSERT_EQ(counter, 30u);
+}
+
+TEST_F(SchedulerTest, WorkStealingDependencies) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<WorkStealingScheduler>());
+
+  std::atomic_uint32_t linear_counter{0u};
+  std::atomic_uint32_t multiple_counter{0u};
+  std::atomic_uint32_t diamond_counter{0u};
+
+  stress_linear_dependencies(linear_counter);
+  stress_multiple_dependencies(multiple_counter);
+  stress_diamond_dependencies(diamond_counter);
+
+  Hyrise::get().scheduler()->finish();
+
+  EXPECT_EQ(linear_counter, 3u);
+  EXPECT_EQ(multiple_counter, 4u);
+  EXPECT_EQ(diamond_counter, 7u);
+}
+
+TEST_F(SchedulerTest, WorkStealingManyNestedJobs) {
+  // Spawn many small jobs from within workers so that they end up in the workers' deques and have to be stolen by the
+  // other (idle) workers.
+  Hyrise::get().topology.use_fake_numa_topology(8, 2);
+  Hyrise::get().set_scheduler(std::make_shared<WorkStealingScheduler>());
+
+  constexpr auto OUTER_TASK_COUNT = 4u;
+  constexpr auto INNER_TASK_COUNT = 1'000u;
+
+  std::atomic_uint32_t counter{0};
+  auto outer_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto outer_task_id = 0u; outer_task_id < OUTER_TASK_COUNT; ++outer_task_id) {
+    outer_tasks.emplace_back(std::make_shared<JobTask>([&counter]() {
+      auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+      jobs.reserve(INNER_TASK_COUNT);
+      for (auto job_id = 0u; job_id < INNER_TASK_COUNT; ++job_id) {
+        jobs.emplace_back(std::make_shared<JobTask>([&counter]() { ++counter; }));
+      }
+      Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(outer_tasks);
+
+  Hyrise::get().scheduler()->finish();
+
+  EXPECT_EQ(counter, OUTER_TASK_COUNT * INNER_TASK_COUNT);
+}
+
+TEST_F(SchedulerTest, WorkStealingSingleWorkerGuaranteeProgress) {
+  Hyrise::get().topology.use_default_topology(1);
+  Hyrise::get().set_scheduler(std::make_shared<WorkStealingScheduler>());
+
+  auto task_done = false;
+  auto task = std::make_shared<JobTask>([&task_done]() {
+    auto subtask = std::make_shared<JobTask>([&task_done]() { task_done = true; });
+
+    subtask->schedule();
+    Hyrise::get().scheduler()->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{subtask});
+  });
+
+  task->schedule();
+  Hyrise::get().scheduler()->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  EXPECT_TRUE(task_done);
+
+  Hyrise::get().scheduler()->finish();
+}
+
 }  // namespace opossum
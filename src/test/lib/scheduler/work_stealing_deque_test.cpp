@@ -0,0 +1,133 @@
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace opossum {
+
+class WorkStealingDequeTest : public BaseTest {
+ protected:
+  std::shared_ptr<AbstractTask> create_task() {
+    return std::make_shared<JobTask>([]() {});
+  }
+};
+
+TEST_F(WorkStealingDequeTest, PopIsLifoStealIsFifo) {
+  auto deque = WorkStealingDeque{};
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+
+  const auto task_a = create_task();
+  const auto task_b = create_task();
+  const auto task_c = create_task();
+  deque.push(task_a);
+  deque.push(task_b);
+  deque.push(task_c);
+  EXPECT_EQ(deque.size(), 3);
+
+  EXPECT_EQ(deque.pop(), task_c);
+  EXPECT_EQ(deque.steal(), task_a);
+  EXPECT_EQ(deque.pop(), task_b);
+
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST_F(WorkStealingDequeTest, Grow) {
+  auto deque = WorkStealingDeque{4};
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (auto task_id = 0; task_id < 100; ++task_id) {
+    tasks.emplace_back(create_task());
+    deque.push(tasks.back());
+  }
+  EXPECT_EQ(deque.size(), 100);
+
+  for (auto task_id = 0; task_id < 50; ++task_id) {
+    EXPECT_EQ(deque.steal(), tasks[task_id]);
+  }
+  for (auto task_id = 99; task_id >= 50; --task_id) {
+    EXPECT_EQ(deque.pop(), tasks[task_id]);
+  }
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST_F(WorkStealingDequeTest, ReleasesRemainingTasks) {
+  auto task = create_task();
+  {
+    auto deque = WorkStealingDeque{};
+    deque.push(task);
+    EXPECT_EQ(task.use_count(), 2);
+  }
+  EXPECT_EQ(task.use_count(), 1);
+}
+
+TEST_F(WorkStealingDequeTest, ConcurrentStealing) {
+  // The owner pushes and pops while several thieves steal. Every task must be retrieved exactly once.
+  constexpr auto TASK_COUNT = 100'000;
+  constexpr auto THIEF_COUNT = 3;
+
+  auto deque = WorkStealingDeque{16};
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  auto task_ids = std::unordered_map<const AbstractTask*, size_t>{};
+  tasks.reserve(TASK_COUNT);
+  for (auto task_id = 0; task_id < TASK_COUNT; ++task_id) {
+    tasks.emplace_back(create_task());
+    task_ids.emplace(tasks.back().get(), task_id);
+  }
+
+  // Each retrieved task is marked so that duplicates can be detected
+  auto retrieved = std::vector<std::atomic_uint32_t>(TASK_COUNT);
+  const auto mark_retrieved = [&](const std::shared_ptr<AbstractTask>& task) {
+    ++retrieved[task_ids.at(task.get())];
+  };
+
+  std::atomic_bool owner_done{false};
+  std::atomic_uint32_t retrieved_count{0};
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_id = 0; thief_id < THIEF_COUNT; ++thief_id) {
+    thieves.emplace_back([&]() {
+      // Thieves only stop once the owner is done and the deque has been drained
+      while (!owner_done || !deque.empty()) {
+        const auto task = deque.steal();
+        if (task) {
+          mark_retrieved(task);
+          ++retrieved_count;
+        }
+      }
+    });
+  }
+
+  for (auto task_id = 0; task_id < TASK_COUNT; ++task_id) {
+    deque.push(tasks[task_id]);
+    if (task_id % 3 == 0) {
+      const auto task = deque.pop();
+      if (task) {
+        mark_retrieved(task);
+        ++retrieved_count;
+      }
+    }
+  }
+  owner_done = true;
+
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+
+  EXPECT_EQ(retrieved_count, TASK_COUNT);
+  for (auto task_id = 0; task_id < TASK_COUNT; ++task_id) {
+    EXPECT_EQ(retrieved[task_id], 1);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,195 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "server/copy_handler.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+
+namespace opossum {
+
+class CopyHandlerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _column_definitions = TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, true}};
+    _table = std::make_shared<Table>(_column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    Hyrise::get().storage_manager.add_table("table_a", _table);
+
+    _expected_table = std::make_shared<Table>(_column_definitions, TableType::Data);
+  }
+
+  uint64_t import(const CopyFormat format, const std::vector<std::string>& data) {
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    auto importer = CopyImporter{"table_a", format, transaction_context};
+    for (const auto& copy_data : data) {
+      importer.consume(copy_data);
+    }
+    const auto row_count = importer.finish();
+    transaction_context->commit();
+    return row_count;
+  }
+
+  TableColumnDefinitions _column_definitions;
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<Table> _expected_table;
+};
+
+TEST_F(CopyHandlerTest, ParseCopyStatement) {
+  EXPECT_FALSE(parse_copy_statement("SELECT * FROM table_a"));
+  EXPECT_FALSE(parse_copy_statement("COPY table_a FROM 'resources/test_data/tbl/int.tbl'"));
+  EXPECT_FALSE(parse_copy_statement("COPY table_a TO 'table_a.bin';"));
+
+  const auto copy_from = parse_copy_statement("copy table_a from stdin;");
+  ASSERT_TRUE(copy_from);
+  EXPECT_EQ(copy_from->direction, CopyDirection::FromStdin);
+  EXPECT_EQ(copy_from->format, CopyFormat::Text);
+  EXPECT_EQ(copy_from->table_name, "table_a");
+
+  const auto copy_from_csv = parse_copy_statement("COPY table_a FROM STDIN WITH (FORMAT csv)");
+  ASSERT_TRUE(copy_from_csv);
+  EXPECT_EQ(copy_from_csv->format, CopyFormat::CSV);
+
+  const auto copy_to = parse_copy_statement("COPY table_a TO STDOUT BINARY");
+  ASSERT_TRUE(copy_to);
+  EXPECT_EQ(copy_to->direction, CopyDirection::ToStdout);
+  EXPECT_EQ(copy_to->format, CopyFormat::Binary);
+  EXPECT_EQ(copy_to->query, "SELECT * FROM table_a");
+
+  const auto copy_query_to =
+      parse_copy_statement("COPY (SELECT a FROM table_a WHERE a IN (1, 2)) TO STDOUT (FORMAT csv)");
+  ASSERT_TRUE(copy_query_to);
+  EXPECT_EQ(copy_query_to->format, CopyFormat::CSV);
+  EXPECT_EQ(copy_query_to->query, "SELECT a FROM table_a WHERE a IN (1, 2)");
+
+  EXPECT_THROW(parse_copy_statement("COPY table_a FROM STDIN (FORMAT parquet)"), InvalidInputException);
+  EXPECT_THROW(parse_copy_statement("COPY (SELECT 1) FROM STDIN"), InvalidInputException);
+}
+
+TEST_F(CopyHandlerTest, ImportText) {
+  // Rows are split across CopyData messages, the last row does not end with a line break
+  EXPECT_EQ(import(CopyFormat::Text, {"1\ta\n2\t\\N\n", "\\N\tb\\tc\\\\\n3", "\t\n4\tx"}), 5u);
+
+  _expected_table->append({1, "a"});
+  _expected_table->append({2, NULL_VALUE});
+  _expected_table->append({NULL_VALUE, "b\tc\\"});
+  _expected_table->append({3, ""});
+  _expected_table->append({4, "x"});
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(CopyHandlerTest, ImportTextNumericEscapes) {
+  // \nnn takes one to three octal digits, \xhh one or two hexadecimal digits. An x without a hexadecimal digit and
+  // non-octal digits are taken literally.
+  EXPECT_EQ(import(CopyFormat::Text, {"1\t\\101\\x42\\1010\\x4a5\\xg\\8\n2\t\\7\\11\\x9\\x\n"}), 2u);
+
+  _expected_table->append({1, "ABA0J5xg8"});
+  _expected_table->append({2, "\a\t\tx"});
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(CopyHandlerTest, ImportTextEndOfDataMarker) {
+  EXPECT_EQ(import(CopyFormat::Text, {"1\ta\r\n\\.\n2\tb\n"}), 1u);
+
+  _expected_table->append({1, "a"});
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(CopyHandlerTest, ImportCSV) {
+  EXPECT_EQ(import(CopyFormat::CSV, {"1,a\n,\"\"\n", "3,\"x,\"\"y\"\"\nz\"\n4,\n5,\"", "b\"\n"}), 5u);
+
+  _expected_table->append({1, "a"});
+  _expected_table->append({NULL_VALUE, ""});
+  _expected_table->append({3, "x,\"y\"\nz"});
+  _expected_table->append({4, NULL_VALUE});
+  _expected_table->append({5, "b"});
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+
+  // Rows are inserted in batches of the table's target chunk size
+  EXPECT_EQ(_table->chunk_count(), 3u);
+}
+
+TEST_F(CopyHandlerTest, ImportRowsSpanningManyMessages) {
+  // Each byte is sent in its own CopyData message, including the escaped quote and the line break within quotes
+  const auto csv_data = std::string{"1,\"x\"\"\ny\"\n2,abc\n"};
+  auto csv_messages = std::vector<std::string>{};
+  for (const auto character : csv_data) {
+    csv_messages.emplace_back(1, character);
+  }
+  EXPECT_EQ(import(CopyFormat::CSV, csv_messages), 2u);
+
+  const auto text_data = std::string{"3\tdef\n4\tg\\th"};
+  auto text_messages = std::vector<std::string>{};
+  for (const auto character : text_data) {
+    text_messages.emplace_back(1, character);
+  }
+  EXPECT_EQ(import(CopyFormat::Text, text_messages), 2u);
+
+  _expected_table->append({1, "x\"\ny"});
+  _expected_table->append({2, "abc"});
+  _expected_table->append({3, "def"});
+  _expected_table->append({4, "g\th"});
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+}
+
+TEST_F(CopyHandlerTest, ImportBinary) {
+  const auto header = std::string{"PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0", 19};
+  const auto row = std::string{"\0\2\0\0\0\4\0\0\1\0\0\0\0\3abc", 17};
+  const auto null_row = std::string{"\0\2\377\377\377\377\377\377\377\377", 10};
+  const auto trailer = std::string{"\377\377", 2};
+
+  // The header and rows are split across CopyData messages
+  const auto data = header + row + null_row + trailer;
+  EXPECT_EQ(import(CopyFormat::Binary, {data.substr(0, 5), data.substr(5, 20), data.substr(25)}), 2u);
+
+  _expected_table->append({256, "abc"});
+  _expected_table->append({NULL_VALUE, NULL_VALUE});
+  EXPECT_TABLE_EQ_ORDERED(_table, _expected_table);
+
+  // The trailer is required
+  EXPECT_THROW(import(CopyFormat::Binary, {header + row}), InvalidInputException);
+
+  // Negative lengths other than -1 (NULL) are rejected before any value is read
+  const auto negative_length_row = std::string{"\0\2\0\0\0\4\0\0\1\0\377\377\377\376abc", 17};
+  EXPECT_THROW(import(CopyFormat::Binary, {header + negative_length_row + trailer}), InvalidInputException);
+  const auto min_length_row = std::string{"\0\2\200\0\0\0\0\0\0\3abc", 13};
+  EXPECT_THROW(import(CopyFormat::Binary, {header + min_length_row + trailer}), InvalidInputException);
+}
+
+TEST_F(CopyHandlerTest, KeyViolation) {
+  _table->create_key_index({{ColumnID{0}}, KeyConstraintType::UNIQUE});
+  EXPECT_EQ(import(CopyFormat::Text, {"1\ta\n"}), 1u);
+
+  // The second row completes a batch, which conflicts with the committed row
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  auto importer = CopyImporter{"table_a", CopyFormat::Text, transaction_context};
+  EXPECT_THROW(importer.consume("2\tb\n1\tc\n"), InvalidInputException);
+  EXPECT_EQ(transaction_context->phase(), TransactionPhase::RolledBackAfterConflict);
+
+  _expected_table->append({1, "a"});
+  const auto [pipeline_status, table] = SQLPipelineBuilder{"SELECT * FROM table_a"}.create_pipeline().get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_TABLE_EQ_ORDERED(table, _expected_table);
+}
+
+TEST_F(CopyHandlerTest, InvalidData) {
+  EXPECT_THROW(import(CopyFormat::Text, {"1\ta\tb\n"}), InvalidInputException);
+  EXPECT_THROW(import(CopyFormat::Text, {"1\n"}), InvalidInputException);
+  EXPECT_THROW(import(CopyFormat::Text, {"1.5\ta\n"}), InvalidInputException);
+  EXPECT_THROW(import(CopyFormat::CSV, {"1,\"a\n"}), InvalidInputException);
+  EXPECT_THROW(import(CopyFormat::CSV, {"1,\"a\"b\n"}), InvalidInputException);
+  EXPECT_THROW(import(CopyFormat::Binary, {std::string{"PGCOPY\n\377\r\n\1\0\0\0\0\0\0\0\0\377\377", 21}}),
+               InvalidInputException);
+
+  const auto not_nullable_table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}},
+                                                          TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  Hyrise::get().storage_manager.add_table("not_nullable", not_nullable_table);
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  auto importer = CopyImporter{"not_nullable", CopyFormat::CSV, transaction_context};
+  EXPECT_THROW(importer.consume("\n"), InvalidInputException);
+
+  EXPECT_THROW(CopyImporter("not_existing", CopyFormat::Text, transaction_context), InvalidInputException);
+}
+
+}  // namespace opossum
@@ -178,13 +178,14 @@ TEST_F(PostgresProtocolHandlerTest, ReadParsePacket) {
   _mocked_socket->write(std::string{"\0", 1});
   _mocked_socket->write(query);
   _mocked_socket->write(std::string{"\0", 1});
-  // Specify data type of parameter. This value has currently no effect, but needs to be read.
+  // Specify data type of parameter. This value is only needed for parameters in binary format.
   _mocked_socket->write(std::string{'\0', '\x01'});
   _mocked_socket->write(std::string{'\0', '\0', '\0', '\x17'});
 
-  const auto& [statement_name_read, query_read] = _protocol_handler->read_parse_packet();
+  const auto& [statement_name_read, query_read, parameter_object_ids] = _protocol_handler->read_parse_packet();
   EXPECT_EQ(statement_name, statement_name_read);
   EXPECT_EQ(query, query_read);
+  EXPECT_EQ(parameter_object_ids, std::vector<uint32_t>{23});
 }
 
 TEST_F(PostgresProtocolHandlerTest, ReadSyncPacket) {
@@ -249,6 +250,97 @@ TEST_F(PostgresProtocolHandlerTest, ReadBindPacket) {
   EXPECT_EQ(statement_information.portal, portal);
   EXPECT_EQ(statement_information.statement_name, statement_name);
   EXPECT_EQ(statement_information.parameters, std::vector<AllTypeVariant>{"test"});
+  EXPECT_EQ(statement_information.parameter_format_codes, std::vector<FormatCode>{FormatCode::Text});
+  EXPECT_EQ(statement_information.result_format_codes, std::vector<FormatCode>{FormatCode::Text});
+}
+
+TEST_F(PostgresProtocolHandlerTest, ReadBindPacketBinaryFormat) {
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x24'});
+  // Unnamed portal and statement
+  _mocked_socket->write(std::string{"\0\0", 2});
+  // Two parameter format codes: binary and text
+  _mocked_socket->write(std::string{'\0', '\x02', '\0', '\x01', '\0', '\0'});
+  // Three parameters, but only two format codes
+  _mocked_socket->write(std::string{'\0', '\x03'});
+
+  EXPECT_THROW(_protocol_handler->read_bind_packet(), InvalidInputException);
+
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x24'});
+  _mocked_socket->write(std::string{"\0\0", 2});
+  _mocked_socket->write(std::string{'\0', '\x02', '\0', '\x01', '\0', '\0'});
+  _mocked_socket->write(std::string{'\0', '\x02'});
+  // Binary int4 with value 42
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x04', '\0', '\0', '\0', '\x2a'});
+  // NULL value
+  _mocked_socket->write(std::string{'\xff', '\xff', '\xff', '\xff'});
+  // One result format code for all columns: binary
+  _mocked_socket->write(std::string{'\0', '\x01', '\0', '\x01'});
+
+  const auto& statement_information = _protocol_handler->read_bind_packet();
+  EXPECT_EQ(statement_information.parameter_format_codes,
+            (std::vector<FormatCode>{FormatCode::Binary, FormatCode::Text}));
+  EXPECT_EQ(statement_information.result_format_codes, std::vector<FormatCode>{FormatCode::Binary});
+  ASSERT_EQ(statement_information.parameters.size(), 2u);
+  EXPECT_TRUE(variant_is_null(statement_information.parameters[1]));
+
+  // The binary parameter is kept as raw bytes until its data type is known
+  EXPECT_EQ(decode_binary_parameter(statement_information.parameters[0], 23), AllTypeVariant{int32_t{42}});
+}
+
+TEST_F(PostgresProtocolHandlerTest, ReadBindPacketNegativeCounts) {
+  // Negative number of parameter format codes
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x0a'});
+  _mocked_socket->write(std::string{"\0\0", 2});
+  _mocked_socket->write(std::string{'\xff', '\xff'});
+  EXPECT_THROW(_protocol_handler->read_bind_packet(), InvalidInputException);
+
+  // Negative number of parameters
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x0c'});
+  _mocked_socket->write(std::string{"\0\0", 2});
+  _mocked_socket->write(std::string{'\0', '\0', '\xff', '\xfe'});
+  EXPECT_THROW(_protocol_handler->read_bind_packet(), InvalidInputException);
+
+  // Negative length of a parameter value other than -1 (NULL)
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x10'});
+  _mocked_socket->write(std::string{"\0\0", 2});
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x01', '\xff', '\xff', '\xff', '\xfe'});
+  EXPECT_THROW(_protocol_handler->read_bind_packet(), InvalidInputException);
+}
+
+TEST_F(PostgresProtocolHandlerTest, ReadCopyPackets) {
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x07'});
+  _mocked_socket->write("1\ta");
+  EXPECT_EQ(_protocol_handler->read_copy_data_packet(), "1\ta");
+
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x09'});
+  _mocked_socket->write(std::string{"fail\0", 5});
+  EXPECT_EQ(_protocol_handler->read_copy_fail_packet(), "fail");
+
+  // The length includes the length field itself, so it cannot be less than four bytes
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x03'});
+  EXPECT_THROW(_protocol_handler->read_copy_data_packet(), InvalidInputException);
+
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\0'});
+  EXPECT_THROW(_protocol_handler->read_copy_fail_packet(), InvalidInputException);
+}
+
+TEST_F(PostgresProtocolHandlerTest, DecodeBinaryParameter) {
+  const auto raw = [](const std::string& bytes) { return AllTypeVariant{pmr_string{bytes}}; };
+
+  EXPECT_EQ(decode_binary_parameter(raw(std::string{'\xff', '\xff', '\xff', '\xfe'}), 23),
+            AllTypeVariant{int32_t{-2}});
+  EXPECT_EQ(decode_binary_parameter(raw(std::string{'\0', '\0', '\0', '\x01', '\0', '\0', '\0', '\0'}), 20),
+            AllTypeVariant{int64_t{4294967296}});
+  // IEEE 754 representations of 1.5
+  EXPECT_EQ(decode_binary_parameter(raw(std::string{'\x3f', '\xc0', '\0', '\0'}), 700), AllTypeVariant{1.5f});
+  EXPECT_EQ(decode_binary_parameter(raw(std::string{'\x3f', '\xf8', '\0', '\0', '\0', '\0', '\0', '\0'}), 701),
+            AllTypeVariant{1.5});
+  EXPECT_EQ(decode_binary_parameter(raw("text"), 25), AllTypeVariant{pmr_string{"text"}});
+  EXPECT_TRUE(variant_is_null(decode_binary_parameter(NULL_VALUE, 23)));
+
+  // Wrong length and unspecified data type
+  EXPECT_THROW(decode_binary_parameter(raw("abc"), 23), InvalidInputException);
+  EXPECT_THROW(decode_binary_parameter(raw("abcd"), 0), InvalidInputException);
 }
 
 TEST_F(PostgresProtocolHandlerTest, ReadExecutePacket) {
@@ -1,6 +1,13 @@
+#include <bit>
+#include <optional>
+#include <string>
+#include <vector>
+
 #include "base_test.hpp"
 #include "mock_socket.hpp"
 
+#include "lossy_cast.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "server/postgres_protocol_handler.hpp"
 #include "server/result_serializer.hpp"
 
@@ -17,6 +24,32 @@ class ResultSerializerTest : public BaseTest {
         std::make_shared<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>(_mocked_socket->get_socket());
   }
 
+  // Splits the DataRow messages of a serialized result into their values. NULL values are std::nullopt.
+  static std::vector<std::vector<std::optional<std::string>>> parse_data_rows(const std::string& data_rows) {
+    auto rows = std::vector<std::vector<std::optional<std::string>>>{};
+    auto position = data_rows.cbegin();
+    while (position != data_rows.cend()) {
+      EXPECT_EQ(*position, 'D');
+      const auto message_end = position + 1 + NetworkConversionHelper::get_message_length(position + 1);
+      const auto column_count = NetworkConversionHelper::get_small_int(position + 5);
+      position += 7;
+
+      auto& row = rows.emplace_back();
+      for (auto column_id = uint16_t{0}; column_id < column_count; ++column_id) {
+        const auto value_length = static_cast<int32_t>(NetworkConversionHelper::get_message_length(position));
+        position += 4;
+        if (value_length == -1) {
+          row.emplace_back(std::nullopt);
+          continue;
+        }
+        row.emplace_back(std::string{position, position + value_length});
+        position += value_length;
+      }
+      EXPECT_EQ(position, message_end);
+    }
+    return rows;
+  }
+
   std::shared_ptr<Table> _test_table;
   std::shared_ptr<MockSocket> _mocked_socket;
   std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>> _protocol_handler;
@@ -34,6 +67,84 @@ TEST_F(ResultSerializerTest, RowDescription) {
   }
 }
 
+TEST_F(ResultSerializerTest, RowDescriptionFormatCodes) {
+  ResultSerializer::send_table_description(_test_table, _protocol_handler, {FormatCode::Binary});
+  _protocol_handler->force_flush();
+  const std::string file_content = _mocked_socket->read();
+
+  // The format code is the last field of each column description
+  EXPECT_EQ(NetworkConversionHelper::get_small_int(file_content.cend() - 2), 1);
+
+  // Either one format code for all columns or one per column
+  EXPECT_THROW(ResultSerializer::send_table_description(_test_table, _protocol_handler,
+                                                        {FormatCode::Binary, FormatCode::Text}),
+               InvalidInputException);
+}
+
+TEST_F(ResultSerializerTest, SerializeChunkText) {
+  const auto column_count = _test_table->column_count();
+  const auto format_codes = std::vector<FormatCode>(column_count, FormatCode::Text);
+  const auto rows = parse_data_rows(
+      ResultSerializer::serialize_chunk(*_test_table->get_chunk(ChunkID{2}), _test_table->column_data_types(),
+                                        format_codes));
+
+  // The values are formatted as the text representation of lossy_variant_cast<pmr_string>
+  ASSERT_EQ(rows.size(), 2u);
+  for (auto row_id = size_t{0}; row_id < rows.size(); ++row_id) {
+    ASSERT_EQ(rows[row_id].size(), column_count);
+    const auto expected_row = _test_table->get_row(4 + row_id);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      const auto& value = expected_row[column_id];
+      if (variant_is_null(value)) {
+        EXPECT_FALSE(rows[row_id][column_id]);
+      } else {
+        EXPECT_EQ(rows[row_id][column_id], std::string{*lossy_variant_cast<pmr_string>(value)});
+      }
+    }
+  }
+}
+
+TEST_F(ResultSerializerTest, SerializeChunkBinary) {
+  const auto format_codes = std::vector<FormatCode>(_test_table->column_count(), FormatCode::Binary);
+  const auto rows = parse_data_rows(
+      ResultSerializer::serialize_chunk(*_test_table->get_chunk(ChunkID{2}), _test_table->column_data_types(),
+                                        format_codes));
+
+  ASSERT_EQ(rows.size(), 2u);
+  const auto& row = rows[0];
+  EXPECT_EQ(row[0], (std::string{'\0', '\0', '\0', '\x68'}));
+  EXPECT_FALSE(row[1]);
+  EXPECT_EQ(row[2], (std::string{'\0', '\0', '\0', '\0', '\0', '\0', '\0', '\x68'}));
+  EXPECT_FALSE(row[3]);
+  // IEEE 754 representations of 104.0
+  EXPECT_EQ(row[4], (std::string{'\x42', '\xd0', '\0', '\0'}));
+  EXPECT_EQ(row[6], (std::string{'\x40', '\x5a', '\0', '\0', '\0', '\0', '\0', '\0'}));
+  EXPECT_EQ(row[8], "104");
+  EXPECT_FALSE(row[9]);
+}
+
+TEST_F(ResultSerializerTest, SerializeCopyChunk) {
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, true}, {"b", DataType::String, true}}, TableType::Data);
+  table->append({1, "a\tb\\"});
+  table->append({NULL_VALUE, ""});
+  table->append({3, "x,\"y\""});
+  table->append({4, NULL_VALUE});
+  const auto& chunk = *table->get_chunk(ChunkID{0});
+  const auto column_data_types = table->column_data_types();
+
+  EXPECT_EQ(ResultSerializer::serialize_copy_chunk(chunk, column_data_types, CopyFormat::Text),
+            "1\ta\\tb\\\\\n\\N\t\n3\tx,\"y\"\n4\t\\N\n");
+  EXPECT_EQ(ResultSerializer::serialize_copy_chunk(chunk, column_data_types, CopyFormat::CSV),
+            "1,a\tb\\\n,\"\"\n3,\"x,\"\"y\"\"\"\n4,\n");
+
+  // Binary rows are the field count followed by length and value of each field
+  const auto binary_rows = ResultSerializer::serialize_copy_chunk(chunk, column_data_types, CopyFormat::Binary);
+  const auto first_row = std::string{"\0\2\0\0\0\4\0\0\0\1\0\0\0\4a\tb\\", 18};
+  const auto second_row = std::string{"\0\2\377\377\377\377\0\0\0\0", 10};
+  EXPECT_EQ(binary_rows.substr(0, first_row.size() + second_row.size()), first_row + second_row);
+}
+
 TEST_F(ResultSerializerTest, QueryResponse) {
   ResultSerializer::send_query_response(_test_table, _protocol_handler);
   _protocol_handler->force_flush();
@@ -43,6 +154,21 @@ TEST_F(ResultSerializerTest, QueryResponse) {
   EXPECT_EQ(std::count(file_content.begin(), file_content.end(), 'D'), _test_table->row_count());
 }
 
+TEST_F(ResultSerializerTest, QueryResponseMultiThreaded) {
+  ResultSerializer::send_query_response(_test_table, _protocol_handler);
+  _protocol_handler->force_flush();
+  const std::string single_threaded_content = _mocked_socket->read();
+
+  // The chunks are serialized in parallel, but have to be sent in order
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+  ResultSerializer::send_query_response(_test_table, _protocol_handler);
+  _protocol_handler->force_flush();
+  const std::string multi_threaded_content = _mocked_socket->read();
+
+  EXPECT_EQ(parse_data_rows(single_threaded_content).size(), size_t{_test_table->row_count()});
+  EXPECT_EQ(multi_threaded_content.substr(single_threaded_content.size()), single_threaded_content);
+}
+
 TEST_F(ResultSerializerTest, CommandCompleteMessage) {
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Insert, 1), "INSERT 0 1");
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Update, 1), "UPDATE -1");
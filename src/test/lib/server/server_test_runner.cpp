@@ -1,8 +1,12 @@
+#include <libpq-fe.h>
 #include <pqxx/pqxx>
 
 #include <fstream>
 #include <future>
 #include <thread>
+#include <vector>
+
+#include <magic_enum.hpp>
 
 #include "base_test.hpp"
 
@@ -11,17 +15,21 @@
 #include "operators/validate.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "server/server.hpp"
+#include "server/session_stream.hpp"
 #include "sql/sql_plan_cache.hpp"
 
 namespace opossum {
 
 // This class tests supported operations of the server implementation. This does not include statements with named
-// portals which are used for CURSOR operations.
-class ServerTestRunner : public BaseTest {
+// portals which are used for CURSOR operations. All tests are run for threaded and for asynchronous sessions.
+class ServerTestRunner : public BaseTestWithParam<SessionMode> {
  protected:
   void SetUp() override {
     Hyrise::reset();
 
+    // Port 0 to select random open port. Two I/O threads make asynchronous sessions handle requests concurrently.
+    _server = std::make_unique<Server>(boost::asio::ip::address(), 0, SendExecutionInfo::No, GetParam(), 2);
+
     _table_a = load_table("resources/test_data/tbl/int_float.tbl", ChunkOffset{2});
     Hyrise::get().storage_manager.add_table("table_a", _table_a);
 
@@ -53,8 +61,7 @@ class ServerTestRunner : public BaseTest {
     std::remove((_export_filename + ".csv.json").c_str());
   }
 
-  std::unique_ptr<Server> _server = std::make_unique<Server>(
-      boost::asio::ip::address(), 0, SendExecutionInfo::No);  // Port 0 to select random open port
+  std::unique_ptr<Server> _server;
   std::unique_ptr<std::thread> _server_thread;
   std::string _connection_string;
 
@@ -62,13 +69,13 @@ class ServerTestRunner : public BaseTest {
   const std::string _export_filename = test_data_path + "server_test";
 };
 
-TEST_F(ServerTestRunner, TestCacheAndSchedulerInitialization) {
+TEST_P(ServerTestRunner, TestCacheAndSchedulerInitialization) {
   EXPECT_NE(std::dynamic_pointer_cast<NodeQueueScheduler>(Hyrise::get().scheduler()), nullptr);
   EXPECT_NE(Hyrise::get().default_lqp_cache, nullptr);
   EXPECT_NE(Hyrise::get().default_pqp_cache, nullptr);
 }
 
-TEST_F(ServerTestRunner, TestSimpleSelect) {
+TEST_P(ServerTestRunner, TestSimpleSelect) {
   pqxx::connection connection{_connection_string};
 
   // We use nontransactions because the regular transactions use "begin" and "commit" keywords that we do not support.
@@ -79,7 +86,29 @@ TEST_F(ServerTestRunner, TestSimpleSelect) {
   EXPECT_EQ(result.size(), _table_a->row_count());
 }
 
-TEST_F(ServerTestRunner, ValidateCorrectTransfer) {
+TEST_P(ServerTestRunner, TestLargeSelect) {
+  // The result spans multiple output batches of asynchronous sessions (see SessionStream)
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, false}};
+  const auto large_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{10'000});
+  const auto value = pmr_string(100, 'x');
+  const auto row_count = 5 * SessionStream::OUTPUT_BATCH_SIZE / value.size();
+  for (auto row_id = size_t{0}; row_id < row_count; ++row_id) {
+    large_table->append({static_cast<int32_t>(row_id), value});
+  }
+  Hyrise::get().storage_manager.add_table("large_table", large_table);
+
+  pqxx::connection connection{_connection_string};
+  pqxx::nontransaction transaction{connection};
+
+  const auto result = transaction.exec("SELECT * FROM large_table;");
+  ASSERT_EQ(result.size(), row_count);
+  EXPECT_EQ(result[row_count - 1][0].as<int32_t>(), static_cast<int32_t>(row_count - 1));
+
+  // The session is still usable afterwards
+  EXPECT_EQ(transaction.exec("SELECT * FROM table_a;").size(), _table_a->row_count());
+}
+
+TEST_P(ServerTestRunner, ValidateCorrectTransfer) {
   const auto all_types_table = load_table("resources/test_data/tbl/all_data_types_sorted.tbl", ChunkOffset{2});
   Hyrise::get().storage_manager.add_table("all_types_table", all_types_table);
 
@@ -107,7 +136,7 @@ TEST_F(ServerTestRunner, ValidateCorrectTransfer) {
   }
 }
 
-TEST_F(ServerTestRunner, TestCopyImport) {
+TEST_P(ServerTestRunner, TestCopyImport) {
   pqxx::connection connection{_connection_string};
 
   pqxx::nontransaction transaction{connection};
@@ -118,7 +147,7 @@ TEST_F(ServerTestRunner, TestCopyImport) {
   EXPECT_TABLE_EQ_ORDERED(Hyrise::get().storage_manager.get_table("another_table"), _table_a);
 }
 
-TEST_F(ServerTestRunner, TestInvalidCopyImport) {
+TEST_P(ServerTestRunner, TestInvalidCopyImport) {
   pqxx::connection connection{_connection_string};
 
   pqxx::nontransaction transaction{connection};
@@ -137,7 +166,7 @@ TEST_F(ServerTestRunner, TestInvalidCopyImport) {
   EXPECT_EQ(result.size(), _table_a->row_count());
 }
 
-TEST_F(ServerTestRunner, TestCopyExport) {
+TEST_P(ServerTestRunner, TestCopyExport) {
   pqxx::connection connection{_connection_string};
 
   pqxx::nontransaction transaction{connection};
@@ -148,7 +177,7 @@ TEST_F(ServerTestRunner, TestCopyExport) {
   EXPECT_TRUE(compare_files(_export_filename + ".bin", "resources/test_data/bin/int_float.bin"));
 }
 
-TEST_F(ServerTestRunner, TestInvalidCopyExport) {
+TEST_P(ServerTestRunner, TestInvalidCopyExport) {
   pqxx::connection connection{_connection_string};
 
   pqxx::nontransaction transaction{connection};
@@ -167,7 +196,7 @@ TEST_F(ServerTestRunner, TestInvalidCopyExport) {
   EXPECT_EQ(result.size(), _table_a->row_count());
 }
 
-TEST_F(ServerTestRunner, TestCopyIntegration) {
+TEST_P(ServerTestRunner, TestCopyIntegration) {
   pqxx::connection connection{_connection_string};
 
   pqxx::nontransaction transaction{connection};
@@ -201,7 +230,140 @@ TEST_F(ServerTestRunner, TestCopyIntegration) {
   EXPECT_TABLE_EQ_ORDERED(table_c, expected_table);
 }
 
-TEST_F(ServerTestRunner, TestInvalidStatement) {
+// The COPY streams of libpqxx differ between its versions, so we use libpq directly for the following tests
+TEST_P(ServerTestRunner, TestCopyFromStdin) {
+  auto* connection = PQconnectdb(_connection_string.c_str());
+  ASSERT_EQ(PQstatus(connection), CONNECTION_OK);
+
+  auto* result = PQexec(connection, "COPY table_a FROM STDIN;");
+  EXPECT_EQ(PQresultStatus(result), PGRES_COPY_IN);
+  PQclear(result);
+
+  // Rows may be split across CopyData messages
+  const auto data = std::string{"1\t2.5\n2\t"};
+  EXPECT_EQ(PQputCopyData(connection, data.data(), static_cast<int>(data.size())), 1);
+  EXPECT_EQ(PQputCopyData(connection, "3.5\n", 4), 1);
+  EXPECT_EQ(PQputCopyEnd(connection, nullptr), 1);
+
+  result = PQgetResult(connection);
+  EXPECT_EQ(PQresultStatus(result), PGRES_COMMAND_OK);
+  EXPECT_STREQ(PQcmdTuples(result), "2");
+  PQclear(result);
+  EXPECT_EQ(PQgetResult(connection), nullptr);
+
+  result = PQexec(connection, "SELECT * FROM table_a WHERE a < 10;");
+  EXPECT_EQ(PQntuples(result), 2);
+  PQclear(result);
+
+  // Invalid data is rejected. The rows are not inserted and the session continues.
+  result = PQexec(connection, "COPY table_a FROM STDIN WITH (FORMAT csv);");
+  EXPECT_EQ(PQresultStatus(result), PGRES_COPY_IN);
+  PQclear(result);
+  const auto invalid_data = std::string{"3,4.5\nfour,5.5\n"};
+  EXPECT_EQ(PQputCopyData(connection, invalid_data.data(), static_cast<int>(invalid_data.size())), 1);
+  EXPECT_EQ(PQputCopyData(connection, "5,6.5\n", 6), 1);
+  EXPECT_EQ(PQputCopyEnd(connection, nullptr), 1);
+
+  result = PQgetResult(connection);
+  EXPECT_EQ(PQresultStatus(result), PGRES_FATAL_ERROR);
+  PQclear(result);
+  EXPECT_EQ(PQgetResult(connection), nullptr);
+
+  result = PQexec(connection, "SELECT * FROM table_a WHERE a < 10;");
+  EXPECT_EQ(PQntuples(result), 2);
+  PQclear(result);
+
+  PQfinish(connection);
+}
+
+TEST_P(ServerTestRunner, TestCopyFromStdinKeyViolation) {
+  _table_a->create_key_index({{ColumnID{0}}, KeyConstraintType::PRIMARY_KEY});
+  const auto row_count = static_cast<int>(_table_a->row_count());
+
+  auto* connection = PQconnectdb(_connection_string.c_str());
+  ASSERT_EQ(PQstatus(connection), CONNECTION_OK);
+
+  // 123 is already stored in table_a. The client receives an error and none of the rows are inserted.
+  auto* result = PQexec(connection, "COPY table_a FROM STDIN;");
+  EXPECT_EQ(PQresultStatus(result), PGRES_COPY_IN);
+  PQclear(result);
+  const auto data = std::string{"1\t2.5\n123\t3.5\n"};
+  EXPECT_EQ(PQputCopyData(connection, data.data(), static_cast<int>(data.size())), 1);
+  EXPECT_EQ(PQputCopyEnd(connection, nullptr), 1);
+
+  result = PQgetResult(connection);
+  EXPECT_EQ(PQresultStatus(result), PGRES_FATAL_ERROR);
+  PQclear(result);
+  EXPECT_EQ(PQgetResult(connection), nullptr);
+
+  result = PQexec(connection, "SELECT * FROM table_a;");
+  EXPECT_EQ(PQntuples(result), row_count);
+  PQclear(result);
+
+  PQfinish(connection);
+}
+
+TEST_P(ServerTestRunner, TestUnfinishedCopiesDoNotBlockQueries) {
+  // More clients than there are workers start a COPY and pause in the middle of a row. Asynchronous sessions must not
+  // occupy a worker while they wait for the rest of the data.
+  const auto copy_count = std::thread::hardware_concurrency() + 1;
+  auto copy_connections = std::vector<PGconn*>{};
+  for (auto copy_id = uint32_t{0}; copy_id < copy_count; ++copy_id) {
+    auto* connection = PQconnectdb(_connection_string.c_str());
+    ASSERT_EQ(PQstatus(connection), CONNECTION_OK);
+    auto* result = PQexec(connection, "COPY table_a FROM STDIN;");
+    EXPECT_EQ(PQresultStatus(result), PGRES_COPY_IN);
+    PQclear(result);
+    EXPECT_EQ(PQputCopyData(connection, "1\t", 2), 1);
+    EXPECT_EQ(PQflush(connection), 0);
+    copy_connections.emplace_back(connection);
+  }
+
+  auto* connection = PQconnectdb(_connection_string.c_str());
+  ASSERT_EQ(PQstatus(connection), CONNECTION_OK);
+  auto* result = PQexec(connection, "SELECT * FROM table_a;");
+  EXPECT_EQ(PQntuples(result), static_cast<int>(_table_a->row_count()));
+  PQclear(result);
+  PQfinish(connection);
+
+  for (auto* copy_connection : copy_connections) {
+    EXPECT_EQ(PQputCopyData(copy_connection, "2.5\n", 4), 1);
+    EXPECT_EQ(PQputCopyEnd(copy_connection, nullptr), 1);
+    result = PQgetResult(copy_connection);
+    EXPECT_EQ(PQresultStatus(result), PGRES_COMMAND_OK);
+    PQclear(result);
+    EXPECT_EQ(PQgetResult(copy_connection), nullptr);
+    PQfinish(copy_connection);
+  }
+}
+
+TEST_P(ServerTestRunner, TestCopyToStdout) {
+  auto* connection = PQconnectdb(_connection_string.c_str());
+  ASSERT_EQ(PQstatus(connection), CONNECTION_OK);
+
+  auto* result = PQexec(connection, "COPY (SELECT a FROM table_a WHERE a > 1000) TO STDOUT WITH CSV;");
+  EXPECT_EQ(PQresultStatus(result), PGRES_COPY_OUT);
+  PQclear(result);
+
+  auto data = std::string{};
+  auto* buffer = static_cast<char*>(nullptr);
+  auto length = int{0};
+  while ((length = PQgetCopyData(connection, &buffer, 0)) > 0) {
+    data.append(buffer, length);
+    PQfreemem(buffer);
+  }
+  EXPECT_EQ(length, -1);
+  EXPECT_EQ(data, "12345\n1234\n");
+
+  result = PQgetResult(connection);
+  EXPECT_EQ(PQresultStatus(result), PGRES_COMMAND_OK);
+  EXPECT_STREQ(PQcmdTuples(result), "2");
+  PQclear(result);
+
+  PQfinish(connection);
+}
+
+TEST_P(ServerTestRunner, TestInvalidStatement) {
   pqxx::connection connection{_connection_string};
 
   pqxx::nontransaction transaction{connection};
@@ -217,7 +379,7 @@ TEST_F(ServerTestRunner, TestInvalidStatement) {
   EXPECT_EQ(result.size(), _table_a->row_count());
 }
 
-TEST_F(ServerTestRunner, TestTransactionCommit) {
+TEST_P(ServerTestRunner, TestTransactionCommit) {
   pqxx::connection connection{_connection_string};
   pqxx::connection verification_connection{_connection_string};
 
@@ -242,7 +404,7 @@ TEST_F(ServerTestRunner, TestTransactionCommit) {
   }
 }
 
-TEST_F(ServerTestRunner, TestTransactionRollback) {
+TEST_P(ServerTestRunner, TestTransactionRollback) {
   pqxx::connection connection{_connection_string};
 
   pqxx::transaction transaction{connection};
@@ -258,14 +420,14 @@ TEST_F(ServerTestRunner, TestTransactionRollback) {
   EXPECT_EQ(verification_result.size(), 3);
 }
 
-TEST_F(ServerTestRunner, TestInvalidTransactionFlow) {
+TEST_P(ServerTestRunner, TestInvalidTransactionFlow) {
   pqxx::connection connection{_connection_string};
 
   pqxx::transaction transaction{connection};
   EXPECT_THROW(transaction.exec("BEGIN;"), pqxx::sql_error);
 }
 
-TEST_F(ServerTestRunner, TestMultipleConnections) {
+TEST_P(ServerTestRunner, TestMultipleConnections) {
   pqxx::connection connection1{_connection_string};
   pqxx::connection connection2{_connection_string};
   pqxx::connection connection3{_connection_string};
@@ -287,7 +449,7 @@ TEST_F(ServerTestRunner, TestMultipleConnections) {
   EXPECT_EQ(result3.size(), expected_num_rows);
 }
 
-TEST_F(ServerTestRunner, TestSimpleInsertSelect) {
+TEST_P(ServerTestRunner, TestSimpleInsertSelect) {
   pqxx::connection connection{_connection_string};
   pqxx::nontransaction transaction{connection};
 
@@ -297,7 +459,7 @@ TEST_F(ServerTestRunner, TestSimpleInsertSelect) {
   EXPECT_EQ(result.size(), expected_num_rows);
 }
 
-TEST_F(ServerTestRunner, TestShutdownDuringExecution) {
+TEST_P(ServerTestRunner, TestShutdownDuringExecution) {
   // Test that open sessions are allowed to finish before the server is destroyed. This is more relevant for tests
   // than for the actual execution. In "real-life", i.e., during our experiments, we usually simply kill the server.
   // In tests however, the server finishing while sessions might not be completely finished could lead to issues
@@ -328,7 +490,7 @@ TEST_F(ServerTestRunner, TestShutdownDuringExecution) {
   // segfaults in regular execution.
 }
 
-TEST_F(ServerTestRunner, TestPreparedStatement) {
+TEST_P(ServerTestRunner, TestPreparedStatement) {
   pqxx::connection connection{_connection_string};
   pqxx::nontransaction transaction{connection};
 
@@ -346,7 +508,7 @@ TEST_F(ServerTestRunner, TestPreparedStatement) {
   EXPECT_EQ(result3.size(), 2u);
 }
 
-TEST_F(ServerTestRunner, TestUnnamedPreparedStatement) {
+TEST_P(ServerTestRunner, TestUnnamedPreparedStatement) {
   pqxx::connection connection{_connection_string};
   pqxx::nontransaction transaction{connection};
 
@@ -363,7 +525,7 @@ TEST_F(ServerTestRunner, TestUnnamedPreparedStatement) {
   EXPECT_EQ(result2.size(), 2u);
 }
 
-TEST_F(ServerTestRunner, TestInvalidPreparedStatement) {
+TEST_P(ServerTestRunner, TestInvalidPreparedStatement) {
   pqxx::connection connection{_connection_string};
   pqxx::nontransaction transaction{connection};
 
@@ -386,7 +548,7 @@ TEST_F(ServerTestRunner, TestInvalidPreparedStatement) {
   EXPECT_EQ(result.size(), 1u);
 }
 
-TEST_F(ServerTestRunner, TestParallelConnections) {
+TEST_P(ServerTestRunner, TestParallelConnections) {
   // This test is by no means perfect, as it can show flaky behaviour. But it is rather hard to get reliable tests with
   // multiple concurrent connections to detect a randomly (but often) occurring bug. This test will/can only fail if a
   // bug is present but it should not fail if no bug is present. It just sends 100 parallel connections and if that
@@ -428,7 +590,7 @@ TEST_F(ServerTestRunner, TestParallelConnections) {
   }
 }
 
-TEST_F(ServerTestRunner, TestTransactionConflicts) {
+TEST_P(ServerTestRunner, TestTransactionConflicts) {
   // Similar to TestParallelConnections, but this time we modify the table, expecting some conflicts on the way
   // Also similar to StressTest.TestTransactionConflicts, only that we go through the server
   auto initial_sum = int64_t{};
@@ -498,4 +660,11 @@ TEST_F(ServerTestRunner, TestTransactionConflicts) {
   EXPECT_EQ(final_sum - initial_sum, successful_increments);
 }
 
+auto server_test_formatter = [](const ::testing::TestParamInfo<SessionMode> info) {
+  return std::string{magic_enum::enum_name(info.param)};
+};
+
+INSTANTIATE_TEST_SUITE_P(SessionModes, ServerTestRunner, ::testing::Values(SessionMode::Threaded, SessionMode::Async),
+                         server_test_formatter);
+
 }  // namespace opossum
@@ -0,0 +1,61 @@
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "sql/normalize_sql_literals.hpp"
+
+namespace opossum {
+
+class NormalizeSQLLiteralsTest : public BaseTest {};
+
+TEST_F(NormalizeSQLLiteralsTest, ComparisonsAndLike) {
+  const auto normalized_sql =
+      normalize_sql_literals("SELECT * FROM t WHERE a = 1 AND b >= 2.5 AND c <> 'x' AND d LIKE 'abc%'");
+  ASSERT_TRUE(normalized_sql);
+  EXPECT_EQ(normalized_sql->sql, "SELECT * FROM t WHERE a = ? AND b >= ? AND c <> ? AND d LIKE ?");
+  EXPECT_EQ(normalized_sql->values,
+            (std::vector<AllTypeVariant>{int32_t{1}, 2.5, pmr_string{"x"}, pmr_string{"abc%"}}));
+  EXPECT_EQ(normalized_sql->plan_cache_key(),
+            "SELECT * FROM t WHERE a = ? AND b >= ? AND c <> ? AND d LIKE ?\n-- int, double, string, string");
+}
+
+TEST_F(NormalizeSQLLiteralsTest, BetweenAndInList) {
+  const auto normalized_sql = normalize_sql_literals(
+      "select a from t where a between 1 and 10 and b in (3, 4, 5000000000) order by 1 limit 5");
+  ASSERT_TRUE(normalized_sql);
+  EXPECT_EQ(normalized_sql->sql, "select a from t where a between ? and ? and b in (?, ?, ?) order by 1 limit 5");
+  EXPECT_EQ(normalized_sql->values,
+            (std::vector<AllTypeVariant>{int32_t{1}, int32_t{10}, int32_t{3}, int32_t{4}, int64_t{5000000000}}));
+}
+
+TEST_F(NormalizeSQLLiteralsTest, InsertValues) {
+  const auto normalized_sql = normalize_sql_literals("INSERT INTO t VALUES (1, 'a', 2.0), (2, 'b', -3.0)");
+  ASSERT_TRUE(normalized_sql);
+  EXPECT_EQ(normalized_sql->sql, "INSERT INTO t VALUES (?, ?, ?), (?, ?, -3.0)");
+  EXPECT_EQ(normalized_sql->values.size(), 5u);
+}
+
+TEST_F(NormalizeSQLLiteralsTest, StructuralLiteralsAreKept) {
+  const auto sql = std::string{
+      "SELECT SUBSTR(a, 1, 2), b + 1 FROM t WHERE c < DATE '2000-01-01' AND d IN (SELECT 1 FROM u) LIMIT 10"};
+  const auto normalized_sql = normalize_sql_literals(sql);
+  ASSERT_TRUE(normalized_sql);
+  EXPECT_EQ(normalized_sql->sql, sql);
+  EXPECT_TRUE(normalized_sql->values.empty());
+}
+
+TEST_F(NormalizeSQLLiteralsTest, EscapedStringsAndComments) {
+  const auto normalized_sql = normalize_sql_literals("SELECT * FROM t WHERE a = 'it''s' -- a = 1\nAND b = 2");
+  ASSERT_TRUE(normalized_sql);
+  EXPECT_EQ(normalized_sql->sql, "SELECT * FROM t WHERE a = 'it''s' -- a = 1\nAND b = ?");
+  EXPECT_EQ(normalized_sql->values, (std::vector<AllTypeVariant>{int32_t{2}}));
+}
+
+TEST_F(NormalizeSQLLiteralsTest, NotNormalizable) {
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE a = ?"));
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE a = 'unterminated"));
+  EXPECT_FALSE(normalize_sql_literals("SELECT * FROM t WHERE a = 1)"));
+}
+
+}  // namespace opossum
@@ -17,6 +17,7 @@
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "utils/memory_budget.hpp"
 
 namespace {
 // This function is a slightly hacky way to check whether an LQP was optimized. This relies on JoinOrderingRule and
@@ -513,6 +514,37 @@ TEST_F(SQLPipelineStatementTest, GetResultTableJoin) {
   EXPECT_TABLE_EQ_UNORDERED(table, _join_result);
 }
 
+TEST_F(SQLPipelineStatementTest, GetResultTableJoinWithMemoryBudget) {
+  // Operators that exceed the budget, such as JoinHash, spill to disk
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.with_memory_budget(0).create_pipeline();
+  auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+
+  const auto& physical_plan = statement->get_physical_plan();
+  const auto& memory_budget = physical_plan->memory_budget();
+  ASSERT_TRUE(memory_budget);
+  EXPECT_EQ(memory_budget->limit(), 0u);
+  EXPECT_EQ(physical_plan->left_input()->memory_budget(), memory_budget);
+
+  const auto [pipeline_status, table] = statement->get_result_table();
+  EXPECT_EQ(pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_TABLE_EQ_UNORDERED(table, _join_result);
+}
+
+TEST_F(SQLPipelineStatementTest, DefaultMemoryBudget) {
+  Hyrise::get().default_memory_budget = 1'000;
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline();
+  auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+
+  const auto& memory_budget = statement->get_physical_plan()->memory_budget();
+  ASSERT_TRUE(memory_budget);
+  EXPECT_EQ(memory_budget->limit(), 1'000u);
+
+  // with_memory_budget() takes precedence over the default
+  auto sql_pipeline_with_budget = SQLPipelineBuilder{_join_query}.with_memory_budget(0).create_pipeline();
+  auto statement_with_budget = get_sql_pipeline_statements(sql_pipeline_with_budget).at(0);
+  EXPECT_EQ(statement_with_budget->get_physical_plan()->memory_budget()->limit(), 0u);
+}
+
 TEST_F(SQLPipelineStatementTest, GetResultTableWithScheduler) {
   auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline();
   auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
@@ -699,6 +731,104 @@ TEST_F(SQLPipelineStatementTest, DefaultPlanCaches) {
   EXPECT_FALSE(statement_3->lqp_cache);
 }
 
+TEST_F(SQLPipelineStatementTest, ParameterizedPlanCache) {
+  const auto parameterized_plan_cache = std::make_shared<SQLParameterizedPlanCache>();
+
+  auto first_sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 1000"}
+                                .with_parameterized_plan_cache(parameterized_plan_cache)
+                                .create_pipeline();
+  auto first_statement = get_sql_pipeline_statements(first_sql_pipeline).at(0);
+  EXPECT_EQ(first_statement->parameterized_plan_cache, parameterized_plan_cache);
+
+  const auto [first_status, first_result] = first_statement->get_result_table();
+  EXPECT_EQ(first_status, SQLPipelineStatus::Success);
+  EXPECT_FALSE(first_statement->metrics()->parameterized_plan_cache_hit);
+  EXPECT_EQ(parameterized_plan_cache->size(), 1u);
+  EXPECT_TRUE(parameterized_plan_cache->has("SELECT * FROM table_a WHERE a > ?\n-- int"));
+
+  auto expected_first_result = std::make_shared<Table>(_int_float_column_definitions, TableType::Data);
+  expected_first_result->append({12345, 458.7f});
+  expected_first_result->append({1234, 457.7f});
+  EXPECT_TABLE_EQ_UNORDERED(first_result, expected_first_result);
+
+  // Only the literal differs, so the plan is reused and instantiated with the new value
+  auto second_sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 10000"}
+                                 .with_parameterized_plan_cache(parameterized_plan_cache)
+                                 .create_pipeline();
+  auto second_statement = get_sql_pipeline_statements(second_sql_pipeline).at(0);
+
+  const auto [second_status, second_result] = second_statement->get_result_table();
+  EXPECT_EQ(second_status, SQLPipelineStatus::Success);
+  EXPECT_TRUE(second_statement->metrics()->parameterized_plan_cache_hit);
+  EXPECT_EQ(parameterized_plan_cache->size(), 1u);
+
+  auto expected_second_result = std::make_shared<Table>(_int_float_column_definitions, TableType::Data);
+  expected_second_result->append({12345, 458.7f});
+  EXPECT_TABLE_EQ_UNORDERED(second_result, expected_second_result);
+}
+
+TEST_F(SQLPipelineStatementTest, ParameterizedPlanCacheDifferentDataTypes) {
+  const auto parameterized_plan_cache = std::make_shared<SQLParameterizedPlanCache>();
+
+  auto int_sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 1234"}
+                              .with_parameterized_plan_cache(parameterized_plan_cache)
+                              .create_pipeline();
+  auto int_statement = get_sql_pipeline_statements(int_sql_pipeline).at(0);
+  const auto [int_status, int_result] = int_statement->get_result_table();
+  EXPECT_EQ(int_status, SQLPipelineStatus::Success);
+  EXPECT_EQ(int_result->row_count(), 1u);
+
+  // The plan that was created for the int literal is not reused for the double literal
+  auto double_sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_a WHERE a > 1233.5"}
+                                 .with_parameterized_plan_cache(parameterized_plan_cache)
+                                 .create_pipeline();
+  auto double_statement = get_sql_pipeline_statements(double_sql_pipeline).at(0);
+  const auto [double_status, double_result] = double_statement->get_result_table();
+  EXPECT_EQ(double_status, SQLPipelineStatus::Success);
+  EXPECT_FALSE(double_statement->metrics()->parameterized_plan_cache_hit);
+  EXPECT_EQ(double_result->row_count(), 2u);
+
+  EXPECT_EQ(parameterized_plan_cache->size(), 2u);
+  EXPECT_TRUE(parameterized_plan_cache->has("SELECT * FROM table_a WHERE a > ?\n-- int"));
+  EXPECT_TRUE(parameterized_plan_cache->has("SELECT * FROM table_a WHERE a > ?\n-- double"));
+}
+
+TEST_F(SQLPipelineStatementTest, ParameterizedPlanCacheNotCacheable) {
+  const auto parameterized_plan_cache = std::make_shared<SQLParameterizedPlanCache>();
+  const auto meta_table_query =
+      "SELECT * FROM " + MetaTableManager::META_PREFIX + "tables WHERE table_name = 'table_a'";
+  const auto normalized_query =
+      "SELECT * FROM " + MetaTableManager::META_PREFIX + "tables WHERE table_name = ?\n-- string";
+
+  for (auto run = 0; run < 2; ++run) {
+    auto sql_pipeline = SQLPipelineBuilder{meta_table_query}
+                            .with_parameterized_plan_cache(parameterized_plan_cache)
+                            .create_pipeline();
+    auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+    const auto [status, result] = statement->get_result_table();
+    EXPECT_EQ(status, SQLPipelineStatus::Success);
+    EXPECT_EQ(result->row_count(), 1u);
+    EXPECT_FALSE(statement->metrics()->parameterized_plan_cache_hit);
+
+    // The statement is marked as not parameterizable
+    ASSERT_TRUE(parameterized_plan_cache->has(normalized_query));
+    EXPECT_FALSE(*parameterized_plan_cache->try_get(normalized_query));
+  }
+}
+
+TEST_F(SQLPipelineStatementTest, ParameterizedPlanCacheInvalidStatement) {
+  const auto parameterized_plan_cache = std::make_shared<SQLParameterizedPlanCache>();
+
+  // The error of the original statement is reported. As the table might be created later, the normalized statement is
+  // not marked as not parameterizable.
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM missing_table WHERE a > 1"}
+                          .with_parameterized_plan_cache(parameterized_plan_cache)
+                          .create_pipeline();
+  auto statement = get_sql_pipeline_statements(sql_pipeline).at(0);
+  EXPECT_THROW(statement->get_optimized_logical_plan(), InvalidInputException);
+  EXPECT_FALSE(parameterized_plan_cache->has("SELECT * FROM missing_table WHERE a > ?\n-- int"));
+}
+
 TEST_F(SQLPipelineStatementTest, MetaTableNoCaching) {
   const auto meta_table_query = "SELECT * FROM " + MetaTableManager::META_PREFIX + "tables";
 
@@ -11,6 +11,7 @@
 #include "logical_query_plan/join_node.hpp"
 #include "operators/abstract_join_operator.hpp"
 #include "operators/print.hpp"
+#include "operators/pqp_utils.hpp"
 #include "operators/validate.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
@@ -635,6 +636,31 @@ TEST_F(SQLPipelineTest, DefaultPlanCaches) {
   EXPECT_FALSE(sql_pipeline_3.lqp_cache);
 }
 
+TEST_F(SQLPipelineTest, PipelinedExecution) {
+  const auto query = std::string{"SELECT a, SUM(b), AVG(b), COUNT(*) FROM table_a_multi WHERE a > 100 GROUP BY a"};
+
+  auto sql_pipeline = SQLPipelineBuilder{query}.create_pipeline();
+  const auto [status, expected_table] = sql_pipeline.get_result_table();
+  EXPECT_EQ(status, SQLPipelineStatus::Success);
+
+  auto pipelined_sql_pipeline =
+      SQLPipelineBuilder{query}.with_pqp_cache(_pqp_cache).with_pipelined_execution().create_pipeline();
+  const auto [pipelined_status, pipelined_table] = pipelined_sql_pipeline.get_result_table();
+  EXPECT_EQ(pipelined_status, SQLPipelineStatus::Success);
+  EXPECT_TABLE_EQ_UNORDERED(pipelined_table, expected_table);
+
+  // The aggregate and the operators below it are executed as a ChunkPipeline
+  auto contains_chunk_pipeline = false;
+  visit_pqp(pipelined_sql_pipeline.get_physical_plans().at(0), [&](const auto& op) {
+    contains_chunk_pipeline |= op->type() == OperatorType::ChunkPipeline;
+    return PQPVisitation::VisitInputs;
+  });
+  EXPECT_TRUE(contains_chunk_pipeline);
+
+  // Pipelined plans are not cached, as they would be used by regular pipelines as well
+  EXPECT_EQ(_pqp_cache->size(), 0u);
+}
+
 TEST_F(SQLPipelineTest, PrecheckDDLOperators) {
   auto sql_pipeline_1 = SQLPipelineBuilder{"CREATE TABLE t (a_int INTEGER)"}.create_pipeline();
   EXPECT_NO_THROW(sql_pipeline_1.get_result_table());
@@ -35,7 +35,7 @@ class QueryPlanCacheTest : public BaseTest {
   }
 
   size_t query_frequency(const std::string& key) const {
-    return (*(cache->_map.find(key)->second)).frequency;
+    return *cache->snapshot().at(key).frequency;
   }
 
   const std::string Q1 = "SELECT * FROM table_a;";
@@ -66,7 +66,8 @@ TEST_F(QueryPlanCacheTest, QueryPlanCacheTest) {
 
 // Test query plan cache with GDFS implementation.
 TEST_F(QueryPlanCacheTest, AutomaticQueryOperatorCacheGDFS) {
-  cache = std::make_shared<SQLPhysicalPlanCache>(2);
+  // With a single shard, the eviction decisions are the same as for GDFSCache
+  cache = std::make_shared<SQLPhysicalPlanCache>(2, 1);
 
   // Execute the queries in arbitrary order.
   execute_query(Q1);  // Miss.
@@ -0,0 +1,229 @@
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/chunk_encoder.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class EncodingAdvisorTest : public BaseTest {
+ public:
+  void SetUp() override {
+    _table = create_test_table();
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+  }
+
+  // Column a consists of long runs of equal values, column b repeats a few strings
+  static std::shared_ptr<Table> create_test_table() {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}};
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2'000});
+    for (auto row_idx = int32_t{0}; row_idx < 6'000; ++row_idx) {
+      const auto b = row_idx % 7 == 0 ? NULL_VALUE
+                                      : AllTypeVariant{pmr_string{"value_"} + pmr_string(std::to_string(row_idx % 5))};
+      table->append({row_idx / 250, b});
+    }
+    table->last_chunk()->finalize();
+    ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{EncodingType::Dictionary});
+    return table;
+  }
+
+  static size_t smallest_estimated_size(const std::vector<EncodingAdvisor::SegmentEncodingCandidate>& candidates) {
+    auto smallest_size = std::numeric_limits<size_t>::max();
+    for (const auto& candidate : candidates) {
+      smallest_size = std::min(smallest_size, candidate.estimated_size);
+    }
+    return smallest_size;
+  }
+
+ protected:
+  const std::string _table_name{"encoding_advisor_table"};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(EncodingAdvisorTest, Candidates) {
+  const auto advisor = EncodingAdvisor{};
+  const auto int_segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  const auto string_segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{1});
+
+  const auto contains = [](const auto& candidates, const SegmentEncodingSpec& encoding_spec) {
+    return std::any_of(candidates.cbegin(), candidates.cend(),
+                       [&](const auto& candidate) { return candidate.encoding_spec == encoding_spec; });
+  };
+
+  const auto int_candidates = advisor.segment_candidates(int_segment, DataType::Int);
+  EXPECT_TRUE(contains(int_candidates, SegmentEncodingSpec{EncodingType::Unencoded}));
+  EXPECT_TRUE(contains(int_candidates, SegmentEncodingSpec{EncodingType::RunLength}));
+  EXPECT_TRUE(contains(int_candidates, SegmentEncodingSpec{EncodingType::LZ4, VectorCompressionType::BitPacking}));
+  EXPECT_TRUE(contains(int_candidates,
+                       SegmentEncodingSpec{EncodingType::FrameOfReference, VectorCompressionType::FixedWidthInteger}));
+  EXPECT_TRUE(
+      contains(int_candidates, SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking}));
+  EXPECT_FALSE(contains(int_candidates, SegmentEncodingSpec{EncodingType::FixedStringDictionary,
+                                                            VectorCompressionType::FixedWidthInteger}));
+
+  const auto string_candidates = advisor.segment_candidates(string_segment, DataType::String);
+  EXPECT_TRUE(contains(string_candidates, SegmentEncodingSpec{EncodingType::FixedStringDictionary,
+                                                              VectorCompressionType::FixedWidthInteger}));
+  EXPECT_FALSE(contains(string_candidates, SegmentEncodingSpec{EncodingType::FrameOfReference,
+                                                               VectorCompressionType::FixedWidthInteger}));
+
+  // Long runs are compressed best by RunLength encoding, which is thus the smallest estimate
+  for (const auto& candidate : int_candidates) {
+    if (candidate.encoding_spec.encoding_type == EncodingType::RunLength) {
+      EXPECT_EQ(candidate.estimated_size, smallest_estimated_size(int_candidates));
+    }
+  }
+}
+
+TEST_F(EncodingAdvisorTest, ExactEstimateForSmallSegments) {
+  // The sample covers the entire segment, so the estimates are the actual sizes. This includes the current encoding.
+  const auto advisor = EncodingAdvisor{ChunkOffset{2'000}};
+  const auto segment = _table->get_chunk(ChunkID{1})->get_segment(ColumnID{1});
+
+  for (const auto& candidate : advisor.segment_candidates(segment, DataType::String)) {
+    const auto encoded_segment = ChunkEncoder::encode_segment(segment, DataType::String, candidate.encoding_spec);
+    EXPECT_EQ(candidate.estimated_size, encoded_segment->memory_usage(MemoryUsageCalculationMode::Full));
+  }
+}
+
+TEST_F(EncodingAdvisorTest, SamplingIsNotCountedAsAccess) {
+  const auto advisor = EncodingAdvisor{};
+  const auto segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  segment->access_counter[SegmentAccessCounter::AccessType::Random] = 17;
+
+  const auto access_counter = segment->access_counter;
+  advisor.segment_candidates(segment, DataType::Int);
+  EXPECT_EQ(segment->access_counter, access_counter);
+}
+
+TEST_F(EncodingAdvisorTest, AccessCosts) {
+  using AccessType = SegmentAccessCounter::AccessType;
+
+  const auto unencoded = SegmentEncodingSpec{EncodingType::Unencoded};
+  const auto lz4 = SegmentEncodingSpec{EncodingType::LZ4, VectorCompressionType::FixedWidthInteger};
+  const auto dictionary_fixed_width =
+      SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::FixedWidthInteger};
+  const auto dictionary_bit_packing = SegmentEncodingSpec{EncodingType::Dictionary, VectorCompressionType::BitPacking};
+
+  EXPECT_EQ(EncodingAdvisor::access_cost_per_value(unencoded, AccessType::Sequential), 1.0);
+  EXPECT_LT(EncodingAdvisor::access_cost_per_value(dictionary_fixed_width, AccessType::Random),
+            EncodingAdvisor::access_cost_per_value(dictionary_bit_packing, AccessType::Random));
+  EXPECT_LT(EncodingAdvisor::access_cost_per_value(lz4, AccessType::Sequential),
+            EncodingAdvisor::access_cost_per_value(lz4, AccessType::Random));
+  EXPECT_EQ(EncodingAdvisor::access_cost_per_value(lz4, AccessType::Dictionary), 0.0);
+}
+
+TEST_F(EncodingAdvisorTest, RecommendWithoutBudget) {
+  // Segments that are accessed get the encoding that is the cheapest to access, the others the smallest encoding
+  const auto hot_segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{1});
+  hot_segment->access_counter[SegmentAccessCounter::AccessType::Random] = 1'000'000;
+
+  const auto advisor = EncodingAdvisor{};
+  const auto recommendations = advisor.recommend(std::nullopt);
+  ASSERT_EQ(recommendations.size(), 6u);
+
+  for (const auto& recommendation : recommendations) {
+    EXPECT_EQ(recommendation.table_name, _table_name);
+    EXPECT_EQ(recommendation.current_encoding_spec.encoding_type, EncodingType::Dictionary);
+
+    const auto segment = _table->get_chunk(recommendation.chunk_id)->get_segment(recommendation.column_id);
+    if (segment == hot_segment) {
+      EXPECT_EQ(recommendation.recommended_encoding_spec, SegmentEncodingSpec{EncodingType::Unencoded});
+    } else {
+      const auto candidates =
+          advisor.segment_candidates(segment, _table->column_data_type(recommendation.column_id));
+      EXPECT_EQ(recommendation.estimated_size, smallest_estimated_size(candidates));
+    }
+  }
+}
+
+TEST_F(EncodingAdvisorTest, RecommendSmallerEncodingForScans) {
+  // Scans have to read all bytes of a segment. For long runs of equal values, RunLength encoding reads a fraction of
+  // the bytes of an unencoded segment, which outweighs the cost of decoding the runs.
+  const auto scanned_segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  scanned_segment->access_counter[SegmentAccessCounter::AccessType::Sequential] = 1'000'000;
+
+  const auto advisor = EncodingAdvisor{};
+  const auto candidates = advisor.segment_candidates(scanned_segment, DataType::Int);
+  const auto unencoded_candidate =
+      std::find_if(candidates.cbegin(), candidates.cend(), [](const auto& candidate) {
+        return candidate.encoding_spec == SegmentEncodingSpec{EncodingType::Unencoded};
+      });
+  const auto run_length_candidate =
+      std::find_if(candidates.cbegin(), candidates.cend(), [](const auto& candidate) {
+        return candidate.encoding_spec == SegmentEncodingSpec{EncodingType::RunLength};
+      });
+  ASSERT_NE(unencoded_candidate, candidates.cend());
+  ASSERT_NE(run_length_candidate, candidates.cend());
+  EXPECT_LT(run_length_candidate->access_cost, unencoded_candidate->access_cost);
+
+  for (const auto& recommendation : advisor.recommend(std::nullopt)) {
+    if (recommendation.chunk_id == ChunkID{0} && recommendation.column_id == ColumnID{0}) {
+      EXPECT_NE(recommendation.recommended_encoding_spec, SegmentEncodingSpec{EncodingType::Unencoded});
+    }
+  }
+}
+
+TEST_F(EncodingAdvisorTest, RecommendWithBudget) {
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    for (auto column_id = ColumnID{0}; column_id < _table->column_count(); ++column_id) {
+      _table->get_chunk(chunk_id)->get_segment(column_id)->access_counter[SegmentAccessCounter::AccessType::Random] =
+          1'000 * (chunk_id + 1);
+    }
+  }
+
+  const auto advisor = EncodingAdvisor{};
+  const auto total_size_and_cost = [](const auto& recommendations) {
+    auto size = size_t{0};
+    auto access_cost = 0.0;
+    for (const auto& recommendation : recommendations) {
+      size += recommendation.estimated_size;
+      access_cost += recommendation.access_cost;
+    }
+    return std::pair{size, access_cost};
+  };
+
+  const auto [unlimited_size, unlimited_cost] = total_size_and_cost(advisor.recommend(std::nullopt));
+  const auto [smallest_size, smallest_cost] = total_size_and_cost(advisor.recommend(size_t{0}));
+  ASSERT_LT(smallest_size, unlimited_size);
+  ASSERT_GT(smallest_cost, unlimited_cost);
+
+  // Smaller encodings are paid for with higher access costs
+  const auto budget = (smallest_size + unlimited_size) / 2;
+  const auto [size, access_cost] = total_size_and_cost(advisor.recommend(budget));
+  EXPECT_LE(size, budget);
+  EXPECT_GE(size, smallest_size);
+  EXPECT_GT(access_cost, unlimited_cost);
+  EXPECT_LE(access_cost, smallest_cost);
+}
+
+TEST_F(EncodingAdvisorTest, Apply) {
+  const auto segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  segment->access_counter[SegmentAccessCounter::AccessType::Sequential] = 42;
+
+  const auto advisor = EncodingAdvisor{};
+  const auto recommendations = advisor.recommend(std::nullopt);
+  EXPECT_GT(EncodingAdvisor::apply(recommendations), 0u);
+
+  for (const auto& recommendation : recommendations) {
+    const auto encoded_segment = _table->get_chunk(recommendation.chunk_id)->get_segment(recommendation.column_id);
+    EXPECT_EQ(get_segment_encoding_spec(encoded_segment), recommendation.recommended_encoding_spec);
+  }
+
+  // The access counters are carried over
+  const auto encoded_segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_NE(encoded_segment, segment);
+  EXPECT_EQ(encoded_segment->access_counter[SegmentAccessCounter::AccessType::Sequential], 42u);
+
+  EXPECT_TABLE_EQ_ORDERED(_table, create_test_table());
+  EXPECT_EQ(EncodingAdvisor::apply(recommendations), 0u);
+}
+
+}  // namespace opossum
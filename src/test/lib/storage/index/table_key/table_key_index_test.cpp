@@ -0,0 +1,178 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "storage/index/table_key/table_key_index.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class TableKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{
+        {"a", DataType::Int, false}, {"b", DataType::String, true}, {"c", DataType::Long, false}};
+    table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3}, UseMvcc::Yes);
+    table->append({1, pmr_string{"one"}, int64_t{10}});
+    table->append({2, NullValue{}, int64_t{10}});
+    table->append({3, pmr_string{"three"}, int64_t{20}});
+    table->append({4, pmr_string{"four"}, int64_t{20}});
+    table->append({5, NullValue{}, int64_t{30}});
+
+    primary_key = std::make_unique<TableKeyConstraint>(std::unordered_set<ColumnID>{ColumnID{0}},
+                                                       KeyConstraintType::PRIMARY_KEY);
+  }
+
+  std::shared_ptr<MvccData> mvcc_data(const ChunkID chunk_id) {
+    return table->get_chunk(chunk_id)->mvcc_data();
+  }
+
+  std::shared_ptr<Table> table;
+  std::unique_ptr<TableKeyConstraint> primary_key;
+};
+
+TEST_F(TableKeyIndexTest, CreateFromTable) {
+  table->create_key_index(*primary_key);
+
+  ASSERT_EQ(table->key_indexes().size(), 1u);
+  EXPECT_EQ(table->soft_key_constraints().size(), 1u);
+
+  const auto& key_index = *table->key_indexes().front();
+  EXPECT_EQ(key_index.column_ids(), std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(key_index.key_type(), KeyConstraintType::PRIMARY_KEY);
+
+  EXPECT_EQ(key_index.lookup({1}), std::vector<RowID>{RowID(ChunkID{0}, ChunkOffset{0})});
+  EXPECT_EQ(key_index.lookup({4}), std::vector<RowID>{RowID(ChunkID{1}, ChunkOffset{0})});
+  EXPECT_TRUE(key_index.lookup({6}).empty());
+
+  // The same key cannot be indexed twice
+  EXPECT_THROW(table->create_key_index(*primary_key), std::logic_error);
+}
+
+TEST_F(TableKeyIndexTest, AddRows) {
+  // Table::create_key_index first indexes the rows that are complete and then adds the rows appended meanwhile
+  auto key_index = TableKeyIndex{*table, *primary_key};
+  EXPECT_TRUE(key_index.lookup({1}).empty());
+
+  const auto indexed_chunk_sizes = std::vector<ChunkOffset>{ChunkOffset{3}, ChunkOffset{1}};
+  key_index.add_rows({}, indexed_chunk_sizes);
+  EXPECT_EQ(key_index.lookup({4}), std::vector<RowID>{RowID(ChunkID{1}, ChunkOffset{0})});
+  EXPECT_TRUE(key_index.lookup({5}).empty());
+
+  table->append({6, pmr_string{"six"}, int64_t{60}});
+  key_index.add_rows(indexed_chunk_sizes, {ChunkOffset{3}, ChunkOffset{3}});
+  EXPECT_EQ(key_index.lookup({5}), std::vector<RowID>{RowID(ChunkID{1}, ChunkOffset{1})});
+  EXPECT_EQ(key_index.lookup({6}), std::vector<RowID>{RowID(ChunkID{1}, ChunkOffset{2})});
+
+  // Rows are not indexed twice
+  EXPECT_EQ(key_index.lookup({1}), std::vector<RowID>{RowID(ChunkID{0}, ChunkOffset{0})});
+  EXPECT_EQ(key_index.lookup({4}), std::vector<RowID>{RowID(ChunkID{1}, ChunkOffset{0})});
+
+  // Rows added later conflict with the ones that were indexed before
+  table->append({6, pmr_string{"six"}, int64_t{60}});
+  EXPECT_THROW(key_index.add_rows({ChunkOffset{3}, ChunkOffset{3}}, {ChunkOffset{3}, ChunkOffset{3}, ChunkOffset{1}}),
+               std::logic_error);
+}
+
+TEST_F(TableKeyIndexTest, CompositeKey) {
+  // The columns of the constraint are sorted, so is the key
+  table->create_key_index({{ColumnID{2}, ColumnID{0}}, KeyConstraintType::UNIQUE});
+  const auto& key_index = *table->key_indexes().front();
+
+  EXPECT_EQ(key_index.column_ids(), std::vector<ColumnID>({ColumnID{0}, ColumnID{2}}));
+  EXPECT_EQ(key_index.lookup({3, int64_t{20}}), std::vector<RowID>{RowID(ChunkID{0}, ChunkOffset{2})});
+  EXPECT_TRUE(key_index.lookup({3, int64_t{30}}).empty());
+}
+
+TEST_F(TableKeyIndexTest, NullKeysAreNotIndexed) {
+  table->create_key_index({{ColumnID{1}}, KeyConstraintType::UNIQUE});
+  const auto& key_index = *table->key_indexes().front();
+
+  EXPECT_EQ(key_index.lookup({pmr_string{"four"}}), std::vector<RowID>{RowID(ChunkID{1}, ChunkOffset{0})});
+  EXPECT_FALSE(key_index.key_of_row(*table->get_chunk(ChunkID{0}), ChunkOffset{1}));
+  EXPECT_EQ(key_index.key_of_row(*table->get_chunk(ChunkID{0}), ChunkOffset{2}),
+            TableKeyIndex::Key{pmr_string{"three"}});
+}
+
+TEST_F(TableKeyIndexTest, DuplicateKeys) {
+  // Column c contains duplicates
+  EXPECT_THROW(table->create_key_index({{ColumnID{2}}, KeyConstraintType::UNIQUE}), std::logic_error);
+
+  // Deleted rows do not count
+  mvcc_data(ChunkID{0})->set_end_cid(ChunkOffset{1}, CommitID{0});
+  mvcc_data(ChunkID{1})->set_end_cid(ChunkOffset{0}, CommitID{0});
+  table->create_key_index({{ColumnID{2}}, KeyConstraintType::UNIQUE});
+
+  const auto& key_index = *table->key_indexes().back();
+  EXPECT_EQ(key_index.lookup({int64_t{10}}),
+            std::vector<RowID>({RowID(ChunkID{0}, ChunkOffset{0}), RowID(ChunkID{0}, ChunkOffset{1})}));
+}
+
+TEST_F(TableKeyIndexTest, InsertConflicts) {
+  table->create_key_index(*primary_key);
+  auto& key_index = *table->key_indexes().front();
+
+  // Rows are added by an Insert of transaction 7 into the mutable chunk, where they are locked by it
+  const auto new_row_id = RowID{ChunkID{1}, ChunkOffset{2}};
+  table->append({6, pmr_string{"six"}, int64_t{60}});
+  mvcc_data(ChunkID{1})->set_begin_cid(ChunkOffset{2}, MvccData::MAX_COMMIT_ID);
+  mvcc_data(ChunkID{1})->set_tid(ChunkOffset{2}, TransactionID{7});
+
+  // Committed rows with the same key conflict
+  EXPECT_FALSE(key_index.try_insert({1}, new_row_id, TransactionID{7}));
+  EXPECT_EQ(key_index.lookup({1}), std::vector<RowID>{RowID(ChunkID{0}, ChunkOffset{0})});
+
+  // Unless the inserting transaction deletes them
+  mvcc_data(ChunkID{0})->set_tid(ChunkOffset{0}, TransactionID{7});
+  EXPECT_TRUE(key_index.try_insert({1}, new_row_id, TransactionID{7}));
+  EXPECT_EQ(key_index.lookup({1}), std::vector<RowID>({RowID(ChunkID{0}, ChunkOffset{0}), new_row_id}));
+
+  // The uncommitted row conflicts with other transactions and with further rows of the same transaction
+  const auto other_row_id = RowID{ChunkID{1}, ChunkOffset{1}};
+  EXPECT_FALSE(key_index.try_insert({1}, other_row_id, TransactionID{8}));
+  EXPECT_FALSE(key_index.try_insert({1}, other_row_id, TransactionID{7}));
+
+  key_index.erase({1}, new_row_id);
+  EXPECT_EQ(key_index.lookup({1}), std::vector<RowID>{RowID(ChunkID{0}, ChunkOffset{0})});
+
+  // Erasing rows that are not indexed has no effect
+  key_index.erase({1}, new_row_id);
+  key_index.erase({42}, new_row_id);
+  EXPECT_EQ(key_index.lookup({1}), std::vector<RowID>{RowID(ChunkID{0}, ChunkOffset{0})});
+}
+
+TEST_F(TableKeyIndexTest, DeletedRowsArePruned) {
+  table->create_key_index(*primary_key);
+  auto& key_index = *table->key_indexes().front();
+
+  const auto new_row_id = RowID{ChunkID{1}, ChunkOffset{2}};
+  table->append({6, pmr_string{"six"}, int64_t{60}});
+  mvcc_data(ChunkID{1})->set_begin_cid(ChunkOffset{2}, MvccData::MAX_COMMIT_ID);
+  mvcc_data(ChunkID{1})->set_tid(ChunkOffset{2}, TransactionID{7});
+
+  // A deleted row that is still visible to an active transaction does not conflict, but is kept
+  auto old_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto deleting_transaction_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  deleting_transaction_context->commit();
+  mvcc_data(ChunkID{0})->set_end_cid(ChunkOffset{0}, Hyrise::get().transaction_manager.last_commit_id());
+
+  EXPECT_TRUE(key_index.try_insert({1}, new_row_id, TransactionID{7}));
+  EXPECT_EQ(key_index.lookup({1}), std::vector<RowID>({RowID(ChunkID{0}, ChunkOffset{0}), new_row_id}));
+  key_index.erase({1}, new_row_id);
+
+  // Rows that are invisible to all transactions are removed. Transactions remain active until their context is gone.
+  old_transaction_context->commit();
+  old_transaction_context = nullptr;
+  EXPECT_TRUE(key_index.try_insert({1}, new_row_id, TransactionID{7}));
+  EXPECT_EQ(key_index.lookup({1}), std::vector<RowID>{new_row_id});
+
+  // Rolled back rows are removed as well
+  mvcc_data(ChunkID{0})->set_end_cid(ChunkOffset{1}, CommitID{0});
+  EXPECT_TRUE(key_index.try_insert({2}, RowID{ChunkID{1}, ChunkOffset{1}}, TransactionID{8}));
+  EXPECT_EQ(key_index.lookup({2}), std::vector<RowID>{RowID(ChunkID{1}, ChunkOffset{1})});
+}
+
+}  // namespace opossum
@@ -0,0 +1,132 @@
+#include "base_test.hpp"
+#include "storage/pos_lists/bitmap_pos_list.hpp"
+#include "storage/pos_lists/row_id_pos_list.hpp"
+
+namespace opossum {
+
+class BitmapPosListTest : public BaseTest {
+ public:
+  void SetUp() override {
+    // Positions in the first word, none in the second word, and several in the third word, including its last bit
+    bitmap = BitmapPosList::Bitmap{0b1011, 0, (uint64_t{1} << 63) | 0b110};
+    pos_list = std::make_shared<BitmapPosList>(ChunkID{2}, bitmap);
+
+    expected_positions = {RowID{ChunkID{2}, ChunkOffset{0}},   RowID{ChunkID{2}, ChunkOffset{1}},
+                          RowID{ChunkID{2}, ChunkOffset{3}},   RowID{ChunkID{2}, ChunkOffset{129}},
+                          RowID{ChunkID{2}, ChunkOffset{130}}, RowID{ChunkID{2}, ChunkOffset{191}}};
+  }
+
+  BitmapPosList::Bitmap bitmap;
+  std::shared_ptr<BitmapPosList> pos_list;
+  std::vector<RowID> expected_positions;
+};
+
+TEST_F(BitmapPosListTest, Properties) {
+  EXPECT_TRUE(pos_list->references_single_chunk());
+  EXPECT_EQ(pos_list->common_chunk_id(), ChunkID{2});
+  EXPECT_EQ(pos_list->size(), 6u);
+  EXPECT_FALSE(pos_list->empty());
+  EXPECT_EQ(pos_list->bitmap(), bitmap);
+
+  EXPECT_TRUE(pos_list->contains(ChunkOffset{3}));
+  EXPECT_FALSE(pos_list->contains(ChunkOffset{2}));
+  EXPECT_TRUE(pos_list->contains(ChunkOffset{191}));
+  EXPECT_FALSE(pos_list->contains(ChunkOffset{192}));
+
+  const auto empty_pos_list = BitmapPosList{ChunkID{0}, BitmapPosList::Bitmap(3)};
+  EXPECT_TRUE(empty_pos_list.empty());
+  EXPECT_EQ(empty_pos_list.begin(), empty_pos_list.end());
+}
+
+TEST_F(BitmapPosListTest, RandomAccess) {
+  for (auto index = size_t{0}; index < expected_positions.size(); ++index) {
+    EXPECT_EQ((*pos_list)[index], expected_positions[index]);
+  }
+}
+
+TEST_F(BitmapPosListTest, RandomAccessDenseAndSparseBlocks) {
+  // Dense words, followed by words with a single position in every fifth word, so that blocks of positions span more
+  // words than a select scans and store their positions explicitly, followed by dense words with gaps again
+  auto large_bitmap = BitmapPosList::Bitmap(10, ~uint64_t{0});
+  for (auto word_index = size_t{0}; word_index < 1'000; ++word_index) {
+    large_bitmap.emplace_back(word_index % 5 == 0 ? uint64_t{1} << (word_index % 64) : 0);
+  }
+  for (auto word_index = size_t{0}; word_index < 20; ++word_index) {
+    large_bitmap.emplace_back(0xF0F0F0F0F0F0F0F0);
+  }
+
+  auto large_expected_positions = std::vector<RowID>{};
+  for (auto offset = size_t{0}; offset < large_bitmap.size() * BitmapPosList::BITS_PER_WORD; ++offset) {
+    if ((large_bitmap[offset / BitmapPosList::BITS_PER_WORD] >> (offset % BitmapPosList::BITS_PER_WORD)) & 1u) {
+      large_expected_positions.emplace_back(RowID{ChunkID{1}, static_cast<ChunkOffset>(offset)});
+    }
+  }
+
+  const auto large_pos_list = BitmapPosList{ChunkID{1}, large_bitmap};
+  ASSERT_EQ(large_pos_list.size(), large_expected_positions.size());
+  for (auto index = size_t{0}; index < large_expected_positions.size(); ++index) {
+    EXPECT_EQ(large_pos_list[index], large_expected_positions[index]);
+    EXPECT_EQ(*(large_pos_list.begin() + static_cast<std::ptrdiff_t>(index)), large_expected_positions[index]);
+  }
+}
+
+TEST_F(BitmapPosListTest, Iterators) {
+  EXPECT_EQ(std::vector<RowID>(pos_list->begin(), pos_list->end()), expected_positions);
+  EXPECT_EQ(std::distance(pos_list->cbegin(), pos_list->cend()), 6);
+
+  auto it = pos_list->begin();
+  it += 4;
+  EXPECT_EQ(*it, expected_positions[4]);
+  --it;
+  EXPECT_EQ(*it, expected_positions[3]);
+  it -= 3;
+  EXPECT_EQ(*it, expected_positions[0]);
+  EXPECT_EQ(*(it + 5), expected_positions[5]);
+  EXPECT_EQ(it + 6, pos_list->end());
+  EXPECT_EQ(*(pos_list->end() - 1), expected_positions[5]);
+  EXPECT_EQ(it->chunk_offset, ChunkOffset{0});
+
+  // The iterators of the AbstractPosList use the virtual operator[]
+  const auto& abstract_pos_list = static_cast<const AbstractPosList&>(*pos_list);
+  EXPECT_EQ(std::vector<RowID>(abstract_pos_list.begin(), abstract_pos_list.end()), expected_positions);
+}
+
+TEST_F(BitmapPosListTest, IsMoreCompact) {
+  // A chunk with 1'000 rows needs 16 words and 16 ranks plus one select sample, i.e., 196 bytes. 24 RowIDs need less.
+  EXPECT_FALSE(BitmapPosList::is_more_compact(24, 1'000));
+  EXPECT_TRUE(BitmapPosList::is_more_compact(25, 1'000));
+}
+
+TEST_F(BitmapPosListTest, TryCreate) {
+  auto row_id_pos_list = RowIDPosList{};
+  row_id_pos_list.guarantee_single_chunk();
+  for (auto chunk_offset = ChunkOffset::base_type{0}; chunk_offset < 200; chunk_offset += 2) {
+    row_id_pos_list.emplace_back(RowID{ChunkID{1}, ChunkOffset{chunk_offset}});
+  }
+
+  const auto created_pos_list = BitmapPosList::try_create(row_id_pos_list, ChunkOffset{200});
+  ASSERT_TRUE(created_pos_list);
+  EXPECT_EQ(created_pos_list->common_chunk_id(), ChunkID{1});
+  EXPECT_EQ(std::vector<RowID>(created_pos_list->begin(), created_pos_list->end()),
+            std::vector<RowID>(row_id_pos_list.begin(), row_id_pos_list.end()));
+
+  // The bitmap would be larger than the positions
+  EXPECT_FALSE(BitmapPosList::try_create(row_id_pos_list, ChunkOffset{100'000}));
+
+  // Positions that are not strictly ascending cannot be represented
+  auto unordered_pos_list = RowIDPosList(row_id_pos_list.begin(), row_id_pos_list.end());
+  unordered_pos_list.guarantee_single_chunk();
+  std::swap(unordered_pos_list[3], unordered_pos_list[4]);
+  EXPECT_FALSE(BitmapPosList::try_create(unordered_pos_list, ChunkOffset{200}));
+
+  auto duplicate_pos_list = RowIDPosList(row_id_pos_list.begin(), row_id_pos_list.end());
+  duplicate_pos_list.guarantee_single_chunk();
+  duplicate_pos_list[4] = duplicate_pos_list[3];
+  EXPECT_FALSE(BitmapPosList::try_create(duplicate_pos_list, ChunkOffset{200}));
+
+  // Positions that reference multiple chunks cannot be represented
+  auto multi_chunk_pos_list = RowIDPosList(row_id_pos_list.begin(), row_id_pos_list.end());
+  EXPECT_FALSE(BitmapPosList::try_create(multi_chunk_pos_list, ChunkOffset{200}));
+}
+
+}  // namespace opossum
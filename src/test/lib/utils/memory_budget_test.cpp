@@ -0,0 +1,76 @@
+#include <limits>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "base_test.hpp"
+
+#include "utils/memory_budget.hpp"
+
+namespace opossum {
+
+class MemoryBudgetTest : public BaseTest {};
+
+TEST_F(MemoryBudgetTest, ReserveAndRelease) {
+  auto memory_budget = MemoryBudget{100};
+  EXPECT_EQ(memory_budget.limit(), 100u);
+
+  EXPECT_TRUE(memory_budget.try_reserve(60));
+  EXPECT_FALSE(memory_budget.try_reserve(41));
+  EXPECT_EQ(memory_budget.reserved_bytes(), 60u);
+  EXPECT_TRUE(memory_budget.try_reserve(40));
+  EXPECT_EQ(memory_budget.reserved_bytes(), 100u);
+
+  memory_budget.release(70);
+  EXPECT_EQ(memory_budget.reserved_bytes(), 30u);
+  EXPECT_EQ(memory_budget.peak_reserved_bytes(), 100u);
+  EXPECT_TRUE(memory_budget.try_reserve(0));
+}
+
+TEST_F(MemoryBudgetTest, Reservation) {
+  const auto memory_budget = std::make_shared<MemoryBudget>(100);
+
+  {
+    auto reservation = MemoryReservation{memory_budget};
+    EXPECT_TRUE(reservation.try_grow(50));
+    EXPECT_FALSE(reservation.try_grow(51));
+    EXPECT_EQ(reservation.bytes(), 50u);
+
+    reservation.shrink(20);
+    EXPECT_EQ(memory_budget->reserved_bytes(), 30u);
+
+    // Moving transfers the reserved bytes
+    auto other_reservation = std::move(reservation);
+    EXPECT_EQ(other_reservation.bytes(), 30u);
+    EXPECT_EQ(memory_budget->reserved_bytes(), 30u);
+  }
+
+  // Destroyed reservations return their bytes to the budget
+  EXPECT_EQ(memory_budget->reserved_bytes(), 0u);
+}
+
+TEST_F(MemoryBudgetTest, ReservationWithoutBudget) {
+  auto reservation = MemoryReservation{nullptr};
+  EXPECT_TRUE(reservation.try_grow(std::numeric_limits<size_t>::max()));
+  reservation.shrink(reservation.bytes());
+}
+
+TEST_F(MemoryBudgetTest, DefaultLimit) {
+  const auto limit = MemoryBudget::default_limit(1);
+  EXPECT_GT(limit, 0u);
+
+  // Concurrent statements share the available memory
+  EXPECT_LE(MemoryBudget::default_limit(4), limit / 4 + 1);
+}
+
+TEST_F(MemoryBudgetTest, ParseLimit) {
+  EXPECT_EQ(MemoryBudget::parse_limit("", 1), std::nullopt);
+  EXPECT_EQ(MemoryBudget::parse_limit("0", 1), size_t{0});
+  EXPECT_EQ(MemoryBudget::parse_limit(" 1000000 ", 1), size_t{1'000'000});
+  EXPECT_TRUE(MemoryBudget::parse_limit("auto", 1));
+
+  EXPECT_THROW(MemoryBudget::parse_limit("a lot", 1), InvalidInputException);
+  EXPECT_THROW(MemoryBudget::parse_limit("-1", 1), InvalidInputException);
+}
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#include "base_test.hpp"
+
+#include "utils/spill_file.hpp"
+
+namespace opossum {
+
+class SpillFileTest : public BaseTest {};
+
+TEST_F(SpillFileTest, WriteAndRead) {
+  auto spill_file = SpillFile{};
+  spill_file.write(int32_t{17});
+  spill_file.write(pmr_string{"Dampfschifffahrtsgesellschaft"});
+  spill_file.write(pmr_string{});
+  spill_file.write(RowID{ChunkID{3}, ChunkOffset{4}});
+  EXPECT_EQ(spill_file.size(), sizeof(int32_t) + 2 * sizeof(size_t) + 29 + sizeof(RowID));
+
+  spill_file.finish_writing();
+
+  auto int_value = int32_t{0};
+  auto string_value = pmr_string{"will be overwritten"};
+  auto empty_string_value = pmr_string{"will be overwritten"};
+  auto row_id = RowID{};
+  spill_file.read(int_value);
+  spill_file.read(string_value);
+  spill_file.read(empty_string_value);
+  spill_file.read(row_id);
+
+  EXPECT_EQ(int_value, 17);
+  EXPECT_EQ(string_value, "Dampfschifffahrtsgesellschaft");
+  EXPECT_EQ(empty_string_value, "");
+  EXPECT_EQ(row_id, (RowID{ChunkID{3}, ChunkOffset{4}}));
+
+  // Reading beyond the written data fails
+  EXPECT_THROW(spill_file.read(int_value), std::logic_error);
+}
+
+}  // namespace opossum
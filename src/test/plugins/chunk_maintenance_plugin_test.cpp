@@ -0,0 +1,184 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/chunk_maintenance_plugin.hpp"
+#include "concurrency/transaction_context.hpp"
+#include "operators/delete.hpp"
+#include "operators/get_table.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace opossum {
+
+class ChunkMaintenancePluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, _chunk_size, UseMvcc::Yes);
+    Hyrise::get().storage_manager.add_table(_table_name, _table);
+
+    // Chunk 0 holds the rows with a = 6, 3, 5, 1, chunk 1 the row with a = 4, which is still open for inserts
+    const auto values = std::make_shared<Table>(column_definitions, TableType::Data);
+    for (const auto a : {6, 3, 5, 1, 4}) {
+      values->append({a, pmr_string{"value_"} + pmr_string(std::to_string(a))});
+    }
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto insert = std::make_shared<Insert>(_table_name, table_wrapper);
+    insert->set_transaction_context(context);
+    insert->execute();
+    context->commit();
+  }
+
+  void TearDown() override {
+    Hyrise::reset();
+  }
+
+ protected:
+  static void _maintenance_loop(ChunkMaintenancePlugin& plugin) {
+    plugin._maintenance_loop();
+  }
+
+  static void _set_clustering_keys(ChunkMaintenancePlugin& plugin, const std::string& clustering_keys) {
+    plugin._clustering_keys_setting->set(clustering_keys);
+  }
+
+  std::shared_ptr<const Table> _visible_rows() {
+    const auto context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+    const auto get_table = std::make_shared<GetTable>(_table_name);
+    get_table->set_transaction_context(context);
+    get_table->execute();
+    const auto validate = std::make_shared<Validate>(get_table);
+    validate->set_transaction_context(context);
+    validate->execute();
+    return validate->get_output();
+  }
+
+  const std::string _table_name{"chunk_maintenance_table"};
+  static constexpr auto _chunk_size = ChunkOffset{4};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkMaintenancePluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseChunkMaintenancePlugin"));
+  EXPECT_NO_THROW(Hyrise::get().settings_manager.get_setting("ChunkMaintenancePlugin.ClusteringKeys"));
+  pm.unload_plugin("hyriseChunkMaintenancePlugin");
+}
+
+TEST_F(ChunkMaintenancePluginTest, InvalidClusteringKeys) {
+  auto plugin = ChunkMaintenancePlugin{};
+  EXPECT_THROW(_set_clustering_keys(plugin, "a"), InvalidInputException);
+  EXPECT_NO_THROW(_set_clustering_keys(plugin, ""));
+  EXPECT_NO_THROW(_set_clustering_keys(plugin, "table_a.a, table_b.b"));
+}
+
+TEST_F(ChunkMaintenancePluginTest, EncodeCompletedChunks) {
+  const auto rows_before = _visible_rows();
+
+  auto plugin = ChunkMaintenancePlugin{};
+  _maintenance_loop(plugin);
+
+  // Chunk 0 is encoded in place, chunk 1 is still used for inserts
+  EXPECT_EQ(_table->chunk_count(), 2);
+  const auto chunk = _table->get_chunk(ChunkID{0});
+  EXPECT_FALSE(chunk->is_mutable());
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(chunk->get_segment(ColumnID{0})));
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<pmr_string>>(chunk->get_segment(ColumnID{1})));
+  EXPECT_TRUE(chunk->pruning_statistics());
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->is_mutable());
+
+  EXPECT_TABLE_EQ_ORDERED(_visible_rows(), rows_before);
+}
+
+TEST_F(ChunkMaintenancePluginTest, SortCompletedChunks) {
+  const auto rows_before = _visible_rows();
+
+  auto plugin = ChunkMaintenancePlugin{};
+  _set_clustering_keys(plugin, _table_name + ".a");
+
+  // A transaction that started before the chunk is replaced keeps the old chunk from being removed
+  const auto old_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  _maintenance_loop(plugin);
+
+  EXPECT_EQ(_table->chunk_count(), 3);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+
+  const auto sorted_chunk = _table->get_chunk(ChunkID{2});
+  EXPECT_FALSE(sorted_chunk->is_mutable());
+  EXPECT_EQ(sorted_chunk->individually_sorted_by(),
+            std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}}});
+  EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(sorted_chunk->get_segment(ColumnID{0})));
+  EXPECT_TRUE(sorted_chunk->pruning_statistics());
+  EXPECT_EQ((*sorted_chunk->get_segment(ColumnID{0}))[ChunkOffset{0}], AllTypeVariant{1});
+  EXPECT_EQ((*sorted_chunk->get_segment(ColumnID{0}))[ChunkOffset{3}], AllTypeVariant{6});
+
+  EXPECT_TABLE_EQ_UNORDERED(_visible_rows(), rows_before);
+
+  // Chunk 1 is still the last mutable chunk. It is not replaced, and Insert keeps appending to it instead of starting
+  // a new chunk after the sorted one.
+  _maintenance_loop(plugin);
+  EXPECT_EQ(_table->chunk_count(), 3);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{1})->get_cleanup_commit_id());
+
+  const auto values = std::make_shared<Table>(_table->column_definitions(), TableType::Data);
+  values->append({7, pmr_string{"value_7"}});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+  const auto insert_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto insert = std::make_shared<Insert>(_table_name, table_wrapper);
+  insert->set_transaction_context(insert_context);
+  insert->execute();
+  insert_context->commit();
+  EXPECT_EQ(_table->chunk_count(), 3);
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->size(), 2);
+  EXPECT_EQ(_visible_rows()->row_count(), 6u);
+
+  // Once the old transaction is done, the replaced chunk is removed
+  old_context->commit();
+  _maintenance_loop(plugin);
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0}));
+  EXPECT_TRUE(_table->get_chunk(ChunkID{1}));
+  EXPECT_EQ(_visible_rows()->row_count(), 6u);
+}
+
+TEST_F(ChunkMaintenancePluginTest, RetryAfterConflict) {
+  auto plugin = ChunkMaintenancePlugin{};
+  _set_clustering_keys(plugin, _table_name + ".a");
+
+  // Another transaction deletes the rows of chunk 0, but has not committed yet
+  const auto delete_context = Hyrise::get().transaction_manager.new_transaction_context(AutoCommit::No);
+  const auto get_table = std::make_shared<GetTable>(_table_name, std::vector<ChunkID>{ChunkID{1}},
+                                                    std::vector<ColumnID>{});
+  get_table->set_transaction_context(delete_context);
+  get_table->execute();
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(delete_context);
+  validate->execute();
+  const auto delete_op = std::make_shared<Delete>(_table_name, validate);
+  delete_op->set_transaction_context(delete_context);
+  delete_op->execute();
+
+  _maintenance_loop(plugin);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_FALSE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_EQ(_table->chunk_count(), 2);
+
+  delete_context->rollback(RollbackReason::User);
+  _maintenance_loop(plugin);
+  EXPECT_TRUE(_table->get_chunk(ChunkID{0})->get_cleanup_commit_id());
+  EXPECT_EQ(_visible_rows()->row_count(), 5u);
+}
+
+}  // namespace opossum
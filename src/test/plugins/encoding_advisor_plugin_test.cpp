@@ -0,0 +1,78 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "lib/utils/plugin_test_utils.hpp"
+
+#include "../../plugins/encoding_advisor_plugin.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/segment_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/plugin_manager.hpp"
+
+namespace opossum {
+
+class EncodingAdvisorPluginTest : public BaseTest {
+ public:
+  void SetUp() override {
+    const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1'000});
+    for (auto row_idx = int32_t{0}; row_idx < 2'000; ++row_idx) {
+      _table->append({row_idx / 100});
+    }
+    _table->last_chunk()->finalize();
+    ChunkEncoder::encode_all_chunks(_table, SegmentEncodingSpec{EncodingType::Unencoded});
+    Hyrise::get().storage_manager.add_table("encoding_advisor_plugin_table", _table);
+  }
+
+  void TearDown() override {
+    Hyrise::reset();
+  }
+
+ protected:
+  static void _advisor_loop(EncodingAdvisorPlugin& plugin) {
+    plugin._advisor_loop();
+  }
+
+  static void _set_memory_budget(EncodingAdvisorPlugin& plugin, const std::string& memory_budget) {
+    plugin._memory_budget_setting->set(memory_budget);
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(EncodingAdvisorPluginTest, LoadUnloadPlugin) {
+  auto& pm = Hyrise::get().plugin_manager;
+  pm.load_plugin(build_dylib_path("libhyriseEncodingAdvisorPlugin"));
+  EXPECT_NO_THROW(Hyrise::get().settings_manager.get_setting("EncodingAdvisorPlugin.MemoryBudget"));
+  pm.unload_plugin("hyriseEncodingAdvisorPlugin");
+}
+
+TEST_F(EncodingAdvisorPluginTest, InvalidMemoryBudget) {
+  auto plugin = EncodingAdvisorPlugin{};
+  EXPECT_THROW(_set_memory_budget(plugin, "a lot"), InvalidInputException);
+  EXPECT_THROW(_set_memory_budget(plugin, "-1"), InvalidInputException);
+  EXPECT_NO_THROW(_set_memory_budget(plugin, ""));
+  EXPECT_NO_THROW(_set_memory_budget(plugin, "1000000"));
+}
+
+TEST_F(EncodingAdvisorPluginTest, ReencodeSegments) {
+  // The first segment is scanned, the second one is not accessed at all. Both are smaller when encoded.
+  const auto scanned_segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  scanned_segment->access_counter[SegmentAccessCounter::AccessType::Sequential] = 1'000'000;
+
+  auto plugin = EncodingAdvisorPlugin{};
+  _advisor_loop(plugin);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto segment = _table->get_chunk(chunk_id)->get_segment(ColumnID{0});
+    EXPECT_NE(get_segment_encoding_spec(segment).encoding_type, EncodingType::Unencoded);
+  }
+
+  // The access counters are carried over to the new segments
+  const auto reencoded_segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  EXPECT_NE(reencoded_segment, scanned_segment);
+  EXPECT_EQ(reencoded_segment->access_counter[SegmentAccessCounter::AccessType::Sequential], 1'000'000u);
+}
+
+}  // namespace opossum